@@ -0,0 +1,173 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "AudioResourceManager.hpp"
+#include "MusicStreamer.hpp"
+
+#include "audio/capybara_song_music.h"
+
+// flappybara-audio-bench [--trials N] [--seconds S] [--stall-ms M]
+//
+// 1. Jump sound latency: time from AudioResourceManager::playAudio() on the game thread until the device callback
+//    first mixes samples of that sound. Covers the command queue, the audio thread tick and the device period.
+// 2. Music underruns: the theme song streamed with different stream buffer sizes, once refilled on the normal audio
+//    thread tick and once with a simulated hitch of --stall-ms every second.
+//
+// Run it on the target cabinet and pick the smallest Config::musicChunkFrames with zero underruns.
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    // Written from the device callback, so only atomics
+    std::atomic<Clock::rep> firstMixedAt = 0;
+
+    void markFirstMix(void *, unsigned int) {
+        Clock::rep expected = 0;
+        firstMixedAt.compare_exchange_strong(expected, Clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+    }
+
+    double percentile(std::vector<double> samples, const double p) {
+        if (samples.empty()) {
+            return 0.0;
+        }
+        std::ranges::sort(samples);
+        const auto index = static_cast<std::size_t>(p * static_cast<double>(samples.size() - 1) + 0.5);
+        return samples[index];
+    }
+
+    double measureOnce(AudioResourceManager &audioManager) {
+        firstMixedAt = 0;
+        const Clock::time_point start = Clock::now();
+        audioManager.playAudio(AudioId::SpringEffect);
+
+        // Give up after a second, a dead device should not hang the report
+        while (firstMixedAt.load(std::memory_order_relaxed) == 0 && Clock::now() - start < std::chrono::seconds(1)) {
+            std::this_thread::yield();
+        }
+
+        const Clock::rep mixed = firstMixedAt.load(std::memory_order_relaxed);
+        if (mixed == 0) {
+            return -1.0;
+        }
+        const Clock::time_point mixedAt{ Clock::duration(mixed) };
+        return std::chrono::duration<double, std::milli>(mixedAt - start).count();
+    }
+
+    struct StreamRun {
+        int chunkFrames;
+        int stallMs;
+        double startLatencyMs;
+        std::uint64_t underruns;
+        std::size_t bufferBytes;
+    };
+
+    StreamRun streamMusic(const int chunkFrames, const int seconds, const int stallMs) {
+        MusicStreamer streamer;
+        StreamRun run{ .chunkFrames = chunkFrames, .stallMs = stallMs, .startLatencyMs = -1.0, .underruns = 0, .bufferBytes = 0 };
+
+        if (!streamer.open(CAPYBARA_SONG_MUSIC_DATA, CAPYBARA_SONG_MUSIC_SIZE, chunkFrames, Config::musicDecodeBuffers)) {
+            return run;
+        }
+        AttachAudioStreamProcessor(streamer.stream(), markFirstMix);
+
+        firstMixedAt = 0;
+        const Clock::time_point start = Clock::now();
+        streamer.play();
+
+        Clock::time_point nextStall = start + std::chrono::seconds(1);
+        while (Clock::now() - start < std::chrono::seconds(seconds)) {
+            streamer.update();
+
+            if (stallMs > 0 && Clock::now() >= nextStall) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(stallMs));
+                nextStall += std::chrono::seconds(1);
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(Config::audioUpdateIntervalMs));
+        }
+
+        if (const Clock::rep mixed = firstMixedAt.load(); mixed != 0) {
+            run.startLatencyMs = std::chrono::duration<double, std::milli>(Clock::time_point{ Clock::duration(mixed) } - start).count();
+        }
+        run.underruns = streamer.underruns();
+        run.bufferBytes = streamer.bufferBytes();
+
+        DetachAudioStreamProcessor(streamer.stream(), markFirstMix);
+        streamer.stop();
+        return run;
+    }
+}
+
+int main(const int argc, char **argv) {
+    int trials = 50;
+    int seconds = 3;
+    int stallMs = 40;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string option = argv[i];
+        if (option == "--trials") {
+            trials = std::stoi(argv[i + 1]);
+        } else if (option == "--seconds") {
+            seconds = std::stoi(argv[i + 1]);
+        } else if (option == "--stall-ms") {
+            stallMs = std::stoi(argv[i + 1]);
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--trials N] [--seconds S] [--stall-ms M]\n";
+            return 2;
+        }
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    AudioResourceManager audioManager;
+    audioManager.attachProcessor(AudioId::SpringEffect, markFirstMix);
+
+    std::vector<double> latencies;
+    int lost = 0;
+    for (int i = 0; i < trials; ++i) {
+        if (const double latency = measureOnce(audioManager); latency >= 0.0) {
+            latencies.push_back(latency);
+        } else {
+            lost++;
+        }
+
+        // Let the voice finish so every trial starts from an idle pool
+        audioManager.stopAudio(AudioId::SpringEffect);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    audioManager.detachProcessor(AudioId::SpringEffect, markFirstMix);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "# FlappyBara audio latency report\n\n";
+    std::cout << "audio thread tick: " << Config::audioUpdateIntervalMs << " ms, voices per sound: " << Config::voicesPerSound << "\n\n";
+
+    std::cout << "## playAudio() to first mixed samples (" << latencies.size() << " trials, " << lost << " never mixed)\n\n";
+    std::cout << "min " << percentile(latencies, 0.0) << " ms | median " << percentile(latencies, 0.5) << " ms | p95 "
+              << percentile(latencies, 0.95) << " ms | max " << percentile(latencies, 1.0) << " ms\n\n";
+
+    std::cout << "## Music stream buffer sizes (" << seconds << " s each)\n\n";
+    if constexpr (CAPYBARA_SONG_MUSIC_SIZE == 0) {
+        std::cout << "Theme song was not cooked, skipped.\n";
+        return 0;
+    } else {
+        std::cout << "| chunk frames | stall | start latency | underruns | decode buffers |\n";
+        std::cout << "|---|---|---|---|---|\n";
+
+        for (const int chunkFrames : { 512, 1024, 2048, 4096, 8192 }) {
+            for (const int stall : { 0, stallMs }) {
+                const StreamRun run = streamMusic(chunkFrames, seconds, stall);
+                std::cout << "| " << run.chunkFrames << " | " << run.stallMs << " ms | " << run.startLatencyMs << " ms | "
+                          << run.underruns << " | " << run.bufferBytes / 1024 << " KiB |\n";
+            }
+        }
+    }
+
+    return 0;
+}
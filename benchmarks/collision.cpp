@@ -0,0 +1,248 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <string>
+
+#include "Collision.hpp"
+#include "Simulation.hpp"
+
+// flappybara-collision-bench [--rects N] [--seeds N]
+//
+// Collision::sweep on --rects random moving and still boxes, checked against the moving box placed at substeps
+// evenly over the step: the sweep must report every overlap a substep finds, no later than that substep, and the box
+// has to overlap the target halfway through every impact it reports. Then --seeds runs of a bird falling (and
+// flapping now and then) through pipes scrolling at up to 100 times the default speed, far enough per step to jump
+// a whole pipe, with every Simulation::step checked the same way against every pair on screen, so no pipe ever
+// passes through the bird. Collision::overlaps with a mask runs on random masks and boxes against a test of every
+// solid cell, and the birds run again with a solid mask through the fine phase. Any difference is reported and fails
+// the run.
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    constexpr float dt = Config::simulationStep;
+    constexpr int substeps = 256;
+
+    double elapsedNs(const Clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+
+    Rectangle at(const Rectangle moving, const Vector2 delta, const float t) {
+        return { moving.x + delta.x * t, moving.y + delta.y * t, moving.width, moving.height };
+    }
+
+    // First substep at which moving overlaps target, if any
+    std::optional<int> bruteSweep(const Rectangle moving, const Vector2 delta, const Rectangle target) {
+        for (int i = 0; i <= substeps; ++i) {
+            if (Collision::overlaps(at(moving, delta, static_cast<float>(i) / substeps), target)) {
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+
+    struct Result {
+        double testNs = 0.0;
+        double bruteNs = 0.0;
+        std::uint64_t hits = 0;
+        std::uint64_t mismatches = 0;
+    };
+
+    Result runSweeps(const std::uint64_t count) {
+        std::mt19937 rng(1);
+        std::uniform_real_distribution<float> position(0.0f, 200.0f);
+        std::uniform_real_distribution<float> size(1.0f, 60.0f);
+        std::uniform_real_distribution<float> motion(-300.0f, 300.0f);
+        std::uniform_int_distribution<int> still(0, 9);
+
+        Result result;
+        for (std::uint64_t i = 0; i < count; ++i) {
+            const Rectangle moving = { position(rng), position(rng), size(rng), size(rng) };
+            const Rectangle target = { position(rng), position(rng), size(rng), size(rng) };
+            // Now and then along one axis only, the sweep handles that axis apart
+            const Vector2 delta = { still(rng) == 0 ? 0.0f : motion(rng), still(rng) == 0 ? 0.0f : motion(rng) };
+
+            Clock::time_point start = Clock::now();
+            const std::optional<Collision::Impact> impact = Collision::sweep(moving, delta, target);
+            result.testNs += elapsedNs(start);
+
+            start = Clock::now();
+            const std::optional<int> first = bruteSweep(moving, delta, target);
+            result.bruteNs += elapsedNs(start);
+
+            bool mismatch = false;
+            if (first) {
+                mismatch |= !impact || impact->time > static_cast<float>(*first) / substeps;
+            }
+            if (impact) {
+                const float middle = (impact->time + std::min(impact->exitTime, 1.0f)) * 0.5f;
+                mismatch |= !Collision::overlaps(at(moving, delta, middle), target);
+            }
+            result.hits += impact.has_value();
+            result.mismatches += mismatch;
+        }
+
+        result.testNs /= static_cast<double>(count);
+        result.bruteNs /= static_cast<double>(count);
+        return result;
+    }
+
+    // Whether rect overlaps any solid cell of mask stretched over where, one cell at a time
+    bool bruteOverlaps(const Collision::Mask &mask, const Rectangle where, const Rectangle rect) {
+        const float cellWidth = where.width / Collision::maskSize;
+        const float cellHeight = where.height / Collision::maskSize;
+        for (int row = 0; row < Collision::maskSize; ++row) {
+            for (int column = 0; column < Collision::maskSize; ++column) {
+                const Rectangle cell = { where.x + column * cellWidth, where.y + row * cellHeight, cellWidth, cellHeight };
+                if ((mask.rows[row] >> column & 1) && Collision::overlaps(cell, rect)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    Result runMasks(const std::uint64_t count) {
+        std::mt19937_64 rng(2);
+        std::uniform_real_distribution<float> position(0.0f, 200.0f);
+        std::uniform_real_distribution<float> size(1.0f, 120.0f);
+        std::uniform_int_distribution<int> sparseness(0, 6);
+
+        Result result;
+        Collision::Mask mask;
+        for (std::uint64_t i = 0; i < count; ++i) {
+            // From solid down to one cell in 64 set, ANDing random words together
+            const int ands = sparseness(rng);
+            for (std::uint64_t &row : mask.rows) {
+                row = ~0ull;
+                for (int a = 0; a < ands; ++a) {
+                    row &= rng();
+                }
+            }
+            const Rectangle where = { position(rng), position(rng), size(rng), size(rng) };
+            const Rectangle rect = { position(rng), position(rng), size(rng), size(rng) };
+
+            Clock::time_point start = Clock::now();
+            const bool hit = Collision::overlaps(mask, where, rect);
+            result.testNs += elapsedNs(start);
+
+            start = Clock::now();
+            const bool bruteHit = bruteOverlaps(mask, where, rect);
+            result.bruteNs += elapsedNs(start);
+
+            result.hits += hit;
+            result.mismatches += hit != bruteHit;
+        }
+
+        result.testNs /= static_cast<double>(count);
+        result.bruteNs /= static_cast<double>(count);
+        return result;
+    }
+
+    struct BirdResult {
+        std::uint64_t steps = 0;
+        std::uint64_t pipeHits = 0;
+        std::uint64_t mismatches = 0;
+    };
+
+    // Whether any substep of the step from before to after overlaps a pair of before, in the pipes' frame
+    bool bruteHitsPipe(const Simulation &before, const Simulation &after) {
+        const float scroll = before.pipeScrollSpeed() * dt;
+        const Rectangle start = { before.playerPosition().x - scroll, before.playerPosition().y, Simulation::playerWidth, Simulation::playerHeight };
+        const Vector2 motion = { scroll, after.playerPosition().y - before.playerPosition().y };
+
+        for (std::size_t i = 0; i < before.pipeCount(); ++i) {
+            const Rectangle top = before.topPipe(i);
+            const Rectangle bottom = before.bottomPipe(i);
+            if (bruteSweep(start, motion, { top.x - scroll, top.y, top.width, top.height })
+                || bruteSweep(start, motion, { bottom.x - scroll, bottom.y, bottom.width, bottom.height })) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    BirdResult runBirds(const std::uint64_t seeds, const Collision::Mask *mask) {
+        BirdResult result;
+        for (std::uint64_t seed = 1; seed <= seeds; ++seed) {
+            std::mt19937 rng(static_cast<std::mt19937::result_type>(seed));
+            std::uniform_real_distribution<float> speed(Simulation::pipeSpeed, Simulation::pipeSpeed * 100.0f);
+            std::uniform_int_distribution<int> flap(0, 39);
+
+            Simulation sim(seed);
+            sim.setPipeSpeed(speed(rng));
+            sim.setPipeSpacing(Simulation::minPipeSpacing);
+            sim.setPipeGap(Simulation::maxPipeGap);
+            sim.setPlayerMask(mask);
+
+            while (!sim.isOver()) {
+                const Simulation before = sim;
+                const std::uint32_t events = sim.step(flap(rng) == 0);
+                result.steps++;
+                result.pipeHits += (events & SimEventHitPipe) != 0;
+
+                // A substep overlap the step didn't report is a pipe passing through the bird. Floor and boundary
+                // deaths end the step before the pipes are looked at.
+                if (!(events & (SimEventHitFloor | SimEventHitBoundary)) && !(events & SimEventHitPipe)) {
+                    result.mismatches += bruteHitsPipe(before, sim);
+                }
+            }
+        }
+        return result;
+    }
+}
+
+int main(const int argc, char **argv) {
+    std::uint64_t rects = 200000;
+    std::uint64_t seeds = 4000;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string option = argv[i];
+        if (option == "--rects") {
+            rects = std::max<std::uint64_t>(1, std::stoull(argv[i + 1]));
+        } else if (option == "--seeds") {
+            seeds = std::max<std::uint64_t>(1, std::stoull(argv[i + 1]));
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--rects N] [--seeds N]\n";
+            return 2;
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "# FlappyBara collision report\n\n";
+
+    const Result sweeps = runSweeps(rects);
+    std::cout << "## Swept AABB over " << rects << " random boxes, ns per test\n\n";
+    std::cout << "| sweep | " << substeps << " substeps | hits | mismatches |\n";
+    std::cout << "|---|---|---|---|\n";
+    std::cout << "| " << sweeps.testNs << " | " << sweeps.bruteNs << " | " << sweeps.hits << " | " << sweeps.mismatches << " |\n\n";
+
+    const Result masks = runMasks(rects);
+    std::cout << "## Mask overlap over " << rects << " random masks and boxes, ns per test\n\n";
+    std::cout << "| one AND per row | every cell | hits | mismatches |\n";
+    std::cout << "|---|---|---|---|\n";
+    std::cout << "| " << masks.testNs << " | " << masks.bruteNs << " | " << masks.hits << " | " << masks.mismatches << " |\n\n";
+
+    // A solid mask collides like the bounding box, so the fine phase must not lose any hit the boxes have either
+    static constexpr Collision::Mask solid = Collision::Mask::solid();
+    std::cout << "## Bird through fast pipes over " << seeds << " seeds\n\n";
+    std::cout << "| player | steps | pipe hits | mismatches |\n";
+    std::cout << "|---|---|---|---|\n";
+
+    std::uint64_t mismatches = sweeps.mismatches + masks.mismatches;
+    for (const Collision::Mask *mask : { static_cast<const Collision::Mask *>(nullptr), &solid }) {
+        const BirdResult birds = runBirds(seeds, mask);
+        mismatches += birds.mismatches;
+        std::cout << "| " << (mask == nullptr ? "bounding box" : "solid mask") << " | " << birds.steps << " | "
+                  << birds.pipeHits << " | " << birds.mismatches << " |\n";
+    }
+
+    std::cout << "\nMismatches: " << mismatches << "\n";
+    return mismatches == 0 ? 0 : 1;
+}
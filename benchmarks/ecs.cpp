@@ -0,0 +1,252 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Ecs.hpp"
+#include "constants.hpp"
+
+// flappybara-ecs-bench [--entities N] [--ticks N]
+//
+// --entities game objects (100k by default) spread over four archetypes are stepped for --ticks fixed steps by
+// three systems, and the same objects as individually allocated classes with a virtual update() in shuffled
+// order, the shape objects had before the component store. Every object must end up at the same position both
+// ways, any difference is reported and fails the run. A second pass measures create/destroy churn.
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    constexpr float dt = Config::simulationStep;
+
+    double elapsedNs(const Clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+
+    struct Position { float x; float y; };
+    struct Velocity { float x; float y; };
+    struct Gravity { float acceleration; };
+    struct Lifetime { float seconds; };
+
+    using World = Ecs::World<Position, Velocity, Gravity, Lifetime>;
+
+    struct FallSystem {
+        using Signature = Ecs::Signature<Velocity, const Gravity>;
+        void operator()(Velocity &velocity, const Gravity &gravity) const { velocity.y += gravity.acceleration * dt; }
+    };
+
+    struct MoveSystem {
+        using Signature = Ecs::Signature<Position, const Velocity>;
+        void operator()(Position &position, const Velocity &velocity) const {
+            position.x += velocity.x * dt;
+            position.y += velocity.y * dt;
+        }
+    };
+
+    struct AgeSystem {
+        using Signature = Ecs::Signature<Lifetime>;
+        void operator()(Lifetime &lifetime) const { lifetime.seconds += dt; }
+    };
+
+    // The same behaviour the old way, one heap object per entity
+    class GameObject {
+    public:
+        virtual ~GameObject() = default;
+        virtual void update() = 0;
+        Position position{};
+    };
+
+    class Static final : public GameObject {
+    public:
+        void update() override {}
+    };
+
+    class Mover : public GameObject {
+    public:
+        Velocity velocity{};
+        void update() override {
+            position.x += velocity.x * dt;
+            position.y += velocity.y * dt;
+        }
+    };
+
+    class Faller final : public Mover {
+    public:
+        Gravity gravity{};
+        void update() override {
+            velocity.y += gravity.acceleration * dt;
+            Mover::update();
+        }
+    };
+
+    class AgingMover final : public Mover {
+    public:
+        Lifetime lifetime{};
+        void update() override {
+            Mover::update();
+            lifetime.seconds += dt;
+        }
+    };
+
+    struct Result {
+        double ecsNs = 0.0;
+        double objectNs = 0.0;
+        double createNs = 0.0;
+        double destroyNs = 0.0;
+        std::size_t archetypes = 0;
+        std::uint64_t mismatches = 0;
+    };
+
+    Result run(const std::size_t count, const std::uint64_t ticks) {
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> coordinate(0.0f, static_cast<float>(Config::WindowWidth));
+        std::uniform_real_distribution<float> speed(-200.0f, 200.0f);
+
+        World world;
+        std::vector<Ecs::Entity> entities;
+        std::vector<std::unique_ptr<GameObject>> objects;
+        entities.reserve(count);
+        objects.reserve(count);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const Position position = { coordinate(rng), coordinate(rng) };
+            const Velocity velocity = { speed(rng), speed(rng) };
+            switch (i % 4) {
+                case 0: {
+                    entities.push_back(world.create(position));
+                    auto object = std::make_unique<Static>();
+                    object->position = position;
+                    objects.push_back(std::move(object));
+                    break;
+                }
+                case 1: {
+                    entities.push_back(world.create(position, velocity));
+                    auto object = std::make_unique<Mover>();
+                    object->position = position;
+                    object->velocity = velocity;
+                    objects.push_back(std::move(object));
+                    break;
+                }
+                case 2: {
+                    entities.push_back(world.create(position, velocity, Gravity{ 400.0f }));
+                    auto object = std::make_unique<Faller>();
+                    object->position = position;
+                    object->velocity = velocity;
+                    object->gravity = { 400.0f };
+                    objects.push_back(std::move(object));
+                    break;
+                }
+                default: {
+                    entities.push_back(world.create(position, velocity, Lifetime{ 0.0f }));
+                    auto object = std::make_unique<AgingMover>();
+                    object->position = position;
+                    object->velocity = velocity;
+                    objects.push_back(std::move(object));
+                    break;
+                }
+            }
+        }
+
+        // Objects allocated over a long session end up visited in no particular memory order
+        std::vector<GameObject *> updateOrder;
+        updateOrder.reserve(count);
+        for (const auto &object : objects) {
+            updateOrder.push_back(object.get());
+        }
+        std::ranges::shuffle(updateOrder, rng);
+
+        Result result;
+        result.archetypes = world.archetypeCount();
+
+        FallSystem fall;
+        MoveSystem move;
+        AgeSystem age;
+        for (std::uint64_t tick = 0; tick < ticks; ++tick) {
+            Clock::time_point start = Clock::now();
+            world.run(fall);
+            world.run(move);
+            world.run(age);
+            result.ecsNs += elapsedNs(start);
+
+            start = Clock::now();
+            for (GameObject *object : updateOrder) {
+                object->update();
+            }
+            result.objectNs += elapsedNs(start);
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const Position &a = world.get<Position>(entities[i]);
+            const Position &b = objects[i]->position;
+            result.mismatches += std::abs(a.x - b.x) > 1e-3f || std::abs(a.y - b.y) > 1e-3f;
+        }
+
+        // Churn: destroy every other entity and create as many again, which reuses the freed handles
+        Clock::time_point start = Clock::now();
+        for (std::size_t i = 0; i < count; i += 2) {
+            world.destroy(entities[i]);
+        }
+        result.destroyNs = elapsedNs(start) / static_cast<double>((count + 1) / 2);
+
+        start = Clock::now();
+        for (std::size_t i = 0; i < count; i += 2) {
+            entities[i] = world.create(Position{ 0.0f, 0.0f }, Velocity{ 1.0f, 1.0f });
+        }
+        result.createNs = elapsedNs(start) / static_cast<double>((count + 1) / 2);
+
+        // Every handle must be live and still find its own components after all the rows moved around
+        result.mismatches += world.size() != count;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (!world.alive(entities[i])) {
+                result.mismatches++;
+            } else if (i % 2 == 1 && std::abs(world.get<Position>(entities[i]).x - objects[i]->position.x) > 1e-3f) {
+                result.mismatches++;
+            }
+        }
+
+        result.ecsNs /= static_cast<double>(ticks * count);
+        result.objectNs /= static_cast<double>(ticks * count);
+        return result;
+    }
+}
+
+int main(const int argc, char **argv) {
+    std::size_t entities = 100000;
+    std::uint64_t ticks = 120;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string option = argv[i];
+        if (option == "--entities") {
+            entities = std::max<std::size_t>(1, std::stoul(argv[i + 1]));
+        } else if (option == "--ticks") {
+            ticks = std::max<std::uint64_t>(1, std::stoull(argv[i + 1]));
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--entities N] [--ticks N]\n";
+            return 2;
+        }
+    }
+
+    const Result result = run(entities, ticks);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "# FlappyBara entity component store report\n\n";
+    std::cout << "## " << entities << " entities in " << result.archetypes << " archetypes, " << ticks << " steps\n\n";
+    std::cout << "| | ns per entity per step |\n";
+    std::cout << "|---|---|\n";
+    std::cout << "| systems over component arrays | " << result.ecsNs << " |\n";
+    std::cout << "| virtual update() per object | " << result.objectNs << " |\n\n";
+    std::cout << "## Churn, ns per entity\n\n";
+    std::cout << "| destroy | create |\n";
+    std::cout << "|---|---|\n";
+    std::cout << "| " << result.destroyNs << " | " << result.createNs << " |\n\n";
+    std::cout << "Mismatches: " << result.mismatches << "\n";
+
+    return result.mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,241 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "JobSystem.hpp"
+#include "Simulation.hpp"
+
+// flappybara-job-bench [--max-threads N] [--jobs N] [--sims N]
+//
+// 1. Spawn overhead: --jobs empty jobs submitted from the main thread, and a binary tree of jobs that spawn their
+//    own children (the work-stealing path), compared against starting one std::jthread per job.
+// 2. Task graph: a layered graph where every task depends on two tasks of the layer before it.
+// 3. Scaling: --sims headless simulations played to the end by a simple bot, spread with parallelFor, for
+//    1, 2, 4, ... up to --max-threads workers (default: the core count, at most 64).
+// 4. Throwing jobs: batches, parallelFor ranges and graph tasks where some throw. Every wait has to return, rethrow
+//    and find all the other jobs run, else the run fails.
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    double elapsedNs(const Clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+
+    double flatSpawn(JobSystem &jobs, const int count) {
+        std::atomic<int> ran = 0;
+        JobCounter counter;
+
+        const Clock::time_point start = Clock::now();
+        for (int i = 0; i < count; ++i) {
+            jobs.submit(counter, [&ran] { ran.fetch_add(1, std::memory_order_relaxed); });
+        }
+        jobs.wait(counter);
+        return elapsedNs(start) / count;
+    }
+
+    void spawnTree(JobSystem &jobs, JobCounter &counter, const int depth) {
+        if (depth == 0) {
+            return;
+        }
+        for (int i = 0; i < 2; ++i) {
+            jobs.submit(counter, [&jobs, &counter, depth] { spawnTree(jobs, counter, depth - 1); });
+        }
+    }
+
+    double treeSpawn(JobSystem &jobs, const int count) {
+        // A full binary tree of depth d holds 2^(d+1) - 2 jobs below the root
+        int depth = 1;
+        while ((2 << depth) - 2 < count) {
+            depth++;
+        }
+
+        JobCounter counter;
+        const Clock::time_point start = Clock::now();
+        spawnTree(jobs, counter, depth);
+        jobs.wait(counter);
+        return elapsedNs(start) / ((2 << depth) - 2);
+    }
+
+    double threadSpawn(const int count) {
+        std::atomic<int> ran = 0;
+        const Clock::time_point start = Clock::now();
+        for (int i = 0; i < count; ++i) {
+            std::jthread([&ran] { ran.fetch_add(1, std::memory_order_relaxed); });
+        }
+        return elapsedNs(start) / count;
+    }
+
+    double graphRun(JobSystem &jobs, const int layers, const int width) {
+        std::atomic<int> ran = 0;
+        TaskGraph graph;
+        for (int layer = 0; layer < layers; ++layer) {
+            for (int i = 0; i < width; ++i) {
+                const TaskGraph::TaskId id = graph.add([&ran] { ran.fetch_add(1, std::memory_order_relaxed); });
+                if (layer > 0) {
+                    const TaskGraph::TaskId above = id - static_cast<TaskGraph::TaskId>(width);
+                    graph.precede(above, id);
+                    graph.precede(above - static_cast<TaskGraph::TaskId>(i) + static_cast<TaskGraph::TaskId>((i + 1) % width), id);
+                }
+            }
+        }
+
+        const Clock::time_point start = Clock::now();
+        graph.run(jobs);
+        return elapsedNs(start) / static_cast<double>(graph.size());
+    }
+
+    // Whether wait() rethrew after running every job of a batch where every 97th job throws, and parallelFor and a
+    // task graph did the same with one range and one task that throw
+    bool survivesThrows(JobSystem &jobs, const int count) {
+        std::atomic<int> ran = 0;
+        bool rethrown = false;
+        JobCounter counter;
+        for (int i = 0; i < count; ++i) {
+            jobs.submit(counter, [&ran, i] {
+                if (i % 97 == 0) {
+                    throw std::runtime_error("job failed");
+                }
+                ran.fetch_add(1, std::memory_order_relaxed);
+            });
+        }
+        try {
+            jobs.wait(counter);
+        } catch (const std::runtime_error &) {
+            rethrown = true;
+        }
+        bool ok = rethrown && ran == count - (count + 96) / 97;
+
+        ran = 0;
+        rethrown = false;
+        try {
+            jobs.parallelFor(static_cast<std::size_t>(count), 16, [&ran](const std::size_t begin, const std::size_t end) {
+                if (begin == 0) {
+                    throw std::runtime_error("range failed");
+                }
+                ran.fetch_add(static_cast<int>(end - begin), std::memory_order_relaxed);
+            });
+        } catch (const std::runtime_error &) {
+            rethrown = true;
+        }
+        ok &= rethrown && ran == count - std::min(count, 16);
+
+        // A chain a -> b with c on its own: b never starts, c still runs
+        ran = 0;
+        rethrown = false;
+        TaskGraph graph;
+        const TaskGraph::TaskId a = graph.add([] { throw std::runtime_error("task failed"); });
+        const TaskGraph::TaskId b = graph.add([&ran] { ran.fetch_add(100, std::memory_order_relaxed); });
+        graph.add([&ran] { ran.fetch_add(1, std::memory_order_relaxed); });
+        graph.precede(a, b);
+        try {
+            graph.run(jobs);
+        } catch (const std::runtime_error &) {
+            rethrown = true;
+        }
+        return ok && rethrown && ran == 1;
+    }
+
+    // Flap whenever the bird sinks below the middle of the next gap
+    std::uint64_t playOut(const std::uint64_t seed) {
+        constexpr std::uint64_t maxTicks = 120ull * 60;
+        Simulation sim(seed);
+        while (!sim.isOver() && sim.ticks() < maxTicks) {
+            const float gapMiddle = (sim.topPipe().height + sim.bottomPipe().y) * 0.5f;
+            sim.step(sim.playerPosition().y + Simulation::playerHeight * 0.5f > gapMiddle && sim.playerSpeed() > 0.0f);
+        }
+        return sim.ticks();
+    }
+
+    double simulate(JobSystem &jobs, const std::size_t sims) {
+        std::vector<std::uint64_t> ticks(sims);
+        const Clock::time_point start = Clock::now();
+        jobs.parallelFor(sims, 8, [&ticks](const std::size_t begin, const std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                ticks[i] = playOut(i + 1);
+            }
+        });
+        return elapsedNs(start) / 1e6;
+    }
+}
+
+int main(const int argc, char **argv) {
+    unsigned int maxThreads = std::clamp(std::thread::hardware_concurrency(), 1u, 64u);
+    int jobCount = 100000;
+    std::size_t sims = 4096;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string option = argv[i];
+        if (option == "--max-threads") {
+            maxThreads = std::clamp(static_cast<unsigned int>(std::stoul(argv[i + 1])), 1u, 64u);
+        } else if (option == "--jobs") {
+            jobCount = std::max(1, std::stoi(argv[i + 1]));
+        } else if (option == "--sims") {
+            sims = std::stoul(argv[i + 1]);
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--max-threads N] [--jobs N] [--sims N]\n";
+            return 2;
+        }
+    }
+
+    std::vector<unsigned int> workerCounts;
+    for (unsigned int workers = 1; workers < maxThreads; workers *= 2) {
+        workerCounts.push_back(workers);
+    }
+    workerCounts.push_back(maxThreads);
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "# FlappyBara job system report\n\n";
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << "\n\n";
+
+    std::cout << "## Spawn overhead (" << jobCount << " empty jobs, ns per job)\n\n";
+    std::cout << "one std::jthread per job: " << threadSpawn(std::min(jobCount, 2000)) << " ns\n\n";
+    std::cout << "| workers | flat submit | nested spawn | task graph |\n";
+    std::cout << "|---|---|---|---|\n";
+    for (const unsigned int workers : workerCounts) {
+        JobSystem jobs(workers);
+        // Warm up, the first run pays for waking every worker and growing the deques
+        flatSpawn(jobs, jobCount);
+
+        std::cout << "| " << workers << " | " << flatSpawn(jobs, jobCount) << " | " << treeSpawn(jobs, jobCount) << " | "
+                  << graphRun(jobs, 64, std::max(2, jobCount / 64)) << " |\n";
+    }
+
+    std::cout << "\n## Throwing jobs\n\n";
+    std::cout << "| workers | rethrown, nothing lost |\n";
+    std::cout << "|---|---|\n";
+    bool failed = false;
+    for (const unsigned int workers : workerCounts) {
+        JobSystem jobs(workers);
+        const bool ok = survivesThrows(jobs, std::min(jobCount, 10000));
+        failed |= !ok;
+        std::cout << "| " << workers << " | " << (ok ? "yes" : "NO") << " |\n";
+    }
+
+    std::cout << "\n## Scaling (" << sims << " simulations played out)\n\n";
+    std::cout << "| workers | time | speedup | efficiency |\n";
+    std::cout << "|---|---|---|---|\n";
+    double baseline = 0.0;
+    for (const unsigned int workers : workerCounts) {
+        JobSystem jobs(workers);
+        simulate(jobs, std::min<std::size_t>(sims, 256));
+
+        const double ms = simulate(jobs, sims);
+        if (workers == 1) {
+            baseline = ms;
+        }
+        const double speedup = baseline / ms;
+        std::cout << "| " << workers << " | " << ms << " ms | " << std::setprecision(2) << speedup << "x | "
+                  << std::setprecision(0) << 100.0 * speedup / workers << "% |\n" << std::setprecision(1);
+    }
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,185 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <numbers>
+#include <random>
+#include <string>
+#include <vector>
+#include <raylib.h>
+
+#include "MusicStreamer.hpp"
+
+// flappybara-music-bench [--loops N]
+//
+// MusicStreamer's QOA decoding against raylib's. A short mono and a short stereo track, neither a whole number of
+// QOA frames or slices long, are encoded with ExportWave(), decoded whole by LoadWaveFromMemory() and streamed through
+// MusicStreamer::nextChunk() at chunk sizes that straddle frame boundaries for --loops passes over the track. Every
+// streamed sample has to equal raylib's sample at that point of the looping track, and after stop() the stream has to
+// start over from the first sample. Any difference is reported and fails the run.
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    constexpr unsigned int sampleRate = 44100;
+
+    // Three whole QOA frames of 5120 and a partial one, the last slice partial too
+    constexpr unsigned int trackFrames = 3 * 5120 + 777;
+
+    double elapsedNs(const Clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+
+    struct Track {
+        std::vector<unsigned char> qoa;
+        std::vector<short> samples;  // raylib's decode of qoa, interleaved
+    };
+
+    // A chord with a little noise and a click, enough for the encoder to use every scalefactor
+    std::vector<short> synthesize(const unsigned int channels) {
+        std::mt19937 rng(channels);
+        std::uniform_int_distribution<int> noise(-600, 600);
+
+        std::vector<short> samples(static_cast<std::size_t>(trackFrames) * channels);
+        for (unsigned int i = 0; i < trackFrames; ++i) {
+            const double t = static_cast<double>(i) / sampleRate;
+            for (unsigned int c = 0; c < channels; ++c) {
+                const double tone = std::sin(t * 2.0 * std::numbers::pi * (220.0 + 110.0 * c)) * 9000.0 +
+                    std::sin(t * 2.0 * std::numbers::pi * 1318.5) * 4000.0;
+                const double click = i % 4000 < 8 ? 20000.0 : 0.0;
+                samples[static_cast<std::size_t>(i) * channels + c] = static_cast<short>(std::clamp(tone + click + noise(rng), -32768.0, 32767.0));
+            }
+        }
+        return samples;
+    }
+
+    // Encoded by raylib through a temporary file, the only way it exports QOA
+    bool encode(const unsigned int channels, Track &track) {
+        std::vector<short> samples = synthesize(channels);
+        const Wave wave = { trackFrames, sampleRate, 16, channels, samples.data() };
+        const std::string path = (std::filesystem::temp_directory_path() / "flappybara-music-bench.qoa").string();
+        if (!ExportWave(wave, path.c_str())) {
+            return false;
+        }
+
+        int size = 0;
+        unsigned char *data = LoadFileData(path.c_str(), &size);
+        std::filesystem::remove(path);
+        if (data == nullptr) {
+            return false;
+        }
+        track.qoa.assign(data, data + size);
+        UnloadFileData(data);
+
+        const Wave decoded = LoadWaveFromMemory(".qoa", track.qoa.data(), static_cast<int>(track.qoa.size()));
+        if (decoded.data == nullptr || decoded.sampleSize != 16 || decoded.channels != channels || decoded.frameCount != trackFrames) {
+            UnloadWave(decoded);
+            return false;
+        }
+        const auto *decodedSamples = static_cast<const short *>(decoded.data);
+        track.samples.assign(decodedSamples, decodedSamples + static_cast<std::size_t>(trackFrames) * channels);
+        UnloadWave(decoded);
+        return true;
+    }
+
+    struct Result {
+        double chunkNs = 0.0;
+        std::uint64_t chunks = 0;
+        std::uint64_t mismatches = 0;
+    };
+
+    // Stream frames of the track from the current position and count every sample that differs from the reference
+    void streamFrames(MusicStreamer &streamer, const Track &track, const unsigned int channels, const int chunkFrames,
+                      const std::uint64_t frames, Result &result) {
+        for (std::uint64_t frame = 0; frame < frames; frame += static_cast<std::uint64_t>(chunkFrames)) {
+            const Clock::time_point start = Clock::now();
+            const short *chunk = streamer.nextChunk();
+            result.chunkNs += elapsedNs(start);
+            result.chunks++;
+
+            if (chunk == nullptr) {
+                result.mismatches += static_cast<std::uint64_t>(chunkFrames) * channels;
+                return;
+            }
+            for (std::size_t i = 0; i < static_cast<std::size_t>(chunkFrames) * channels; ++i) {
+                const std::size_t position = static_cast<std::size_t>((frame + i / channels) % trackFrames) * channels + i % channels;
+                result.mismatches += chunk[i] != track.samples[position];
+            }
+        }
+    }
+
+    Result run(const Track &track, const unsigned int channels, const int chunkFrames, const std::uint64_t loops) {
+        Result result;
+        MusicStreamer streamer;
+        if (!streamer.open(track.qoa.data(), track.qoa.size(), chunkFrames, 3)) {
+            result.mismatches = 1;
+            return result;
+        }
+
+        streamFrames(streamer, track, channels, chunkFrames, loops * trackFrames, result);
+
+        // Whatever was decoded ahead is dropped, the next chunk is the top of the track again
+        streamer.stop();
+        streamFrames(streamer, track, channels, chunkFrames, trackFrames, result);
+
+        result.chunkNs /= static_cast<double>(std::max<std::uint64_t>(result.chunks, 1));
+        return result;
+    }
+}
+
+int main(const int argc, char **argv) {
+    std::uint64_t loops = 3;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string option = argv[i];
+        if (option == "--loops") {
+            loops = std::max<std::uint64_t>(1, std::stoull(argv[i + 1]));
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--loops N]\n";
+            return 2;
+        }
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    // The streamer creates its audio stream on open(), that needs a device even though nothing is played
+    InitAudioDevice();
+    if (!IsAudioDeviceReady()) {
+        std::cerr << "No audio device, MusicStreamer can't be opened\n";
+        return 1;
+    }
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "# FlappyBara music stream report\n\n";
+    std::cout << "## " << trackFrames << " frame track streamed " << loops << " times and again after stop(), ns per chunk\n\n";
+    std::cout << "| channels | compressed bytes | chunk frames | chunks | decode | mismatches |\n";
+    std::cout << "|---|---|---|---|---|---|\n";
+
+    std::uint64_t mismatches = 0;
+    for (const unsigned int channels : { 1u, 2u }) {
+        Track track;
+        if (!encode(channels, track)) {
+            std::cerr << "raylib failed to encode or decode a " << channels << " channel QOA track\n";
+            mismatches++;
+            continue;
+        }
+
+        // Smaller than a slice, unaligned, exactly a QOA frame and larger than one
+        for (const int chunkFrames : { 13, 1000, 5120, 7001 }) {
+            const Result result = run(track, channels, chunkFrames, loops);
+            mismatches += result.mismatches;
+            std::cout << "| " << channels << " | " << track.qoa.size() << " | " << chunkFrames << " | " << result.chunks
+                      << " | " << result.chunkNs << " | " << result.mismatches << " |\n";
+        }
+    }
+
+    CloseAudioDevice();
+
+    std::cout << "\nMismatches: " << mismatches << "\n";
+    return mismatches == 0 ? 0 : 1;
+}
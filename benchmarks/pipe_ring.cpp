@@ -0,0 +1,194 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Collision.hpp"
+#include "Simulation.hpp"
+
+// flappybara-pipe-bench [--ticks N]
+//
+// Drives the real Simulation::step() over pipe streams from the default spacing down to Simulation::minPipeSpacing
+// and at speeds up to six times the default, restarting every run that ends. Every step is checked against a brute
+// force pass over every pair that was on screen before it: the score has to go up by the number of pairs that
+// crossed behind the player and the step has to end on a pipe exactly when the swept player hits any of them, so
+// the window of pairs step() looks at never misses one. A WideSimulation (1024 pair ring) is stepped in lockstep
+// with the same inputs and has to play the identical run. Any difference is reported and fails the run.
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    constexpr float dt = Config::simulationStep;
+
+    // Wide enough for a flap, at the default gap the bot below crashes into the first pair every time
+    constexpr float gap = 220.0f;
+
+    double elapsedNs(const Clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+
+    struct Stream {
+        float spacing;
+        float speed;
+    };
+
+    struct Result {
+        double stepNs = 0.0;
+        double wideStepNs = 0.0;
+        double bruteNs = 0.0;
+        std::size_t peakPairs = 0;
+        std::uint64_t pairsPassed = 0;
+        std::uint64_t pipeHits = 0;
+        std::uint64_t mismatches = 0;
+    };
+
+    template <typename Sim>
+    void configure(Sim &sim, const Stream &stream) {
+        sim.setPipeSpacing(stream.spacing);
+        sim.setPipeSpeed(stream.speed);
+        sim.setPipeGap(gap);
+    }
+
+    // Flap once the bird sinks towards the bottom of the gap it is heading for
+    bool wantsJump(const Simulation &sim) {
+        const float gapBottom = sim.bottomPipe().y - 30.0f;
+        return sim.playerSpeed() > 0.0f && sim.playerPosition().y + Simulation::playerHeight > gapBottom;
+    }
+
+    // What step() should have done, from every pair of the state before it
+    struct Expected {
+        int scored = 0;
+        bool hitPipe = false;
+    };
+
+    Expected bruteForce(const Simulation &before, const Simulation &after) {
+        Expected expected;
+        const float scroll = before.pipeScrollSpeed() * dt;
+        const float playerX = before.playerPosition().x;
+        const Rectangle start = { playerX - scroll, before.playerPosition().y, Simulation::playerWidth, Simulation::playerHeight };
+        const Vector2 motion = { scroll, after.playerPosition().y - before.playerPosition().y };
+
+        for (std::size_t i = 0; i < before.pipeCount(); ++i) {
+            const Rectangle top = before.topPipe(i);
+            const bool wasBehind = top.x + Simulation::pipeWidth < playerX;
+            if (!wasBehind && top.x - scroll + Simulation::pipeWidth < playerX) {
+                expected.scored++;
+            }
+
+            // A pair that ends the step just touching the player hasn't reached it, the sweep may round that into a hit
+            if (top.x - scroll >= playerX + Simulation::playerWidth) {
+                continue;
+            }
+            const Rectangle bottom = before.bottomPipe(i);
+            if (Collision::sweep(start, motion, { top.x - scroll, top.y, top.width, top.height })
+                || Collision::sweep(start, motion, { bottom.x - scroll, bottom.y, bottom.width, bottom.height })) {
+                expected.hitPipe = true;
+            }
+        }
+        return expected;
+    }
+
+    Result run(const Stream &stream, const std::uint64_t ticks) {
+        Simulation sim(1);
+        WideSimulation wide(1);
+        configure(sim, stream);
+        configure(wide, stream);
+
+        Result result;
+        std::uint64_t runs = 0;
+        for (std::uint64_t tick = 0; tick < ticks; ++tick) {
+            if (sim.isOver()) {
+                runs++;
+                sim.reset(runs + 1);
+                wide.reset(runs + 1);
+                configure(sim, stream);
+                configure(wide, stream);
+            }
+
+            const bool jump = wantsJump(sim);
+            const Simulation before = sim;
+
+            Clock::time_point start = Clock::now();
+            const std::uint32_t events = sim.step(jump);
+            result.stepNs += elapsedNs(start);
+
+            start = Clock::now();
+            const std::uint32_t wideEvents = wide.step(jump);
+            result.wideStepNs += elapsedNs(start);
+
+            start = Clock::now();
+            const Expected expected = bruteForce(before, sim);
+            result.bruteNs += elapsedNs(start);
+
+            result.peakPairs = std::max(result.peakPairs, before.pipeCount());
+            result.pairsPassed += static_cast<std::uint64_t>(sim.score() - before.score());
+            result.pipeHits += (events & SimEventHitPipe) != 0;
+
+            // Floor and boundary deaths end the step before the pipes are looked at
+            bool mismatch = false;
+            if (!(events & (SimEventHitFloor | SimEventHitBoundary))) {
+                const bool hitPipe = (events & SimEventHitPipe) != 0;
+                mismatch |= hitPipe != expected.hitPipe;
+                if (!hitPipe) {
+                    mismatch |= sim.score() - before.score() != expected.scored;
+                }
+            }
+
+            const Vector2 a = sim.playerPosition();
+            const Vector2 b = wide.playerPosition();
+            mismatch |= events != wideEvents || sim.score() != wide.score() || a.x != b.x || a.y != b.y ||
+                sim.pipeCount() != wide.pipeCount();
+
+            result.mismatches += mismatch;
+        }
+
+        result.stepNs /= static_cast<double>(ticks);
+        result.wideStepNs /= static_cast<double>(ticks);
+        result.bruteNs /= static_cast<double>(ticks);
+        return result;
+    }
+}
+
+int main(const int argc, char **argv) {
+    std::uint64_t ticks = 120ull * 60 * 5;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string option = argv[i];
+        if (option == "--ticks") {
+            ticks = std::max<std::uint64_t>(1, std::stoull(argv[i + 1]));
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--ticks N]\n";
+            return 2;
+        }
+    }
+
+    std::vector<Stream> streams;
+    for (const float spacing : { Simulation::pipeSpacing, 440.0f, Simulation::minPipeSpacing }) {
+        for (const float speed : { Simulation::pipeSpeed, Simulation::pipeSpeed * 3.0f, Simulation::pipeSpeed * 6.0f }) {
+            streams.push_back({ spacing, speed });
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "# FlappyBara pipe ring report\n\n";
+    std::cout << "## Simulation::step over " << ticks << " ticks per stream, ns per step\n\n";
+    std::cout << "| spacing | speed | peak live pairs | pairs passed | pipe hits | step | wide ring step | brute force | mismatches |\n";
+    std::cout << "|---|---|---|---|---|---|---|---|---|\n";
+
+    std::uint64_t mismatches = 0;
+    for (const Stream &stream : streams) {
+        const Result result = run(stream, ticks);
+        mismatches += result.mismatches;
+        std::cout << "| " << stream.spacing << " | " << stream.speed << " | " << result.peakPairs << " | " << result.pairsPassed
+                  << " | " << result.pipeHits << " | " << result.stepNs << " | " << result.wideStepNs << " | "
+                  << result.bruteNs << " | " << result.mismatches << " |\n";
+    }
+
+    std::cout << "\nMismatches: " << mismatches << "\n";
+    return mismatches == 0 ? 0 : 1;
+}
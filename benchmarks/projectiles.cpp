@@ -0,0 +1,138 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "ProjectilePool.hpp"
+#include "Simulation.hpp"
+
+// flappybara-projectile-bench [--max-projectiles N] [--ticks N]
+//
+// A pool kept at 64, 256, 1024, ... live projectiles (respawning whatever leaves the screen) is stepped for --ticks
+// fixed steps. Per step it reports the SIMD update plus grid rebuild, the player query through the grid and the
+// same query as a brute force scan over every projectile. Both queries must agree on every step, any mismatch
+// is reported and fails the run.
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    constexpr float dt = Config::simulationStep;
+    constexpr float margin = Config::projectileCellSize;
+
+    double elapsedNs(const Clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+
+    struct Result {
+        double updateNs = 0.0;
+        double gridNs = 0.0;
+        double bruteNs = 0.0;
+        std::uint64_t hits = 0;
+        std::uint64_t mismatches = 0;
+    };
+
+    bool bruteOverlaps(const ProjectilePool &pool, const Rectangle rect) {
+        const float radiusSquared = pool.radius() * pool.radius();
+        bool hit = false;
+        for (std::size_t slot = 0; slot < pool.slotCount(); ++slot) {
+            if (!pool.active(slot)) {
+                continue;
+            }
+            const Vector2 p = pool.position(slot);
+            const float dx = p.x - std::clamp(p.x, rect.x, rect.x + rect.width);
+            const float dy = p.y - std::clamp(p.y, rect.y, rect.y + rect.height);
+            hit |= dx * dx + dy * dy <= radiusSquared;
+        }
+        return hit;
+    }
+
+    Result run(const std::size_t live, const std::uint64_t ticks) {
+        const Rectangle bounds = { -margin, -margin, Config::WindowWidth + 2.0f * margin, Config::WindowHeight + 2.0f * margin };
+        ProjectilePool pool(live, Config::projectileRadius, bounds, Config::projectileCellSize);
+
+        std::mt19937 rng(static_cast<std::mt19937::result_type>(live));
+        std::uniform_real_distribution<float> x(0.0f, static_cast<float>(Config::WindowWidth));
+        std::uniform_real_distribution<float> y(0.0f, static_cast<float>(Config::WindowHeight));
+        std::uniform_real_distribution<float> velocity(-300.0f, 300.0f);
+
+        Result result;
+        for (std::uint64_t tick = 0; tick < ticks; ++tick) {
+            // Top the pool back up, spawn() must never fail below capacity
+            while (pool.activeCount() < live) {
+                if (pool.spawn({ x(rng), y(rng) }, { velocity(rng), velocity(rng) }) == ProjectilePool::invalidHandle) {
+                    result.mismatches++;
+                    break;
+                }
+            }
+
+            Clock::time_point start = Clock::now();
+            pool.update(dt);
+            result.updateNs += elapsedNs(start);
+
+            // The player sweeps up and down the screen at its usual x
+            const float top = static_cast<float>(tick % 480) / 480.0f * (Config::WindowHeight - Simulation::playerHeight);
+            const Rectangle player = { GlobalVariables::defaultPosition.x, top, Simulation::playerWidth, Simulation::playerHeight };
+
+            start = Clock::now();
+            const bool gridHit = pool.overlaps(player);
+            result.gridNs += elapsedNs(start);
+
+            start = Clock::now();
+            const bool bruteHit = bruteOverlaps(pool, player);
+            result.bruteNs += elapsedNs(start);
+
+            result.hits += gridHit;
+            result.mismatches += gridHit != bruteHit;
+        }
+
+        result.updateNs /= static_cast<double>(ticks);
+        result.gridNs /= static_cast<double>(ticks);
+        result.bruteNs /= static_cast<double>(ticks);
+        return result;
+    }
+}
+
+int main(const int argc, char **argv) {
+    std::size_t maxProjectiles = 65536;
+    std::uint64_t ticks = 120ull * 10;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string option = argv[i];
+        if (option == "--max-projectiles") {
+            maxProjectiles = std::max<std::size_t>(1, std::stoul(argv[i + 1]));
+        } else if (option == "--ticks") {
+            ticks = std::max<std::uint64_t>(1, std::stoull(argv[i + 1]));
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--max-projectiles N] [--ticks N]\n";
+            return 2;
+        }
+    }
+
+    std::vector<std::size_t> counts;
+    for (std::size_t count = 64; count < maxProjectiles; count *= 4) {
+        counts.push_back(count);
+    }
+    counts.push_back(maxProjectiles);
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "# FlappyBara projectile report\n\n";
+    std::cout << "## " << ticks << " steps, ns per step\n\n";
+    std::cout << "| live projectiles | update + grid | grid query | brute force query | steps with a hit | mismatches |\n";
+    std::cout << "|---|---|---|---|---|---|\n";
+
+    std::uint64_t mismatches = 0;
+    for (const std::size_t count : counts) {
+        const Result result = run(count, ticks);
+        mismatches += result.mismatches;
+        std::cout << "| " << count << " | " << result.updateNs << " | " << result.gridNs << " | " << result.bruteNs
+                  << " | " << result.hits << " | " << result.mismatches << " |\n";
+    }
+
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,78 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <raylib.h>
+
+// Builds the embedded asset headers from the source PNG/WAV files in the resources directory. They are written to
+// <output dir>/textures and <output dir>/audio in the build tree, the source tree is never touched.
+// The theme song is transcoded to QOA so the game can stream it in small chunks, sprites listed in
+// Assets::collisionMasks also get a 1-bit collision mask header and the parallax textures are packed into one atlas.
+// This runs as the flappybara-cook build step so the game itself never converts assets at runtime.
+//
+// Every input is hashed and compared against the manifest of the previous cook, unchanged assets are skipped
+// as long as their header still exists. Stale assets are cooked in parallel.
+class AssetCooker {
+public:
+    AssetCooker(std::filesystem::path resourcesDir, std::filesystem::path outputDir, std::filesystem::path manifestPath);
+
+    // Cook every stale asset using up to threadCount threads. Returns the number of assets that failed.
+    int cook(unsigned int threadCount);
+
+private:
+    enum class AssetKind {
+        Texture,
+        Sound,
+        Music,      // QOA compressed and streamed at runtime instead of decoded up front
+        CollisionMask,
+        Atlas       // Several textures stacked into one, cooked like a texture
+    };
+
+    enum class CookResult {
+        Cooked,
+        UpToDate,
+        Failed
+    };
+
+    struct CookJob {
+        AssetKind kind;
+        std::string name;                 // Source path relative to the resources directory, the manifest key
+        std::filesystem::path source;
+        std::filesystem::path output;
+        std::string symbol;               // Macro prefix in the generated header, e.g. BASE_TEXTURE
+        std::vector<std::filesystem::path> parts;   // Atlas sources top to bottom, source itself doesn't exist
+        std::uint64_t inputHash = 0;
+    };
+
+    std::vector<CookJob> collectJobs() const;
+    CookResult cookJob(CookJob &job);
+    bool cookTexture(const CookJob &job);
+    bool cookSound(const CookJob &job);
+    bool cookMusic(const CookJob &job);
+    bool cookCollisionMask(const CookJob &job);
+    bool cookAtlas(const CookJob &job);
+
+    void loadManifest();
+    void saveManifest() const;
+
+    static std::uint64_t hashFile(const std::filesystem::path &path, bool &ok);
+    // hashFile() for every source of the job, ok only when all of them could be read
+    static std::uint64_t hashSources(const CookJob &job, bool &ok);
+    static bool writeFileAtomically(const std::filesystem::path &path, const std::string &contents);
+
+    std::filesystem::path resourcesDir;
+    std::filesystem::path outputDir;
+    std::filesystem::path manifestPath;
+
+    // Input hashes from the previous cook, keyed by CookJob::name
+    std::unordered_map<std::string, std::uint64_t> manifest;
+    std::mutex manifestMutex;
+};
@@ -0,0 +1,127 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+// Compile-time handles for the assets the game ships with.
+// Each id is an index into the resource managers' flat slot arrays, so hot-path lookups never build or hash a string.
+// The order of the enums must match the tables below.
+
+enum class TextureId : std::uint8_t {
+    BackgroundDay,
+    BackgroundNight,
+    Floor,
+    PipeGreen,
+    PipeRed,
+    Player,
+    ParallaxAtlas,
+    Count
+};
+
+enum class AudioId : std::uint8_t {
+    SpringEffect,
+    GameOver,
+    LevelComplete,
+    Score,
+    Count
+};
+
+struct AssetInfo {
+    std::string_view key;    // The string key used by the slow lookup path and in logs
+    std::string_view path;   // The source file the embedded header is cooked from, relative to resources/
+};
+
+struct AtlasPart {
+    TextureId id;
+    int height;              // Rows the texture takes up in the atlas once resized to the atlas width
+};
+
+namespace Assets {
+    inline constexpr std::array<AssetInfo, static_cast<std::size_t>(TextureId::Count)> textures = {{
+        {"background-day", "textures/background_day.png"},
+        {"background-night", "textures/background_night.png"},
+        {"floor", "textures/base.png"},
+        {"pipe-green", "textures/pipe_green.png"},
+        {"pipe-red", "textures/pipe_red.png"},
+        {"player", "textures/player.png"},
+        {"parallax-atlas", "textures/parallax_atlas.png"},   // Built from parallaxAtlasParts, there is no such file
+    }};
+
+    inline constexpr std::array<AssetInfo, static_cast<std::size_t>(AudioId::Count)> sounds = {{
+        {"spring-effect", "audio/spring.wav"},
+        {"game-over", "audio/game_over.wav"},
+        {"level-complete", "audio/level_complete.wav"},
+        {"score", "audio/score.wav"},
+    }};
+
+    // Sprites collided pixel-accurately, flappybara-cook writes a Collision::Mask header next to their texture header
+    inline constexpr std::array collisionMasks = { TextureId::Player };
+
+    // flappybara-cook stacks these top to bottom into TextureId::ParallaxAtlas, each resized to parallaxAtlasWidth,
+    // so every parallax layer is drawn from the one texture (see Background)
+    inline constexpr int parallaxAtlasWidth = 288;
+    inline constexpr std::array<AtlasPart, 3> parallaxAtlasParts = {{
+        {TextureId::BackgroundDay, 512},
+        {TextureId::BackgroundNight, 512},
+        {TextureId::Floor, 96},
+    }};
+
+    // First atlas row of id's part, or the height of the whole atlas for a texture that isn't in it
+    constexpr int parallaxAtlasRow(const TextureId id) {
+        int row = 0;
+        for (const AtlasPart &part : parallaxAtlasParts) {
+            if (part.id == id) {
+                return row;
+            }
+            row += part.height;
+        }
+        return row;
+    }
+
+    inline constexpr AssetInfo themeSong = {"theme-song", "audio/capybara_song.wav"};
+
+    constexpr std::size_t index(const TextureId id) {
+        return static_cast<std::size_t>(id);
+    }
+
+    constexpr std::size_t index(const AudioId id) {
+        return static_cast<std::size_t>(id);
+    }
+
+    constexpr std::string_view key(const TextureId id) {
+        return textures[index(id)].key;
+    }
+
+    constexpr std::string_view key(const AudioId id) {
+        return sounds[index(id)].key;
+    }
+
+    // Slow path for tools and string based callers, a linear scan over a handful of entries
+    constexpr std::optional<TextureId> textureIdFromKey(const std::string_view key) {
+        for (std::size_t i = 0; i < textures.size(); ++i) {
+            if (textures[i].key == key) {
+                return static_cast<TextureId>(i);
+            }
+        }
+        return std::nullopt;
+    }
+
+    constexpr std::optional<AudioId> audioIdFromKey(const std::string_view key) {
+        for (std::size_t i = 0; i < sounds.size(); ++i) {
+            if (sounds[i].key == key) {
+                return static_cast<AudioId>(i);
+            }
+        }
+        return std::nullopt;
+    }
+
+    static_assert(textureIdFromKey("parallax-atlas") == TextureId::ParallaxAtlas, "Texture table is out of order with TextureId");
+    static_assert(audioIdFromKey("score") == AudioId::Score, "Audio table is out of order with AudioId");
+}
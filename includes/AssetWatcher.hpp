@@ -0,0 +1,58 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <raylib.h>
+
+#include "AssetIds.hpp"
+#include "AudioResourceManager.hpp"
+#include "TextureResourceManager.hpp"
+
+// Hot reloading is a development feature, it is compiled out of release builds and only implemented with inotify.
+#if !defined(NDEBUG) && defined(__linux__)
+    #define FLAPPYBARA_HOT_RELOAD 1
+#else
+    #define FLAPPYBARA_HOT_RELOAD 0
+#endif
+
+// Watches resources/textures and resources/audio for saved PNG/WAV files.
+// Changed files are decoded on a background thread and handed to the resource managers
+// by applyPendingReloads(), which the game loop calls once per frame before drawing.
+// A change to a part of the parallax atlas rebuilds the whole atlas, that is the texture the game draws them from.
+class AssetWatcher {
+public:
+    AssetWatcher();
+    ~AssetWatcher();
+
+    AssetWatcher(const AssetWatcher&) = delete;
+    AssetWatcher& operator=(const AssetWatcher&) = delete;
+
+    // Swap every decoded asset into the managers. Only the GPU upload / sound creation happens here.
+    void applyPendingReloads(TextureResourceManager &textureManager, AudioResourceManager &audioManager);
+
+private:
+    struct PendingReload {
+        bool isTexture = false;
+        TextureId textureId = TextureId::Count;
+        AudioId audioId = AudioId::Count;
+        Image image{};
+        Wave wave{};
+    };
+
+    void watchLoop();
+    void decodeFile(const std::string &directory, const std::string &filename);
+    void discardPending();
+
+    int inotifyFd = -1;
+    std::atomic<bool> running = false;
+    std::thread worker;
+
+    std::mutex pendingMutex;
+    std::vector<PendingReload> pending;
+};
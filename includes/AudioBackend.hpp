@@ -0,0 +1,63 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <raylib.h>
+
+// One playable voice owned by a backend, 0 is never a valid voice
+using VoiceHandle = std::uint32_t;
+inline constexpr VoiceHandle invalidVoice = 0;
+
+enum class AudioBackendKind {
+    Raylib,     // Real output through raylib's audio device
+    Null        // No device, see NullAudioBackend
+};
+
+// Everything AudioResourceManager needs from an audio device.
+// Calls are serialized by AudioResourceManager (its slot mutex or the audio thread), so backends don't need to lock.
+// NullAudioBackend still does, only so tests can query it from their own thread.
+class AudioBackend {
+public:
+    virtual ~AudioBackend() = default;
+
+    // Create voices.size() voices sharing the samples of wave. voices[0] owns the samples and must be destroyed last.
+    // Returns false and leaves voices untouched when the samples could not be loaded.
+    virtual bool createVoices(std::string_view key, const Wave &wave, std::span<VoiceHandle> voices) = 0;
+    virtual void destroyVoices(std::span<const VoiceHandle> voices) = 0;
+
+    virtual void play(VoiceHandle voice) = 0;
+    virtual void stop(VoiceHandle voice) = 0;
+    // A paused voice doesn't count as playing, resume() carries on from where it was paused
+    virtual void pause(VoiceHandle voice) = 0;
+    virtual void resume(VoiceHandle voice) = 0;
+    virtual bool isPlaying(VoiceHandle voice) const = 0;
+    virtual void setVolume(VoiceHandle voice, float volume) = 0;
+
+    // Length of the voice's samples in seconds
+    virtual float duration(VoiceHandle voice) const = 0;
+
+    // Background music from an embedded QOA file, see MusicStreamer
+    virtual bool openMusic(const unsigned char *data, std::size_t size) = 0;
+    virtual void closeMusic() = 0;
+    virtual void playMusic() = 0;
+    virtual void stopMusic() = 0;
+    virtual void pauseMusic() = 0;
+    virtual void resumeMusic() = 0;
+    virtual void setMusicVolume(float volume) = 0;
+    virtual void setMusicPitch(float pitch) = 0;
+    virtual void updateMusic() = 0;
+    virtual std::uint64_t musicUnderruns() const = 0;
+
+    // Diagnostics hook into the device callback, backends without a device ignore it
+    virtual void attachProcessor(VoiceHandle, AudioCallback) {}
+    virtual void detachProcessor(VoiceHandle, AudioCallback) {}
+};
+
+std::unique_ptr<AudioBackend> createAudioBackend(AudioBackendKind kind);
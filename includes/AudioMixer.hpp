@@ -0,0 +1,47 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Every sound plays through exactly one bus, the bus gain scales all of its voices
+enum class AudioBus : std::uint8_t {
+    Sfx,
+    Music,
+    Ui,
+    Count
+};
+
+// Per-bus gain stage in front of raylib's mixer. Gains never jump, they glide towards their targets
+// in update() so volume changes and ducking don't click. Owned and driven by the audio thread.
+class AudioMixer {
+public:
+    AudioMixer();
+
+    void setMasterVolume(float volume);
+    void setBusVolume(AudioBus bus, float volume);
+
+    // Pull the music bus down to Config::musicDuckGain for holdSeconds, then let it recover
+    void duckMusic(float holdSeconds);
+
+    // Advance the gains by deltaSeconds. Returns a bit per bus whose gain moved.
+    std::uint32_t update(float deltaSeconds);
+
+    // Effective gain of a bus: master * bus volume * ducking
+    float gain(AudioBus bus) const;
+
+private:
+    static constexpr std::size_t busCount = static_cast<std::size_t>(AudioBus::Count);
+
+    float targetFor(std::size_t bus) const;
+
+    float masterVolume = 1.0f;
+    std::array<float, busCount> busVolumes{};
+    std::array<float, busCount> gains{};
+
+    float duckHoldSeconds = 0.0f;
+};
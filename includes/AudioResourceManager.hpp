@@ -4,29 +4,62 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 #include <raylib.h>
+#include "AssetIds.hpp"
+#include "AudioBackend.hpp"
+#include "AudioMixer.hpp"
 #include "Logger.hpp"
+#include "Settings.hpp"
+#include "SpscQueue.hpp"
+#include "constants.hpp"
 
+// What happens when a sound is triggered while all of its voices are busy
+enum class VoiceStealPolicy {
+    RoundRobin,     // Always restart the next voice in turn, even if an idle one exists
+    StealOldest     // Prefer an idle voice, otherwise restart the voice that started longest ago
+};
+
+// Sounds are played and the music stream is refilled on a dedicated audio thread, so frame hitches don't starve it.
+// The game thread only posts commands into a lock-free queue; all methods must be called from the game thread.
 class AudioResourceManager {
 public:
-    // Constructor: Initializes the audio device
-    AudioResourceManager();
+    // Constructor: Takes over the backend (which opens the audio device, if it has one) and starts the audio thread.
+    // Headless tools pass a NullAudioBackend so nothing touches a sound card.
+    explicit AudioResourceManager(std::unique_ptr<AudioBackend> backend = createAudioBackend(AudioBackendKind::Raylib));
 
-    // Destructor: Cleans up all loaded resources and closes the audio device
+    // Destructor: Stops the audio thread, cleans up all loaded resources and closes the audio device
     ~AudioResourceManager();
 
     // Play a sound resource
+    // The AudioId overload is the per-frame path, it only posts a command to the audio thread.
+    void playAudio(AudioId id);
     void playAudio(const std::string &key);
 
     // Play a raw sound resource
     // Used mainly for playing audio header files
-    void playRawAudio(const std::string &key, const Wave &wave);
+    // At most Config::maxCachedRawSounds are kept, the least recently played one is unloaded to make room.
+    void playRawAudio(const std::string &key, const Wave &wave, AudioBus bus = AudioBus::Sfx);
+
+    void setVoiceStealPolicy(VoiceStealPolicy policy);
 
     // Stop a sound resource
+    void stopAudio(AudioId id);
     void stopAudio(const std::string &key);
 
+    // Volume of every voice of a sound, 0.0 to 1.0
+    void setAudioVolume(AudioId id, float volume);
+
+    // Replace a predefined sound with freshly decoded samples, taking ownership of wave
+    void reloadAudio(AudioId id, const Wave &wave);
+
     // Unload a specific sound resource
     void unloadAudio(const std::string &key);
 
@@ -36,29 +69,112 @@ public:
     // Unload all loaded sound resources
     void unloadAllAudio();
 
-    // A utility function to build all audio headers from wave files
-    // This is used so sound resources can be embedded in the final executable without having to load them at runtime.
-    // The function can be enabled in the constants.h file.
-    //
-    // This function is meant to be run in development only and should not be enabled in release builds.
-    void buildAudioHeaders();
+    void playBackgroundMusic();
+    void stopBackgroundMusic();
+    void setMusicVolume(float volume);
 
-    Music getBackgroundMusicRef() const;
+    // Playback speed of the music, 1 is normal. Raises the key along with the tempo.
+    void setMusicPitch(float pitch);
 
-    void playBackgroundMusic();
+    // Mixer controls, gains glide to the new values over Config::busGainSmoothingMs
+    void setMasterVolume(float volume);
+    void setBusVolume(AudioBus bus, float volume);
+
+    // While muted nothing is submitted to the device at all, playAudio() returns before touching a voice
+    void setMuted(bool mute);
+
+    // Pausing holds every playing voice and the music where they are, unpausing carries on from there.
+    // Sounds played while paused start as usual.
+    void setPaused(bool pause);
+
+    // Push the volume and mute settings to the mixer
+    void applySettings(const Settings &settings);
+
+    // Diagnostics: processor runs inside the device callback whenever a voice of this sound is mixed
+    void attachProcessor(AudioId id, AudioCallback processor);
+    void detachProcessor(AudioId id, AudioCallback processor);
 
 private:
-    // Created in loadAudioResources() method
-    Music background_game_music;
+    enum class AudioCommandType : std::uint8_t {
+        Play,
+        Stop,
+        SetVolume,
+        PlayMusic,
+        StopMusic,
+        SetMusicVolume,
+        SetMusicPitch,
+        SetMasterVolume,
+        SetBusVolume,
+        SetMuted,
+        SetPaused
+    };
 
-    // Audio sound cache
-    std::unordered_map<std::string, Sound> audioResources;
-    std::unordered_map<std::string, std::string> predefinedAudioPaths = {
-        // Sound effects
-        {"spring-effect", "../resources/audio/spring.wav"},
-        {"game-over", "../resources/audio/game_over.wav"},
-        {"level-complete", "../resources/audio/level_complete.wav"},
-        {"score", "../resources/audio/score.wav"},
-        {"theme-song", "../resources/audio/capybara_song.wav"},
+    struct AudioCommand {
+        AudioCommandType type = AudioCommandType::Play;
+        std::uint32_t slot = 0;     // Index into audioSlots for sound commands, the AudioBus for SetBusVolume
+        float value = 0.0f;         // Volume for the volume commands, pitch for SetMusicPitch, non-zero to mute or pause for SetMuted and SetPaused
+        std::uint32_t generation = 0;   // AudioEntry::generation of the slot when the command was posted
+    };
+
+    struct Voice {
+        VoiceHandle handle = invalidVoice;
+        std::uint64_t startedAt = 0;    // playSerial when this voice last started, 0 if never
+        bool paused = false;            // Held by setPaused(), resumed when unpausing
     };
+
+    // Every sound gets Config::voicesPerSound voices so overlapping triggers don't cut each other off.
+    // voices[0] owns the samples, the others share them (LoadSoundAlias() aliases on the raylib backend).
+    struct AudioEntry {
+        std::string key;
+        std::vector<Voice> voices;
+        std::size_t nextVoice = 0;
+        std::uint64_t lastPlayed = 0;
+        AudioBus bus = AudioBus::Sfx;
+        float volume = 1.0f;            // Set by setAudioVolume(), scaled by the bus gain
+        bool ducksMusic = false;        // Stings that pull the music bus down while they play
+        std::uint32_t generation = 0;   // Bumped when playRawAudio() hands the slot to another sound
+    };
+
+    void post(const AudioCommand &command);
+    // Post a sound command for slot, stamped with the slot's generation
+    void postSlot(AudioCommandType type, std::size_t slot, float value = 0.0f);
+    void audioThreadLoop(const std::stop_token &stopToken);
+    void execute(const AudioCommand &command);
+
+    void playSlot(AudioEntry &entry);
+    void stopSlot(const AudioEntry &entry);
+    AudioEntry *findSlot(const std::string &key);
+
+    void applyBusGains(std::uint32_t changedBuses);
+    void applyVoiceVolume(const AudioEntry &entry);
+
+    void createVoices(AudioEntry &entry, const Wave &wave);
+    void destroyVoices(AudioEntry &entry);
+    Voice &acquireVoice(AudioEntry &entry);
+    void enforceVoiceCap();
+
+    // Owns the voices and the background music stream, created before and destroyed after everything below
+    std::unique_ptr<AudioBackend> backend;
+    float musicVolume = 1.0f;
+
+    // Audio thread state, guarded by slotMutex like the voices they scale
+    AudioMixer mixer;
+    bool muted = false;
+    bool paused = false;
+
+    // Audio sound cache
+    // The first AudioId::Count slots belong to the predefined sounds, playRawAudio() appends after them.
+    std::vector<AudioEntry> audioSlots;
+    std::unordered_map<std::string, std::size_t> slotIndices;
+
+    VoiceStealPolicy stealPolicy = VoiceStealPolicy::StealOldest;
+    std::uint64_t playSerial = 0;
+
+    // Guards audioSlots and the voices. The audio thread holds it while executing commands,
+    // the game thread only takes it on slow paths that add, reload or unload sounds.
+    std::mutex slotMutex;
+
+    SpscQueue<AudioCommand, 256> commandQueue;
+    std::atomic<std::uint64_t> droppedCommands = 0;
+    std::jthread audioThread;
 };
\ No newline at end of file
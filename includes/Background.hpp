@@ -0,0 +1,65 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <raylib.h>
+
+// One horizontal band of the scenery, cut from the parallax atlas and scrolled at its own rate
+struct ParallaxLayer {
+    float top;              // Where the band starts on screen, as a fraction of the background's height
+    float rate;             // Scroll speed as a multiple of the pipes', 0 holds still and 1 moves with them
+    float repeat;           // How many times the band is tiled across the background
+    float dayTop;           // Atlas rows the band is cut from, by day and by night
+    float dayBottom;
+    float nightTop;
+    float nightBottom;
+};
+
+// Draws the scrolling scenery behind the pipes: sky, clouds, city, bushes and the floor, all cut from the
+// parallax atlas. Every layer is drawn by a single full-screen quad, the fragment shader looks up the layer of
+// each pixel and offsets its texture coordinates by the layer's rate. The CPU only sets the scroll and night
+// uniforms each frame, however many layers there are. Day and night are mixed in the same pass by the
+// nightAmount uniform, so the screen is filled once however far the fade is.
+// Needs a window, the shader is compiled by the constructor and released by the destructor.
+class Background {
+public:
+    static constexpr std::size_t maxLayers = 8;
+
+    // Starts with defaultLayers()
+    Background();
+    ~Background();
+
+    Background(const Background &) = delete;
+    Background &operator=(const Background &) = delete;
+
+    // Sky, clouds, city, bushes and floor as laid out in the cooked atlas, for a background of the window's size
+    static std::span<const ParallaxLayer> defaultLayers();
+
+    // Layers ordered top to bottom, each reaches down to where the next one starts. At most maxLayers are used.
+    // Uploaded to the shader when they change, never per frame.
+    void setLayers(std::span<const ParallaxLayer> layers);
+
+    // scrolled is how far the pipes have moved in pixels since the run started, nightAmount how far into the night
+    // the sky is (0 is all day, 1 all night). Each layer's offset is wrapped to one texture width here, so a long run
+    // doesn't lose precision. Without the shader every layer is drawn as its own quad and day and night don't mix.
+    void draw(Texture2D atlas, double scrolled, float nightAmount, Rectangle dest);
+
+private:
+    // Layers as uniforms, texture rows normalized by the atlas height
+    void uploadLayers() const;
+
+    Shader m_shader{};
+    int m_layerScrollLoc = -1;
+    int m_nightAmountLoc = -1;
+    int m_layerCountLoc = -1;
+    int m_layerScreenLoc = -1;
+    int m_layerAtlasLoc = -1;
+
+    ParallaxLayer m_layers[maxLayers]{};
+    std::size_t m_layerCount = 0;
+    int m_atlasHeight = 0;   // The atlas height the uploaded layers were normalized for, 0 before the first draw
+};
@@ -0,0 +1,57 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+#include "Simulation.hpp"
+
+// The small neural network that plays the game for the trainer and the demo bot.
+// inputCount inputs -> hiddenCount tanh units -> one output, the bird jumps when the output is positive.
+namespace BotBrain {
+    inline constexpr int inputCount = 4;
+    inline constexpr int hiddenCount = 8;
+
+    // Hidden weights and biases, then the output weights and bias
+    inline constexpr int parameterCount = hiddenCount * (inputCount + 1) + hiddenCount + 1;
+
+    struct Genome {
+        std::array<float, parameterCount> weights{};
+        float fitness = 0.0f;
+    };
+
+    using Inputs = std::array<float, inputCount>;
+
+    // Normalized network inputs: player height, vertical speed, offset to the gap center and distance to the pipes
+    Inputs observe(const Simulation &sim);
+
+    // One bird, scalar
+    bool decide(const Genome &genome, const Inputs &inputs);
+
+    // Many birds at once. The weights of `lanes` genomes are interleaved so every lane runs the same instruction
+    // stream on its own genome, four lanes per SSE register.
+    class Batch {
+    public:
+        static constexpr std::size_t lanes = 8;
+
+        // Load up to `lanes` genomes, unused lanes get zero weights
+        void load(std::span<const Genome> genomes);
+
+        // inputs[i] belongs to lane i, jump[i] receives lane i's decision
+        void decide(const std::array<Inputs, lanes> &inputs, std::array<bool, lanes> &jump) const;
+
+    private:
+        // weights[parameter * lanes + lane]
+        alignas(16) std::array<float, parameterCount * lanes> weights{};
+    };
+
+    // Genome files: "FBGN", format version, layer sizes, the weights and the fitness, all little-endian
+    bool saveGenome(const std::string &path, const Genome &genome);
+    std::optional<Genome> loadGenome(const std::string &path);
+}
@@ -0,0 +1,103 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <raylib.h>
+
+namespace Collision {
+    // Interior overlap, rectangles that only share an edge don't collide
+    inline bool overlaps(const Rectangle a, const Rectangle b) {
+        return a.x < b.x + b.width && a.x + a.width > b.x && a.y < b.y + b.height && a.y + a.height > b.y;
+    }
+
+    // Fractions of a step: time is the time of impact in [0, 1], exitTime when the boxes separate again (may be past 1)
+    struct Impact {
+        float time;
+        float exitTime;
+    };
+
+    // Swept AABB: moving travels by delta over one step while target stays put. Returns when the two first overlap
+    // during the step, or nullopt when they never do. Unlike testing overlap only at the end of the step, nothing
+    // thin or fast can pass through unnoticed. For two moving boxes pass the difference of their motions as delta.
+    inline std::optional<Impact> sweep(const Rectangle moving, const Vector2 delta, const Rectangle target) {
+        constexpr float infinity = std::numeric_limits<float>::infinity();
+
+        // Per axis, the open interval of t during which the projections overlap
+        const auto axis = [](const float start, const float size, const float velocity, const float targetStart,
+                             const float targetSize, float &enter, float &exit) {
+            if (velocity == 0.0f) {
+                const bool overlapping = start < targetStart + targetSize && start + size > targetStart;
+                enter = overlapping ? -infinity : infinity;
+                exit = overlapping ? infinity : -infinity;
+                return;
+            }
+            const float a = (targetStart - (start + size)) / velocity;
+            const float b = (targetStart + targetSize - start) / velocity;
+            enter = std::min(a, b);
+            exit = std::max(a, b);
+        };
+
+        float enterX, exitX, enterY, exitY;
+        axis(moving.x, moving.width, delta.x, target.x, target.width, enterX, exitX);
+        axis(moving.y, moving.height, delta.y, target.y, target.height, enterY, exitY);
+
+        const float enter = std::max(enterX, enterY);
+        const float exit = std::min(exitX, exitY);
+        if (enter >= exit || exit <= 0.0f || enter >= 1.0f) {
+            return std::nullopt;
+        }
+        return Impact{ .time = std::max(enter, 0.0f), .exitTime = exit };
+    }
+
+    // 1-bit collision shape of a sprite: a maskSize x maskSize grid stretched over wherever the sprite is drawn,
+    // one word per row with bit x set when column x is solid. flappybara-cook builds them from the sprite's alpha.
+    inline constexpr int maskSize = 64;
+
+    struct Mask {
+        std::array<std::uint64_t, maskSize> rows{};
+
+        // Every cell solid, collides exactly like the bounding box
+        static constexpr Mask solid() {
+            Mask mask;
+            mask.rows.fill(~0ull);
+            return mask;
+        }
+    };
+
+    // Fine phase, for after the bounding boxes were found to overlap: whether rect covers a solid cell of mask drawn
+    // over where. A cell rect only partly covers counts, so no hit the pixels would have is ever missed.
+    // One AND per row of the overlap.
+    inline bool overlaps(const Mask &mask, const Rectangle where, const Rectangle rect) {
+        const float columnsPerPixel = static_cast<float>(maskSize) / where.width;
+        const float rowsPerPixel = static_cast<float>(maskSize) / where.height;
+        const float left = (std::max(rect.x, where.x) - where.x) * columnsPerPixel;
+        const float right = (std::min(rect.x + rect.width, where.x + where.width) - where.x) * columnsPerPixel;
+        const float top = (std::max(rect.y, where.y) - where.y) * rowsPerPixel;
+        const float bottom = (std::min(rect.y + rect.height, where.y + where.height) - where.y) * rowsPerPixel;
+        if (right <= left || bottom <= top) {
+            return false;
+        }
+
+        const int firstColumn = static_cast<int>(left);
+        const int lastColumn = std::min(maskSize - 1, static_cast<int>(std::ceil(right)) - 1);
+        const int firstRow = static_cast<int>(top);
+        const int lastRow = std::min(maskSize - 1, static_cast<int>(std::ceil(bottom)) - 1);
+
+        // Columns firstColumn to lastColumn as one word
+        const std::uint64_t span = (~0ull >> (maskSize - 1 - (lastColumn - firstColumn))) << firstColumn;
+        for (int row = firstRow; row <= lastRow; ++row) {
+            if (mask.rows[row] & span) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
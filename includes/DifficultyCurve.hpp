@@ -0,0 +1,36 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "Simulation.hpp"
+
+// Piecewise linear difficulty keyed by score. Between two points every value is interpolated, before the first
+// and after the last point their level holds. Cheap, but meant to be evaluated when the score changes rather
+// than every frame.
+//
+// Loaded from "key=value" lines: every "score=N" line starts a new point that inherits all values from the one
+// before it, the keys after it override them. Without a file the curve is flat at the default level.
+class DifficultyCurve {
+public:
+    struct Point {
+        int score = 0;
+        DifficultyLevel level;
+    };
+
+    DifficultyCurve() = default;
+    explicit DifficultyCurve(std::vector<Point> points);
+
+    static DifficultyCurve load(const std::string &path);
+
+    DifficultyLevel at(int score) const;
+
+    // Sorted by score
+    const std::vector<Point> &points() const;
+
+private:
+    std::vector<Point> m_points;
+};
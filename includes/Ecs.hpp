@@ -0,0 +1,297 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Lightweight archetype entity component store.
+// The component types are fixed at compile time by World's parameter list. Entities with the same set of components
+// share an archetype, which keeps one contiguous array per component and one row per entity, so a system walking
+// some of the components touches nothing else. A system's signature is its component list, turned into a bit mask
+// at compile time; each() visits every archetype whose mask contains it, in the order the archetypes were first used.
+namespace Ecs {
+    struct Entity {
+        std::uint32_t index = UINT32_MAX;
+        std::uint32_t generation = 0;
+
+        bool operator==(const Entity &) const = default;
+    };
+
+    inline constexpr Entity nullEntity{};
+
+    // The components a system reads or writes, e.g. "using Signature = Ecs::Signature<Position, Velocity>;"
+    template <typename... Components>
+    struct Signature {};
+
+    template <typename... Components>
+    class World {
+        static_assert(sizeof...(Components) > 0 && sizeof...(Components) <= 64, "A world holds 1 to 64 component types");
+
+        template <typename Component, typename First, typename... Rest>
+        static constexpr std::size_t indexOf() {
+            if constexpr (std::is_same_v<Component, First>) {
+                return 0;
+            } else {
+                static_assert(sizeof...(Rest) > 0, "Component type is not part of this world");
+                return 1 + indexOf<Component, Rest...>();
+            }
+        }
+
+    public:
+        using Mask = std::uint64_t;
+
+        // const components in a signature are read-only but match like the plain type
+        template <typename Component>
+        static constexpr Mask bit = Mask{1} << indexOf<std::remove_const_t<Component>, Components...>();
+
+        template <typename... Cs>
+        static constexpr Mask signature = (Mask{0} | ... | bit<Cs>);
+
+        // A new entity with exactly these components
+        template <typename... Cs>
+        Entity create(Cs... components) {
+            static_assert(std::popcount(signature<Cs...>) == sizeof...(Cs), "Each component can only be given once");
+
+            Entity entity;
+            if (!m_free.empty()) {
+                entity.index = m_free.back();
+                m_free.pop_back();
+            } else {
+                entity.index = static_cast<std::uint32_t>(m_records.size());
+                m_records.emplace_back();
+            }
+            entity.generation = m_records[entity.index].generation;
+
+            const std::uint32_t archetypeIndex = archetypeFor(signature<Cs...>);
+            Archetype &archetype = m_archetypes[archetypeIndex];
+            (column<Cs>(archetype).push_back(std::move(components)), ...);
+            place(entity, archetypeIndex);
+            return entity;
+        }
+
+        // The last entity of the archetype moves into the freed row, handles to the destroyed entity go stale
+        void destroy(const Entity entity) {
+            if (!alive(entity)) {
+                return;
+            }
+
+            Record &record = m_records[entity.index];
+            eraseRow(record.archetype, record.row);
+            record.generation++;
+            record.alive = false;
+            m_free.push_back(entity.index);
+            m_size--;
+        }
+
+        bool alive(const Entity entity) const {
+            return entity.index < m_records.size() && m_records[entity.index].alive &&
+                   m_records[entity.index].generation == entity.generation;
+        }
+
+        template <typename Component>
+        bool has(const Entity entity) const {
+            return alive(entity) && (m_archetypes[m_records[entity.index].archetype].mask & bit<Component>) != 0;
+        }
+
+        // The entity must be alive and have the component
+        template <typename Component>
+        Component &get(const Entity entity) {
+            const Record &record = m_records[entity.index];
+            return column<Component>(m_archetypes[record.archetype])[record.row];
+        }
+
+        // Moves the entity to the archetype with the component added, or overwrites the one it has
+        template <typename Component>
+        void add(const Entity entity, Component component) {
+            if (!alive(entity)) {
+                return;
+            }
+            if (has<Component>(entity)) {
+                get<Component>(entity) = std::move(component);
+                return;
+            }
+
+            const std::uint32_t from = m_records[entity.index].archetype;
+            const std::uint32_t to = archetypeFor(m_archetypes[from].mask | bit<Component>);
+            column<Component>(m_archetypes[to]).push_back(std::move(component));
+            move(entity, to);
+        }
+
+        template <typename Component>
+        void remove(const Entity entity) {
+            if (!has<Component>(entity)) {
+                return;
+            }
+
+            const std::uint32_t from = m_records[entity.index].archetype;
+            move(entity, archetypeFor(m_archetypes[from].mask & ~bit<Component>));
+        }
+
+        // fn(Cs &...) for every entity that has all of Cs, one archetype at a time.
+        // Entities must not be created, destroyed or change components until it returns.
+        template <typename... Cs, typename Fn>
+        void each(Fn &&fn) {
+            constexpr Mask wanted = signature<Cs...>;
+            for (Archetype &archetype : m_archetypes) {
+                if ((archetype.mask & wanted) != wanted || archetype.entities.empty()) {
+                    continue;
+                }
+
+                const std::size_t count = archetype.entities.size();
+                const auto visit = [&](Cs *... columns) {
+                    for (std::size_t row = 0; row < count; ++row) {
+                        fn(columns[row]...);
+                    }
+                };
+                visit(column<std::remove_const_t<Cs>>(archetype).data()...);
+            }
+        }
+
+        // each() with the entity handle first, fn(Entity, Cs &...)
+        template <typename... Cs, typename Fn>
+        void eachEntity(Fn &&fn) {
+            constexpr Mask wanted = signature<Cs...>;
+            for (Archetype &archetype : m_archetypes) {
+                if ((archetype.mask & wanted) != wanted || archetype.entities.empty()) {
+                    continue;
+                }
+
+                const std::size_t count = archetype.entities.size();
+                const auto visit = [&](Cs *... columns) {
+                    for (std::size_t row = 0; row < count; ++row) {
+                        fn(archetype.entities[row], columns[row]...);
+                    }
+                };
+                visit(column<std::remove_const_t<Cs>>(archetype).data()...);
+            }
+        }
+
+        // Runs a system over the entities matching its Signature: system(Cs &...)
+        template <typename System>
+        void run(System &system) {
+            runWith(system, typename System::Signature{});
+        }
+
+        // Entities alive
+        std::size_t size() const { return m_size; }
+        std::size_t archetypeCount() const { return m_archetypes.size(); }
+
+        // Destroys every entity, the archetypes keep their memory
+        void clear() {
+            for (Archetype &archetype : m_archetypes) {
+                archetype.entities.clear();
+                std::apply([](auto &... columns) { (columns.clear(), ...); }, archetype.columns);
+            }
+            for (std::uint32_t index = 0; index < m_records.size(); ++index) {
+                if (m_records[index].alive) {
+                    m_records[index].alive = false;
+                    m_records[index].generation++;
+                    m_free.push_back(index);
+                }
+            }
+            m_size = 0;
+        }
+
+    private:
+        struct Archetype {
+            Mask mask = 0;
+            std::tuple<std::vector<Components>...> columns;   // Only the columns in mask are used
+            std::vector<Entity> entities;                     // Row to entity, for fixing up moved rows
+        };
+
+        struct Record {
+            std::uint32_t generation = 0;
+            std::uint32_t archetype = 0;
+            std::uint32_t row = 0;
+            bool alive = false;
+        };
+
+        template <typename Component>
+        static std::vector<Component> &column(Archetype &archetype) {
+            return std::get<std::vector<Component>>(archetype.columns);
+        }
+
+        template <typename System, typename... Cs>
+        void runWith(System &system, Signature<Cs...>) {
+            each<Cs...>(system);
+        }
+
+        // Archetypes are few and looked up only on structural changes, a scan is enough
+        std::uint32_t archetypeFor(const Mask mask) {
+            for (std::uint32_t i = 0; i < m_archetypes.size(); ++i) {
+                if (m_archetypes[i].mask == mask) {
+                    return i;
+                }
+            }
+            m_archetypes.push_back(Archetype{ .mask = mask, .columns = {}, .entities = {} });
+            return static_cast<std::uint32_t>(m_archetypes.size() - 1);
+        }
+
+        // Components were already pushed onto the archetype's columns, add the row that owns them
+        void place(const Entity entity, const std::uint32_t archetypeIndex) {
+            Archetype &archetype = m_archetypes[archetypeIndex];
+            Record &record = m_records[entity.index];
+            record.archetype = archetypeIndex;
+            record.row = static_cast<std::uint32_t>(archetype.entities.size());
+            record.alive = true;
+            archetype.entities.push_back(entity);
+            m_size++;
+        }
+
+        // Swap-remove row from every column the archetype uses
+        void eraseRow(const std::uint32_t archetypeIndex, const std::uint32_t row) {
+            Archetype &archetype = m_archetypes[archetypeIndex];
+            const std::uint32_t last = static_cast<std::uint32_t>(archetype.entities.size() - 1);
+
+            const auto eraseFrom = [&]<typename Component>(std::vector<Component> &values) {
+                if ((archetype.mask & bit<Component>) == 0) {
+                    return;
+                }
+                if (row != last) {
+                    values[row] = std::move(values[last]);
+                }
+                values.pop_back();
+            };
+            std::apply([&](auto &... columns) { (eraseFrom(columns), ...); }, archetype.columns);
+
+            if (row != last) {
+                const Entity moved = archetype.entities[last];
+                archetype.entities[row] = moved;
+                m_records[moved.index].row = row;
+            }
+            archetype.entities.pop_back();
+        }
+
+        // Carry the components both archetypes share over to the end of to, then drop the old row. Components only
+        // to has were pushed by the caller.
+        void move(const Entity entity, const std::uint32_t to) {
+            const Record record = m_records[entity.index];
+            Archetype &source = m_archetypes[record.archetype];
+            Archetype &target = m_archetypes[to];
+
+            const auto carry = [&]<typename Component>(std::vector<Component> &values) {
+                if ((source.mask & target.mask & bit<Component>) != 0) {
+                    column<Component>(target).push_back(std::move(values[record.row]));
+                }
+            };
+            std::apply([&](auto &... columns) { (carry(columns), ...); }, source.columns);
+
+            eraseRow(record.archetype, record.row);
+            m_size--;
+            place(entity, to);
+        }
+
+        std::vector<Archetype> m_archetypes;
+        std::vector<Record> m_records;      // Indexed by Entity::index
+        std::vector<std::uint32_t> m_free;  // Indices of destroyed entities, reused by create()
+        std::size_t m_size = 0;
+    };
+}
@@ -0,0 +1,64 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#ifndef FLAPPYBARA_ENV_H
+#define FLAPPYBARA_ENV_H
+
+// C ABI over a vector of headless FlappyBara simulations, for reinforcement learning from Python (ctypes, cffi).
+//
+// Every call writes into buffers owned by the caller, nothing is allocated per step. With numpy, allocate
+// observations as float32[count][FB_ENV_OBSERVATION_SIZE], rewards as float32[count], dones as uint8[count]
+// once and pass their data pointers on every call.
+//
+// An environment that finishes during fb_env_step() reports done = 1 and is reset immediately with the next seed,
+// so the observation written for it is already the first observation of its new episode.
+//
+// Rewards per step: +1 for every pipe passed, -1 on death, otherwise FB_ENV_ALIVE_REWARD.
+
+#include <stdint.h>
+
+#if defined(_WIN32)
+    #if defined(FLAPPYBARA_ENV_BUILD)
+        #define FB_ENV_API __declspec(dllexport)
+    #else
+        #define FB_ENV_API __declspec(dllimport)
+    #endif
+#else
+    #define FB_ENV_API __attribute__((visibility("default")))
+#endif
+
+// Player height, vertical speed, offset to the gap center and distance to the pipes, all roughly in [-1, 1]
+#define FB_ENV_OBSERVATION_SIZE 4
+#define FB_ENV_ALIVE_REWARD 0.01f
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct FbEnv FbEnv;
+
+// count environments. Each fb_env_step() advances every environment by frameSkip simulation ticks (1/120 s each),
+// the action only applies to the first tick. pixelWidth/pixelHeight > 0 enables fb_env_render(), which opens a
+// hidden window for the GPU context unless the process already has a raylib window. Rendering environments share that
+// window, it is closed when the last of them is destroyed. Returns NULL on bad arguments.
+FB_ENV_API FbEnv *fb_env_create(int count, int frameSkip, int pixelWidth, int pixelHeight);
+FB_ENV_API void fb_env_destroy(FbEnv *env);
+
+FB_ENV_API int fb_env_count(const FbEnv *env);
+
+// Reset every environment, environment i gets seed + i. Later automatic resets continue from seed + count.
+FB_ENV_API void fb_env_reset(FbEnv *env, uint64_t seed, float *observations);
+
+// actions[i] != 0 makes environment i jump. Returns the number of environments that finished this step.
+FB_ENV_API int fb_env_step(FbEnv *env, const uint8_t *actions, float *observations, float *rewards, uint8_t *dones);
+
+// Draw every environment and copy them into pixels as uint8[count][pixelHeight][pixelWidth][4] RGBA, top row first.
+// Returns 0 if the environment was created without pixel observations.
+FB_ENV_API int fb_env_render(FbEnv *env, uint8_t *pixels);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FLAPPYBARA_ENV_H
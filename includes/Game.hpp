@@ -4,8 +4,16 @@
 
 #pragma once
 
+#include <random>
 #include "AudioResourceManager.hpp"
+#include "Background.hpp"
+#include "DifficultyCurve.hpp"
+#include "GameComponents.hpp"
 #include "TextureResourceManager.hpp"
+#include "InputSource.hpp"
+#include "ProjectilePool.hpp"
+#include "Settings.hpp"
+#include "Simulation.hpp"
 #include "constants.hpp"
 
 enum class GameActivityState {
@@ -24,7 +32,7 @@ struct GameState {
 
 class Game {
 public:
-    Game(GameState &game_state, AudioResourceManager &audioManager, TextureResourceManager &textureManager);
+    Game(GameState &game_state, AudioResourceManager &audioManager, TextureResourceManager &textureManager, Settings &settings);
     ~Game();
 
     void update();
@@ -35,30 +43,87 @@ public:
 
     void draw_game_over();
 
+    // Over the frozen play field: Resume goes back to PLAYING, Settings to SETTINGS and Menu ends the run
+    void draw_pause();
+
+    // Volume sliders and mute, changes are heard immediately and saved on Back
+    void draw_settings();
+
     void reset_game();
 
+    // Holds the run and every sound where they are until resume(). The time in between is never simulated, the
+    // accumulator keeps its remainder and the frame that took the whole pause is dropped.
+    void pause();
+    void resume();
+
+    // Let input drive the player instead of the keyboard, nullptr goes back to the keyboard.
+    // input must outlive the game or be replaced before it is destroyed.
+    void setInputSource(InputSource *input);
+
+    // Attract mode: after Config::attractIdleSeconds on the menu without input, bot plays demo runs until
+    // a key or mouse button is pressed. nullptr turns it off. bot must outlive the game.
+    void setAttractInput(InputSource *bot);
+
+    // Soak testing: bot plays from now on, every game over starts the next run and is logged. bot must outlive the game.
+    void startSoak(InputSource *bot);
+
+    // Projectiles spawned per second of play before the difficulty scales it, 0 turns them off. Demo and soak runs never spawn any,
+    // the bots only plan around the pipes.
+    void setProjectileRate(float perSecond);
+
 private:
     GameState &game_state;
     AudioResourceManager &audioManager;
     TextureResourceManager &textureManager;
+    Settings &settings;
 
-    Rectangle m_pipes[2] = {
-        { Config::WindowWidth, 0, m_pipeWidth, 200 },
-        { Config::WindowWidth, 200 + m_pipeGap, m_pipeWidth, Config::WindowHeight - 200 - m_pipeGap },
-    };
-
-    float m_playerWidth = 70.0f;
-    float m_playerHeight = 70.0f;
-    float m_playerSpeed;                  // The speed of the player in pixels per second
-    Vector2 m_playerPosition;             // The position of the player in pixels
-    bool m_pipePassed;                    // If the player has passed a pipe
-    int m_score;                          // The current score of the player
+    // The physics run in fixed steps, m_accumulator carries the frame time not yet simulated
+    Simulation m_sim;
+    float m_accumulator = 0.0f;
+    bool m_dropFrameTime = false;         // Set by resume(), the next update() adds no time
     int m_gameOverScore;                  // The score at which the game is over
 
-    float m_pipeWidth = 80.0f;
-    float m_pipeGap = 150.f;
-    float m_pipeSpeed = 200.f;
+    // Loaded from Config::difficultyPath, the simulation follows it on its own, the spawner and music on score changes
+    DifficultyCurve m_difficulty;
+    float m_projectileRateScale = 1.0f;
+
+    // The scenery scrolls with the pipes, the sky fades towards the difficulty's night value over Config::nightFadeSeconds
+    Background m_background;
+    double m_scrolled = 0.0;              // A double so hours of scrolling stay exact to a fraction of a pixel
+    float m_night = 0.0f;
+    float m_nightTarget = 0.0f;
+
+    // Pipes and the player as entities, drawn by systems after following the simulation
+    GameWorld m_world;
+
+    // Cooked from the player sprite's alpha, so transparent corners of the sprite don't collide
+    Collision::Mask m_playerMask;
+
+    // Stepped together with m_sim, spawn positions come from the run's seed
+    ProjectilePool m_projectiles;
+    std::mt19937 m_projectileRng;
+    float m_projectileRate = Config::projectilesPerSecond;
+    float m_projectilesDue = 0.0f;
+
+    KeyboardInput m_keyboard;
+    InputSource *m_input = &m_keyboard;
+
+    // Demo and soak runs are played by m_autoplay instead of m_input
+    InputSource *m_autoplay = nullptr;
+    bool m_demo = false;
+    bool m_soak = false;
+    float m_menuIdleTime = 0.0f;
+    std::uint64_t m_autoplayRuns = 0;
+
+    // Spawner, music pitch and sky from the level m_sim applied at the current score
+    void applyDifficulty();
+
+    // Spawn the projectiles that came due during one fixed step
+    void spawnProjectiles();
+
+    // Any key or mouse button, ends a demo and resets the menu idle timer
+    static bool anyInput();
 
-    const float m_gravity = 400.0f;      // pixels per second ^ 2
-    const float m_jumpHeight = -250.0f;
+    // GuiButton that clicks on the interface bus when pressed
+    bool uiButton(Rectangle bounds, const char *text);
 };
\ No newline at end of file
@@ -0,0 +1,36 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <raylib.h>
+#include "AssetIds.hpp"
+#include "Ecs.hpp"
+
+// Components of the objects Game draws. Simulation stays the owner of the physics state, it is a plain value the
+// bots copy every frame, so entities that mirror it carry a component saying what they follow and a system copies
+// the simulation's state into their Transform before drawing.
+
+// Where the object is drawn
+struct Transform {
+    Rectangle rect;
+};
+
+// Stretched over the Transform, skipped while hidden
+struct Sprite {
+    TextureId texture;
+    bool visible = true;
+};
+
+// Follows the simulation's player
+struct PlayerBody {};
+
+// Follows one pipe of the simulation's pipe pair at index pair (0 is the oldest), hidden while there is no such pair
+struct PipeSegment {
+    std::uint32_t pair;
+    bool top;
+};
+
+using GameWorld = Ecs::World<Transform, Sprite, PlayerBody, PipeSegment>;
@@ -0,0 +1,107 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "BotBrain.hpp"
+#include "Simulation.hpp"
+
+// Where Game gets its jump decisions from, a player at the keyboard or a bot.
+class InputSource {
+public:
+    virtual ~InputSource() = default;
+
+    // Called once per rendered frame before any simulation step of that frame
+    virtual void beginFrame() {}
+
+    // Called before every simulation step, true to jump on this step
+    virtual bool wantsJump(const Simulation &sim) = 0;
+};
+
+// Space bar. A frame can run several simulation steps, the key press only jumps on the first of them.
+class KeyboardInput final : public InputSource {
+public:
+    void beginFrame() override;
+    bool wantsJump(const Simulation &sim) override;
+
+private:
+    bool pressed = false;
+};
+
+// A trained genome from flappybara-train playing on its own
+class GenomeInput final : public InputSource {
+public:
+    explicit GenomeInput(const BotBrain::Genome &genome);
+
+    bool wantsJump(const Simulation &sim) override;
+
+private:
+    BotBrain::Genome genome;
+};
+
+// Plays by fast-forwarding copies of the simulation. It searches depth first for a line of flaps that survives
+// until the bird is past the next pipe: first not flapping at all, then flapping at the latest step that could
+// help, then earlier ones, up to Config::botMaxFlaps flaps placed every Config::botFlapResolutionTicks steps.
+// Branches that crash are dropped, flaps while still rising from the last one are never tried, and the search
+// stops at the first line that survives or when the frame's budget runs out, keeping the longest line so far.
+// The simulation is deterministic, so as long as that line still survives to the current horizon it is simply
+// replayed and nothing is searched at all. Flaps at a step and (to a quarter pixel) a height that were already
+// searched to a crash are not searched again for the rest of the run, so a search the budget cut short gets further
+// on the next step. That is a heuristic: a flap close to a searched one may be skipped although it would survive.
+class LookaheadInput final : public InputSource {
+public:
+    explicit LookaheadInput(std::chrono::microseconds frameBudget = std::chrono::microseconds(Config::botBudgetMicros));
+
+    void beginFrame() override;
+    bool wantsJump(const Simulation &sim) override;
+
+    // Searches the frame budget ran out on, the bot then carried on with the longest line found in time
+    std::uint64_t searchesCutShort() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    // Ticks at which the line being searched or followed flaps
+    struct Plan {
+        std::array<std::uint64_t, Config::botMaxFlaps> flaps{};
+        int count = 0;
+
+        bool flapsAt(std::uint64_t tick) const;
+    };
+
+    // A flap that was already searched to a crash, with at most flapsLeft more flaps after it
+    struct DeadEnd {
+        std::uint64_t key = 0;
+        std::uint64_t longest = 0;
+        int flapsLeft = 0;
+        std::uint32_t generation = 0;
+    };
+
+    std::uint64_t search(const Simulation &start, std::uint64_t horizon, int flapsLeft, Plan &line, Plan &best, bool &aborted);
+    static std::uint64_t deadEndKey(const Simulation &flapped);
+    DeadEnd &deadEnd(const Simulation &flapped);
+    // Walk the current plan from start, aborted when the deadline passes on the way
+    std::uint64_t replay(const Simulation &start, std::uint64_t horizon, bool &aborted) const;
+    bool followPlan(const Simulation &sim) const;
+
+    std::chrono::microseconds budget;
+    Clock::time_point deadline{};
+    std::uint64_t searchStart = 0;
+
+    // Snapshots at the steps a flap could branch off, one list per flap depth so searching never allocates
+    std::array<std::vector<Simulation>, Config::botMaxFlaps> branchPoints;
+
+    // Flaps known to end in a crash, only entries of the current generation (one per run) count
+    std::vector<DeadEnd> deadEnds;
+    std::uint32_t generation = 1;
+
+    Plan plan;
+    std::uint64_t plannedAt = 0;
+    std::uint64_t planHorizon = 0;
+    std::uint64_t cutShort = 0;
+};
@@ -0,0 +1,123 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Counts the jobs of one batch that have not finished yet, see JobSystem::wait()
+class JobCounter {
+public:
+    bool done() const { return m_remaining.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class JobSystem;
+    std::atomic<std::size_t> m_remaining = 0;
+
+    // The first exception thrown by a job of the batch, written once by whoever sets m_failed
+    std::atomic<bool> m_failed = false;
+    std::exception_ptr m_error;
+};
+
+// Work-stealing thread pool shared by the cooker, the trainer and the benchmarks.
+// Every worker owns a deque: it pushes and pops its own jobs at the back (newest first, still warm in cache),
+// idle workers steal from the front of the others (oldest first, usually the biggest pieces of work).
+// Threads that are not workers hand their jobs out round robin and help run jobs while they wait.
+//
+// A job that throws still counts as finished, wait() rethrows the first exception of the batch once all of it has run.
+// Jobs may submit more jobs and wait on them.
+class JobSystem {
+public:
+    using Job = std::move_only_function<void()>;
+
+    explicit JobSystem(unsigned int workerCount = std::thread::hardware_concurrency());
+
+    // Joins the workers, jobs still queued are dropped. wait() on every counter first.
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    unsigned int workerCount() const;
+
+    // Queue a job, counter.done() turns true once it and every other job submitted with counter have run
+    void submit(JobCounter &counter, Job job);
+
+    // Block until counter is done, running queued jobs on the calling thread in the meantime.
+    // Rethrows the first exception a job submitted with counter threw.
+    void wait(const JobCounter &counter);
+
+    // Call body(begin, end) for ranges of at most grain indices covering [0, count) and wait for all of them.
+    // Rethrows the first exception body threw, after every range has run.
+    void parallelFor(std::size_t count, std::size_t grain, const std::function<void(std::size_t, std::size_t)> &body);
+
+private:
+    struct Task {
+        Job job;
+        JobCounter *counter = nullptr;
+    };
+
+    // Own cache line each, so workers hammering their own deque don't slow their neighbours down
+    struct alignas(64) WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void workerLoop(const std::stop_token &stopToken, unsigned int index);
+    void push(Task task);
+    bool tryRunOne(unsigned int self);
+    bool popOwn(unsigned int self, Task &task);
+    bool steal(unsigned int self, Task &task);
+    static void run(Task &task);
+
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+    std::atomic<unsigned int> m_nextQueue = 0;      // Round robin target for jobs from outside the pool
+
+    // Idle workers sleep here instead of spinning, m_queued counts jobs pushed but not yet popped
+    std::atomic<std::size_t> m_queued = 0;
+    std::atomic<unsigned int> m_sleeping = 0;
+    std::mutex m_sleepMutex;
+    std::condition_variable_any m_wake;
+
+    std::vector<std::jthread> m_workers;
+};
+
+// Jobs with dependencies between them. Build it once, then run() it as often as needed:
+// a task starts as soon as every task it depends on has finished.
+class TaskGraph {
+public:
+    using TaskId = std::size_t;
+
+    TaskId add(std::function<void()> work);
+
+    // after only starts once before has finished
+    void precede(TaskId before, TaskId after);
+
+    // Run every task once and wait for the whole graph. Returns false without running anything if it has a cycle.
+    // A task that throws never starts the tasks after it, the first exception is rethrown once the rest has run.
+    bool run(JobSystem &jobs);
+
+    std::size_t size() const;
+
+private:
+    struct Node {
+        std::function<void()> work;
+        std::vector<TaskId> successors;
+        std::size_t predecessors = 0;
+    };
+
+    bool isAcyclic() const;
+    void launch(JobSystem &jobs, JobCounter &counter, std::atomic<std::size_t> *pending, TaskId id) const;
+
+    std::vector<Node> m_nodes;
+};
@@ -0,0 +1,19 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+
+// Handing resident pages back to the OS, for large read-only data that is read once from front to back.
+namespace MemoryPages {
+    // Size of a virtual memory page, 4096 where the platform can't tell
+    std::size_t pageSize();
+
+    // Drop the whole pages inside [begin, end) from resident memory, they are read back from their file when touched
+    // again. Only for read-only data mapped from a file, e.g. arrays embedded in the executable: anonymous (heap) pages
+    // would come back zeroed. Linux only through madvise(MADV_DONTNEED), elsewhere it releases nothing.
+    // Returns how far the release got, a page boundary up to end, or begin when nothing was released.
+    const unsigned char *releaseFileBacked(const unsigned char *begin, const unsigned char *end);
+}
@@ -0,0 +1,95 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <raylib.h>
+
+// Streams a QOA compressed track straight out of an embedded byte array.
+// Only one QOA frame is decoded at a time into a small ring of chunk buffers that is kept full ahead of the playhead,
+// so memory use depends on Config::musicChunkFrames and Config::musicDecodeBuffers, not on the length of the track.
+//
+// update() does the decoding and must be called regularly from a single thread (the audio thread).
+class MusicStreamer {
+public:
+    MusicStreamer() = default;
+    ~MusicStreamer();
+
+    MusicStreamer(const MusicStreamer&) = delete;
+    MusicStreamer& operator=(const MusicStreamer&) = delete;
+
+    // Open a QOA file held in memory. data must stay valid until close().
+    // releaseConsumed drops the pages of data already decoded from resident memory as playback moves on, only pass it
+    // for data embedded in the executable, see MemoryPages::releaseFileBacked().
+    bool open(const unsigned char *data, std::size_t size, int chunkFrames, int decodeBuffers, bool releaseConsumed = false);
+    void close();
+
+    void play();
+    void stop();
+    void pause();
+    void resume();
+    void setVolume(float volume);
+    void setPitch(float pitch);
+    bool isPlaying() const;
+
+    // Decode ahead into free chunk buffers and hand finished chunks to the audio stream
+    void update();
+
+    // Take the oldest decoded chunk of chunkFrames frames, decoding it first if none is waiting, or nullptr when
+    // nothing could be decoded. Valid until the next call to update(), nextChunk() or stop().
+    const short *nextChunk();
+
+    // Decode buffers owned by the streamer, for diagnostics
+    std::size_t bufferBytes() const;
+
+    // Number of times playback starved: either both stream sub-buffers drained before update() refilled them,
+    // or the stream asked for data and nothing could be decoded
+    std::uint64_t underruns() const;
+
+    AudioStream stream() const;
+
+private:
+    struct Lms {
+        int history[4] = {};
+        int weights[4] = {};
+    };
+
+    bool decodeFrame();
+    void fillChunks();
+    void rewind();
+    void releaseConsumedPages();
+
+    const unsigned char *m_data = nullptr;
+    std::size_t m_size = 0;
+    std::size_t m_readOffset = 0;       // Next QOA frame in m_data
+    std::size_t m_releasedOffset = 0;   // Bytes of m_data already handed back to the OS
+    bool m_releaseConsumed = false;
+
+    unsigned int m_channels = 0;
+    unsigned int m_sampleRate = 0;
+    std::array<Lms, 8> m_lms{};
+
+    // The frame most recently decoded and how much of it has been copied into chunks
+    std::vector<short> m_frameSamples;
+    std::size_t m_frameLength = 0;
+    std::size_t m_frameConsumed = 0;
+
+    // Ring of decoded chunks waiting to be submitted to the stream
+    std::vector<short> m_chunks;
+    int m_chunkFrames = 0;
+    int m_chunkCount = 0;
+    int m_chunkHead = 0;               // Oldest decoded chunk
+    int m_chunksReady = 0;
+
+    AudioStream m_stream{};
+    bool m_playing = false;
+    std::uint64_t m_underruns = 0;
+    std::chrono::steady_clock::time_point m_lastSubmit{};
+    bool m_hasSubmitted = false;
+};
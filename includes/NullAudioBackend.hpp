@@ -0,0 +1,79 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "AudioBackend.hpp"
+
+// Accepts every command without touching an audio device, for headless servers, CI and simulation/replay tools.
+// Voices "play" for their real length measured on a virtual clock that only moves when advance() is called,
+// and every play is counted so tests can assert on what the game tried to play.
+//
+// Unlike the other backends the query methods are safe to call from any thread.
+class NullAudioBackend final : public AudioBackend {
+public:
+    NullAudioBackend() = default;
+
+    bool createVoices(std::string_view key, const Wave &wave, std::span<VoiceHandle> handles) override;
+    void destroyVoices(std::span<const VoiceHandle> handles) override;
+
+    void play(VoiceHandle voice) override;
+    void stop(VoiceHandle voice) override;
+    void pause(VoiceHandle voice) override;
+    void resume(VoiceHandle voice) override;
+    bool isPlaying(VoiceHandle voice) const override;
+    void setVolume(VoiceHandle voice, float volume) override;
+    float duration(VoiceHandle voice) const override;
+
+    bool openMusic(const unsigned char *data, std::size_t size) override;
+    void closeMusic() override;
+    void playMusic() override;
+    void stopMusic() override;
+    void pauseMusic() override;
+    void resumeMusic() override;
+    void setMusicVolume(float volume) override;
+    void setMusicPitch(float pitch) override;
+    void updateMusic() override;
+    std::uint64_t musicUnderruns() const override;
+
+    // Move the virtual clock forward, voices whose samples ran out stop playing
+    void advance(double seconds);
+    double now() const;
+
+    // Plays of a sound by key across all of its voices, and of every sound
+    std::uint64_t playCount(std::string_view key) const;
+    std::uint64_t totalPlays() const;
+
+    // Playing and not paused, and paused by pauseMusic() until resumeMusic(), stopMusic() or playMusic()
+    bool isMusicPlaying() const;
+    bool isMusicPaused() const;
+
+private:
+    struct NullVoice {
+        std::string key;
+        double length = 0.0;
+        double startedAt = 0.0;
+        double pausedAt = 0.0;
+        bool playing = false;
+        bool paused = false;
+        bool alive = false;
+    };
+
+    const NullVoice *find(VoiceHandle voice) const;
+    NullVoice *find(VoiceHandle voice);
+
+    mutable std::mutex mutex;
+    std::vector<NullVoice> voices;          // Indexed by handle - 1
+    std::unordered_map<std::string, std::uint64_t> plays;
+    std::uint64_t playsTotal = 0;
+    double clock = 0.0;
+
+    bool musicOpen = false;
+    bool musicPlaying = false;
+    bool musicPaused = false;
+};
@@ -0,0 +1,85 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Fixed-capacity ring of pipe pairs, oldest (leftmost) first, stored as one array per field.
+// Pairs are addressed by sequence number: every push gets the next one and it stays valid until that pair is popped,
+// so callers can remember a pair (e.g. the next one to score) while older pairs are recycled in front of it.
+template <std::size_t Capacity>
+class PipeRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "PipeRing capacity must be a power of two");
+
+public:
+    static constexpr std::size_t capacity = Capacity;
+
+    std::size_t size() const { return static_cast<std::size_t>(m_tail - m_head); }
+    bool empty() const { return m_head == m_tail; }
+    bool full() const { return size() == Capacity; }
+
+    // Sequence numbers of the oldest pair and one past the newest
+    std::uint64_t head() const { return m_head; }
+    std::uint64_t tail() const { return m_tail; }
+
+    void clear() {
+        m_head = 0;
+        m_tail = 0;
+    }
+
+    // Returns false when the ring is full, the pair is not added
+    bool push(const float x, const float gapY, const float gapSize) {
+        if (full()) {
+            return false;
+        }
+
+        const std::size_t slot = m_tail & mask;
+        m_x[slot] = x;
+        m_gapY[slot] = gapY;
+        m_gapSize[slot] = gapSize;
+        m_passed[slot] = 0;
+        m_tail++;
+        return true;
+    }
+
+    void popFront() {
+        m_head++;
+    }
+
+    float x(const std::uint64_t id) const { return m_x[id & mask]; }
+    float gapY(const std::uint64_t id) const { return m_gapY[id & mask]; }      // Top of the gap
+    float gapSize(const std::uint64_t id) const { return m_gapSize[id & mask]; }
+    bool passed(const std::uint64_t id) const { return m_passed[id & mask] != 0; }
+    void setPassed(const std::uint64_t id) { m_passed[id & mask] = 1; }
+
+    // Move every pair left by dx. The live pairs are at most two contiguous runs of m_x, both plain loops the
+    // compiler vectorizes.
+    void scroll(const float dx) {
+        const std::size_t first = m_head & mask;
+        const std::size_t count = size();
+        const std::size_t run = std::min(count, Capacity - first);
+
+        for (std::size_t i = first; i < first + run; ++i) {
+            m_x[i] -= dx;
+        }
+        for (std::size_t i = 0; i < count - run; ++i) {
+            m_x[i] -= dx;
+        }
+    }
+
+private:
+    static constexpr std::size_t mask = Capacity - 1;
+
+    std::array<float, Capacity> m_x{};
+    std::array<float, Capacity> m_gapY{};
+    std::array<float, Capacity> m_gapSize{};
+    std::array<std::uint8_t, Capacity> m_passed{};
+
+    std::uint64_t m_head = 0;
+    std::uint64_t m_tail = 0;
+};
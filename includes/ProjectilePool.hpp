@@ -0,0 +1,74 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <raylib.h>
+#include "Collision.hpp"
+
+// Fixed-capacity pool of round projectiles that fly in straight lines.
+// All memory is allocated by the constructor, spawn() reuses freed slots from a free list and never allocates.
+// Positions and velocities are stored one array per component so update() moves four projectiles per SSE
+// instruction. After every update the live projectiles are bucketed into a uniform grid over the bounds, and
+// overlaps() only tests the projectiles in the handful of cells a rectangle touches.
+class ProjectilePool {
+public:
+    using Handle = std::uint32_t;
+    static constexpr Handle invalidHandle = UINT32_MAX;
+
+    // Projectiles that leave bounds are despawned by update(). Smaller cells mean fewer candidates per query
+    // but a bigger grid to clear every update, a cell about the size of the player is a good start.
+    ProjectilePool(std::size_t capacity, float radius, Rectangle bounds, float cellSize);
+
+    // Returns invalidHandle when the pool is full. The handle stays valid until the projectile is despawned.
+    Handle spawn(Vector2 position, Vector2 velocity);
+    void despawn(Handle handle);
+    void clear();
+
+    // Move every projectile by dt, despawn the ones that left the bounds and rebuild the grid
+    void update(float dt);
+
+    // Whether any projectile touches rect, as of the last update(). With a mask stretched over rect, projectiles
+    // touching the rectangle only count when their bounding square covers a solid cell of it.
+    bool overlaps(Rectangle rect, const Collision::Mask *mask = nullptr) const;
+
+    std::size_t activeCount() const;
+    std::size_t capacity() const;
+    float radius() const;
+
+    // Slots [0, slotCount()) may hold projectiles, check active() before using one
+    std::size_t slotCount() const;
+    bool active(std::size_t slot) const;
+    Vector2 position(std::size_t slot) const;
+
+private:
+    std::size_t cellColumn(float x) const;
+    std::size_t cellRow(float y) const;
+    void rebuildGrid();
+
+    std::vector<float> m_x;
+    std::vector<float> m_y;
+    std::vector<float> m_velocityX;
+    std::vector<float> m_velocityY;
+    std::vector<std::uint8_t> m_active;
+
+    // Freed slots below m_highWater, reused before the pool grows into untouched slots
+    std::vector<Handle> m_free;
+    std::size_t m_highWater = 0;
+    std::size_t m_activeCount = 0;
+
+    float m_radius;
+    Rectangle m_bounds;
+    float m_inverseCellSize;
+    std::size_t m_columns;
+    std::size_t m_rows;
+
+    // Live slots sorted by cell: cell c holds m_cellSlots[m_cellStart[c]] up to m_cellSlots[m_cellStart[c + 1]]
+    std::vector<std::uint32_t> m_cellStart;
+    std::vector<Handle> m_cellSlots;
+    std::vector<std::uint32_t> m_slotCell;
+};
@@ -0,0 +1,56 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <vector>
+#include "AudioBackend.hpp"
+#include "MusicStreamer.hpp"
+
+// Plays through raylib's audio device. Owns the device for its whole lifetime.
+class RaylibAudioBackend final : public AudioBackend {
+public:
+    // Initializes the audio device
+    RaylibAudioBackend();
+
+    // Closes the music stream and the audio device, every voice must have been destroyed already
+    ~RaylibAudioBackend() override;
+
+    RaylibAudioBackend(const RaylibAudioBackend&) = delete;
+    RaylibAudioBackend& operator=(const RaylibAudioBackend&) = delete;
+
+    bool createVoices(std::string_view key, const Wave &wave, std::span<VoiceHandle> voices) override;
+    void destroyVoices(std::span<const VoiceHandle> voices) override;
+
+    void play(VoiceHandle voice) override;
+    void stop(VoiceHandle voice) override;
+    void pause(VoiceHandle voice) override;
+    void resume(VoiceHandle voice) override;
+    bool isPlaying(VoiceHandle voice) const override;
+    void setVolume(VoiceHandle voice, float volume) override;
+    float duration(VoiceHandle voice) const override;
+
+    bool openMusic(const unsigned char *data, std::size_t size) override;
+    void closeMusic() override;
+    void playMusic() override;
+    void stopMusic() override;
+    void pauseMusic() override;
+    void resumeMusic() override;
+    void setMusicVolume(float volume) override;
+    void setMusicPitch(float pitch) override;
+    void updateMusic() override;
+    std::uint64_t musicUnderruns() const override;
+
+    void attachProcessor(VoiceHandle voice, AudioCallback processor) override;
+    void detachProcessor(VoiceHandle voice, AudioCallback processor) override;
+
+private:
+    VoiceHandle allocate(const Sound &sound);
+
+    // Indexed by handle - 1, destroyed voices go on the free list and their handle is reused
+    std::vector<Sound> sounds;
+    std::vector<VoiceHandle> freeHandles;
+
+    MusicStreamer music;
+};
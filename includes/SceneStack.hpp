@@ -0,0 +1,105 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <span>
+#include <vector>
+#include <raylib.h>
+#include "AssetIds.hpp"
+#include "TextureResourceManager.hpp"
+
+// One screen of the game, see SceneStack
+class Scene {
+public:
+    virtual ~Scene() = default;
+
+    // Pushed onto the stack, after its textures were uploaded
+    virtual void enter() {}
+    // Popped off the stack
+    virtual void exit() {}
+    // Another scene was pushed on top of this one
+    virtual void pause() {}
+    // The scene on top of this one was popped
+    virtual void resume() {}
+
+    // Only the scene on top is updated, the ones below it are frozen
+    virtual void update() {}
+    virtual void draw() = 0;
+
+    // Textures the scene draws, uploaded before it is entered so its first frame doesn't stall on them
+    virtual std::span<const TextureId> textures() const { return {}; }
+
+    // An overlay is drawn over the scenes below it instead of replacing them. Those are frozen, so they are drawn
+    // once into a render texture and every frame after that only the cached frame and the overlay are drawn.
+    virtual bool overlay() const { return false; }
+};
+
+// The screens of the game as a stack, the top scene is the one updated and drawn.
+// Changes requested with push(), pop(), replace() and clear() wait for the start of the next update(), so scenes
+// can request them from their own hooks. A pushed scene first has its textures uploaded a few at a time within
+// Config::scenePreloadBudgetMs per frame, with a loading screen drawn until they are all resident. Changes
+// requested after it wait for it.
+class SceneStack {
+public:
+    SceneStack(TextureResourceManager &textureManager, Color clearColor);
+    ~SceneStack();
+
+    SceneStack(const SceneStack &) = delete;
+    SceneStack &operator=(const SceneStack &) = delete;
+
+    void push(std::unique_ptr<Scene> scene);
+    void pop();
+    // Pops the top scene and pushes scene in its place
+    void replace(std::unique_ptr<Scene> scene);
+    // Pops every scene
+    void clear();
+
+    // Apply the requested changes, keep loading and update the top scene
+    void update();
+    // Call between BeginDrawing() and EndDrawing()
+    void draw();
+
+    // Nothing on the stack and nothing waiting to be pushed, time to quit
+    bool empty() const;
+
+private:
+    enum class ChangeKind {
+        Push,
+        Pop,
+        Clear
+    };
+
+    struct Change {
+        ChangeKind kind;
+        std::unique_ptr<Scene> scene;
+    };
+
+    void applyChanges();
+    void enterScene(std::unique_ptr<Scene> scene);
+    void exitScene();
+
+    // Upload some of the loading scene's textures, true once all of them are resident
+    bool preload();
+    void drawLoadingScreen() const;
+
+    // Draw every scene under the top overlay into m_frozenFrame
+    void captureFrozenFrame();
+
+    TextureResourceManager &textureManager;
+    Color clearColor;
+
+    std::vector<std::unique_ptr<Scene>> m_scenes;
+    std::deque<Change> m_changes;
+
+    // Waiting for its textures before it is pushed
+    std::unique_ptr<Scene> m_loading;
+    std::size_t m_loadedTextures = 0;
+
+    // The scenes under the top overlay as they were when it was pushed, recaptured whenever the stack changes
+    RenderTexture2D m_frozenFrame{};
+    bool m_frozenFrameValid = false;
+};
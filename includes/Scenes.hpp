@@ -0,0 +1,90 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include "Game.hpp"
+#include "SceneStack.hpp"
+
+// The game's screens on the SceneStack. Game still runs and draws each of them and reports where the player wants
+// to go next through GameState::activity_state, the scenes turn that into stack changes. Each scene sets the
+// activity back to its own when it is entered or uncovered.
+
+class MenuScene final : public Scene {
+public:
+    MenuScene(Game &game, GameState &game_state, SceneStack &scenes);
+
+    void enter() override;
+    void resume() override;
+    void draw() override;
+
+private:
+    Game &game;
+    GameState &game_state;
+    SceneStack &scenes;
+};
+
+// The play field. Frozen while the pause menu is on top of it.
+class PlayScene final : public Scene {
+public:
+    PlayScene(Game &game, GameState &game_state, SceneStack &scenes);
+
+    void enter() override;
+    void pause() override;
+    void resume() override;
+    void update() override;
+    void draw() override;
+    std::span<const TextureId> textures() const override;
+
+private:
+    Game &game;
+    GameState &game_state;
+    SceneStack &scenes;
+};
+
+// Drawn over the frozen play field. While it is on top raylib waits for input events instead of drawing at the
+// target frame rate, so a paused game costs next to nothing.
+class PauseScene final : public Scene {
+public:
+    PauseScene(Game &game, GameState &game_state, SceneStack &scenes);
+
+    void enter() override;
+    void exit() override;
+    void pause() override;
+    void resume() override;
+    void draw() override;
+    bool overlay() const override;
+
+private:
+    Game &game;
+    GameState &game_state;
+    SceneStack &scenes;
+};
+
+class GameOverScene final : public Scene {
+public:
+    GameOverScene(Game &game, GameState &game_state, SceneStack &scenes);
+
+    void enter() override;
+    void draw() override;
+
+private:
+    Game &game;
+    GameState &game_state;
+    SceneStack &scenes;
+};
+
+// Pushed over the menu or the pause menu, Back pops it
+class SettingsScene final : public Scene {
+public:
+    SettingsScene(Game &game, GameState &game_state, SceneStack &scenes);
+
+    void enter() override;
+    void draw() override;
+
+private:
+    Game &game;
+    GameState &game_state;
+    SceneStack &scenes;
+};
@@ -0,0 +1,20 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <string>
+
+// Player adjustable options, persisted as "key=value" lines in Config::settingsPath.
+// Unknown keys are ignored and missing keys keep their defaults, so old settings files keep working.
+struct Settings {
+    float masterVolume = 1.0f;
+    float sfxVolume = 1.0f;
+    float musicVolume = 0.6f;
+    float uiVolume = 1.0f;
+    bool muted = false;
+
+    static Settings load(const std::string &path);
+    bool save(const std::string &path) const;
+};
@@ -0,0 +1,166 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <raylib.h>
+#include "Collision.hpp"
+#include "PipeRing.hpp"
+#include "constants.hpp"
+
+class DifficultyCurve;
+
+// Things that happened during one Simulation::step(), combined as bit flags
+enum SimEvent : std::uint32_t {
+    SimEventNone = 0,
+    SimEventJumped = 1 << 0,
+    SimEventScored = 1 << 1,
+    SimEventHitFloor = 1 << 2,
+    SimEventHitBoundary = 1 << 3,
+    SimEventHitPipe = 1 << 4,
+
+    SimEventDied = SimEventHitFloor | SimEventHitBoundary | SimEventHitPipe
+};
+
+// Sizes and defaults of the game's physics, shared by every BasicSimulation
+struct SimulationConstants {
+    static constexpr float playerWidth = 70.0f;
+    static constexpr float playerHeight = 70.0f;
+    static constexpr float pipeWidth = 80.0f;
+    static constexpr float pipeGap = 150.0f;                                        // Default gap
+    static constexpr float maxPipeGap = 300.0f;
+    static constexpr float pipeSpacing = Config::WindowWidth + pipeWidth;           // Default spacing, one pair on screen
+    // A pipe and room for the player between it and the next one
+    static constexpr float minPipeSpacing = pipeWidth + playerWidth;
+    static constexpr float pipeSpeed = 200.0f;                                      // Default speed
+    static constexpr float gravity = 400.0f;        // pixels per second ^ 2
+    static constexpr float jumpHeight = -250.0f;
+};
+
+// Everything that gets harder as the score rises, see DifficultyCurve
+struct DifficultyLevel {
+    float pipeSpeed = SimulationConstants::pipeSpeed;
+    float pipeGap = SimulationConstants::pipeGap;
+    float pipeSpacing = SimulationConstants::pipeSpacing;
+    float gravity = SimulationConstants::gravity;
+    float projectileRate = 1.0f;        // Multiplies the game's projectile spawn rate
+    float musicPitch = 1.0f;
+    float night = 0.0f;                 // 0 is the day sky, 1 the night sky, in between a mix
+};
+
+// The game's physics without any rendering, audio, input or wall clock.
+// It advances in fixed steps of Config::simulationStep and draws pipe gaps from its own seeded generator,
+// so the same seed and the same jump inputs always produce the same run. It is a plain value: copying it
+// snapshots the whole game, which is what the trainer and the bots use to evaluate or look ahead.
+// MaxPipePairs is the capacity of its pipe ring, the game uses the Simulation alias below.
+template <std::size_t MaxPipePairs>
+class BasicSimulation : public SimulationConstants {
+public:
+    explicit BasicSimulation(std::uint64_t seed = 0);
+
+    void reset(std::uint64_t seed);
+
+    // Advance by one fixed step, jumping first if jump is set. Returns the SimEvent flags raised.
+    // Does nothing once the player is dead.
+    std::uint32_t step(bool jump);
+
+    bool isOver() const;
+    int score() const;
+    std::uint64_t ticks() const;
+
+    Vector2 playerPosition() const;
+    float playerSpeed() const;
+    Rectangle playerRect() const;
+
+    // The pipe pair the player has to fly through next, or the last one passed while no other is on screen
+    Rectangle topPipe() const;
+    Rectangle bottomPipe() const;
+
+    // Every pipe pair on screen, index 0 is the leftmost
+    std::size_t pipeCount() const;
+    Rectangle topPipe(std::size_t index) const;
+    Rectangle bottomPipe(std::size_t index) const;
+
+    // Horizontal distance between consecutive pipe pairs and the gap of pairs spawned from now on.
+    // Spacing is clamped to minPipeSpacing so pipes never overlap, the gap to what the player fits through and the
+    // screen can hold.
+    void setPipeSpacing(float spacing);
+    void setPipeGap(float gap);
+
+    // How fast the pipes scroll left, in pixels per second. Collisions are swept over each step, so any speed
+    // is safe at the fixed step.
+    void setPipeSpeed(float speed);
+    float pipeScrollSpeed() const;
+
+    // Vertical acceleration of the player in pixels per second ^ 2
+    void setGravity(float gravity);
+
+    // Let curve set pipe speed, gap, spacing and gravity from the score: on reset and whenever the score changes.
+    // Overrides the setters above at those points. nullptr (the default) leaves them alone.
+    // curve must outlive the simulation and every copy of it.
+    void setDifficulty(const DifficultyCurve *curve);
+
+    // The level curve gave at the current score, the default level without a curve. The rest of the game reads
+    // its own values from here instead of evaluating the curve again.
+    const DifficultyLevel &difficulty() const;
+
+    // The player's collision shape against pipes, stretched over playerRect(). nullptr (the default) collides with
+    // the whole rectangle. mask must outlive the simulation and every copy of it.
+    void setPlayerMask(const Collision::Mask *mask);
+
+    float floorY() const;
+
+    static constexpr std::size_t maxPipePairs = MaxPipePairs;
+
+    // Pairs from just off the left edge to the right edge at the minimum spacing, the ring must hold all of them
+    static constexpr std::size_t pipePairsOnScreen = static_cast<std::size_t>((Config::WindowWidth + pipeWidth) / minPipeSpacing) + 1;
+    static_assert(MaxPipePairs >= pipePairsOnScreen, "The pipe ring can't hold every pair on screen at the minimum spacing");
+
+private:
+    // Uniform float in [min, max) from a splitmix64 sequence, identical on every platform and standard library
+    float nextRandom(float min, float max);
+
+    // Add pairs at the right edge until the spacing is filled and drop the ones that left the screen
+    void recyclePipes();
+    void spawnPipe(float x, float gapTop);
+
+    // Apply m_difficulty at the current score
+    void applyDifficulty();
+
+    // Whether the player, moving by motion from start over this step, touches pipe at any point of it
+    bool sweepHitsPipe(Rectangle start, Vector2 motion, Rectangle pipe) const;
+
+    // The pair topPipe() and bottomPipe() describe
+    std::uint64_t focusPipe() const;
+
+    Vector2 m_playerPosition{};
+    float m_playerSpeed = 0.0f;
+
+    // Scoring and collision only look at pairs from m_nextPipe on, the first one not passed yet
+    PipeRing<maxPipePairs> m_pipes;
+    std::uint64_t m_nextPipe = 0;
+    float m_pipeSpacing = pipeSpacing;
+    float m_pipeGap = pipeGap;
+    float m_pipeSpeed = pipeSpeed;
+    float m_gravity = gravity;
+    const Collision::Mask *m_playerMask = nullptr;
+    const DifficultyCurve *m_difficulty = nullptr;
+    DifficultyLevel m_level;
+
+    int m_score = 0;
+    bool m_over = false;
+    std::uint64_t m_ticks = 0;
+    std::uint64_t m_rngState = 0;
+};
+
+// The game's simulation, pipes never overlap so a small ring holds every pair on screen
+using Simulation = BasicSimulation<8>;
+
+// The same physics over a much larger ring, for benchmarks checking that the capacity never changes a run
+using WideSimulation = BasicSimulation<1024>;
+
+extern template class BasicSimulation<8>;
+extern template class BasicSimulation<1024>;
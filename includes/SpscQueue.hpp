@@ -0,0 +1,61 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+
+// Fixed-capacity lock-free queue for exactly one producer thread and one consumer thread.
+// Used to hand commands from the game loop to the audio thread without locks or allocations.
+template <typename T, std::size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+public:
+    // Producer only. Returns false when the queue is full, the item is not enqueued.
+    bool tryPush(const T &item) {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_cachedHead == Capacity) {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if (tail - m_cachedHead == Capacity) {
+                return false;
+            }
+        }
+
+        m_items[tail & (Capacity - 1)] = item;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only
+    std::optional<T> tryPop() {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_cachedTail) {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            if (head == m_cachedTail) {
+                return std::nullopt;
+            }
+        }
+
+        T item = m_items[head & (Capacity - 1)];
+        m_head.store(head + 1, std::memory_order_release);
+        return item;
+    }
+
+private:
+    static constexpr std::size_t cacheLine = 64;
+
+    // Producer and consumer indices live on separate cache lines so the two threads don't false share.
+    // Each side also caches the other's index and only reloads it when the queue looks full/empty.
+    alignas(cacheLine) std::atomic<std::size_t> m_head = 0;
+    std::size_t m_cachedTail = 0;
+
+    alignas(cacheLine) std::atomic<std::size_t> m_tail = 0;
+    std::size_t m_cachedHead = 0;
+
+    alignas(cacheLine) std::array<T, Capacity> m_items{};
+};
@@ -0,0 +1,35 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <span>
+#include <raylib.h>
+#include "Collision.hpp"
+
+// Offline texture processing shared by the asset cooker and the debug hot reload path.
+namespace TexturePreprocess {
+    // Convert image to R8G8B8A8, premultiply its alpha and append a full box-filtered mip chain.
+    // The result uses raylib's mipmap layout (levels stored back to back) and must be freed with UnloadImage().
+    // Textures built this way have to be drawn with BLEND_ALPHA_PREMULTIPLY.
+    Image premultipliedMipChain(const Image &source);
+
+    // Collision::Mask of image: a cell is solid when at least half of the pixels it covers have alpha of
+    // alphaThreshold or more
+    Collision::Mask collisionMask(const Image &source, unsigned char alphaThreshold = 128);
+
+    // Bytes taken by all mip levels of an image or texture
+    std::size_t mipChainSize(int width, int height, int format, int mipmaps);
+
+    // Assets::parallaxAtlasParts stacked top to bottom in R8G8B8A8, parts[i] being the decoded image of part i.
+    // Each is resized to the atlas width and its height in the table. Not premultiplied yet, run the result through
+    // premultipliedMipChain(). Returns an image without data on failure, free it with UnloadImage() either way.
+    Image parallaxAtlas(std::span<const Image> parts);
+
+    // raylib's file loaders (LoadImage, LoadWave, ...) share static scratch buffers and aren't thread-safe.
+    // Every thread decoding through them holds this, the cooker's workers and the hot reload watcher alike.
+    std::mutex &decodeMutex();
+}
@@ -5,31 +5,84 @@
 #pragma once
 
 #include <raylib.h>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <vector>
+#include "AssetIds.hpp"
 #include "Logger.hpp"
+#include "constants.hpp"
+
+// Usage counters for the texture residency policy.
+// These are meant to be read when tuning Config::textureBudgetBytes for low-memory hardware.
+struct TextureResidencyStats {
+    std::size_t budgetBytes = 0;         // The VRAM budget textures are evicted against
+    std::size_t residentBytes = 0;       // Bytes currently uploaded to the GPU
+    std::size_t peakResidentBytes = 0;   // Highest residentBytes seen since startup
+    std::uint64_t hits = 0;              // getTexture() calls served by a resident texture
+    std::uint64_t uploads = 0;           // getTexture() calls that had to upload the texture
+    std::uint64_t evictions = 0;         // Textures unloaded to stay under the budget
+    std::uint64_t budgetOverruns = 0;    // Uploads that could not fit even after evicting
+};
 
 class TextureResourceManager {
 public:
     TextureResourceManager();
     ~TextureResourceManager();
 
+    // Register an embedded image. The texture is uploaded on the first getTexture() call.
+    // Throws if the image has no data, the cooker never embeds an empty texture.
+    void loadTextureFromHeader(TextureId id, const Image &image);
     void loadTextureFromHeader(const std::string &key, const Image &image);
     void loadTextureResources();
+    // Register a texture file on disk. The texture is loaded on the first getTexture() call.
+    // Unlike cooked textures these keep straight alpha and a single mip level.
     void addTexture(const std::string &key, const std::string &path);
-    Texture2D getTexture(const std::string &key) const;
+    // Returns the texture for id, uploading it (and evicting others) if it is not resident.
+    // This is the per-frame path, it is a plain index into the slot array.
+    Texture2D getTexture(TextureId id);
+    // Whether id is uploaded right now, getTexture() uploads it otherwise
+    bool isResident(TextureId id) const;
+    // String lookup for tools and textures added at runtime with addTexture().
+    Texture2D getTexture(const std::string &key);
     void unloadTexture(const std::string &key);
+    // Replace the source pixels of a texture, taking ownership of image.
+    // A resident texture is dropped and re-uploaded from the new pixels on its next getTexture() call.
+    void reloadTexture(TextureId id, const Image &image);
     void unloadAllTextures();
-    void buildTextureHeaders();
+
+    // Advance the frame counter used for LRU tracking. Call once per frame before drawing.
+    void beginFrame();
+
+    void setBudget(std::size_t budgetBytes);
+    const TextureResidencyStats &getStats() const;
+    void logStats() const;
 
 private:
-    std::unordered_map<std::string, Texture2D> textureResources;
-    std::unordered_map<std::string, std::string> predefinedTextures = {
-            {"floor", "../resources/textures/base.png"},
-            {"background-day", "../resources/textures/background_day.png"},
-            {"background-night", "../resources/textures/background_night.png"},
-            {"pipe-green", "../resources/textures/pipe_green.png"},
-            {"pipe-red", "../resources/textures/pipe_red.png"},
-            {"player", "../resources/textures/player.png"},{}
+    struct TextureEntry {
+        std::string key;
+        bool registered = false;
+        Image source{};                  // Embedded pixels, data is nullptr for textures on disk
+        bool ownsSource = false;         // True once a hot reload replaced the embedded pixels
+        std::string path;                // Source file for textures registered with addTexture()
+        Texture2D texture{};             // GPU texture, id == 0 while not resident
+        std::size_t byteSize = 0;        // VRAM footprint of the texture when resident
+        std::uint64_t lastUsedFrame = 0;
+        std::uint32_t uploadCount = 0;
+        std::uint32_t evictionCount = 0;
     };
+
+    Texture2D acquireTexture(TextureEntry &entry);
+    TextureEntry &slotForKey(const std::string &key);
+    void makeResident(TextureEntry &entry);
+    void evictUntilFits(std::size_t incomingBytes, const TextureEntry *keep);
+    void evict(TextureEntry &entry);
+    void release(TextureEntry &entry);
+
+    // The first TextureId::Count slots belong to the predefined assets, addTexture() appends after them.
+    std::vector<TextureEntry> textureSlots;
+    std::unordered_map<std::string, std::size_t> slotIndices;
+    std::uint64_t currentFrame = 1;
+    TextureResidencyStats stats{ .budgetBytes = Config::textureBudgetBytes };
 };
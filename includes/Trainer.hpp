@@ -0,0 +1,61 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+#include "BotBrain.hpp"
+#include "JobSystem.hpp"
+
+struct TrainerOptions {
+    std::size_t population = 1024;
+    int evaluationRuns = 3;                         // Runs per genome, every genome sees the same pipe seeds
+    std::uint64_t maxTicks = 120ull * 120;          // Two minutes of game time per run
+    float eliteFraction = 0.1f;                     // Best genomes copied unchanged into the next generation
+    float mutationRate = 0.1f;                      // Chance for each weight to be perturbed
+    float mutationStrength = 0.3f;                  // Standard deviation of the perturbation
+    unsigned int threads = std::thread::hardware_concurrency();
+    std::uint64_t seed = 1;
+};
+
+// Neuroevolution of BotBrain genomes on headless Simulations.
+// Genomes are evaluated BotBrain::Batch::lanes at a time, each batch steps its birds in lockstep with batched
+// inference, and batches are spread over all cores by a JobSystem. Selection is elitism plus tournaments,
+// breeding is uniform crossover followed by gaussian mutation.
+class Trainer {
+public:
+    explicit Trainer(const TrainerOptions &options);
+
+    // Evaluate the current population and breed the next one from it
+    void runGeneration();
+
+    int generation() const;
+
+    // Best genome of the most recently evaluated generation
+    const BotBrain::Genome &best() const;
+    float meanFitness() const;
+    float bestAverageScore() const;
+
+private:
+    void evaluate(std::uint64_t generationSeed);
+    void evaluateBatch(std::size_t first, std::uint64_t generationSeed);
+    void breed();
+    const BotBrain::Genome &tournament();
+
+    TrainerOptions options;
+    JobSystem jobs;
+    std::vector<BotBrain::Genome> population;
+    std::vector<float> averageScores;
+
+    BotBrain::Genome bestGenome;
+    float bestScore = 0.0f;
+    float mean = 0.0f;
+
+    std::mt19937_64 rng;
+    int generationIndex = 0;
+};
@@ -3,6 +3,7 @@
 //
 #pragma once
 
+#include <cstddef>
 #include "raylib.h"
 
 namespace Config {
@@ -11,12 +12,62 @@ namespace Config {
     static constexpr int WindowHeight = 600;
     static constexpr auto WindowTitle = "FlappyBara";
 
-    // Enable audio file header building in development.
-    // Remember to disable this in release builds.
-    static constexpr bool buildAudioHeaders = false;
-    static constexpr bool buildTextureHeaders = false;
+    // The game physics always advance in steps of this many seconds, see Simulation.
+    // A frame longer than maxFrameTime only advances that far so a hitch can't trigger a catch-up spiral.
+    static constexpr float simulationStep = 1.0f / 120.0f;
+    static constexpr float maxFrameTime = 0.25f;
 
-    static constexpr bool disableAudio = false;
+    // The lookahead bot (attract mode, --soak) looks at least botLookaheadTicks steps ahead and always until it is
+    // past the next pipe. It tries up to botMaxFlaps flaps placed every botFlapResolutionTicks steps and never spends
+    // more than botBudgetMicros of a frame on it. After attractIdleSeconds on the menu without input it starts playing.
+    static constexpr int botLookaheadTicks = 120;
+    static constexpr int botMaxFlaps = 8;
+    static constexpr int botFlapResolutionTicks = 2;
+    static constexpr int botBudgetMicros = 1000;
+    static constexpr float attractIdleSeconds = 20.0f;
+
+    // Projectiles fly in from the right and end the run on contact. Normal play spawns projectilesPerSecond,
+    // --bullet-hell spawns bulletHellProjectilesPerSecond. The pool never holds more than maxProjectiles and files
+    // them into a grid of projectileCellSize pixel cells for the collision test against the player.
+    static constexpr float projectilesPerSecond = 0.5f;
+    static constexpr float bulletHellProjectilesPerSecond = 120.0f;
+    static constexpr std::size_t maxProjectiles = 8192;
+    static constexpr float projectileRadius = 6.0f;
+    static constexpr float projectileCellSize = 64.0f;
+
+    // Volumes and mute live in the player's settings file, see Settings
+    static constexpr auto settingsPath = "../settings.cfg";
+
+    // How speed, gaps, spacing, gravity, projectiles, music pitch and the sky follow the score, see DifficultyCurve
+    static constexpr auto difficultyPath = "../difficulty.cfg";
+
+    // Seconds the sky takes to fade all the way between day and night when the difficulty's night value changes
+    static constexpr float nightFadeSeconds = 3.0f;
+
+    // How quickly mixer bus gains follow volume changes, and how far the music dips under the game over sting
+    static constexpr float busGainSmoothingMs = 30.0f;
+    static constexpr float musicDuckGain = 0.3f;
+
+    // Voices per sound effect (the first owns the samples, the rest are aliases sharing them),
+    // the cap on voices playing at once across all sounds, and how many playRawAudio() sounds stay cached.
+    static constexpr int voicesPerSound = 4;
+    static constexpr int maxActiveVoices = 12;
+    static constexpr std::size_t maxCachedRawSounds = 8;
+
+    // How often the audio thread drains its command queue and refills the music stream
+    static constexpr int audioUpdateIntervalMs = 5;
+
+    // Background music is decoded ahead into this many chunks of this many frames each.
+    // Larger chunks ride out longer stalls of the audio thread at the cost of memory and start latency.
+    static constexpr int musicChunkFrames = 4096;
+    static constexpr int musicDecodeBuffers = 3;
+
+    // Textures are uploaded on first use and evicted least-recently-used once this many bytes are resident.
+    // Lower this on low-memory hardware, TextureResourceManager::logStats() reports how often it is hit.
+    static constexpr std::size_t textureBudgetBytes = 64 * 1024 * 1024;
+
+    // Texture uploads a scene waiting to be pushed gets per frame, the loading screen stays responsive meanwhile
+    static constexpr float scenePreloadBudgetMs = 4.0f;
 
     static constexpr bool disableFileLogging = false;
     static constexpr bool disableConsoleLogging = false;
@@ -5,7 +5,13 @@
 #pragma once
 
 #include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
 #include "raylib.h"
 
 #include "constants.hpp"
-#include "Game.hpp"
\ No newline at end of file
+#include "AssetWatcher.hpp"
+#include "Game.hpp"
+#include "SceneStack.hpp"
+#include "Scenes.hpp"
\ No newline at end of file
@@ -1,1579 +0,0 @@
-
-//////////////////////////////////////////////////////////////////////////////////
-//                                                                              //
-// WaveAsCode exporter v1.1 - Wave data exported as an array of bytes           //
-//                                                                              //
-// more info and bugs-report:  github.com/raysan5/raylib                        //
-// feedback and support:       ray[at]raylib.com                                //
-//                                                                              //
-// Copyright (c) 2018-2024 Ramon Santamaria (@raysan5)                          //
-//                                                                              //
-//////////////////////////////////////////////////////////////////////////////////
-
-// Wave data information
-#define SPRING_AUDIO_FRAME_COUNT      15609
-#define SPRING_AUDIO_SAMPLE_RATE      22050
-#define SPRING_AUDIO_SAMPLE_SIZE      16
-#define SPRING_AUDIO_CHANNELS         1
-
-static unsigned char SPRING_AUDIO_DATA[31218] = { 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x4, 0x0, 0x6, 0x0, 0x8, 0x0, 0xa, 0x0, 0xc, 0x0, 0xe, 0x0, 0x10, 0x0,
-    0x12, 0x0, 0x14, 0x0, 0x13, 0x0, 0xf1, 0xff, 0xe1, 0xff, 0xe3, 0xff, 0xe0, 0xff, 0xde, 0xff, 0xdc, 0xff, 0xda, 0xff,
-    0xd8, 0xff, 0xd6, 0xff, 0xd4, 0xff, 0xd2, 0xff, 0xd0, 0xff, 0xce, 0xff, 0xcc, 0xff, 0xca, 0xff, 0xc8, 0xff, 0xc6, 0xff,
-    0xc4, 0xff, 0xc2, 0xff, 0xc0, 0xff, 0xbe, 0xff, 0xbc, 0xff, 0xba, 0xff, 0xb8, 0xff, 0xb6, 0xff, 0xb4, 0xff, 0xb2, 0xff,
-    0xb0, 0xff, 0xae, 0xff, 0xeb, 0xff, 0x6b, 0x0, 0x4e, 0x0, 0x5d, 0x0, 0x5a, 0x0, 0x5e, 0x0, 0x5f, 0x0, 0x61, 0x0,
-    0x63, 0x0, 0x65, 0x0, 0x67, 0x0, 0x5f, 0x0, 0xce, 0xff, 0x7b, 0xff, 0x9a, 0xff, 0x88, 0xff, 0x8d, 0xff, 0x88, 0xff,
-    0x88, 0xff, 0x85, 0xff, 0x83, 0xff, 0x81, 0xff, 0x7f, 0xff, 0x7d, 0xff, 0x7b, 0xff, 0x79, 0xff, 0x77, 0xff, 0x75, 0xff,
-    0x73, 0xff, 0x71, 0xff, 0x6f, 0xff, 0x6d, 0xff, 0x6b, 0xff, 0x69, 0xff, 0x67, 0xff, 0x65, 0xff, 0x63, 0xff, 0x61, 0xff,
-    0x61, 0xff, 0x5e, 0xff, 0x5c, 0xff, 0xf7, 0xff, 0xe3, 0x0, 0x90, 0x0, 0xb8, 0x0, 0xa9, 0x0, 0xb3, 0x0, 0xb1, 0x0,
-    0xb5, 0x0, 0xb6, 0x0, 0xb8, 0x0, 0xba, 0x0, 0x9d, 0x0, 0x5f, 0xff, 0x2f, 0xff, 0x45, 0xff, 0x37, 0xff, 0x3b, 0xff,
-    0x36, 0xff, 0x36, 0xff, 0x33, 0xff, 0x31, 0xff, 0x2f, 0xff, 0x2d, 0xff, 0x2b, 0xff, 0x29, 0xff, 0x27, 0xff, 0x25, 0xff,
-    0x23, 0xff, 0x21, 0xff, 0x1f, 0xff, 0x1d, 0xff, 0x1b, 0xff, 0x1a, 0xff, 0x18, 0xff, 0x16, 0xff, 0x14, 0xff, 0x12, 0xff,
-    0x10, 0xff, 0xe, 0xff, 0xc, 0xff, 0x33, 0xff, 0xd3, 0x0, 0x11, 0x1, 0xf4, 0x0, 0x5, 0x1, 0x0, 0x1, 0x5, 0x1,
-    0x6, 0x1, 0x8, 0x1, 0xa, 0x1, 0xc, 0x1, 0xe, 0x1, 0x10, 0x0, 0x8e, 0xfe, 0x18, 0xff, 0xd8, 0xfe, 0xf2, 0xfe,
-    0xe3, 0xfe, 0xe7, 0xfe, 0xe2, 0xfe, 0xe2, 0xfe, 0xe0, 0xfe, 0xde, 0xfe, 0xdc, 0xfe, 0xda, 0xfe, 0xd8, 0xfe, 0xd6, 0xfe,
-    0xd4, 0xfe, 0xd2, 0xfe, 0xd0, 0xfe, 0xce, 0xfe, 0xcc, 0xfe, 0xca, 0xfe, 0xc8, 0xfe, 0xc6, 0xfe, 0xc4, 0xfe, 0xc2, 0xfe,
-    0xc0, 0xfe, 0xbe, 0xfe, 0xbc, 0xfe, 0xd2, 0xfe, 0x70, 0x0, 0x9f, 0x1, 0x2e, 0x1, 0x63, 0x1, 0x4e, 0x1, 0x5a, 0x1,
-    0x58, 0x1, 0x5c, 0x1, 0x5d, 0x1, 0x5f, 0x1, 0x61, 0x1, 0x7b, 0x0, 0x54, 0xfe, 0xbc, 0xfe, 0x90, 0xfe, 0x9f, 0xfe,
-    0x96, 0xfe, 0x97, 0xfe, 0x94, 0xfe, 0x92, 0xfe, 0x90, 0xfe, 0x8e, 0xfe, 0x8c, 0xfe, 0x8a, 0xfe, 0x88, 0xfe, 0x88, 0xfe,
-    0x85, 0xfe, 0x83, 0xfe, 0x81, 0xfe, 0x7f, 0xfe, 0x7d, 0xfe, 0x7b, 0xfe, 0x79, 0xfe, 0x77, 0xfe, 0x75, 0xfe, 0x73, 0xfe,
-    0x71, 0xfe, 0x6f, 0xfe, 0x6d, 0xfe, 0x92, 0xfe, 0xc1, 0x0, 0xf5, 0x1, 0x7f, 0x1, 0xb7, 0x1, 0xa1, 0x1, 0xad, 0x1,
-    0xab, 0x1, 0xaf, 0x1, 0xb0, 0x1, 0xb2, 0x1, 0xb4, 0x1, 0x1e, 0x0, 0xb5, 0xfd, 0x93, 0xfe, 0x2f, 0xfe, 0x58, 0xfe,
-    0x43, 0xfe, 0x4a, 0xfe, 0x44, 0xfe, 0x44, 0xfe, 0x41, 0xfe, 0x40, 0xfe, 0x3e, 0xfe, 0x3c, 0xfe, 0x3a, 0xfe, 0x38, 0xfe,
-    0x36, 0xfe, 0x34, 0xfe, 0x32, 0xfe, 0x30, 0xfe, 0x2e, 0xfe, 0x2c, 0xfe, 0x2a, 0xfe, 0x28, 0xfe, 0x28, 0xfe, 0x25, 0xfe,
-    0x23, 0xfe, 0x21, 0xfe, 0x1f, 0xfe, 0xd6, 0xfe, 0x16, 0x2, 0xf2, 0x1, 0xf8, 0x1, 0xf9, 0x1, 0xfb, 0x1, 0xfd, 0x1,
-    0xff, 0x1, 0x1, 0x2, 0x3, 0x2, 0x5, 0x2, 0xb3, 0x1, 0x53, 0xfe, 0xd8, 0xfd, 0x14, 0xfe, 0xf6, 0xfd, 0x1, 0xfe,
-    0xf9, 0xfd, 0xfa, 0xfd, 0xf7, 0xfd, 0xf5, 0xfd, 0xf3, 0xfd, 0xf1, 0xfd, 0xef, 0xfd, 0xed, 0xfd, 0xeb, 0xfd, 0xea, 0xfd,
-    0xe8, 0xfd, 0xe6, 0xfd, 0xe4, 0xfd, 0xe2, 0xfd, 0xe0, 0xfd, 0xde, 0xfd, 0xdc, 0xfd, 0xda, 0xfd, 0xd8, 0xfd, 0xd7, 0xfd,
-    0xd5, 0xfd, 0xd3, 0xfd, 0x14, 0xfe, 0x59, 0x1, 0xa4, 0x2, 0x20, 0x2, 0x5d, 0x2, 0x45, 0x2, 0x53, 0x2, 0x50, 0x2,
-    0x54, 0x2, 0x55, 0x2, 0x57, 0x2, 0x2e, 0x2, 0x47, 0xff, 0x26, 0xfd, 0xf3, 0xfd, 0x96, 0xfd, 0xbd, 0xfd, 0xaa, 0xfd,
-    0xaf, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xa7, 0xfd, 0xa5, 0xfd, 0xa3, 0xfd, 0xa1, 0xfd, 0x9f, 0xfd, 0x9f, 0xfd, 0x9c, 0xfd,
-    0x9a, 0xfd, 0x98, 0xfd, 0x96, 0xfd, 0x94, 0xfd, 0x92, 0xfd, 0x90, 0xfd, 0x8f, 0xfd, 0x8d, 0xfd, 0x8b, 0xfd, 0x89, 0xfd,
-    0x87, 0xfd, 0xd1, 0xfd, 0x8b, 0x1, 0x3, 0x3, 0x6c, 0x2, 0xb2, 0x2, 0x96, 0x2, 0xa5, 0x2, 0xa2, 0x2, 0xa6, 0x2,
-    0xa7, 0x2, 0xa8, 0x2, 0x5c, 0x2, 0x82, 0xfe, 0xfc, 0xfc, 0x9a, 0xfd, 0x51, 0xfd, 0x6f, 0xfd, 0x5f, 0xfd, 0x63, 0xfd,
-    0x5e, 0xfd, 0x5e, 0xfd, 0x5b, 0xfd, 0x5a, 0xfd, 0x58, 0xfd, 0x56, 0xfd, 0x54, 0xfd, 0x52, 0xfd, 0x50, 0xfd, 0x4e, 0xfd,
-    0x4c, 0xfd, 0x4c, 0xfd, 0x49, 0xfd, 0x47, 0xfd, 0x45, 0xfd, 0x43, 0xfd, 0x41, 0xfd, 0x3f, 0xfd, 0x3e, 0xfd, 0x3c, 0xfd,
-    0x4c, 0xfe, 0x1d, 0x3, 0xe7, 0x2, 0xee, 0x2, 0xef, 0x2, 0xf1, 0x2, 0xf3, 0x2, 0xf5, 0x2, 0xf7, 0x2, 0xf9, 0x2,
-    0xfb, 0x2, 0x9d, 0x1, 0xc7, 0xfc, 0x37, 0xfd, 0x14, 0xfd, 0x1f, 0xfd, 0x18, 0xfd, 0x19, 0xfd, 0x16, 0xfd, 0x14, 0xfd,
-    0x12, 0xfd, 0x10, 0xfd, 0xe, 0xfd, 0xc, 0xfd, 0xc, 0xfd, 0x9, 0xfd, 0x7, 0xfd, 0x5, 0xfd, 0x3, 0xfd, 0x1, 0xfd,
-    0x0, 0xfd, 0xfe, 0xfc, 0xfc, 0xfc, 0xfa, 0xfc, 0xf8, 0xfc, 0xf6, 0xfc, 0xf4, 0xfc, 0xf4, 0xfc, 0x3c, 0xfd, 0x86, 0x1,
-    0xdf, 0x3, 0xf6, 0x2, 0x60, 0x3, 0x34, 0x3, 0x4b, 0x3, 0x43, 0x3, 0x4a, 0x3, 0x49, 0x3, 0x4d, 0x3, 0xd8, 0x2,
-    0xc3, 0xfd, 0x70, 0xfc, 0x2, 0xfd, 0xbe, 0xfc, 0xd9, 0xfc, 0xcb, 0xfc, 0xcf, 0xfc, 0xca, 0xfc, 0xca, 0xfc, 0xc7, 0xfc,
-    0xc5, 0xfc, 0xc4, 0xfc, 0xc2, 0xfc, 0xc0, 0xfc, 0xbe, 0xfc, 0xbc, 0xfc, 0xba, 0xfc, 0xb9, 0xfc, 0xb7, 0xfc, 0xb5, 0xfc,
-    0xb3, 0xfc, 0xb1, 0xfc, 0xaf, 0xfc, 0xae, 0xfc, 0xac, 0xfc, 0xaa, 0xfc, 0xd2, 0xfc, 0xc8, 0x0, 0x86, 0x4, 0x22, 0x3,
-    0xc2, 0x3, 0x7d, 0x3, 0x9f, 0x3, 0x93, 0x3, 0x9b, 0x3, 0x9a, 0x3, 0x9e, 0x3, 0x1f, 0x3, 0x8f, 0xfd, 0x1e, 0xfc,
-    0xbd, 0xfc, 0x74, 0xfc, 0x92, 0xfc, 0x82, 0xfc, 0x86, 0xfc, 0x81, 0xfc, 0x81, 0xfc, 0x7f, 0xfc, 0x7d, 0xfc, 0x7b, 0xfc,
-    0x79, 0xfc, 0x77, 0xfc, 0x76, 0xfc, 0x74, 0xfc, 0x72, 0xfc, 0x70, 0xfc, 0x6e, 0xfc, 0x6c, 0xfc, 0x6c, 0xfc, 0x69, 0xfc,
-    0x67, 0xfc, 0x65, 0xfc, 0x63, 0xfc, 0x62, 0xfc, 0xd1, 0xfc, 0x51, 0x2, 0x7b, 0x4, 0x9b, 0x3, 0x1, 0x4, 0xd6, 0x3,
-    0xed, 0x3, 0xe5, 0x3, 0xec, 0x3, 0xeb, 0x3, 0xef, 0x3, 0x7f, 0x2, 0x1, 0xfc, 0x4b, 0xfc, 0x42, 0xfc, 0x42, 0xfc,
-    0x40, 0xfc, 0x3e, 0xfc, 0x3c, 0xfc, 0x3a, 0xfc, 0x38, 0xfc, 0x36, 0xfc, 0x36, 0xfc, 0x33, 0xfc, 0x31, 0xfc, 0x2f, 0xfc,
-    0x2d, 0xfc, 0x2d, 0xfc, 0x2a, 0xfc, 0x28, 0xfc, 0x26, 0xfc, 0x24, 0xfc, 0x24, 0xfc, 0x21, 0xfc, 0x1f, 0xfc, 0x1d, 0xfc,
-    0x1b, 0xfc, 0x1b, 0xfc, 0x5f, 0xfe, 0xdd, 0x4, 0xf5, 0x3, 0x4b, 0x4, 0x29, 0x4, 0x3b, 0x4, 0x36, 0x4, 0x3b, 0x4,
-    0x3c, 0x4, 0x3e, 0x4, 0xe, 0x4, 0x4f, 0xff, 0xd5, 0xfa, 0x7f, 0xfc, 0xc1, 0xfb, 0x13, 0xfc, 0xed, 0xfb, 0xfb, 0xfb,
-    0xf2, 0xfb, 0xf3, 0xfb, 0xf0, 0xfb, 0xf0, 0xfb, 0xed, 0xfb, 0xeb, 0xfb, 0xe9, 0xfb, 0xe8, 0xfb, 0xe6, 0xfb, 0xe4, 0xfb,
-    0xe2, 0xfb, 0xe0, 0xfb, 0xdf, 0xfb, 0xdd, 0xfb, 0xdb, 0xfb, 0xd9, 0xfb, 0xd7, 0xfb, 0xd7, 0xfb, 0xd4, 0xfb, 0xa3, 0xfc,
-    0x63, 0x4, 0xb1, 0x4, 0x6b, 0x4, 0x8f, 0x4, 0x81, 0x4, 0x8b, 0x4, 0x89, 0x4, 0x8d, 0x4, 0x8e, 0x4, 0x90, 0x4,
-    0xd4, 0x0, 0x57, 0xfa, 0x4c, 0xfc, 0x73, 0xfb, 0xd2, 0xfb, 0xa5, 0xfb, 0xb6, 0xfb, 0xab, 0xfb, 0xaf, 0xfb, 0xaa, 0xfb,
-    0xaa, 0xfb, 0xa7, 0xfb, 0xa5, 0xfb, 0xa5, 0xfb, 0xa2, 0xfb, 0xa0, 0xfb, 0x9e, 0xfb, 0x9e, 0xfb, 0x9b, 0xfb, 0x99, 0xfb,
-    0x97, 0xfb, 0x96, 0xfb, 0x94, 0xfb, 0x92, 0xfb, 0x90, 0xfb, 0x8f, 0xfb, 0x6c, 0xfc, 0xb2, 0x4, 0x5, 0x5, 0xb9, 0x4,
-    0xdf, 0x4, 0xd1, 0x4, 0xdb, 0x4, 0xd9, 0x4, 0xdd, 0x4, 0xde, 0x4, 0xc4, 0x4, 0xd7, 0xff, 0xf0, 0xf9, 0x1b, 0xfc,
-    0x25, 0xfb, 0x90, 0xfb, 0x5e, 0xfb, 0x72, 0xfb, 0x66, 0xfb, 0x68, 0xfb, 0x66, 0xfb, 0x64, 0xfb, 0x62, 0xfb, 0x60, 0xfb,
-    0x5f, 0xfb, 0x5d, 0xfb, 0x5b, 0xfb, 0x59, 0xfb, 0x58, 0xfb, 0x56, 0xfb, 0x54, 0xfb, 0x52, 0xfb, 0x50, 0xfb, 0x50, 0xfb,
-    0x4d, 0xfb, 0x4b, 0xfb, 0x4a, 0xfb, 0x85, 0xfe, 0x31, 0x6, 0xb9, 0x4, 0x50, 0x5, 0x11, 0x5, 0x30, 0x5, 0x25, 0x5,
-    0x2d, 0x5, 0x2b, 0x5, 0x2f, 0x5, 0x5d, 0x4, 0xf5, 0xfb, 0xc4, 0xfa, 0x5e, 0xfb, 0x15, 0xfb, 0x33, 0xfb, 0x24, 0xfb,
-    0x28, 0xfb, 0x23, 0xfb, 0x23, 0xfb, 0x21, 0xfb, 0x1f, 0xfb, 0x1d, 0xfb, 0x1b, 0xfb, 0x1b, 0xfb, 0x18, 0xfb, 0x16, 0xfb,
-    0x14, 0xfb, 0x14, 0xfb, 0x11, 0xfb, 0xf, 0xfb, 0xe, 0xfb, 0xc, 0xfb, 0xa, 0xfb, 0x8, 0xfb, 0x7, 0xfb, 0xc1, 0xfb,
-    0xf5, 0x3, 0x14, 0x6, 0x28, 0x5, 0x95, 0x5, 0x68, 0x5, 0x7f, 0x5, 0x76, 0x5, 0x7d, 0x5, 0x7c, 0x5, 0x60, 0x5,
-    0xd9, 0xff, 0x38, 0xf9, 0xa8, 0xfb, 0x94, 0xfa, 0xc, 0xfb, 0xd5, 0xfa, 0xea, 0xfa, 0xde, 0xfa, 0xe2, 0xfa, 0xdd, 0xfa,
-    0xdd, 0xfa, 0xda, 0xfa, 0xda, 0xfa, 0xd7, 0xfa, 0xd5, 0xfa, 0xd3, 0xfa, 0xd3, 0xfa, 0xd0, 0xfa, 0xce, 0xfa, 0xcd, 0xfa,
-    0xcb, 0xfa, 0xc9, 0xfa, 0xc7, 0xfa, 0xc7, 0xfa, 0xc4, 0xfa, 0x26, 0xfb, 0xd, 0x2, 0x14, 0x7, 0x2c, 0x5, 0x5, 0x6,
-    0xa8, 0x5, 0xd4, 0x5, 0xc3, 0x5, 0xcd, 0x5, 0xcb, 0x5, 0xcf, 0x5, 0x19, 0x1, 0xe9, 0xf8, 0x64, 0xfb, 0x53, 0xfa,
-    0xc9, 0xfa, 0x92, 0xfa, 0xa8, 0xfa, 0x9c, 0xfa, 0x9e, 0xfa, 0x9b, 0xfa, 0x9a, 0xfa, 0x98, 0xfa, 0x96, 0xfa, 0x94, 0xfa,
-    0x94, 0xfa, 0x91, 0xfa, 0x90, 0xfa, 0x8e, 0xfa, 0x8c, 0xfa, 0x8a, 0xfa, 0x89, 0xfa, 0x87, 0xfa, 0x85, 0xfa, 0x84, 0xfa,
-    0x82, 0xfa, 0xb, 0xfb, 0xec, 0x2, 0x3b, 0x7, 0x8c, 0x5, 0x4d, 0x6, 0xfa, 0x5, 0x22, 0x6, 0x13, 0x6, 0x1d, 0x6,
-    0x1b, 0x6, 0xfb, 0x5, 0xdc, 0xff, 0x84, 0xf8, 0x38, 0xfb, 0x6, 0xfa, 0x8c, 0xfa, 0x4d, 0xfa, 0x67, 0xfa, 0x59, 0xfa,
-    0x5d, 0xfa, 0x58, 0xfa, 0x58, 0xfa, 0x56, 0xfa, 0x54, 0xfa, 0x53, 0xfa, 0x51, 0xfa, 0x4f, 0xfa, 0x4d, 0xfa, 0x4c, 0xfa,
-    0x4a, 0xfa, 0x48, 0xfa, 0x47, 0xfa, 0x45, 0xfa, 0x43, 0xfa, 0x42, 0xfa, 0x40, 0xfa, 0xf4, 0xfb, 0x81, 0x6, 0x7b, 0x6,
-    0x51, 0x6, 0x69, 0x6, 0x61, 0x6, 0x68, 0x6, 0x66, 0x6, 0x6a, 0x6, 0x6b, 0x6, 0x6b, 0x5, 0x18, 0xfb, 0xa2, 0xf9,
-    0x5f, 0xfa, 0x7, 0xfa, 0x2c, 0xfa, 0x19, 0xfa, 0x1f, 0xfa, 0x1a, 0xfa, 0x1a, 0xfa, 0x17, 0xfa, 0x17, 0xfa, 0x14, 0xfa,
-    0x12, 0xfa, 0x11, 0xfa, 0xf, 0xfa, 0xd, 0xfa, 0xc, 0xfa, 0xa, 0xfa, 0x8, 0xfa, 0x7, 0xfa, 0x5, 0xfa, 0x3, 0xfa,
-    0x2, 0xfa, 0x0, 0xfa, 0x4a, 0xfa, 0x97, 0x1, 0x76, 0x8, 0xe6, 0x5, 0x9, 0x7, 0x8b, 0x6, 0xc5, 0x6, 0xad, 0x6,
-    0xbb, 0x6, 0xb8, 0x6, 0x6e, 0x6, 0xa, 0xff, 0x15, 0xf8, 0xae, 0xfa, 0x88, 0xf9, 0x8, 0xfa, 0xcc, 0xf9, 0xe5, 0xf9,
-    0xd8, 0xf9, 0xda, 0xf9, 0xd8, 0xf9, 0xd6, 0xf9, 0xd4, 0xf9, 0xd3, 0xf9, 0xd1, 0xf9, 0xcf, 0xf9, 0xce, 0xf9, 0xcc, 0xf9,
-    0xca, 0xf9, 0xc9, 0xf9, 0xc7, 0xf9, 0xc5, 0xf9, 0xc4, 0xf9, 0xc2, 0xf9, 0xc0, 0xf9, 0xbf, 0xf9, 0x56, 0xff, 0xe, 0x9,
-    0x1c, 0x6, 0x62, 0x7, 0xd4, 0x6, 0x16, 0x7, 0xfa, 0x6, 0x9, 0x7, 0x5, 0x7, 0xa, 0x7, 0xc0, 0x0, 0x38, 0xf7,
-    0xb3, 0xfa, 0x2a, 0xf9, 0xd6, 0xf9, 0x87, 0xf9, 0xa8, 0xf9, 0x97, 0xf9, 0x9c, 0xf9, 0x97, 0xf9, 0x97, 0xf9, 0x95, 0xf9,
-    0x93, 0xf9, 0x92, 0xf9, 0x90, 0xf9, 0x8e, 0xf9, 0x8d, 0xf9, 0x8b, 0xf9, 0x89, 0xf9, 0x88, 0xf9, 0x86, 0xf9, 0x85, 0xf9,
-    0x83, 0xf9, 0x81, 0xf9, 0x80, 0xf9, 0xf8, 0xff, 0xc9, 0x9, 0x34, 0x6, 0xc8, 0x7, 0x17, 0x7, 0x69, 0x7, 0x47, 0x7,
-    0x59, 0x7, 0x53, 0x7, 0x4, 0x7, 0xfd, 0xfe, 0x6e, 0xf7, 0x41, 0xfa, 0x1, 0xf9, 0x8d, 0xf9, 0x4d, 0xf9, 0x67, 0xf9,
-    0x58, 0xf9, 0x5d, 0xf9, 0x58, 0xf9, 0x58, 0xf9, 0x56, 0xf9, 0x54, 0xf9, 0x53, 0xf9, 0x51, 0xf9, 0x4f, 0xf9, 0x4e, 0xf9,
-    0x4c, 0xf9, 0x4a, 0xf9, 0x49, 0xf9, 0x47, 0xf9, 0x46, 0xf9, 0x44, 0xf9, 0x42, 0xf9, 0x18, 0xfa, 0x9f, 0x4, 0xc3, 0x8,
-    0x14, 0x7, 0xd6, 0x7, 0x83, 0x7, 0xa9, 0x7, 0x9b, 0x7, 0xa5, 0x7, 0xa3, 0x7, 0x4a, 0x6, 0x56, 0xf9, 0xd7, 0xf8,
-    0x4c, 0xf9, 0x13, 0xf9, 0x2a, 0xf9, 0x1e, 0xf9, 0x21, 0xf9, 0x1d, 0xf9, 0x1d, 0xf9, 0x1a, 0xf9, 0x19, 0xf9, 0x17, 0xf9,
-    0x15, 0xf9, 0x14, 0xf9, 0x12, 0xf9, 0x11, 0xf9, 0xf, 0xf9, 0xd, 0xf9, 0xc, 0xf9, 0xa, 0xf9, 0x9, 0xf9, 0x7, 0xf9,
-    0x5, 0xf9, 0x4, 0xf9, 0x9a, 0xfe, 0xde, 0x9, 0x1a, 0x7, 0x42, 0x8, 0xc1, 0x7, 0xfd, 0x7, 0xe5, 0x7, 0xf3, 0x7,
-    0xef, 0x7, 0x98, 0x7, 0xf1, 0xfe, 0xcb, 0xf6, 0xd6, 0xf9, 0x7e, 0xf8, 0x14, 0xf9, 0xcf, 0xf8, 0xec, 0xf8, 0xdc, 0xf8,
-    0xe1, 0xf8, 0xdc, 0xf8, 0xdd, 0xf8, 0xda, 0xf8, 0xd9, 0xf8, 0xd7, 0xf8, 0xd5, 0xf8, 0xd4, 0xf8, 0xd2, 0xf8, 0xd1, 0xf8,
-    0xcf, 0xf8, 0xcd, 0xf8, 0xcc, 0xf8, 0xca, 0xf8, 0xc9, 0xf8, 0xc7, 0xf8, 0xac, 0xfb, 0xc0, 0x8, 0x26, 0x8, 0x38, 0x8,
-    0x34, 0x8, 0x39, 0x8, 0x3a, 0x8, 0x3c, 0x8, 0x3e, 0x8, 0x3f, 0x8, 0xab, 0x1, 0x3b, 0xf6, 0xb5, 0xf9, 0x35, 0xf8,
-    0xdd, 0xf8, 0x90, 0xf8, 0xb0, 0xf8, 0xa0, 0xf8, 0xa4, 0xf8, 0xa0, 0xf8, 0xa0, 0xf8, 0x9d, 0xf8, 0x9d, 0xf8, 0x9a, 0xf8,
-    0x99, 0xf8, 0x97, 0xf8, 0x96, 0xf8, 0x94, 0xf8, 0x92, 0xf8, 0x91, 0xf8, 0x8f, 0xf8, 0x8e, 0xf8, 0x8c, 0xf8, 0x8b, 0xf8,
-    0x8a, 0xfb, 0x12, 0x9, 0x72, 0x8, 0x86, 0x8, 0x81, 0x8, 0x86, 0x8, 0x87, 0x8, 0x89, 0x8, 0x8b, 0x8, 0x8c, 0x8,
-    0xfd, 0x0, 0x87, 0xf5, 0xb4, 0xf9, 0xde, 0xf7, 0xac, 0xf8, 0x4f, 0xf8, 0x76, 0xf8, 0x62, 0xf8, 0x69, 0xf8, 0x63, 0xf8,
-    0x64, 0xf8, 0x61, 0xf8, 0x60, 0xf8, 0x5e, 0xf8, 0x5d, 0xf8, 0x5b, 0xf8, 0x59, 0xf8, 0x58, 0xf8, 0x56, 0xf8, 0x55, 0xf8,
-    0x53, 0xf8, 0x52, 0xf8, 0x50, 0xf8, 0x4e, 0xf8, 0x80, 0xfe, 0xfc, 0xa, 0xea, 0x7, 0x33, 0x9, 0xa5, 0x8, 0xe6, 0x8,
-    0xcb, 0x8, 0xda, 0x8, 0xd6, 0x8, 0xe1, 0x7, 0xa5, 0xfb, 0xda, 0xf6, 0xcd, 0xf8, 0xee, 0xf7, 0x4f, 0xf8, 0x21, 0xf8,
-    0x33, 0xf8, 0x29, 0xf8, 0x2c, 0xf8, 0x28, 0xf8, 0x28, 0xf8, 0x25, 0xf8, 0x24, 0xf8, 0x22, 0xf8, 0x21, 0xf8, 0x1f, 0xf8,
-    0x1e, 0xf8, 0x1c, 0xf8, 0x1a, 0xf8, 0x19, 0xf8, 0x17, 0xf8, 0x16, 0xf8, 0x14, 0xf8, 0x12, 0xf9, 0x94, 0x5, 0x7c, 0xa,
-    0x7e, 0x8, 0x62, 0x9, 0xff, 0x8, 0x2e, 0x9, 0x1c, 0x9, 0x26, 0x9, 0x24, 0x9, 0x82, 0x3, 0x1d, 0xf6, 0xae, 0xf8,
-    0xa9, 0xf7, 0x19, 0xf8, 0xe5, 0xf7, 0xfa, 0xf7, 0xee, 0xf7, 0xf2, 0xf7, 0xed, 0xf7, 0xee, 0xf7, 0xeb, 0xf7, 0xea, 0xf7,
-    0xe8, 0xf7, 0xe7, 0xf7, 0xe5, 0xf7, 0xe3, 0xf7, 0xe2, 0xf7, 0xe0, 0xf7, 0xdf, 0xf7, 0xdd, 0xf7, 0xdc, 0xf7, 0xda, 0xf7,
-    0xd9, 0xf7, 0x16, 0x0, 0x93, 0xc, 0x3, 0x8, 0x6, 0xa, 0x24, 0x9, 0x8b, 0x9, 0x5f, 0x9, 0x75, 0x9, 0x6f, 0x9,
-    0xf5, 0x6, 0x89, 0xf7, 0x96, 0xf7, 0xd3, 0xf7, 0xb3, 0xf7, 0xbf, 0xf7, 0xb7, 0xf7, 0xb8, 0xf7, 0xb6, 0xf7, 0xb4, 0xf7,
-    0xb3, 0xf7, 0xb1, 0xf7, 0xb0, 0xf7, 0xae, 0xf7, 0xad, 0xf7, 0xab, 0xf7, 0xaa, 0xf7, 0xa8, 0xf7, 0xa7, 0xf7, 0xa5, 0xf7,
-    0xa4, 0xf7, 0xa2, 0xf7, 0xa0, 0xf7, 0x9f, 0xf7, 0x68, 0xfe, 0x17, 0xc, 0xba, 0x8, 0x21, 0xa, 0x86, 0x9, 0xcd, 0x9,
-    0xaf, 0x9, 0xc0, 0x9, 0xbb, 0x9, 0x9, 0x8, 0xbf, 0xf7, 0x20, 0xf7, 0xb5, 0xf7, 0x6d, 0xf7, 0x8b, 0xf7, 0x7b, 0xf7,
-    0x80, 0xf7, 0x7b, 0xf7, 0x7c, 0xf7, 0x79, 0xf7, 0x78, 0xf7, 0x76, 0xf7, 0x75, 0xf7, 0x73, 0xf7, 0x72, 0xf7, 0x70, 0xf7,
-    0x6f, 0xf7, 0x6d, 0xf7, 0x6c, 0xf7, 0x6a, 0xf7, 0x69, 0xf7, 0x67, 0xf7, 0x66, 0xf7, 0x21, 0x0, 0x5a, 0xd, 0x87, 0x8,
-    0xa7, 0xa, 0xb8, 0x9, 0x24, 0xa, 0xf7, 0x9, 0xd, 0xa, 0x7, 0xa, 0xa5, 0x5, 0x2b, 0xf6, 0x99, 0xf7, 0x2b, 0xf7,
-    0x57, 0xf7, 0x41, 0xf7, 0x49, 0xf7, 0x43, 0xf7, 0x44, 0xf7, 0x41, 0xf7, 0x41, 0xf7, 0x3e, 0xf7, 0x3d, 0xf7, 0x3b, 0xf7,
-    0x3a, 0xf7, 0x38, 0xf7, 0x37, 0xf7, 0x35, 0xf7, 0x34, 0xf7, 0x32, 0xf7, 0x31, 0xf7, 0x2f, 0xf7, 0x2e, 0xf7, 0x4c, 0xf8,
-    0x56, 0x6, 0xd8, 0xb, 0x99, 0x9, 0x9b, 0xa, 0x2b, 0xa, 0x5f, 0xa, 0x4a, 0xa, 0x56, 0xa, 0x1a, 0xa, 0xb, 0x0,
-    0xfa, 0xf3, 0x6d, 0xf8, 0x78, 0xf6, 0x55, 0xf7, 0xef, 0xf6, 0x1b, 0xf7, 0x5, 0xf7, 0xd, 0xf7, 0x7, 0xf7, 0x8, 0xf7,
-    0x5, 0xf7, 0x4, 0xf7, 0x2, 0xf7, 0x1, 0xf7, 0xff, 0xf6, 0xfe, 0xf6, 0xfc, 0xf6, 0xfb, 0xf6, 0xf9, 0xf6, 0xf8, 0xf6,
-    0xf6, 0xf6, 0xf5, 0xf6, 0x53, 0xfe, 0x2e, 0xd, 0x88, 0x9, 0xd, 0xb, 0x63, 0xa, 0xb2, 0xa, 0x92, 0xa, 0xa2, 0xa,
-    0x9d, 0xa, 0xfe, 0x5, 0xab, 0xf5, 0x2c, 0xf7, 0xb9, 0xf6, 0xe7, 0xf6, 0xd1, 0xf6, 0xd8, 0xf6, 0xd3, 0xf6, 0xd3, 0xf6,
-    0xd1, 0xf6, 0xd0, 0xf6, 0xce, 0xf6, 0xcd, 0xf6, 0xcb, 0xf6, 0xca, 0xf6, 0xc8, 0xf6, 0xc7, 0xf6, 0xc5, 0xf6, 0xc4, 0xf6,
-    0xc2, 0xf6, 0xc1, 0xf6, 0xbf, 0xf6, 0xbe, 0xf6, 0x85, 0xfa, 0x99, 0xb, 0xcd, 0xa, 0xe6, 0xa, 0xe1, 0xa, 0xe5, 0xa,
-    0xe6, 0xa, 0xe8, 0xa, 0xea, 0xa, 0x3, 0x9, 0xe5, 0xf6, 0x33, 0xf6, 0xda, 0xf6, 0x89, 0xf6, 0xab, 0xf6, 0x9a, 0xf6,
-    0x9f, 0xf6, 0x9b, 0xf6, 0x9b, 0xf6, 0x98, 0xf6, 0x98, 0xf6, 0x96, 0xf6, 0x94, 0xf6, 0x93, 0xf6, 0x91, 0xf6, 0x90, 0xf6,
-    0x8e, 0xf6, 0x8d, 0xf6, 0x8b, 0xf6, 0x8a, 0xf6, 0x89, 0xf6, 0x87, 0xf6, 0x6e, 0xf9, 0x69, 0xb, 0x5a, 0xb, 0x13, 0xb,
-    0x38, 0xb, 0x2a, 0xb, 0x33, 0xb, 0x31, 0xb, 0x35, 0xb, 0x42, 0x9, 0xaf, 0xf6, 0xfa, 0xf5, 0xa4, 0xf6, 0x52, 0xf6,
-    0x74, 0xf6, 0x63, 0xf6, 0x68, 0xf6, 0x64, 0xf6, 0x64, 0xf6, 0x62, 0xf6, 0x60, 0xf6, 0x5f, 0xf6, 0x5e, 0xf6, 0x5c, 0xf6,
-    0x5b, 0xf6, 0x59, 0xf6, 0x58, 0xf6, 0x56, 0xf6, 0x55, 0xf6, 0x53, 0xf6, 0x52, 0xf6, 0x50, 0xf6, 0x46, 0xfb, 0xba, 0xc,
-    0x1f, 0xb, 0x9a, 0xb, 0x68, 0xb, 0x81, 0xb, 0x78, 0xb, 0x7f, 0xb, 0x7e, 0xb, 0x82, 0x6, 0xef, 0xf4, 0x8e, 0xf6,
-    0x12, 0xf6, 0x44, 0xf6, 0x2b, 0xf6, 0x35, 0xf6, 0x2f, 0xf6, 0x2f, 0xf6, 0x2d, 0xf6, 0x2b, 0xf6, 0x2a, 0xf6, 0x29, 0xf6,
-    0x27, 0xf6, 0x26, 0xf6, 0x24, 0xf6, 0x23, 0xf6, 0x21, 0xf6, 0x20, 0xf6, 0x1e, 0xf6, 0x1d, 0xf6, 0x1c, 0xf6, 0x5b, 0xf6,
-    0xab, 0x1, 0x3b, 0xf, 0x3b, 0xa, 0x6e, 0xc, 0x76, 0xb, 0xe7, 0xb, 0xb7, 0xb, 0xcf, 0xb, 0x44, 0xb, 0xbe, 0xfe,
-    0xee, 0xf2, 0x59, 0xf7, 0x66, 0xf5, 0x43, 0xf6, 0xdd, 0xf5, 0x9, 0xf6, 0xf3, 0xf5, 0xfb, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5,
-    0xf4, 0xf5, 0xf2, 0xf5, 0xf1, 0xf5, 0xf0, 0xf5, 0xee, 0xf5, 0xed, 0xf5, 0xeb, 0xf5, 0xea, 0xf5, 0xe8, 0xf5, 0xe7, 0xf5,
-    0xe5, 0xf5, 0xd, 0xfa, 0xd5, 0xc, 0xf6, 0xb, 0xf, 0xc, 0xa, 0xc, 0xf, 0xc, 0xf, 0xc, 0x11, 0xc, 0x13, 0xc,
-    0xcd, 0x5, 0xeb, 0xf3, 0x6f, 0xf6, 0x84, 0xf5, 0xe9, 0xf5, 0xba, 0xf5, 0xcc, 0xf5, 0xc3, 0xf5, 0xc4, 0xf5, 0xc2, 0xf5,
-    0xc1, 0xf5, 0xbf, 0xf5, 0xbe, 0xf5, 0xbc, 0xf5, 0xbb, 0xf5, 0xba, 0xf5, 0xb8, 0xf5, 0xb7, 0xf5, 0xb5, 0xf5, 0xb4, 0xf5,
-    0xb2, 0xf5, 0xb1, 0xf5, 0x48, 0xf7, 0x1c, 0x9, 0xb7, 0xd, 0xb4, 0xb, 0x9c, 0xc, 0x38, 0xc, 0x67, 0xc, 0x54, 0xc,
-    0x5f, 0xc, 0x27, 0x9, 0x53, 0xf5, 0x62, 0xf5, 0xb2, 0xf5, 0x89, 0xf5, 0x99, 0xf5, 0x90, 0xf5, 0x91, 0xf5, 0x8f, 0xf5,
-    0x8e, 0xf5, 0x8c, 0xf5, 0x8b, 0xf5, 0x8a, 0xf5, 0x88, 0xf5, 0x87, 0xf5, 0x85, 0xf5, 0x84, 0xf5, 0x83, 0xf5, 0x81, 0xf5,
-    0x80, 0xf5, 0x7e, 0xf5, 0x7d, 0xf5, 0xd7, 0xf6, 0xd5, 0x7, 0x7e, 0xe, 0xc8, 0xb, 0xfe, 0xc, 0x75, 0xc, 0xb5, 0xc,
-    0x9b, 0xc, 0xa9, 0xc, 0x76, 0xa, 0xad, 0xf5, 0xe2, 0xf4, 0xa0, 0xf5, 0x46, 0xf5, 0x6b, 0xf5, 0x59, 0xf5, 0x5f, 0xf5,
-    0x5a, 0xf5, 0x5b, 0xf5, 0x58, 0xf5, 0x57, 0xf5, 0x56, 0xf5, 0x54, 0xf5, 0x53, 0xf5, 0x51, 0xf5, 0x50, 0xf5, 0x4f, 0xf5,
-    0x4d, 0xf5, 0x4c, 0xf5, 0x4a, 0xf5, 0x49, 0xf5, 0x38, 0xf7, 0x13, 0xb, 0xe1, 0xd, 0x73, 0xc, 0x1c, 0xd, 0xd3, 0xc,
-    0xf5, 0xc, 0xe9, 0xc, 0xf1, 0xc, 0x5b, 0x7, 0xc2, 0xf3, 0x90, 0xf5, 0x6, 0xf5, 0x3f, 0xf5, 0x24, 0xf5, 0x2e, 0xf5,
-    0x27, 0xf5, 0x28, 0xf5, 0x26, 0xf5, 0x25, 0xf5, 0x23, 0xf5, 0x22, 0xf5, 0x20, 0xf5, 0x1f, 0xf5, 0x1e, 0xf5, 0x1c, 0xf5,
-    0x1b, 0xf5, 0x19, 0xf5, 0x18, 0xf5, 0x17, 0xf5, 0x15, 0xf5, 0xdf, 0xfb, 0x35, 0xf, 0x7f, 0xc, 0x7c, 0xd, 0xf, 0xd,
-    0x42, 0xd, 0x2e, 0xd, 0x39, 0xd, 0xee, 0xc, 0x45, 0x0, 0x15, 0xf1, 0xaf, 0xf6, 0x39, 0xf4, 0x50, 0xf5, 0xd1, 0xf4,
-    0x8, 0xf5, 0xee, 0xf4, 0xf7, 0xf4, 0xf1, 0xf4, 0xf2, 0xf4, 0xef, 0xf4, 0xef, 0xf4, 0xed, 0xf4, 0xeb, 0xf4, 0xea, 0xf4,
-    0xe9, 0xf4, 0xe7, 0xf4, 0xe6, 0xf4, 0xe5, 0xf4, 0xe3, 0xf4, 0xa, 0xf6, 0xca, 0x6, 0xf4, 0xf, 0x5f, 0xc, 0xf6, 0xd,
-    0x43, 0xd, 0x95, 0xd, 0x73, 0xd, 0x85, 0xd, 0xda, 0x8, 0xe7, 0xf3, 0xde, 0xf4, 0xc3, 0xf4, 0xca, 0xf4, 0xc5, 0xf4,
-    0xc5, 0xf4, 0xc3, 0xf4, 0xc2, 0xf4, 0xc0, 0xf4, 0xbf, 0xf4, 0xbe, 0xf4, 0xbc, 0xf4, 0xbb, 0xf4, 0xba, 0xf4, 0xb8, 0xf4,
-    0xb7, 0xf4, 0xb5, 0xf4, 0xb4, 0xf4, 0xb3, 0xf4, 0xb1, 0xf4, 0xb0, 0xf4, 0x47, 0xff, 0xad, 0x11, 0x17, 0xc, 0x7d, 0xe,
-    0x6f, 0xd, 0xe9, 0xd, 0xb6, 0xd, 0xce, 0xd, 0x0, 0xc, 0x2b, 0xf8, 0xa, 0xf3, 0x48, 0xf5, 0x46, 0xf4, 0xb8, 0xf4,
-    0x83, 0xf4, 0x98, 0xf4, 0x8d, 0xf4, 0x90, 0xf4, 0x8d, 0xf4, 0x8c, 0xf4, 0x8b, 0xf4, 0x89, 0xf4, 0x88, 0xf4, 0x87, 0xf4,
-    0x85, 0xf4, 0x84, 0xf4, 0x82, 0xf4, 0x81, 0xf4, 0x80, 0xf4, 0x7e, 0xf4, 0xe3, 0xfc, 0xcc, 0x10, 0xfa, 0xc, 0x7f, 0xe,
-    0xd5, 0xd, 0x24, 0xe, 0x3, 0xe, 0x14, 0xe, 0x8d, 0xc, 0xb4, 0xf9, 0x4f, 0xf2, 0x52, 0xf5, 0xfb, 0xf3, 0x91, 0xf4,
-    0x4d, 0xf4, 0x69, 0xf4, 0x5a, 0xf4, 0x5f, 0xf4, 0x5b, 0xf4, 0x5b, 0xf4, 0x59, 0xf4, 0x58, 0xf4, 0x56, 0xf4, 0x55, 0xf4,
-    0x54, 0xf4, 0x52, 0xf4, 0x51, 0xf4, 0x50, 0xf4, 0x4e, 0xf4, 0x4d, 0xf4, 0x12, 0xfe, 0xc2, 0x11, 0xea, 0xc, 0xee, 0xe,
-    0xc, 0xe, 0x73, 0xe, 0x48, 0xe, 0x5d, 0xe, 0x7f, 0xc, 0xeb, 0xf7, 0x99, 0xf2, 0xec, 0xf4, 0xe0, 0xf3, 0x56, 0xf4,
-    0x1f, 0xf4, 0x36, 0xf4, 0x2a, 0xf4, 0x2d, 0xf4, 0x2a, 0xf4, 0x29, 0xf4, 0x28, 0xf4, 0x26, 0xf4, 0x25, 0xf4, 0x24, 0xf4,
-    0x22, 0xf4, 0x21, 0xf4, 0x20, 0xf4, 0x1e, 0xf4, 0x1d, 0xf4, 0xbb, 0xf4, 0xf9, 0x3, 0x53, 0x12, 0xf5, 0xc, 0x53, 0xf,
-    0x47, 0xe, 0xc1, 0xe, 0x8d, 0xe, 0xa6, 0xe, 0x5d, 0x8, 0x6b, 0xf2, 0x70, 0xf4, 0xd6, 0xf3, 0x15, 0xf4, 0xf8, 0xf3,
-    0x2, 0xf4, 0xfc, 0xf3, 0xfd, 0xf3, 0xfa, 0xf3, 0xfa, 0xf3, 0xf8, 0xf3, 0xf7, 0xf3, 0xf5, 0xf3, 0xf4, 0xf3, 0xf3, 0xf3,
-    0xf1, 0xf3, 0xf0, 0xf3, 0xef, 0xf3, 0xee, 0xf3, 0xec, 0xf3, 0x74, 0xf6, 0x89, 0xe, 0x73, 0xf, 0x97, 0xe, 0x1, 0xf,
-    0xd3, 0xe, 0xeb, 0xe, 0xe2, 0xe, 0x45, 0xe, 0xad, 0xfe, 0x1, 0xf0, 0x7e, 0xf5, 0x14, 0xf3, 0x25, 0xf4, 0xa9, 0xf3,
-    0xdf, 0xf3, 0xc5, 0xf3, 0xcf, 0xf3, 0xc9, 0xf3, 0xc9, 0xf3, 0xc7, 0xf3, 0xc6, 0xf3, 0xc5, 0xf3, 0xc3, 0xf3, 0xc2, 0xf3,
-    0xc1, 0xf3, 0xbf, 0xf3, 0xbe, 0xf3, 0xbd, 0xf3, 0xe, 0xf4, 0x61, 0x2, 0x90, 0x13, 0x39, 0xd, 0x2, 0x10, 0xc7, 0xe,
-    0x55, 0xf, 0x19, 0xf, 0x36, 0xf, 0x67, 0x7, 0x52, 0xf1, 0x6c, 0xf4, 0x4b, 0xf3, 0xc8, 0xf3, 0x8e, 0xf3, 0xa6, 0xf3,
-    0x9a, 0xf3, 0x9d, 0xf3, 0x9a, 0xf3, 0x9a, 0xf3, 0x98, 0xf3, 0x97, 0xf3, 0x95, 0xf3, 0x94, 0xf3, 0x93, 0xf3, 0x91, 0xf3,
-    0x90, 0xf3, 0x8f, 0xf3, 0x8e, 0xf3, 0x8c, 0xf3, 0xb5, 0xfc, 0x72, 0x12, 0x47, 0xe, 0xed, 0xf, 0x36, 0xf, 0x8a, 0xf,
-    0x67, 0xf, 0x79, 0xf, 0x80, 0xb, 0x1f, 0xf3, 0x32, 0xf3, 0x95, 0xf3, 0x63, 0xf3, 0x77, 0xf3, 0x6d, 0xf3, 0x6f, 0xf3,
-    0x6c, 0xf3, 0x6c, 0xf3, 0x6a, 0xf3, 0x69, 0xf3, 0x68, 0xf3, 0x66, 0xf3, 0x65, 0xf3, 0x64, 0xf3, 0x62, 0xf3, 0x61, 0xf3,
-    0x60, 0xf3, 0x5f, 0xf3, 0x5d, 0xf3, 0x58, 0xfb, 0x16, 0x12, 0xe3, 0xe, 0xe, 0x10, 0x8d, 0xf, 0xc9, 0xf, 0xb0, 0xf,
-    0xbe, 0xf, 0xe, 0xd, 0x9e, 0xf3, 0xa7, 0xf2, 0x90, 0xf3, 0x21, 0xf3, 0x51, 0xf3, 0x3a, 0xf3, 0x42, 0xf3, 0x3c, 0xf3,
-    0x3d, 0xf3, 0x3b, 0xf3, 0x3a, 0xf3, 0x39, 0xf3, 0x37, 0xf3, 0x36, 0xf3, 0x35, 0xf3, 0x34, 0xf3, 0x32, 0xf3, 0x31, 0xf3,
-    0x30, 0xf3, 0x2e, 0xf3, 0xa5, 0xfc, 0x19, 0x13, 0xca, 0xe, 0x7f, 0x10, 0xc0, 0xf, 0x17, 0x10, 0xf4, 0xf, 0x5, 0x10,
-    0x91, 0xa, 0xc, 0xf2, 0x2f, 0xf3, 0xf, 0xf3, 0x17, 0xf3, 0x12, 0xf3, 0x12, 0xf3, 0x10, 0xf3, 0xf, 0xf3, 0xe, 0xf3,
-    0xd, 0xf3, 0xb, 0xf3, 0xa, 0xf3, 0x9, 0xf3, 0x7, 0xf3, 0x6, 0xf3, 0x5, 0xf3, 0x4, 0xf3, 0x2, 0xf3, 0x1, 0xf3,
-    0x0, 0xf3, 0xff, 0xf2, 0xfd, 0xf2, 0xfc, 0xf2, 0xfb, 0xf2, 0xf9, 0xf2, 0xf8, 0xf2, 0xf7, 0xf2, 0xf6, 0xf2, 0xf4, 0xf2,
-    0xf3, 0xf2, 0xf2, 0xf2, 0xf1, 0xf2, 0xb4, 0xf5, 0x5, 0x10, 0x5, 0x11, 0x15, 0x10, 0x87, 0x10, 0x57, 0x10, 0x6e, 0x10,
-    0x66, 0x10, 0x6b, 0x10, 0x6c, 0x10, 0x6e, 0x10, 0x6f, 0x10, 0xb3, 0x6, 0x98, 0xef, 0x7, 0xf4, 0x46, 0xf2, 0xa, 0xf3,
-    0xb0, 0xf2, 0xd7, 0xf2, 0xc4, 0xf2, 0xcb, 0xf2, 0xc5, 0xf2, 0xc7, 0xf2, 0xc4, 0xf2, 0xc3, 0xf2, 0xc2, 0xf2, 0xc1, 0xf2,
-    0xbf, 0xf2, 0xbe, 0xf2, 0xbd, 0xf2, 0xbc, 0xf2, 0xba, 0xf2, 0xb9, 0xf2, 0xb8, 0xf2, 0xb7, 0xf2, 0xb5, 0xf2, 0xb4, 0xf2,
-    0xb3, 0xf2, 0xb2, 0xf2, 0xb0, 0xf2, 0xaf, 0xf2, 0x81, 0xf5, 0x68, 0x10, 0x6d, 0x11, 0x77, 0x10, 0xec, 0x10, 0xba, 0x10,
-    0xd3, 0x10, 0xca, 0x10, 0xd0, 0x10, 0xcf, 0x10, 0xd3, 0x10, 0xd3, 0x10, 0x8, 0x4, 0xce, 0xed, 0x8f, 0xf4, 0xaa, 0xf1,
-    0xf1, 0xf2, 0x5d, 0xf2, 0x9d, 0xf2, 0x7f, 0xf2, 0x8b, 0xf2, 0x83, 0xf2, 0x85, 0xf2, 0x83, 0xf2, 0x82, 0xf2, 0x80, 0xf2,
-    0x7f, 0xf2, 0x7e, 0xf2, 0x7d, 0xf2, 0x7c, 0xf2, 0x7a, 0xf2, 0x79, 0xf2, 0x78, 0xf2, 0x77, 0xf2, 0x75, 0xf2, 0x74, 0xf2,
-    0x73, 0xf2, 0x72, 0xf2, 0x70, 0xf2, 0x6f, 0xf2, 0x6e, 0xf2, 0x88, 0xfc, 0x7f, 0x14, 0xe7, 0xf, 0xb8, 0x11, 0xee, 0x10,
-    0x4a, 0x11, 0x24, 0x11, 0x36, 0x11, 0x31, 0x11, 0x35, 0x11, 0x36, 0x11, 0x67, 0xf, 0xb0, 0xf8, 0xc8, 0xef, 0x6a, 0xf3,
-    0xcd, 0xf1, 0x83, 0xf2, 0x30, 0xf2, 0x54, 0xf2, 0x41, 0xf2, 0x48, 0xf2, 0x43, 0xf2, 0x44, 0xf2, 0x42, 0xf2, 0x41, 0xf2,
-    0x3f, 0xf2, 0x3e, 0xf2, 0x3d, 0xf2, 0x3c, 0xf2, 0x3b, 0xf2, 0x39, 0xf2, 0x38, 0xf2, 0x37, 0xf2, 0x36, 0xf2, 0x34, 0xf2,
-    0x33, 0xf2, 0x32, 0xf2, 0x31, 0xf2, 0x30, 0xf2, 0x2e, 0xf2, 0x20, 0xf5, 0x2b, 0x11, 0x3b, 0x12, 0x3a, 0x11, 0xb5, 0x11,
-    0x80, 0x11, 0x9a, 0x11, 0x91, 0x11, 0x96, 0x11, 0x97, 0x11, 0x99, 0x11, 0xdc, 0x10, 0xb2, 0xfe, 0x98, 0xed, 0x0, 0xf4,
-    0x2e, 0xf1, 0x6e, 0xf2, 0xdd, 0xf1, 0x1d, 0xf2, 0xfe, 0xf1, 0xa, 0xf2, 0x4, 0xf2, 0x4, 0xf2, 0x2, 0xf2, 0x1, 0xf2,
-    0x0, 0xf2, 0xff, 0xf1, 0xfe, 0xf1, 0xfc, 0xf1, 0xfb, 0xf1, 0xfa, 0xf1, 0xf9, 0xf1, 0xf8, 0xf1, 0xf6, 0xf1, 0xf5, 0xf1,
-    0xf4, 0xf1, 0xf3, 0xf1, 0xf2, 0xf1, 0xf0, 0xf1, 0xef, 0xf1, 0xf0, 0xf4, 0x8c, 0x11, 0xa1, 0x12, 0x9c, 0x11, 0x18, 0x12,
-    0xe3, 0x11, 0xfc, 0x11, 0xf4, 0x11, 0xf9, 0x11, 0xf9, 0x11, 0xfb, 0x11, 0xdb, 0x10, 0x9e, 0xfc, 0xe7, 0xed, 0x84, 0xf3,
-    0xa, 0xf1, 0x23, 0xf2, 0xa4, 0xf1, 0xdb, 0xf1, 0xc0, 0xf1, 0xcb, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc4, 0xf1, 0xc2, 0xf1,
-    0xc1, 0xf1, 0xc0, 0xf1, 0xbf, 0xf1, 0xbe, 0xf1, 0xbc, 0xf1, 0xbb, 0xf1, 0xba, 0xf1, 0xb9, 0xf1, 0xb8, 0xf1, 0xb6, 0xf1,
-    0xb5, 0xf1, 0xb4, 0xf1, 0xb3, 0xf1, 0xb2, 0xf1, 0xb0, 0xf1, 0x6a, 0xfc, 0xdc, 0x15, 0xfb, 0x10, 0xe9, 0x12, 0x12, 0x12,
-    0x74, 0x12, 0x4a, 0x12, 0x5f, 0x12, 0x58, 0x12, 0x5d, 0x12, 0x5d, 0x12, 0xbf, 0xd, 0x2c, 0xf1, 0x44, 0xf1, 0xb7, 0xf1,
-    0x7d, 0xf1, 0x95, 0xf1, 0x89, 0xf1, 0x8c, 0xf1, 0x89, 0xf1, 0x89, 0xf1, 0x87, 0xf1, 0x86, 0xf1, 0x85, 0xf1, 0x84, 0xf1,
-    0x82, 0xf1, 0x81, 0xf1, 0x80, 0xf1, 0x7f, 0xf1, 0x7e, 0xf1, 0x7d, 0xf1, 0x7b, 0xf1, 0x7a, 0xf1, 0x79, 0xf1, 0x78, 0xf1,
-    0x77, 0xf1, 0x76, 0xf1, 0x74, 0xf1, 0x73, 0xf1, 0x2e, 0xf4, 0x24, 0x10, 0x16, 0x14, 0x13, 0x12, 0xfe, 0x12, 0x97, 0x12,
-    0xc7, 0x12, 0xb3, 0x12, 0xbf, 0x12, 0xbb, 0x12, 0xc0, 0x12, 0xc9, 0x10, 0x3a, 0xf8, 0x99, 0xee, 0x87, 0xf2, 0xc7, 0xf0,
-    0x8e, 0xf1, 0x33, 0xf1, 0x5a, 0xf1, 0x47, 0xf1, 0x4e, 0xf1, 0x49, 0xf1, 0x4a, 0xf1, 0x47, 0xf1, 0x47, 0xf1, 0x46, 0xf1,
-    0x44, 0xf1, 0x43, 0xf1, 0x42, 0xf1, 0x41, 0xf1, 0x40, 0xf1, 0x3f, 0xf1, 0x3d, 0xf1, 0x3c, 0xf1, 0x3b, 0xf1, 0x3a, 0xf1,
-    0x39, 0xf1, 0x38, 0xf1, 0x36, 0xf1, 0x98, 0xf3, 0x48, 0xe, 0x2a, 0x15, 0x27, 0x12, 0x81, 0x13, 0xe8, 0x12, 0x2f, 0x13,
-    0x11, 0x13, 0x21, 0x13, 0x1c, 0x13, 0x21, 0x13, 0x20, 0x11, 0x1e, 0xf8, 0x4f, 0xee, 0x50, 0xf2, 0x88, 0xf0, 0x52, 0xf1,
-    0xf6, 0xf0, 0x1e, 0xf1, 0xa, 0xf1, 0x11, 0xf1, 0xd, 0xf1, 0xd, 0xf1, 0xb, 0xf1, 0xa, 0xf1, 0x9, 0xf1, 0x8, 0xf1,
-    0x7, 0xf1, 0x5, 0xf1, 0x4, 0xf1, 0x3, 0xf1, 0x2, 0xf1, 0x1, 0xf1, 0x0, 0xf1, 0xff, 0xf0, 0xfd, 0xf0, 0xfc, 0xf0,
-    0xfb, 0xf0, 0xfa, 0xf0, 0xd5, 0xf5, 0xdf, 0x13, 0xc6, 0x13, 0x4c, 0x13, 0x8a, 0x13, 0x71, 0x13, 0x7e, 0x13, 0x7a, 0x13,
-    0x7f, 0x13, 0x7e, 0x13, 0x81, 0x13, 0xfe, 0xc, 0x99, 0xef, 0xf7, 0xf0, 0xd1, 0xf0, 0xdc, 0xf0, 0xd5, 0xf0, 0xd7, 0xf0,
-    0xd4, 0xf0, 0xd4, 0xf0, 0xd2, 0xf0, 0xd1, 0xf0, 0xd0, 0xf0, 0xcf, 0xf0, 0xce, 0xf0, 0xcd, 0xf0, 0xcb, 0xf0, 0xca, 0xf0,
-    0xc9, 0xf0, 0xc8, 0xf0, 0xc7, 0xf0, 0xc6, 0xf0, 0xc5, 0xf0, 0xc3, 0xf0, 0xc2, 0xf0, 0xc1, 0xf0, 0xc0, 0xf0, 0xbf, 0xf0,
-    0x27, 0xf1, 0x80, 0x3, 0x7d, 0x19, 0x5f, 0x11, 0xf0, 0x14, 0x5b, 0x13, 0x12, 0x14, 0xc3, 0x13, 0xe8, 0x13, 0xda, 0x13,
-    0xe2, 0x13, 0xa2, 0x12, 0x77, 0xfc, 0x57, 0xec, 0x7d, 0xf2, 0xc8, 0xef, 0xfb, 0xf0, 0x70, 0xf0, 0xad, 0xf0, 0x90, 0xf0,
-    0x9b, 0xf0, 0x95, 0xf0, 0x96, 0xf0, 0x94, 0xf0, 0x93, 0xf0, 0x92, 0xf0, 0x91, 0xf0, 0x90, 0xf0, 0x8e, 0xf0, 0x8d, 0xf0,
-    0x8c, 0xf0, 0x8b, 0xf0, 0x8a, 0xf0, 0x89, 0xf0, 0x88, 0xf0, 0x87, 0xf0, 0x85, 0xf0, 0x84, 0xf0, 0x83, 0xf0, 0xec, 0xfd,
-    0xf3, 0x18, 0x4b, 0x12, 0xf, 0x15, 0xd8, 0x13, 0x64, 0x14, 0x28, 0x14, 0x44, 0x14, 0x3b, 0x14, 0x40, 0x14, 0xd5, 0x13,
-    0x16, 0x1, 0x9b, 0xea, 0xe8, 0xf2, 0x44, 0xef, 0xe1, 0xf0, 0x27, 0xf0, 0x79, 0xf0, 0x53, 0xf0, 0x62, 0xf0, 0x59, 0xf0,
-    0x5c, 0xf0, 0x59, 0xf0, 0x59, 0xf0, 0x57, 0xf0, 0x56, 0xf0, 0x55, 0xf0, 0x54, 0xf0, 0x53, 0xf0, 0x52, 0xf0, 0x51, 0xf0,
-    0x50, 0xf0, 0x4e, 0xf0, 0x4d, 0xf0, 0x4c, 0xf0, 0x4b, 0xf0, 0x4a, 0xf0, 0x49, 0xf0, 0xa1, 0xff, 0x46, 0x1a, 0x2e, 0x12,
-    0xa7, 0x15, 0x1d, 0x14, 0xcf, 0x14, 0x82, 0x14, 0xa6, 0x14, 0x98, 0x14, 0xa1, 0x14, 0xe8, 0x12, 0xe, 0xfa, 0x76, 0xec,
-    0xca, 0xf1, 0x6e, 0xef, 0x7a, 0xf0, 0x1, 0xf0, 0x36, 0xf0, 0x1d, 0xf0, 0x26, 0xf0, 0x20, 0xf0, 0x22, 0xf0, 0x1f, 0xf0,
-    0x1f, 0xf0, 0x1d, 0xf0, 0x1c, 0xf0, 0x1b, 0xf0, 0x1a, 0xf0, 0x19, 0xf0, 0x18, 0xf0, 0x17, 0xf0, 0x16, 0xf0, 0x15, 0xf0,
-    0x13, 0xf0, 0x12, 0xf0, 0x11, 0xf0, 0x10, 0xf0, 0x3a, 0xf2, 0x55, 0xd, 0xf5, 0x17, 0x9f, 0x13, 0x8c, 0x15, 0xb3, 0x14,
-    0x16, 0x15, 0xec, 0x14, 0x1, 0x15, 0xf9, 0x14, 0xff, 0x14, 0x49, 0xc, 0xb4, 0xed, 0x88, 0xf0, 0xb0, 0xef, 0xb, 0xf0,
-    0xe1, 0xef, 0xf2, 0xef, 0xe9, 0xef, 0xeb, 0xef, 0xe9, 0xef, 0xe8, 0xef, 0xe7, 0xef, 0xe6, 0xef, 0xe5, 0xef, 0xe4, 0xef,
-    0xe3, 0xef, 0xe1, 0xef, 0xe0, 0xef, 0xdf, 0xef, 0xde, 0xef, 0xdd, 0xef, 0xdc, 0xef, 0xdb, 0xef, 0xda, 0xef, 0xd9, 0xef,
-    0xd8, 0xef, 0xd7, 0xef, 0xaf, 0xff, 0x33, 0x1b, 0xd7, 0x12, 0x6d, 0x16, 0xd6, 0x14, 0x8e, 0x15, 0x3e, 0x15, 0x64, 0x15,
-    0x55, 0x15, 0x5e, 0x15, 0xb4, 0x12, 0xd, 0xf5, 0x66, 0xed, 0xc0, 0xf0, 0x40, 0xef, 0xea, 0xef, 0x9d, 0xef, 0xbd, 0xef,
-    0xad, 0xef, 0xb3, 0xef, 0xaf, 0xef, 0xaf, 0xef, 0xae, 0xef, 0xac, 0xef, 0xab, 0xef, 0xaa, 0xef, 0xa9, 0xef, 0xa8, 0xef,
-    0xa7, 0xef, 0xa6, 0xef, 0xa5, 0xef, 0xa4, 0xef, 0xa3, 0xef, 0xa2, 0xef, 0xa1, 0xef, 0xa0, 0xef, 0x9f, 0xef, 0xec, 0xfd,
-    0xbd, 0x1a, 0xa5, 0x13, 0x97, 0x16, 0x4b, 0x15, 0xe1, 0x15, 0xa1, 0x15, 0xbf, 0x15, 0xb4, 0x15, 0xba, 0x15, 0x8, 0x13,
-    0xea, 0xf4, 0x25, 0xed, 0x8c, 0xf0, 0x7, 0xef, 0xb3, 0xef, 0x64, 0xef, 0x85, 0xef, 0x75, 0xef, 0x7b, 0xef, 0x77, 0xef,
-    0x77, 0xef, 0x76, 0xef, 0x74, 0xef, 0x73, 0xef, 0x72, 0xef, 0x71, 0xef, 0x70, 0xef, 0x6f, 0xef, 0x6e, 0xef, 0x6d, 0xef,
-    0x6c, 0xef, 0x6b, 0xef, 0x6a, 0xef, 0x69, 0xef, 0x68, 0xef, 0xdb, 0xef, 0xf, 0x4, 0x47, 0x1c, 0x56, 0x13, 0x43, 0x17,
-    0x86, 0x15, 0x4e, 0x16, 0xf7, 0x15, 0x20, 0x16, 0xf, 0x16, 0x19, 0x16, 0xcb, 0xe, 0xe1, 0xed, 0x69, 0xef, 0x3e, 0xef,
-    0x4a, 0xef, 0x44, 0xef, 0x45, 0xef, 0x43, 0xef, 0x42, 0xef, 0x41, 0xef, 0x40, 0xef, 0x3f, 0xef, 0x3e, 0xef, 0x3d, 0xef,
-    0x3c, 0xef, 0x3b, 0xef, 0x3a, 0xef, 0x39, 0xef, 0x37, 0xef, 0x36, 0xef, 0x35, 0xef, 0x34, 0xef, 0x33, 0xef, 0x32, 0xef,
-    0x31, 0xef, 0x30, 0xef, 0xdf, 0xf2, 0xef, 0x15, 0x43, 0x17, 0x1, 0x16, 0x9a, 0x16, 0x58, 0x16, 0x77, 0x16, 0x6c, 0x16,
-    0x72, 0x16, 0x72, 0x16, 0x11, 0x15, 0x4c, 0xfc, 0x49, 0xea, 0x28, 0xf1, 0x22, 0xee, 0x79, 0xef, 0xde, 0xee, 0x22, 0xef,
-    0x2, 0xef, 0xf, 0xef, 0x8, 0xef, 0xa, 0xef, 0x7, 0xef, 0x6, 0xef, 0x5, 0xef, 0x4, 0xef, 0x3, 0xef, 0x2, 0xef,
-    0x1, 0xef, 0x0, 0xef, 0xff, 0xee, 0xfe, 0xee, 0xfd, 0xee, 0xfc, 0xee, 0xfb, 0xee, 0xfa, 0xee, 0xd7, 0xf0, 0xfa, 0xb,
-    0xcf, 0x1a, 0x0, 0x15, 0x92, 0x17, 0x6e, 0x16, 0xf2, 0x16, 0xba, 0x16, 0xd5, 0x16, 0xca, 0x16, 0xd1, 0x16, 0x9, 0x4,
-    0x9e, 0xe7, 0x0, 0xf2, 0x73, 0xed, 0x79, 0xef, 0x90, 0xee, 0xf7, 0xee, 0xc7, 0xee, 0xdb, 0xee, 0xd1, 0xee, 0xd4, 0xee,
-    0xd1, 0xee, 0xd1, 0xee, 0xcf, 0xee, 0xce, 0xee, 0xcd, 0xee, 0xcc, 0xee, 0xcb, 0xee, 0xca, 0xee, 0xc9, 0xee, 0xc8, 0xee,
-    0xc7, 0xee, 0xc6, 0xee, 0xc5, 0xee, 0xc4, 0xee, 0xa9, 0xf0, 0x2e, 0xc, 0x3a, 0x1b, 0x55, 0x15, 0xf1, 0x17, 0xc9, 0x16,
-    0x4f, 0x17, 0x15, 0x17, 0x31, 0x17, 0x26, 0x17, 0xb3, 0x16, 0x81, 0x1, 0x1d, 0xe8, 0x7d, 0xf1, 0x60, 0xed, 0x34, 0xef,
-    0x61, 0xee, 0xbe, 0xee, 0x93, 0xee, 0xa4, 0xee, 0x9b, 0xee, 0x9e, 0xee, 0x9b, 0xee, 0x9b, 0xee, 0x9a, 0xee, 0x99, 0xee,
-    0x98, 0xee, 0x97, 0xee, 0x96, 0xee, 0x95, 0xee, 0x94, 0xee, 0x93, 0xee, 0x92, 0xee, 0x91, 0xee, 0x90, 0xee, 0x8f, 0xee,
-    0x66, 0xf2, 0xfd, 0x16, 0x61, 0x18, 0x11, 0x17, 0xb0, 0x17, 0x6a, 0x17, 0x8b, 0x17, 0x7f, 0x17, 0x86, 0x17, 0x85, 0x17,
-    0xa1, 0x14, 0x42, 0xf4, 0xe8, 0xeb, 0x91, 0xef, 0xee, 0xed, 0xa7, 0xee, 0x53, 0xee, 0x77, 0xee, 0x66, 0xee, 0x6c, 0xee,
-    0x68, 0xee, 0x68, 0xee, 0x66, 0xee, 0x65, 0xee, 0x64, 0xee, 0x63, 0xee, 0x62, 0xee, 0x61, 0xee, 0x60, 0xee, 0x5f, 0xee,
-    0x5e, 0xee, 0x5d, 0xee, 0x5c, 0xee, 0x5b, 0xee, 0x5a, 0xee, 0x59, 0xee, 0xd7, 0x1, 0x5b, 0x1f, 0x93, 0x14, 0x4d, 0x19,
-    0x35, 0x17, 0x26, 0x18, 0xbc, 0x17, 0xed, 0x17, 0xd9, 0x17, 0xe4, 0x17, 0x44, 0x6, 0xb2, 0xe7, 0xfc, 0xf0, 0x2, 0xed,
-    0xc5, 0xee, 0xfa, 0xed, 0x53, 0xee, 0x2a, 0xee, 0x3b, 0xee, 0x32, 0xee, 0x34, 0xee, 0x32, 0xee, 0x31, 0xee, 0x30, 0xee,
-    0x2f, 0xee, 0x2e, 0xee, 0x2e, 0xee, 0x2d, 0xee, 0x2c, 0xee, 0x2b, 0xee, 0x2a, 0xee, 0x29, 0xee, 0x28, 0xee, 0x27, 0xee,
-    0x26, 0xee, 0xff, 0xf9, 0xbf, 0x1b, 0xff, 0x16, 0xb8, 0x18, 0xf9, 0x17, 0x50, 0x18, 0x2b, 0x18, 0x3e, 0x18, 0x37, 0x18,
-    0x3c, 0x18, 0x56, 0xc, 0x76, 0xea, 0x3b, 0xef, 0x82, 0xed, 0x41, 0xee, 0xea, 0xed, 0x10, 0xee, 0xfd, 0xed, 0x4, 0xee,
-    0x0, 0xee, 0x0, 0xee, 0xff, 0xed, 0xfe, 0xed, 0xfd, 0xed, 0xfc, 0xed, 0xfb, 0xed, 0xfa, 0xed, 0xf9, 0xed, 0xf8, 0xed,
-    0xf7, 0xed, 0xf6, 0xed, 0xf5, 0xed, 0xf4, 0xed, 0xf3, 0xed, 0xf2, 0xed, 0xf3, 0xf9, 0x26, 0x1c, 0x55, 0x17, 0x14, 0x19,
-    0x52, 0x18, 0xab, 0x18, 0x85, 0x18, 0x98, 0x18, 0x91, 0x18, 0x96, 0x18, 0x84, 0x8, 0x26, 0xe8, 0x1e, 0xf0, 0xd0, 0xec,
-    0x46, 0xee, 0x9e, 0xed, 0xe7, 0xed, 0xc5, 0xed, 0xd3, 0xed, 0xcb, 0xed, 0xcd, 0xed, 0xcb, 0xed, 0xca, 0xed, 0xc9, 0xed,
-    0xc8, 0xed, 0xc7, 0xed, 0xc6, 0xed, 0xc5, 0xed, 0xc4, 0xed, 0xc4, 0xed, 0xc3, 0xed, 0xc2, 0xed, 0xc1, 0xed, 0xc0, 0xed,
-    0xbf, 0xed, 0x4, 0x2, 0xb7, 0x20, 0x80, 0x15, 0x6a, 0x1a, 0x3b, 0x18, 0x37, 0x19, 0xc8, 0x18, 0xfc, 0x18, 0xe6, 0x18,
-    0x6b, 0x17, 0x2b, 0xfc, 0x60, 0xe8, 0xed, 0xef, 0x9a, 0xec, 0x14, 0xee, 0x69, 0xed, 0xb4, 0xed, 0x91, 0xed, 0xa0, 0xed,
-    0x97, 0xed, 0x9b, 0xed, 0x98, 0xed, 0x97, 0xed, 0x96, 0xed, 0x95, 0xed, 0x94, 0xed, 0x93, 0xed, 0x92, 0xed, 0x91, 0xed,
-    0x90, 0xed, 0x8f, 0xed, 0x8f, 0xed, 0x8e, 0xed, 0x8d, 0xed, 0x23, 0xf1, 0xe3, 0x15, 0x11, 0x1b, 0x6c, 0x18, 0x9f, 0x19,
-    0x18, 0x19, 0x56, 0x19, 0x3c, 0x19, 0x4a, 0x19, 0x45, 0x19, 0xfc, 0xe, 0xc8, 0xea, 0x22, 0xee, 0x22, 0xed, 0x8e, 0xed,
-    0x5d, 0xed, 0x71, 0xed, 0x67, 0xed, 0x6b, 0xed, 0x68, 0xed, 0x67, 0xed, 0x66, 0xed, 0x65, 0xed, 0x64, 0xed, 0x63, 0xed,
-    0x62, 0xed, 0x61, 0xed, 0x61, 0xed, 0x60, 0xed, 0x5f, 0xed, 0x5e, 0xed, 0x5d, 0xed, 0x5c, 0xed, 0x5b, 0xed, 0x63, 0xee,
-    0xdd, 0x7, 0xd8, 0x1f, 0xdd, 0x16, 0xd1, 0x1a, 0xf, 0x19, 0xda, 0x19, 0x81, 0x19, 0xaa, 0x19, 0x9a, 0x19, 0xfd, 0x15,
-    0xa5, 0xf0, 0x63, 0xeb, 0x13, 0xee, 0xdb, 0xec, 0x65, 0xed, 0x26, 0xed, 0x41, 0xed, 0x33, 0xed, 0x39, 0xed, 0x35, 0xed,
-    0x35, 0xed, 0x34, 0xed, 0x33, 0xed, 0x32, 0xed, 0x31, 0xed, 0x30, 0xed, 0x2f, 0xed, 0x2e, 0xed, 0x2d, 0xed, 0x2c, 0xed,
-    0x2b, 0xed, 0x2a, 0xed, 0x29, 0xed, 0xaf, 0xed, 0x18, 0x5, 0x28, 0x21, 0xcb, 0x16, 0x58, 0x1b, 0x52, 0x19, 0x3b, 0x1a,
-    0xd5, 0x19, 0x5, 0x1a, 0xf1, 0x19, 0x4a, 0x16, 0x7d, 0xf0, 0x2c, 0xeb, 0xe4, 0xed, 0xa9, 0xec, 0x34, 0xed, 0xf5, 0xec,
-    0xf, 0xed, 0x3, 0xed, 0x7, 0xed, 0x4, 0xed, 0x3, 0xed, 0x2, 0xed, 0x1, 0xed, 0x1, 0xed, 0x0, 0xed, 0xff, 0xec,
-    0xfe, 0xec, 0xfd, 0xec, 0xfc, 0xec, 0xfb, 0xec, 0xfa, 0xec, 0xf9, 0xec, 0xf8, 0xec, 0x90, 0xee, 0xe, 0xb, 0xc8, 0x1f,
-    0xe0, 0x17, 0x5c, 0x1b, 0xd0, 0x19, 0x82, 0x1a, 0x35, 0x1a, 0x59, 0x1a, 0x4b, 0x1a, 0xc8, 0x11, 0x33, 0xeb, 0x1, 0xed,
-    0xce, 0xec, 0xde, 0xec, 0xd5, 0xec, 0xd8, 0xec, 0xd5, 0xec, 0xd5, 0xec, 0xd4, 0xec, 0xd3, 0xec, 0xd2, 0xec, 0xd1, 0xec,
-    0xd0, 0xec, 0xcf, 0xec, 0xcf, 0xec, 0xce, 0xec, 0xcd, 0xec, 0xcc, 0xec, 0xcb, 0xec, 0xca, 0xec, 0xc9, 0xec, 0xc8, 0xec,
-    0xc7, 0xec, 0x3d, 0xf3, 0x2d, 0x1b, 0xb, 0x1b, 0x69, 0x1a, 0xb9, 0x1a, 0x98, 0x1a, 0xa8, 0x1a, 0xa3, 0x1a, 0xa7, 0x1a,
-    0x1d, 0x1a, 0x12, 0x2, 0x3e, 0xe5, 0xe5, 0xef, 0x39, 0xeb, 0x4c, 0xed, 0x5e, 0xec, 0xc6, 0xec, 0x97, 0xec, 0xab, 0xec,
-    0xa0, 0xec, 0xa4, 0xec, 0xa1, 0xec, 0xa1, 0xec, 0xa0, 0xec, 0x9f, 0xec, 0x9e, 0xec, 0x9d, 0xec, 0x9c, 0xec, 0x9b, 0xec,
-    0x9a, 0xec, 0x99, 0xec, 0x99, 0xec, 0x98, 0xec, 0x39, 0xee, 0x62, 0xb, 0x97, 0x20, 0x80, 0x18, 0x10, 0x1c, 0x7c, 0x1a,
-    0x32, 0x1b, 0xe3, 0x1a, 0x8, 0x1b, 0xf9, 0x1a, 0xe4, 0xd, 0x8a, 0xe8, 0xcd, 0xed, 0xe6, 0xeb, 0xba, 0xec, 0x5a, 0xec,
-    0x83, 0xec, 0x70, 0xec, 0x77, 0xec, 0x73, 0xec, 0x73, 0xec, 0x72, 0xec, 0x71, 0xec, 0x70, 0xec, 0x6f, 0xec, 0x6e, 0xec,
-    0x6e, 0xec, 0x6d, 0xec, 0x6c, 0xec, 0x6b, 0xec, 0x6a, 0xec, 0x69, 0xec, 0x68, 0xec, 0x67, 0xec, 0x6f, 0x2, 0xcc, 0x23,
-    0x9b, 0x17, 0xf3, 0x1c, 0x94, 0x1a, 0xa4, 0x1b, 0x2c, 0x1b, 0x64, 0x1b, 0x4c, 0x1b, 0x81, 0x12, 0x94, 0xea, 0x73, 0xec,
-    0x3e, 0xec, 0x4e, 0xec, 0x45, 0xec, 0x48, 0xec, 0x46, 0xec, 0x45, 0xec, 0x44, 0xec, 0x43, 0xec, 0x43, 0xec, 0x42, 0xec,
-    0x41, 0xec, 0x40, 0xec, 0x3f, 0xec, 0x3e, 0xec, 0x3d, 0xec, 0x3c, 0xec, 0x3b, 0xec, 0x3b, 0xec, 0x3a, 0xec, 0x39, 0xec,
-    0xc6, 0xec, 0x91, 0x5, 0x48, 0x23, 0x4f, 0x18, 0x1f, 0x1d, 0xfc, 0x1a, 0xf2, 0x1b, 0x86, 0x1b, 0xb8, 0x1b, 0xa3, 0x1b,
-    0x46, 0xe, 0x14, 0xe8, 0x77, 0xed, 0x84, 0xeb, 0x5d, 0xec, 0xfb, 0xeb, 0x25, 0xec, 0x11, 0xec, 0x18, 0xec, 0x15, 0xec,
-    0x14, 0xec, 0x13, 0xec, 0x13, 0xec, 0x12, 0xec, 0x11, 0xec, 0x10, 0xec, 0xf, 0xec, 0xe, 0xec, 0xd, 0xec, 0xc, 0xec,
-    0xc, 0xec, 0xb, 0xec, 0xa, 0xec, 0xd9, 0xee, 0x13, 0x12, 0xe1, 0x1f, 0x3f, 0x1a, 0xc0, 0x1c, 0xa3, 0x1b, 0x24, 0x1c,
-    0xec, 0x1b, 0x7, 0x1c, 0x6c, 0x1b, 0x4e, 0x2, 0x2b, 0xe4, 0x4d, 0xef, 0x6a, 0xea, 0x97, 0xec, 0x9d, 0xeb, 0xb, 0xec,
-    0xd9, 0xeb, 0xee, 0xeb, 0xe3, 0xeb, 0xe7, 0xeb, 0xe4, 0xeb, 0xe4, 0xeb, 0xe3, 0xeb, 0xe2, 0xeb, 0xe1, 0xeb, 0xe0, 0xeb,
-    0xdf, 0xeb, 0xdf, 0xeb, 0xde, 0xeb, 0xdd, 0xeb, 0xdc, 0xeb, 0xdb, 0xeb, 0x82, 0xf9, 0x67, 0x20, 0xec, 0x1a, 0xe8, 0x1c,
-    0xc, 0x1c, 0x70, 0x1c, 0x45, 0x1c, 0x5a, 0x1c, 0x52, 0x1c, 0x7e, 0x15, 0x27, 0xeb, 0x4c, 0xeb, 0xf8, 0xeb, 0xa2, 0xeb,
-    0xc8, 0xeb, 0xb6, 0xeb, 0xbd, 0xeb, 0xb8, 0xeb, 0xba, 0xeb, 0xb7, 0xeb, 0xb7, 0xeb, 0xb6, 0xeb, 0xb5, 0xeb, 0xb4, 0xeb,
-    0xb4, 0xeb, 0xb3, 0xeb, 0xb2, 0xeb, 0xb1, 0xeb, 0xb0, 0xeb, 0xaf, 0xeb, 0xae, 0xeb, 0xae, 0xeb, 0xb3, 0xef, 0xe0, 0x18,
-    0xad, 0x1e, 0xb6, 0x1b, 0xe, 0x1d, 0x77, 0x1c, 0xbc, 0x1c, 0x9e, 0x1c, 0xae, 0x1c, 0xc6, 0x19, 0xb4, 0xf5, 0x8e, 0xe7,
-    0x56, 0xed, 0xc5, 0xea, 0xe9, 0xeb, 0x66, 0xeb, 0x9f, 0xeb, 0x84, 0xeb, 0x8f, 0xeb, 0x89, 0xeb, 0x8a, 0xeb, 0x89, 0xeb,
-    0x88, 0xeb, 0x87, 0xeb, 0x86, 0xeb, 0x85, 0xeb, 0x84, 0xeb, 0x84, 0xeb, 0x83, 0xeb, 0x82, 0xeb, 0x81, 0xeb, 0x80, 0xeb,
-    0x67, 0xee, 0xc1, 0x12, 0x1, 0x21, 0x2f, 0x1b, 0xc5, 0x1d, 0x9f, 0x1c, 0x24, 0x1d, 0xea, 0x1c, 0x6, 0x1d, 0xa6, 0x1a,
-    0xd8, 0xf8, 0x5a, 0xe6, 0x99, 0xed, 0x66, 0xea, 0xd2, 0xeb, 0x2e, 0xeb, 0x77, 0xeb, 0x54, 0xeb, 0x63, 0xeb, 0x5b, 0xeb,
-    0x5d, 0xeb, 0x5b, 0xeb, 0x5b, 0xeb, 0x5a, 0xeb, 0x59, 0xeb, 0x58, 0xeb, 0x57, 0xeb, 0x57, 0xeb, 0x56, 0xeb, 0x55, 0xeb,
-    0x54, 0xeb, 0x53, 0xeb, 0xd8, 0xee, 0x37, 0x16, 0x5f, 0x20, 0xec, 0x1b, 0xea, 0x1d, 0x8, 0x1d, 0x6f, 0x1d, 0x43, 0x1d,
-    0x58, 0x1d, 0x5f, 0x1a, 0x8f, 0xf5, 0x20, 0xe7, 0x4, 0xed, 0x67, 0xea, 0x90, 0xeb, 0xa, 0xeb, 0x45, 0xeb, 0x2a, 0xeb,
-    0x34, 0xeb, 0x2f, 0xeb, 0x30, 0xeb, 0x2e, 0xeb, 0x2e, 0xeb, 0x2d, 0xeb, 0x2c, 0xeb, 0x2b, 0xeb, 0x2a, 0xeb, 0x2a, 0xeb,
-    0x29, 0xeb, 0x28, 0xeb, 0x27, 0xeb, 0x26, 0xeb, 0x1, 0xf7, 0xab, 0x20, 0xd2, 0x1c, 0xf6, 0x1d, 0x7a, 0x1d, 0xb3, 0x1d,
-    0x9c, 0x1d, 0xa8, 0x1d, 0xa4, 0x1d, 0xc4, 0x11, 0xfa, 0xe7, 0xd8, 0xeb, 0xb3, 0xea, 0x2f, 0xeb, 0xf6, 0xea, 0xe, 0xeb,
-    0x3, 0xeb, 0x6, 0xeb, 0x4, 0xeb, 0x3, 0xeb, 0x3, 0xeb, 0x2, 0xeb, 0x1, 0xeb, 0x0, 0xeb, 0xff, 0xea, 0xff, 0xea,
-    0xfe, 0xea, 0xfd, 0xea, 0xfc, 0xea, 0xfb, 0xea, 0xfb, 0xea, 0xc5, 0xec, 0xd3, 0xc, 0x22, 0x24, 0x3e, 0x1b, 0x28, 0x1f,
-    0x6b, 0x1d, 0x33, 0x1e, 0xdc, 0x1d, 0x5, 0x1e, 0x8d, 0x1b, 0xbb, 0xf8, 0xac, 0xe5, 0x25, 0xed, 0xd8, 0xe9, 0x50, 0xeb,
-    0x62, 0xea, 0x19, 0xe8, 0xe0, 0xe7, 0xa, 0xe8, 0xf9, 0xe7, 0x3, 0xe8, 0x1, 0xe8, 0x4, 0xe8, 0x5, 0xe8, 0x6, 0xe8,
-    0x9, 0xe8, 0x9, 0xe8, 0xc, 0xe8, 0xd, 0xe8, 0xe, 0xe8, 0x11, 0xe8, 0x11, 0xe8, 0xe8, 0xfd, 0xde, 0x29, 0x6, 0x1f,
-    0x81, 0x23, 0x80, 0x21, 0x62, 0x22, 0xfa, 0x21, 0x25, 0x22, 0xe, 0x22, 0xd3, 0x6, 0x87, 0xdd, 0xa3, 0xec, 0x7, 0xe6,
-    0xfc, 0xe8, 0xac, 0xe7, 0x45, 0xe8, 0x3, 0xe8, 0x23, 0xe8, 0x17, 0xe8, 0x1e, 0xe8, 0x1e, 0xe8, 0x20, 0xe8, 0x21, 0xe8,
-    0x23, 0xe8, 0x24, 0xe8, 0x27, 0xe8, 0x27, 0xe8, 0x2a, 0xe8, 0x2b, 0xe8, 0x2c, 0xe8, 0x2f, 0xe8, 0x81, 0xf8, 0xfb, 0x26,
-    0x6a, 0x20, 0xc6, 0x22, 0xba, 0x21, 0x2e, 0x22, 0xf7, 0x21, 0xd, 0x22, 0xff, 0x21, 0x8d, 0x9, 0x13, 0xdf, 0x0, 0xec,
-    0x7b, 0xe6, 0xf2, 0xe8, 0xda, 0xe7, 0x59, 0xe8, 0x23, 0xe8, 0x3d, 0xe8, 0x34, 0xe8, 0x3b, 0xe8, 0x39, 0xe8, 0x3d, 0xe8,
-    0x3d, 0xe8, 0x40, 0xe8, 0x41, 0xe8, 0x42, 0xe8, 0x45, 0xe8, 0x45, 0xe8, 0x48, 0xe8, 0x49, 0xe8, 0x4a, 0xe8, 0x47, 0xfb,
-    0x4a, 0x28, 0xa0, 0x1f, 0x7, 0x23, 0x83, 0x21, 0x2d, 0x22, 0xde, 0x21, 0xfd, 0x21, 0x3f, 0x21, 0x1d, 0x3, 0xf8, 0xde,
-    0x55, 0xec, 0x7c, 0xe6, 0x1a, 0xe9, 0xf1, 0xe7, 0x79, 0xe8, 0x3e, 0xe8, 0x5b, 0xe8, 0x50, 0xe8, 0x57, 0xe8, 0x57, 0xe8,
-    0x59, 0xe8, 0x5a, 0xe8, 0x5c, 0xe8, 0x5d, 0xe8, 0x5f, 0xe8, 0x60, 0xe8, 0x63, 0xe8, 0x63, 0xe8, 0x66, 0xe8, 0x14, 0xe9,
-    0x2b, 0x7, 0x37, 0x2b, 0xe2, 0x1d, 0xb7, 0x23, 0x1a, 0x21, 0x40, 0x22, 0xba, 0x21, 0xf3, 0x21, 0xc9, 0x1d, 0x87, 0xf0,
-    0xd7, 0xe4, 0xfa, 0xe9, 0xb2, 0xe7, 0xb9, 0xe8, 0x47, 0xe8, 0x7b, 0xe8, 0x67, 0xe8, 0x72, 0xe8, 0x6f, 0xe8, 0x73, 0xe8,
-    0x73, 0xe8, 0x76, 0xe8, 0x76, 0xe8, 0x79, 0xe8, 0x7a, 0xe8, 0x7b, 0xe8, 0x7e, 0xe8, 0x7e, 0xe8, 0x81, 0xe8, 0x82, 0xe8,
-    0xe7, 0xed, 0x2f, 0x21, 0x1b, 0x23, 0x40, 0x21, 0x1c, 0x22, 0xb6, 0x21, 0xe0, 0x21, 0xc9, 0x21, 0xd1, 0x21, 0x40, 0xc,
-    0xe1, 0xe0, 0x93, 0xeb, 0x26, 0xe7, 0x1f, 0xe9, 0x40, 0xe8, 0xa5, 0xe8, 0x7b, 0xe8, 0x90, 0xe8, 0x89, 0xe8, 0x8f, 0xe8,
-    0x8e, 0xe8, 0x91, 0xe8, 0x91, 0xe8, 0x94, 0xe8, 0x95, 0xe8, 0x96, 0xe8, 0x99, 0xe8, 0x99, 0xe8, 0x9c, 0xe8, 0x9c, 0xe8,
-    0xf7, 0xe9, 0xe5, 0xa, 0xe1, 0x29, 0x41, 0x1e, 0x59, 0x23, 0x10, 0x21, 0x11, 0x22, 0x9b, 0x21, 0xcd, 0x21, 0x55, 0x1c,
-    0x4b, 0xe9, 0x5b, 0xe7, 0x36, 0xe9, 0x5a, 0xe8, 0xbf, 0xe8, 0x94, 0xe8, 0xaa, 0xe8, 0xa2, 0xe8, 0xa8, 0xe8, 0xa8, 0xe8,
-    0xa9, 0xe8, 0xac, 0xe8, 0xac, 0xe8, 0xaf, 0xe8, 0xaf, 0xe8, 0xb2, 0xe8, 0xb3, 0xe8, 0xb4, 0xe8, 0xb7, 0xe8, 0xb7, 0xe8,
-    0xba, 0xe8, 0xd5, 0x0, 0xae, 0x2a, 0xf1, 0x1d, 0x61, 0x23, 0xf2, 0x20, 0x5, 0x22, 0x87, 0x21, 0xbb, 0x21, 0x9e, 0x1d,
-    0xc7, 0xf0, 0x31, 0xe5, 0x4a, 0xea, 0x5, 0xe8, 0xc, 0xe9, 0x99, 0xe8, 0xce, 0xe8, 0xb9, 0xe8, 0xc4, 0xe8, 0xc2, 0xe8,
-    0xc5, 0xe8, 0xc6, 0xe8, 0xc8, 0xe8, 0xc9, 0xe8, 0xcb, 0xe8, 0xcc, 0xe8, 0xce, 0xe8, 0xcf, 0xe8, 0xd1, 0xe8, 0xd2, 0xe8,
-    0xd5, 0xe8, 0xdc, 0x0, 0x96, 0x2a, 0xe1, 0x1d, 0x4e, 0x23, 0xe1, 0x20, 0xf3, 0x21, 0x76, 0x21, 0xa9, 0x21, 0xe4, 0x1c,
-    0x2e, 0xed, 0x71, 0xe6, 0xe7, 0xe9, 0x59, 0xe8, 0xe, 0xe9, 0xbf, 0xe8, 0xe4, 0xe8, 0xd6, 0xe8, 0xdf, 0xe8, 0xdd, 0xe8,
-    0xe0, 0xe8, 0xe1, 0xe8, 0xe3, 0xe8, 0xe4, 0xe8, 0xe6, 0xe8, 0xe7, 0xe8, 0xe9, 0xe8, 0xea, 0xe8, 0xed, 0xe8, 0xed, 0xe8,
-    0x44, 0xea, 0xe6, 0xa, 0x97, 0x29, 0x14, 0x1e, 0x1f, 0x23, 0xdc, 0x20, 0xdb, 0x21, 0x65, 0x21, 0x97, 0x21, 0x31, 0x14,
-    0x81, 0xe5, 0xd2, 0xe9, 0x8e, 0xe8, 0x1b, 0xe9, 0xde, 0xe8, 0xfc, 0xe8, 0xf0, 0xe8, 0xf9, 0xe8, 0xf6, 0xe8, 0xfa, 0xe8,
-    0xfa, 0xe8, 0xfd, 0xe8, 0xfe, 0xe8, 0xff, 0xe8, 0x1, 0xe9, 0x2, 0xe9, 0x5, 0xe9, 0x5, 0xe9, 0x8, 0xe9, 0x8, 0xe9,
-    0xaf, 0xed, 0x2f, 0x1d, 0xde, 0x23, 0x6e, 0x20, 0xf7, 0x21, 0x44, 0x21, 0x91, 0x21, 0x6c, 0x21, 0xd0, 0x20, 0x45, 0x3,
-    0xec, 0xdf, 0xfe, 0xec, 0x45, 0xe7, 0xd5, 0xe9, 0xb2, 0xe8, 0x37, 0xe9, 0xfd, 0xe8, 0x1a, 0xe9, 0xf, 0xe9, 0x16, 0xe9,
-    0x15, 0xe9, 0x18, 0xe9, 0x19, 0xe9, 0x1a, 0xe9, 0x1d, 0xe9, 0x1d, 0xe9, 0x20, 0xe9, 0x20, 0xe9, 0x23, 0xe9, 0x23, 0xe9,
-    0xf4, 0x0, 0x4a, 0x2a, 0xb6, 0x1d, 0x14, 0x23, 0xad, 0x20, 0xbc, 0x21, 0x40, 0x21, 0x74, 0x21, 0x6c, 0x19, 0x73, 0xe8,
-    0x9b, 0xe8, 0x68, 0xe9, 0x6, 0xe9, 0x34, 0xe9, 0x21, 0xe9, 0x2c, 0xe9, 0x29, 0xe9, 0x2d, 0xe9, 0x2d, 0xe9, 0x30, 0xe9,
-    0x31, 0xe9, 0x32, 0xe9, 0x34, 0xe9, 0x35, 0xe9, 0x37, 0xe9, 0x38, 0xe9, 0x3b, 0xe9, 0x3b, 0xe9, 0x3e, 0xe9, 0xcb, 0xf3,
-    0x6b, 0x23, 0x2e, 0x21, 0x69, 0x21, 0x53, 0x21, 0x59, 0x21, 0x54, 0x21, 0x52, 0x21, 0x4, 0x1e, 0xcb, 0xf4, 0xa7, 0xe4,
-    0x41, 0xeb, 0x57, 0xe8, 0xa6, 0xe9, 0x14, 0xe9, 0x57, 0xe9, 0x3b, 0xe9, 0x4a, 0xe9, 0x46, 0xe9, 0x49, 0xe9, 0x4a, 0xe9,
-    0x4c, 0xe9, 0x4d, 0xe9, 0x4f, 0xe9, 0x50, 0xe9, 0x52, 0xe9, 0x53, 0xe9, 0x56, 0xe9, 0x56, 0xe9, 0x9b, 0xee, 0xa4, 0x20,
-    0x84, 0x22, 0xb6, 0x20, 0x8a, 0x21, 0x27, 0x21, 0x50, 0x21, 0x3b, 0x21, 0xa0, 0x1e, 0x79, 0xf8, 0xa7, 0xe3, 0xd3, 0xeb,
-    0x3c, 0xe8, 0xd8, 0xe9, 0x22, 0xe9, 0x76, 0xe9, 0x52, 0xe9, 0x65, 0xe9, 0x5f, 0xe9, 0x63, 0xe9, 0x64, 0xe9, 0x65, 0xe9,
-    0x67, 0xe9, 0x68, 0xe9, 0x6a, 0xe9, 0x6b, 0xe9, 0x6e, 0xe9, 0x6e, 0xe9, 0x71, 0xe9, 0xaf, 0xee, 0x92, 0x20, 0x72, 0x22,
-    0xa4, 0x20, 0x78, 0x21, 0x15, 0x21, 0x3e, 0x21, 0x29, 0x21, 0xe9, 0x1d, 0xeb, 0xf4, 0xe2, 0xe4, 0x71, 0xeb, 0x8c, 0xe8,
-    0xda, 0xe9, 0x46, 0xe9, 0x8b, 0xe9, 0x6e, 0xe9, 0x7d, 0xe9, 0x79, 0xe9, 0x7d, 0xe9, 0x7d, 0xe9, 0x80, 0xe9, 0x80, 0xe9,
-    0x83, 0xe9, 0x83, 0xe9, 0x86, 0xe9, 0x86, 0xe9, 0x89, 0xe9, 0x89, 0xe9, 0x8c, 0xe9, 0x8d, 0xe9, 0x8e, 0xe9, 0x90, 0xe9,
-    0x91, 0xe9, 0x93, 0xe9, 0x94, 0xe9, 0x96, 0xe9, 0x97, 0xe9, 0x99, 0xe9, 0x9a, 0xe9, 0x9c, 0xe9, 0x44, 0xea, 0x52, 0x7,
-    0x20, 0x2a, 0x40, 0x1d, 0xe2, 0x22, 0x5c, 0x20, 0x79, 0x21, 0xf6, 0x20, 0x2d, 0x21, 0x12, 0x21, 0x1b, 0x21, 0x13, 0x21,
-    0x2b, 0x1d, 0x6f, 0xf1, 0x2d, 0xe6, 0x20, 0xeb, 0xed, 0xe8, 0xeb, 0xe9, 0x7b, 0xe9, 0xb0, 0xe9, 0x9a, 0xe9, 0xa7, 0xe9,
-    0xa3, 0xe9, 0xa7, 0xe9, 0xa7, 0xe9, 0xa9, 0xe9, 0xaa, 0xe9, 0xac, 0xe9, 0xad, 0xe9, 0xaf, 0xe9, 0xb0, 0xe9, 0xb3, 0xe9,
-    0xb3, 0xe9, 0xb6, 0xe9, 0xb6, 0xe9, 0xb9, 0xe9, 0xb9, 0xe9, 0xbc, 0xe9, 0xbc, 0xe9, 0xbf, 0xe9, 0xbf, 0xe9, 0xc2, 0xe9,
-    0xbf, 0x3, 0x18, 0x2b, 0xb3, 0x1c, 0xfd, 0x22, 0x2b, 0x20, 0x6a, 0x21, 0xd8, 0x20, 0x17, 0x21, 0xf7, 0x20, 0x2, 0x21,
-    0xfa, 0x20, 0x16, 0x1d, 0x8b, 0xf1, 0x54, 0xe6, 0x42, 0xeb, 0x12, 0xe9, 0xe, 0xea, 0xa0, 0xe9, 0xd3, 0xe9, 0xbf, 0xe9,
-    0xc9, 0xe9, 0xc7, 0xe9, 0xca, 0xe9, 0xcb, 0xe9, 0xcd, 0xe9, 0xce, 0xe9, 0xd0, 0xe9, 0xd1, 0xe9, 0xd3, 0xe9, 0xd4, 0xe9,
-    0xd6, 0xe9, 0xd7, 0xe9, 0xd9, 0xe9, 0xda, 0xe9, 0xdc, 0xe9, 0xdd, 0xe9, 0xdf, 0xe9, 0xe0, 0xe9, 0xe2, 0xe9, 0xe3, 0xe9,
-    0x7c, 0xec, 0xb, 0x12, 0x8e, 0x26, 0x80, 0x1e, 0x9, 0x22, 0x72, 0x20, 0x24, 0x21, 0xd2, 0x20, 0xf3, 0x20, 0xe1, 0x20,
-    0xe6, 0x20, 0xe1, 0x20, 0x5e, 0x11, 0x36, 0xe5, 0x71, 0xeb, 0x33, 0xe9, 0x31, 0xea, 0xc2, 0xe9, 0xf6, 0xe9, 0xe1, 0xe9,
-    0xec, 0xe9, 0xe9, 0xe9, 0xed, 0xe9, 0xed, 0xe9, 0xf0, 0xe9, 0xf0, 0xe9, 0xf3, 0xe9, 0xf3, 0xe9, 0xf6, 0xe9, 0xf6, 0xe9,
-    0xf9, 0xe9, 0xf9, 0xe9, 0xfc, 0xe9, 0xfc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x2, 0xea, 0x2, 0xea, 0x5, 0xea, 0x5, 0xea,
-    0x8, 0xea, 0x12, 0xfc, 0xd5, 0x26, 0x9b, 0x1e, 0xd6, 0x21, 0x66, 0x20, 0x6, 0x21, 0xbb, 0x20, 0xda, 0x20, 0xc9, 0x20,
-    0xcd, 0x20, 0xc8, 0x20, 0xeb, 0x1c, 0xc1, 0xf1, 0xa2, 0xe6, 0x85, 0xeb, 0x5a, 0xe9, 0x54, 0xea, 0xe6, 0xe9, 0x1a, 0xea,
-    0x5, 0xea, 0x10, 0xea, 0xd, 0xea, 0x11, 0xea, 0x11, 0xea, 0x14, 0xea, 0x14, 0xea, 0x17, 0xea, 0x17, 0xea, 0x1a, 0xea,
-    0x1a, 0xea, 0x1d, 0xea, 0x1d, 0xea, 0x20, 0xea, 0x20, 0xea, 0x23, 0xea, 0x23, 0xea, 0x26, 0xea, 0x26, 0xea, 0x28, 0xea,
-    0x29, 0xea, 0xff, 0xf6, 0x13, 0x24, 0xe4, 0x1f, 0x1c, 0x21, 0x94, 0x20, 0xcd, 0x20, 0xb1, 0x20, 0xba, 0x20, 0xb2, 0x20,
-    0xb2, 0x20, 0xb0, 0x20, 0xd5, 0x1c, 0xda, 0xf1, 0xc8, 0xe6, 0xa6, 0xeb, 0x7d, 0xe9, 0x76, 0xea, 0x9, 0xea, 0x3c, 0xea,
-    0x28, 0xea, 0x32, 0xea, 0x30, 0xea, 0x33, 0xea, 0x34, 0xea, 0x35, 0xea, 0x37, 0xea, 0x38, 0xea, 0x3a, 0xea, 0x3b, 0xea,
-    0x3d, 0xea, 0x3e, 0xea, 0x40, 0xea, 0x41, 0xea, 0x43, 0xea, 0x44, 0xea, 0x46, 0xea, 0x47, 0xea, 0x49, 0xea, 0x4a, 0xea,
-    0x4c, 0xea, 0x4b, 0x1, 0x36, 0x29, 0xe, 0x1d, 0x3e, 0x22, 0xec, 0x1f, 0xf2, 0x20, 0x7a, 0x20, 0xac, 0x20, 0x92, 0x20,
-    0x9b, 0x20, 0x94, 0x20, 0xd2, 0x13, 0xfc, 0xe6, 0x25, 0xeb, 0xec, 0xe9, 0x74, 0xea, 0x3a, 0xea, 0x55, 0xea, 0x4c, 0xea,
-    0x52, 0xea, 0x51, 0xea, 0x54, 0xea, 0x55, 0xea, 0x56, 0xea, 0x58, 0xea, 0x59, 0xea, 0x5b, 0xea, 0x5c, 0xea, 0x5e, 0xea,
-    0x5f, 0xea, 0x61, 0xea, 0x62, 0xea, 0x64, 0xea, 0x65, 0xea, 0x67, 0xea, 0x68, 0xea, 0x6a, 0xea, 0x6b, 0xea, 0x6d, 0xea,
-    0x84, 0xef, 0xec, 0x1f, 0xbd, 0x21, 0xfd, 0x1f, 0xcb, 0x20, 0x6b, 0x20, 0x92, 0x20, 0x7e, 0x20, 0x84, 0x20, 0x7e, 0x20,
-    0x7d, 0x20, 0x4e, 0x1d, 0x8e, 0xf5, 0xff, 0xe5, 0x5d, 0xec, 0x8d, 0xe9, 0xd0, 0xea, 0x42, 0xea, 0x84, 0xea, 0x68, 0xea,
-    0x77, 0xea, 0x72, 0xea, 0x77, 0xea, 0x77, 0xea, 0x79, 0xea, 0x7a, 0xea, 0x7c, 0xea, 0x7d, 0xea, 0x7f, 0xea, 0x80, 0xea,
-    0x82, 0xea, 0x83, 0xea, 0x85, 0xea, 0x86, 0xea, 0x88, 0xea, 0x89, 0xea, 0x8b, 0xea, 0x8c, 0xea, 0x8e, 0xea, 0xba, 0xed,
-    0x5a, 0x15, 0xdd, 0x24, 0x83, 0x1e, 0x4f, 0x21, 0xb, 0x20, 0x99, 0x20, 0x57, 0x20, 0x71, 0x20, 0x62, 0x20, 0x65, 0x20,
-    0xda, 0x1d, 0x20, 0xf9, 0x12, 0xe5, 0xf1, 0xec, 0x7b, 0xe9, 0x9, 0xeb, 0x59, 0xea, 0xaa, 0xea, 0x87, 0xea, 0x9a, 0xea,
-    0x93, 0xea, 0x99, 0xea, 0x98, 0xea, 0x9a, 0xea, 0x9b, 0xea, 0x9d, 0xea, 0x9e, 0xea, 0xa0, 0xea, 0xa1, 0xea, 0xa3, 0xea,
-    0xa4, 0xea, 0xa6, 0xea, 0xa7, 0xea, 0xa9, 0xea, 0xaa, 0xea, 0xac, 0xea, 0xad, 0xea, 0xaf, 0xea, 0x1a, 0xef, 0x40, 0x1c,
-    0x9a, 0x22, 0x55, 0x1f, 0xcd, 0x20, 0x21, 0x20, 0x6a, 0x20, 0x46, 0x20, 0x53, 0x20, 0x4b, 0x20, 0x4b, 0x20, 0xdf, 0x1b,
-    0xc6, 0xee, 0x6e, 0xe8, 0xb0, 0xeb, 0x3a, 0xea, 0xe3, 0xea, 0x9a, 0xea, 0xbd, 0xea, 0xaf, 0xea, 0xb8, 0xea, 0xb5, 0xea,
-    0xb9, 0xea, 0xb9, 0xea, 0xbc, 0xea, 0xbc, 0xea, 0xbe, 0xea, 0xbf, 0xea, 0xc1, 0xea, 0xc2, 0xea, 0xc4, 0xea, 0xc5, 0xea,
-    0xc7, 0xea, 0xc8, 0xea, 0xca, 0xea, 0xcb, 0xea, 0xcd, 0xea, 0xce, 0xea, 0xd0, 0xea, 0xe9, 0xfe, 0x60, 0x27, 0x64, 0x1d,
-    0x85, 0x21, 0xac, 0x1f, 0x7b, 0x20, 0x1c, 0x20, 0x43, 0x20, 0x2f, 0x20, 0x34, 0x20, 0x2f, 0x20, 0x9a, 0x9, 0x67, 0xe2,
-    0x55, 0xee, 0x3c, 0xe9, 0x83, 0xeb, 0x80, 0xea, 0xf6, 0xea, 0xc3, 0xea, 0xdd, 0xea, 0xd3, 0xea, 0xda, 0xea, 0xd8, 0xea,
-    0xdb, 0xea, 0xdc, 0xea, 0xde, 0xea, 0xdf, 0xea, 0xe1, 0xea, 0xe2, 0xea, 0xe3, 0xea, 0xe5, 0xea, 0xe6, 0xea, 0xe8, 0xea,
-    0xe9, 0xea, 0xeb, 0xea, 0xec, 0xea, 0xee, 0xea, 0xef, 0xea, 0xf2, 0xf4, 0x1b, 0x22, 0xfc, 0x1f, 0x34, 0x20, 0x20, 0x20,
-    0x25, 0x20, 0x1f, 0x20, 0x1e, 0x20, 0x1c, 0x20, 0x1a, 0x20, 0x17, 0x20, 0x99, 0xe, 0x21, 0xe5, 0x1a, 0xed, 0xf8, 0xe9,
-    0x5c, 0xeb, 0xc0, 0xea, 0x8, 0xeb, 0xe9, 0xea, 0xf9, 0xea, 0xf4, 0xea, 0xf9, 0xea, 0xf9, 0xea, 0xfb, 0xea, 0xfc, 0xea,
-    0xfd, 0xea, 0xff, 0xea, 0x0, 0xeb, 0x2, 0xeb, 0x3, 0xeb, 0x5, 0xeb, 0x6, 0xeb, 0x8, 0xeb, 0x9, 0xeb, 0xb, 0xeb,
-    0xc, 0xeb, 0xd, 0xeb, 0xf, 0xeb, 0x7, 0xf5, 0x0, 0x22, 0xe2, 0x1f, 0x1c, 0x20, 0x6, 0x20, 0xb, 0x20, 0x6, 0x20,
-    0x5, 0x20, 0x3, 0x20, 0x1, 0x20, 0xfd, 0x1f, 0x15, 0xc, 0xff, 0xe3, 0xe3, 0xed, 0xcc, 0xe9, 0x9e, 0xeb, 0xd0, 0xea,
-    0x2e, 0xeb, 0x7, 0xeb, 0x1a, 0xeb, 0x14, 0xeb, 0x19, 0xeb, 0x18, 0xeb, 0x1b, 0xeb, 0x1c, 0xeb, 0x1d, 0xeb, 0x1f, 0xeb,
-    0x20, 0xeb, 0x22, 0xeb, 0x23, 0xeb, 0x25, 0xeb, 0x26, 0xeb, 0x27, 0xeb, 0x29, 0xeb, 0x2a, 0xeb, 0x2c, 0xeb, 0x2d, 0xeb,
-    0x2f, 0xeb, 0x83, 0x1, 0x44, 0x28, 0x77, 0x1c, 0x81, 0x21, 0x41, 0x1f, 0x3f, 0x20, 0xc9, 0x1f, 0xfb, 0x1f, 0xe1, 0x1f,
-    0xea, 0x1f, 0x69, 0x1d, 0x73, 0xf9, 0xcf, 0xe5, 0x85, 0xed, 0x21, 0xea, 0xa6, 0xeb, 0xfb, 0xea, 0x49, 0xeb, 0x29, 0xeb,
-    0x39, 0xeb, 0x34, 0xeb, 0x38, 0xeb, 0x38, 0xeb, 0x3b, 0xeb, 0x3b, 0xeb, 0x3d, 0xeb, 0x3e, 0xeb, 0x40, 0xeb, 0x41, 0xeb,
-    0x43, 0xeb, 0x44, 0xeb, 0x46, 0xeb, 0x47, 0xeb, 0x49, 0xeb, 0x4a, 0xeb, 0x4b, 0xeb, 0x4d, 0xeb, 0x3f, 0xf0, 0x40, 0x1f,
-    0x3, 0x21, 0x51, 0x1f, 0x18, 0x20, 0xbb, 0x1f, 0xe1, 0x1f, 0xcd, 0x1f, 0xd3, 0x1f, 0xcd, 0x1f, 0xcc, 0x1f, 0x96, 0x9,
-    0x8, 0xe3, 0xc4, 0xee, 0xc0, 0xe9, 0xfe, 0xeb, 0x0, 0xeb, 0x73, 0xeb, 0x42, 0xeb, 0x5a, 0xeb, 0x51, 0xeb, 0x57, 0xeb,
-    0x57, 0xeb, 0x59, 0xeb, 0x5a, 0xeb, 0x5b, 0xeb, 0x5d, 0xeb, 0x5e, 0xeb, 0x60, 0xeb, 0x61, 0xeb, 0x63, 0xeb, 0x64, 0xeb,
-    0x65, 0xeb, 0x67, 0xeb, 0x68, 0xeb, 0x6a, 0xeb, 0x6b, 0xeb, 0x1d, 0xef, 0x5f, 0x18, 0xff, 0x22, 0x53, 0x1e, 0x66, 0x20,
-    0x75, 0x1f, 0xdd, 0x1f, 0xab, 0x1f, 0xbe, 0x1f, 0xb3, 0x1f, 0xb5, 0x1f, 0x8, 0xc, 0x73, 0xe4, 0x36, 0xee, 0x2c, 0xea,
-    0xf9, 0xeb, 0x2e, 0xeb, 0x8a, 0xeb, 0x64, 0xeb, 0x77, 0xeb, 0x70, 0xeb, 0x76, 0xeb, 0x75, 0xeb, 0x77, 0xeb, 0x78, 0xeb,
-    0x7a, 0xeb, 0x7b, 0xeb, 0x7d, 0xeb, 0x7e, 0xeb, 0x80, 0xeb, 0x81, 0xeb, 0x82, 0xeb, 0x84, 0xeb, 0x85, 0xeb, 0x87, 0xeb,
-    0x88, 0xeb, 0x8a, 0xeb, 0x71, 0xf0, 0xf, 0x1f, 0xcf, 0x20, 0x20, 0x1f, 0xe6, 0x1f, 0x89, 0x1f, 0xaf, 0x1f, 0x9b, 0x1f,
-    0xa1, 0x1f, 0x9b, 0x1f, 0xfd, 0x1e, 0xc0, 0x3, 0x1f, 0xe3, 0x2f, 0xef, 0xe8, 0xe9, 0x44, 0xec, 0x39, 0xeb, 0xb2, 0xeb,
-    0x7e, 0xeb, 0x97, 0xeb, 0x8e, 0xeb, 0x94, 0xeb, 0x94, 0xeb, 0x96, 0xeb, 0x97, 0xeb, 0x98, 0xeb, 0x9a, 0xeb, 0x9b, 0xeb,
-    0x9d, 0xeb, 0x9e, 0xeb, 0xa0, 0xeb, 0xa1, 0xeb, 0xa2, 0xeb, 0xa4, 0xeb, 0xa5, 0xeb, 0xa7, 0xeb, 0xa8, 0xeb, 0x2e, 0xff,
-    0x7c, 0x26, 0xca, 0x1c, 0xcb, 0x20, 0x1, 0x1f, 0xcb, 0x1f, 0x6c, 0x1f, 0x94, 0x1f, 0x7f, 0x1f, 0x85, 0x1f, 0xa0, 0x1a,
-    0x41, 0xec, 0x83, 0xea, 0x30, 0xec, 0x6a, 0xeb, 0xc4, 0xeb, 0x9e, 0xeb, 0xb1, 0xeb, 0xab, 0xeb, 0xaf, 0xeb, 0xb0, 0xeb,
-    0xb1, 0xeb, 0xb3, 0xeb, 0xb4, 0xeb, 0xb5, 0xeb, 0xb7, 0xeb, 0xb8, 0xeb, 0xba, 0xeb, 0xbb, 0xeb, 0xbd, 0xeb, 0xbe, 0xeb,
-    0xbf, 0xeb, 0xc1, 0xeb, 0xc2, 0xeb, 0xc4, 0xeb, 0xc5, 0xeb, 0x10, 0xf3, 0x1e, 0x20, 0xf4, 0x1f, 0x3a, 0x1f, 0x92, 0x1f,
-    0x66, 0x1f, 0x76, 0x1f, 0x6c, 0x1f, 0x6e, 0x1f, 0x6a, 0x1f, 0x60, 0x1c, 0x68, 0xf6, 0x8a, 0xe7, 0x9f, 0xed, 0xf0, 0xea,
-    0x25, 0xec, 0x9d, 0xeb, 0xdc, 0xeb, 0xc2, 0xeb, 0xcf, 0xeb, 0xcc, 0xeb, 0xcf, 0xeb, 0xd0, 0xeb, 0xd1, 0xeb, 0xd3, 0xeb,
-    0xd4, 0xeb, 0xd6, 0xeb, 0xd7, 0xeb, 0xd8, 0xeb, 0xda, 0xeb, 0xdb, 0xeb, 0xdd, 0xeb, 0xde, 0xeb, 0xdf, 0xeb, 0xe1, 0xeb,
-    0xe2, 0xeb, 0xba, 0xf0, 0xc7, 0x1e, 0x80, 0x20, 0xd6, 0x1e, 0x9b, 0x1f, 0x3f, 0x1f, 0x65, 0x1f, 0x50, 0x1f, 0x56, 0x1f,
-    0x51, 0x1f, 0x4b, 0x1c, 0x7a, 0xf6, 0xac, 0xe7, 0xba, 0xed, 0xe, 0xeb, 0x42, 0xec, 0xba, 0xeb, 0xf9, 0xeb, 0xdf, 0xeb,
-    0xed, 0xeb, 0xe8, 0xeb, 0xed, 0xeb, 0xed, 0xeb, 0xef, 0xeb, 0xf0, 0xeb, 0xf1, 0xeb, 0xf3, 0xeb, 0xf4, 0xeb, 0xf6, 0xeb,
-    0xf7, 0xeb, 0xf8, 0xeb, 0xfa, 0xeb, 0xfb, 0xeb, 0xfd, 0xeb, 0xfe, 0xeb, 0xff, 0xeb, 0xe, 0xf8, 0x65, 0x22, 0x77, 0x1e,
-    0x9e, 0x1f, 0x1d, 0x1f, 0x53, 0x1f, 0x38, 0x1f, 0x40, 0x1f, 0x39, 0x1f, 0x39, 0x1f, 0xfe, 0x17, 0x5b, 0xeb, 0x83, 0xeb,
-    0x3b, 0xec, 0xe4, 0xeb, 0xd, 0xec, 0xfd, 0xeb, 0x5, 0xec, 0x4, 0xec, 0x6, 0xec, 0x7, 0xec, 0x8, 0xec, 0xa, 0xec,
-    0xb, 0xec, 0xc, 0xec, 0xe, 0xec, 0xe, 0xec, 0x10, 0xec, 0x11, 0xec, 0x13, 0xec, 0x14, 0xec, 0x15, 0xec, 0x16, 0xec,
-    0x18, 0xec, 0x19, 0xec, 0x4e, 0xed, 0xbe, 0xa, 0x6f, 0x26, 0xd, 0x1c, 0x98, 0x20, 0x8f, 0x1e, 0x74, 0x1f, 0xb, 0x1f,
-    0x37, 0x1f, 0x20, 0x1f, 0x8e, 0x1e, 0xd6, 0x3, 0xd7, 0xe3, 0xab, 0xef, 0x7e, 0xea, 0xcf, 0xec, 0xc8, 0xeb, 0x40, 0xec,
-    0xb, 0xec, 0x25, 0xec, 0x1b, 0xec, 0x22, 0xec, 0x20, 0xec, 0x23, 0xec, 0x23, 0xec, 0x25, 0xec, 0x26, 0xec, 0x28, 0xec,
-    0x29, 0xec, 0x2a, 0xec, 0x2b, 0xec, 0x2d, 0xec, 0x2e, 0xec, 0x2f, 0xec, 0x31, 0xec, 0x31, 0xec, 0xf4, 0xfc, 0xb0, 0x24,
-    0xb, 0x1d, 0xb, 0x20, 0xb6, 0x1e, 0x4a, 0x1f, 0x5, 0x1f, 0x21, 0x1f, 0x12, 0x1f, 0x15, 0x1f, 0x54, 0xe, 0xa2, 0xe6,
-    0x44, 0xee, 0x44, 0xeb, 0x98, 0xec, 0x3, 0xec, 0x47, 0xec, 0x2a, 0xec, 0x39, 0xec, 0x34, 0xec, 0x39, 0xec, 0x38, 0xec,
-    0x3a, 0xec, 0x3b, 0xec, 0x3d, 0xec, 0x3e, 0xec, 0x3f, 0xec, 0x40, 0xec, 0x42, 0xec, 0x43, 0xec, 0x44, 0xec, 0x45, 0xec,
-    0x47, 0xec, 0x48, 0xec, 0x49, 0xec, 0x9c, 0xfa, 0x60, 0x23, 0x9f, 0x1d, 0xaf, 0x1f, 0xc6, 0x1e, 0x2a, 0x1f, 0xfb, 0x1e,
-    0xd, 0x1f, 0x2, 0x1f, 0x4, 0x1f, 0x50, 0xe, 0xbe, 0xe6, 0x5a, 0xee, 0x5c, 0xeb, 0xb0, 0xec, 0x1a, 0xec, 0x5f, 0xec,
-    0x42, 0xec, 0x51, 0xec, 0x4b, 0xec, 0x50, 0xec, 0x50, 0xec, 0x52, 0xec, 0x52, 0xec, 0x54, 0xec, 0x55, 0xec, 0x57, 0xec,
-    0x58, 0xec, 0x59, 0xec, 0x5a, 0xec, 0x5c, 0xec, 0x5d, 0xec, 0x5e, 0xec, 0x5f, 0xec, 0x61, 0xec, 0xca, 0x1, 0xf6, 0x26,
-    0xa5, 0x1b, 0x7a, 0x20, 0x51, 0x1e, 0x44, 0x1f, 0xd5, 0x1e, 0x4, 0x1f, 0xec, 0x1e, 0x5c, 0x1e, 0xe3, 0x3, 0x32, 0xe4,
-    0xea, 0xef, 0xc9, 0xea, 0x14, 0xed, 0xf, 0xec, 0x86, 0xec, 0x52, 0xec, 0x6b, 0xec, 0x62, 0xec, 0x68, 0xec, 0x67, 0xec,
-    0x69, 0xec, 0x6a, 0xec, 0x6c, 0xec, 0x6d, 0xec, 0x6e, 0xec, 0x6f, 0xec, 0x71, 0xec, 0x72, 0xec, 0x73, 0xec, 0x74, 0xec,
-    0x76, 0xec, 0x77, 0xec, 0x6f, 0xef, 0x87, 0x14, 0xd, 0x23, 0x1a, 0x1d, 0xba, 0x1f, 0x8b, 0x1e, 0xf, 0x1f, 0xd1, 0x1e,
-    0xea, 0x1e, 0xdc, 0x1e, 0x23, 0x1a, 0xb, 0xed, 0x5a, 0xeb, 0xfa, 0xec, 0x39, 0xec, 0x91, 0xec, 0x6c, 0xec, 0x7e, 0xec,
-    0x78, 0xec, 0x7d, 0xec, 0x7c, 0xec, 0x7e, 0xec, 0x7f, 0xec, 0x81, 0xec, 0x82, 0xec, 0x83, 0xec, 0x85, 0xec, 0x85, 0xec,
-    0x87, 0xec, 0x88, 0xec, 0x8a, 0xec, 0x8a, 0xec, 0x8c, 0xec, 0x8d, 0xec, 0x8f, 0xec, 0xd6, 0x1, 0xc6, 0x26, 0x88, 0x1b,
-    0x54, 0x20, 0x2f, 0x1e, 0x21, 0x1f, 0xb2, 0x1e, 0xe1, 0x1e, 0xc9, 0x1e, 0xb, 0x1d, 0x68, 0xfd, 0x6e, 0xe6, 0x36, 0xef,
-    0x5b, 0xeb, 0x15, 0xed, 0x52, 0xec, 0xaa, 0xec, 0x85, 0xec, 0x97, 0xec, 0x91, 0xec, 0x96, 0xec, 0x95, 0xec, 0x97, 0xec,
-    0x98, 0xec, 0x9a, 0xec, 0x9b, 0xec, 0x9c, 0xec, 0x9d, 0xec, 0x9f, 0xec, 0xa0, 0xec, 0xa1, 0xec, 0xa2, 0xec, 0xa4, 0xec,
-    0xa5, 0xec, 0x24, 0xfd, 0x42, 0x24, 0xbb, 0x1c, 0xb0, 0x1f, 0x5f, 0x1e, 0xf2, 0x1e, 0xad, 0x1e, 0xc9, 0x1e, 0xba, 0x1e,
-    0xf9, 0x1c, 0x72, 0xfd, 0x8a, 0xe6, 0x4a, 0xef, 0x73, 0xeb, 0x2b, 0xed, 0x69, 0xec, 0xc1, 0xec, 0x9c, 0xec, 0xae, 0xec,
-    0xa8, 0xec, 0xac, 0xec, 0xac, 0xec, 0xae, 0xec, 0xaf, 0xec, 0xb0, 0xec, 0xb2, 0xec, 0xb2, 0xec, 0xb4, 0xec, 0xb5, 0xec,
-    0xb7, 0xec, 0xb7, 0xec, 0xb9, 0xec, 0xba, 0xec, 0xbb, 0xec, 0xe2, 0x1, 0x97, 0x26, 0x6a, 0x1b, 0x2f, 0x20, 0xd, 0x1e,
-    0xfe, 0x1e, 0x8f, 0x1e, 0xbe, 0x1e, 0xa6, 0x1e, 0x29, 0x1b, 0xc5, 0xf3, 0xa2, 0xe9, 0x17, 0xee, 0x1d, 0xec, 0x0, 0xed,
-    0x9c, 0xec, 0xcb, 0xec, 0xb8, 0xec, 0xc2, 0xec, 0xbf, 0xec, 0xc3, 0xec, 0xc2, 0xec, 0xc5, 0xec, 0xc5, 0xec, 0xc7, 0xec,
-    0xc8, 0xec, 0xc9, 0xec, 0xcb, 0xec, 0xcc, 0xec, 0xcd, 0xec, 0xce, 0xec, 0xd0, 0xec, 0xd0, 0xec, 0x2a, 0xef, 0x28, 0x11,
-    0xb9, 0x23, 0x6f, 0x1c, 0xa3, 0x1f, 0x32, 0x1e, 0xd3, 0x1e, 0x88, 0x1e, 0xa7, 0x1e, 0x96, 0x1e, 0xe8, 0x12, 0xc6, 0xe9,
-    0x99, 0xed, 0x79, 0xec, 0xf5, 0xec, 0xc0, 0xec, 0xda, 0xec, 0xd0, 0xec, 0xd6, 0xec, 0xd5, 0xec, 0xd8, 0xec, 0xd8, 0xec,
-    0xda, 0xec, 0xdb, 0xec, 0xdc, 0xec, 0xdd, 0xec, 0xdf, 0xec, 0xe0, 0xec, 0xe1, 0xec, 0xe2, 0xec, 0xe4, 0xec, 0xe5, 0xec,
-    0xe6, 0xec, 0xe7, 0xec, 0x41, 0xfd, 0x0, 0x24, 0x8c, 0x1c, 0x79, 0x1f, 0x2c, 0x1e, 0xbd, 0x1e, 0x79, 0x1e, 0x95, 0x1e,
-    0x86, 0x1e, 0xa, 0x1b, 0xe7, 0xf3, 0xd3, 0xe9, 0x42, 0xee, 0x49, 0xec, 0x2c, 0xed, 0xc9, 0xec, 0xf7, 0xec, 0xe4, 0xec,
-    0xee, 0xec, 0xeb, 0xec, 0xef, 0xec, 0xef, 0xec, 0xf1, 0xec, 0xf1, 0xec, 0xf3, 0xec, 0xf4, 0xec, 0xf5, 0xec, 0xf7, 0xec,
-    0xf8, 0xec, 0xf9, 0xec, 0xfa, 0xec, 0xfc, 0xec, 0xfc, 0xec, 0xfa, 0xf3, 0x23, 0x1f, 0xfb, 0x1e, 0x49, 0x1e, 0x9d, 0x1e,
-    0x74, 0x1e, 0x83, 0x1e, 0x79, 0x1e, 0x7b, 0x1e, 0x4e, 0x1d, 0xcc, 0x0, 0xf8, 0xe5, 0x7, 0xf0, 0x9f, 0xeb, 0x97, 0xed,
-    0xb8, 0xec, 0x1d, 0xed, 0xf2, 0xec, 0x7, 0xed, 0x0, 0xed, 0x4, 0xed, 0x4, 0xed, 0x6, 0xed, 0x7, 0xed, 0x8, 0xed,
-    0xa, 0xed, 0xb, 0xed, 0xc, 0xed, 0xd, 0xed, 0xf, 0xed, 0xf, 0xed, 0x11, 0xed, 0x12, 0xed, 0xa, 0xf4, 0x11, 0x1f,
-    0xe9, 0x1e, 0x37, 0x1e, 0x8b, 0x1e, 0x62, 0x1e, 0x71, 0x1e, 0x68, 0x1e, 0x6a, 0x1e, 0x14, 0x1c, 0x6d, 0xfa, 0xb, 0xe8,
-    0x42, 0xef, 0x16, 0xec, 0x82, 0xed, 0xe1, 0xec, 0x2b, 0xed, 0xb, 0xed, 0x1b, 0xed, 0x16, 0xed, 0x1a, 0xed, 0x1a, 0xed,
-    0x1c, 0xed, 0x1d, 0xed, 0x1e, 0xed, 0x1f, 0xed, 0x21, 0xed, 0x21, 0xed, 0x23, 0xed, 0x24, 0xed, 0x26, 0xed, 0x26, 0xed,
-    0x28, 0xed, 0xb, 0xfb, 0x91, 0x22, 0xfc, 0x1c, 0xfd, 0x1e, 0x1a, 0x1e, 0x7b, 0x1e, 0x4d, 0x1e, 0x5f, 0x1e, 0x54, 0x1e,
-    0x4a, 0x1a, 0xe8, 0xf0, 0x16, 0xeb, 0x13, 0xee, 0xbc, 0xec, 0x57, 0xed, 0x13, 0xed, 0x34, 0xed, 0x26, 0xed, 0x2e, 0xed,
-    0x2d, 0xed, 0x2f, 0xed, 0x30, 0xed, 0x31, 0xed, 0x32, 0xed, 0x34, 0xed, 0x35, 0xed, 0x36, 0xed, 0x37, 0xed, 0x39, 0xed,
-    0x39, 0xed, 0x3b, 0xed, 0x3c, 0xed, 0xf8, 0xee, 0xd9, 0xd, 0x4a, 0x24, 0xb6, 0x1b, 0x79, 0x1f, 0xc8, 0x1d, 0x86, 0x1e,
-    0x2e, 0x1e, 0x53, 0x1e, 0x3f, 0x1e, 0x3a, 0x7, 0x52, 0xe4, 0x17, 0xf1, 0x82, 0xeb, 0x1, 0xee, 0xe5, 0xec, 0x66, 0xed,
-    0x2e, 0xed, 0x48, 0xed, 0x3f, 0xed, 0x44, 0xed, 0x44, 0xed, 0x46, 0xed, 0x46, 0xed, 0x48, 0xed, 0x49, 0xed, 0x4b, 0xed,
-    0x4b, 0xed, 0x4d, 0xed, 0x4e, 0xed, 0x4f, 0xed, 0x51, 0xed, 0x51, 0xed, 0x6b, 0xfd, 0x96, 0x23, 0x3d, 0x1c, 0x20, 0x1f,
-    0xd8, 0x1d, 0x66, 0x1e, 0x24, 0x1e, 0x3f, 0x1e, 0x31, 0x1e, 0x4, 0x15, 0x84, 0xeb, 0x78, 0xed, 0x43, 0xed, 0x56, 0xed,
-    0x4f, 0xed, 0x53, 0xed, 0x54, 0xed, 0x55, 0xed, 0x56, 0xed, 0x58, 0xed, 0x58, 0xed, 0x5a, 0xed, 0x5b, 0xed, 0x5c, 0xed,
-    0x5e, 0xed, 0x5e, 0xed, 0x60, 0xed, 0x61, 0xed, 0x62, 0xed, 0x64, 0xed, 0x65, 0xed, 0x66, 0xed, 0x92, 0xf6, 0xf9, 0x1f,
-    0x5, 0x1e, 0x3b, 0x1e, 0x27, 0x1e, 0x2c, 0x1e, 0x27, 0x1e, 0x26, 0x1e, 0x24, 0x1e, 0x8d, 0x19, 0xf6, 0xed, 0x52, 0xec,
-    0xe5, 0xed, 0x2a, 0xed, 0x80, 0xed, 0x5b, 0xed, 0x6e, 0xed, 0x67, 0xed, 0x6b, 0xed, 0x6c, 0xed, 0x6d, 0xed, 0x6e, 0xed,
-    0x70, 0xed, 0x70, 0xed, 0x72, 0xed, 0x73, 0xed, 0x75, 0xed, 0x75, 0xed, 0x77, 0xed, 0x78, 0xed, 0x79, 0xed, 0x7b, 0xed,
-    0xe9, 0xf8, 0x12, 0x21, 0x58, 0x1d, 0x6f, 0x1e, 0xf6, 0x1d, 0x28, 0x1e, 0xe, 0x1e, 0x17, 0x1e, 0x11, 0x1e, 0xef, 0x14,
-    0xb0, 0xeb, 0xa1, 0xed, 0x6c, 0xed, 0x7f, 0xed, 0x78, 0xed, 0x7c, 0xed, 0x7d, 0xed, 0x7e, 0xed, 0x7f, 0xed, 0x81, 0xed,
-    0x81, 0xed, 0x83, 0xed, 0x84, 0xed, 0x85, 0xed, 0x87, 0xed, 0x87, 0xed, 0x89, 0xed, 0x8a, 0xed, 0x8b, 0xed, 0x8d, 0xed,
-    0x8d, 0xed, 0x8f, 0xed, 0x12, 0x2, 0xaf, 0x25, 0xd7, 0x1a, 0x78, 0x1f, 0x66, 0x1d, 0x4f, 0x1e, 0xe4, 0x1d, 0x11, 0x1e,
-    0xfa, 0x1d, 0x84, 0x9, 0xeb, 0xe5, 0xc1, 0xf0, 0x1f, 0xec, 0x31, 0xee, 0x46, 0xed, 0xb1, 0xed, 0x83, 0xed, 0x99, 0xed,
-    0x91, 0xed, 0x96, 0xed, 0x96, 0xed, 0x98, 0xed, 0x98, 0xed, 0x9a, 0xed, 0x9b, 0xed, 0x9c, 0xed, 0x9e, 0xed, 0x9e, 0xed,
-    0xa0, 0xed, 0xa1, 0xed, 0xa2, 0xed, 0xc, 0xf1, 0x27, 0x17, 0xf9, 0x20, 0xa7, 0x1c, 0x91, 0x1e, 0xb3, 0x1d, 0x13, 0x1e,
-    0xe5, 0x1d, 0xf7, 0x1d, 0xf3, 0x19, 0x54, 0xf1, 0x9a, 0xeb, 0x8a, 0xee, 0x39, 0xed, 0xd1, 0xed, 0x8f, 0xed, 0xae, 0xed,
-    0xa2, 0xed, 0xa9, 0xed, 0xa8, 0xed, 0xaa, 0xed, 0xab, 0xed, 0xac, 0xed, 0xad, 0xed, 0xaf, 0xed, 0xaf, 0xed, 0xb1, 0xed,
-    0xb2, 0xed, 0xb3, 0xed, 0xb5, 0xed, 0xb5, 0xed, 0xb7, 0xed, 0x5f, 0x4, 0xab, 0x26, 0x1f, 0x1a, 0x9a, 0x1f, 0x26, 0x1d,
-    0x3b, 0x1e, 0xbc, 0x1d, 0xf2, 0x1d, 0xb5, 0x1c, 0x1, 0x1, 0xe1, 0xe6, 0xad, 0xf0, 0x62, 0xec, 0x4d, 0xee, 0x74, 0xed,
-    0xd7, 0xed, 0xac, 0xed, 0xc1, 0xed, 0xb9, 0xed, 0xbf, 0xed, 0xbe, 0xed, 0xc0, 0xed, 0xc1, 0xed, 0xc2, 0xed, 0xc3, 0xed,
-    0xc5, 0xed, 0xc5, 0xed, 0xc7, 0xed, 0xc8, 0xed, 0xc9, 0xed, 0xca, 0xed, 0x9b, 0xfd, 0x18, 0x23, 0xe1, 0x1b, 0xb6, 0x1e,
-    0x74, 0x1d, 0xff, 0x1d, 0xbe, 0x1d, 0xd9, 0x1d, 0xca, 0x1d, 0x3d, 0x7, 0x10, 0xe5, 0x90, 0xf1, 0x19, 0xec, 0x8a, 0xee,
-    0x75, 0xed, 0xf2, 0xed, 0xbc, 0xed, 0xd6, 0xed, 0xcc, 0xed, 0xd3, 0xed, 0xd1, 0xed, 0xd4, 0xed, 0xd4, 0xed, 0xd6, 0xed,
-    0xd6, 0xed, 0xd8, 0xed, 0xd9, 0xed, 0xda, 0xed, 0xdc, 0xed, 0xdc, 0xed, 0xde, 0xed, 0xa2, 0xfd, 0x3, 0x23, 0xd1, 0x1b,
-    0xa4, 0x1e, 0x63, 0x1d, 0xef, 0x1d, 0xae, 0x1d, 0xc9, 0x1d, 0x2a, 0x1d, 0x23, 0x4, 0x1f, 0xe6, 0x38, 0xf1, 0x5c, 0xec,
-    0x89, 0xee, 0x92, 0xed, 0x2, 0xee, 0xd2, 0xed, 0xe9, 0xed, 0xe0, 0xed, 0xe6, 0xed, 0xe5, 0xed, 0xe7, 0xed, 0xe8, 0xed,
-    0xe9, 0xed, 0xeb, 0xed, 0xeb, 0xed, 0xed, 0xed, 0xee, 0xed, 0xef, 0xed, 0xf0, 0xed, 0xf2, 0xed, 0x67, 0x4, 0x64, 0x26,
-    0xf5, 0x19, 0x63, 0x1f, 0xf4, 0x1c, 0x7, 0x1e, 0x8a, 0x1d, 0xc0, 0x1d, 0x67, 0x1b, 0xe0, 0xfa, 0x13, 0xe9, 0x10, 0xf0,
-    0xfd, 0xec, 0x5d, 0xee, 0xc2, 0xed, 0x9, 0xee, 0xeb, 0xed, 0xfa, 0xed, 0xf5, 0xed, 0xf9, 0xed, 0xf9, 0xed, 0xfb, 0xed,
-    0xfb, 0xed, 0xfd, 0xed, 0xfe, 0xed, 0xff, 0xed, 0x1, 0xee, 0x1, 0xee, 0x3, 0xee, 0x4, 0xee, 0x61, 0xf1, 0xed, 0x16,
-    0x99, 0x20, 0x58, 0x1c, 0x3b, 0x1e, 0x60, 0x1d, 0xbf, 0x1d, 0x91, 0x1d, 0xa3, 0x1d, 0x69, 0x12, 0x1f, 0xeb, 0xc3, 0xee,
-    0xb1, 0xed, 0x27, 0xee, 0xf5, 0xed, 0xd, 0xee, 0x4, 0xee, 0xa, 0xee, 0x9, 0xee, 0xb, 0xee, 0xc, 0xee, 0xd, 0xee,
-    0xe, 0xee, 0xf, 0xee, 0x11, 0xee, 0x11, 0xee, 0x13, 0xee, 0x14, 0xee, 0x15, 0xee, 0x17, 0xee, 0x17, 0xee, 0x30, 0x2,
-    0x11, 0x25, 0x72, 0x1a, 0xfb, 0x1e, 0xf3, 0x1c, 0xd8, 0x1d, 0x6f, 0x1d, 0x9b, 0x1d, 0xbb, 0x1a, 0xe0, 0xf7, 0x32, 0xea,
-    0xcb, 0xef, 0x53, 0xed, 0x6e, 0xee, 0xf2, 0xed, 0x2b, 0xee, 0x13, 0xee, 0x1f, 0xee, 0x1c, 0xee, 0x1f, 0xee, 0x1f, 0xee,
-    0x21, 0xee, 0x22, 0xee, 0x23, 0xee, 0x24, 0xee, 0x26, 0xee, 0x26, 0xee, 0x28, 0xee, 0x29, 0xee, 0x2a, 0xee, 0x4c, 0xf9,
-    0x67, 0x20, 0xc6, 0x1c, 0xd6, 0x1d, 0x60, 0x1d, 0x90, 0x1d, 0x78, 0x1d, 0x80, 0x1d, 0x5d, 0x1c, 0x1b, 0x1, 0x74, 0xe7,
-    0x13, 0xf1, 0xdc, 0xec, 0xbf, 0xee, 0xe8, 0xed, 0x4a, 0xee, 0x20, 0xee, 0x34, 0xee, 0x2d, 0xee, 0x32, 0xee, 0x31, 0xee,
-    0x34, 0xee, 0x34, 0xee, 0x36, 0xee, 0x36, 0xee, 0x38, 0xee, 0x39, 0xee, 0x3a, 0xee, 0x3c, 0xee, 0x3c, 0xee, 0x1e, 0xf7,
-    0x31, 0x1f, 0x4d, 0x1d, 0x80, 0x1d, 0x6d, 0x1d, 0x72, 0x1d, 0x6d, 0x1d, 0x6c, 0x1d, 0x4e, 0x1c, 0x1f, 0x1, 0x8c, 0xe7,
-    0x23, 0xf1, 0xef, 0xec, 0xd0, 0xee, 0xfc, 0xed, 0x5c, 0xee, 0x33, 0xee, 0x47, 0xee, 0x40, 0xee, 0x44, 0xee, 0x44, 0xee,
-    0x46, 0xee, 0x47, 0xee, 0x48, 0xee, 0x49, 0xee, 0x4b, 0xee, 0x4b, 0xee, 0x4d, 0xee, 0x4e, 0xee, 0x4f, 0xee, 0x96, 0xfb,
-    0x65, 0x21, 0xd, 0x1c, 0xf9, 0x1d, 0x1f, 0x1d, 0x7c, 0x1d, 0x50, 0x1d, 0x60, 0x1d, 0x94, 0x1a, 0x0, 0xf8, 0x74, 0xea,
-    0xff, 0xef, 0x8d, 0xed, 0xa5, 0xee, 0x2a, 0xee, 0x63, 0xee, 0x4b, 0xee, 0x57, 0xee, 0x54, 0xee, 0x56, 0xee, 0x57, 0xee,
-    0x59, 0xee, 0x59, 0xee, 0x5b, 0xee, 0x5c, 0xee, 0x5d, 0xee, 0x5e, 0xee, 0x60, 0xee, 0x60, 0xee, 0xef, 0xee, 0x7e, 0x7,
-    0xea, 0x24, 0x8, 0x1a, 0xca, 0x1e, 0xa8, 0x1c, 0x99, 0x1d, 0x2a, 0x1d, 0x59, 0x1d, 0x70, 0x14, 0xab, 0xec, 0x85, 0xee,
-    0x54, 0xee, 0x65, 0xee, 0x5f, 0xee, 0x64, 0xee, 0x63, 0xee, 0x66, 0xee, 0x66, 0xee, 0x68, 0xee, 0x68, 0xee, 0x6a, 0xee,
-    0x6b, 0xee, 0x6c, 0xee, 0x6e, 0xee, 0x6e, 0xee, 0x70, 0xee, 0x71, 0xee, 0x72, 0xee, 0x73, 0xee, 0xdb, 0xf2, 0xb7, 0x1c,
-    0x4a, 0x1e, 0xc6, 0x1c, 0x79, 0x1d, 0x26, 0x1d, 0x48, 0x1d, 0x36, 0x1d, 0x95, 0x1b, 0x24, 0xfe, 0xc1, 0xe8, 0xed, 0xf0,
-    0x56, 0xed, 0xf2, 0xee, 0x3c, 0xee, 0x8f, 0xee, 0x6c, 0xee, 0x7d, 0xee, 0x77, 0xee, 0x7b, 0xee, 0x7b, 0xee, 0x7d, 0xee,
-    0x7e, 0xee, 0x7f, 0xee, 0x80, 0xee, 0x81, 0xee, 0x83, 0xee, 0x83, 0xee, 0x85, 0xee, 0x2b, 0xf0, 0x89, 0xd, 0xe1, 0x22,
-    0xb8, 0x1a, 0x4c, 0x1e, 0xb1, 0x1c, 0x65, 0x1d, 0x12, 0x1d, 0x34, 0x1d, 0x9a, 0xb, 0x4f, 0xe8, 0x2, 0xf1, 0x69, 0xed,
-    0x3, 0xef, 0x4e, 0xee, 0xa1, 0xee, 0x7d, 0xee, 0x8e, 0xee, 0x89, 0xee, 0x8d, 0xee, 0x8d, 0xee, 0x8f, 0xee, 0x8f, 0xee,
-    0x91, 0xee, 0x92, 0xee, 0x93, 0xee, 0x94, 0xee, 0x95, 0xee, 0x97, 0xee, 0x97, 0xee, 0x79, 0x4, 0x96, 0x25, 0x79, 0x19,
-    0xc3, 0x1e, 0x64, 0x1c, 0x70, 0x1d, 0xf6, 0x1c, 0x29, 0x1d, 0xf3, 0xf, 0xa6, 0xea, 0xe6, 0xef, 0x3, 0xee, 0xd8, 0xee,
-    0x7b, 0xee, 0xa6, 0xee, 0x94, 0xee, 0x9e, 0xee, 0x9b, 0xee, 0x9e, 0xee, 0x9f, 0xee, 0xa0, 0xee, 0xa1, 0xee, 0xa3, 0xee,
-    0xa3, 0xee, 0xa5, 0xee, 0xa6, 0xee, 0xa7, 0xee, 0xa8, 0xee, 0xa9, 0xee, 0x7b, 0x4, 0x7e, 0x25, 0x6b, 0x19, 0xb1, 0x1e,
-    0x55, 0x1c, 0x60, 0x1d, 0xe6, 0x1c, 0x19, 0x1d, 0xec, 0xf, 0xba, 0xea, 0xf7, 0xef, 0x15, 0xee, 0xe9, 0xee, 0x8d, 0xee,
-    0xb8, 0xee, 0xa6, 0xee, 0xb0, 0xee, 0xad, 0xee, 0xb0, 0xee, 0xb0, 0xee, 0xb2, 0xee, 0xb3, 0xee, 0xb4, 0xee, 0xb5, 0xee,
-    0xb6, 0xee, 0xb8, 0xee, 0xb8, 0xee, 0xba, 0xee, 0xd1, 0xef, 0x7c, 0xa, 0x8f, 0x23, 0x28, 0x1a, 0x46, 0x1e, 0x6c, 0x1c,
-    0x3d, 0x1d, 0xdd, 0x1c, 0x5, 0x1d, 0xf0, 0x1c, 0xf6, 0x1c, 0xf1, 0x1c, 0xae, 0x19, 0x3e, 0xf5, 0xda, 0xeb, 0xfb, 0xef,
-    0x25, 0xee, 0xf9, 0xee, 0x9c, 0xee, 0xc7, 0xee, 0xb6, 0xee, 0xbf, 0xee, 0xbc, 0xee, 0xc0, 0xee, 0xbf, 0xee, 0xc1, 0xee,
-    0xc2, 0xee, 0xc4, 0xee, 0xc4, 0xee, 0xc6, 0xee, 0xc7, 0xee, 0xc8, 0xee, 0xc9, 0xee, 0xca, 0xee, 0xcc, 0xee, 0xcc, 0xee,
-    0xce, 0xee, 0xcf, 0xee, 0xd0, 0xee, 0xd1, 0xee, 0xd2, 0xee, 0xd4, 0xee, 0x29, 0x0, 0xf, 0x23, 0x72, 0x1a, 0x1, 0x1e,
-    0x6a, 0x1c, 0x1c, 0x1d, 0xca, 0x1c, 0xec, 0x1c, 0xda, 0x1c, 0xdf, 0x1c, 0xda, 0x1c, 0xb0, 0x1a, 0x47, 0xfb, 0x20, 0xea,
-    0xdc, 0xf0, 0xe5, 0xed, 0x3a, 0xef, 0xa3, 0xee, 0xe8, 0xee, 0xcb, 0xee, 0xda, 0xee, 0xd4, 0xee, 0xd9, 0xee, 0xd8, 0xee,
-    0xda, 0xee, 0xdb, 0xee, 0xdc, 0xee, 0xde, 0xee, 0xde, 0xee, 0xe0, 0xee, 0xe1, 0xee, 0xe2, 0xee, 0xe3, 0xee, 0xe4, 0xee,
-    0xe6, 0xee, 0xe6, 0xee, 0xe8, 0xee, 0xe9, 0xee, 0xea, 0xee, 0xeb, 0xee, 0xec, 0xee, 0x80, 0x4, 0x28, 0x25, 0x36, 0x19,
-    0x6d, 0x1e, 0x17, 0x1c, 0x20, 0x1d, 0xa7, 0x1c, 0xda, 0x1c, 0xc0, 0x1c, 0xc9, 0x1c, 0xc2, 0x1c, 0xfd, 0x18, 0x69, 0xf2,
-    0xfd, 0xec, 0xc6, 0xef, 0x85, 0xee, 0x16, 0xef, 0xd7, 0xee, 0xf5, 0xee, 0xe9, 0xee, 0xf0, 0xee, 0xef, 0xee, 0xf1, 0xee,
-    0xf2, 0xee, 0xf3, 0xee, 0xf4, 0xee, 0xf5, 0xee, 0xf7, 0xee, 0xf7, 0xee, 0xf9, 0xee, 0xfa, 0xee, 0xfb, 0xee, 0xfc, 0xee,
-    0xfd, 0xee, 0xfe, 0xee, 0x0, 0xef, 0x0, 0xef, 0x2, 0xef, 0x3, 0xef, 0x4, 0xef, 0xc7, 0xf2, 0x3d, 0x19, 0xa6, 0x1e,
-    0xdd, 0x1b, 0x1c, 0x1d, 0x8a, 0x1c, 0xc9, 0x1c, 0xab, 0x1c, 0xb6, 0x1c, 0xae, 0x1c, 0xae, 0x1c, 0xac, 0x1c, 0x5a, 0x9,
-    0xd1, 0xe7, 0x5, 0xf2, 0xa9, 0xed, 0x9b, 0xef, 0xbf, 0xee, 0x22, 0xef, 0xf7, 0xee, 0xc, 0xef, 0x5, 0xef, 0x9, 0xef,
-    0x9, 0xef, 0xb, 0xef, 0xc, 0xef, 0xd, 0xef, 0xe, 0xef, 0x10, 0xef, 0x10, 0xef, 0x12, 0xef, 0x12, 0xef, 0x14, 0xef,
-    0x15, 0xef, 0x16, 0xef, 0x17, 0xef, 0x19, 0xef, 0x19, 0xef, 0x1b, 0xef, 0x1c, 0xef, 0xb8, 0xf0, 0x5d, 0xd, 0x2f, 0x22,
-    0x3a, 0x1a, 0xb7, 0x1d, 0x26, 0x1c, 0xd6, 0x1c, 0x84, 0x1c, 0xa6, 0x1c, 0x94, 0x1c, 0x99, 0x1c, 0x94, 0x1c, 0x9e, 0xd,
-    0x22, 0xea, 0xf6, 0xf0, 0x46, 0xee, 0x77, 0xef, 0xf1, 0xee, 0x2f, 0xef, 0x14, 0xef, 0x22, 0xef, 0x1e, 0xef, 0x21, 0xef,
-    0x21, 0xef, 0x23, 0xef, 0x24, 0xef, 0x25, 0xef, 0x26, 0xef, 0x27, 0xef, 0x29, 0xef, 0x29, 0xef, 0x2b, 0xef, 0x2b, 0xef,
-    0x2d, 0xef, 0x2e, 0xef, 0x2f, 0xef, 0x30, 0xef, 0x32, 0xef, 0x32, 0xef, 0x34, 0xef, 0x56, 0xf1, 0x46, 0x10, 0x2a, 0x21,
-    0x88, 0x1a, 0x72, 0x1d, 0x22, 0x1c, 0xb6, 0x1c, 0x71, 0x1c, 0x8d, 0x1c, 0x7e, 0x1c, 0x81, 0x1c, 0x7d, 0x1c, 0x33, 0x7,
-    0xf8, 0xe6, 0xc1, 0xf2, 0x9a, 0xed, 0xe8, 0xef, 0xe2, 0xee, 0x58, 0xef, 0x25, 0xef, 0x3d, 0xef, 0x34, 0xef, 0x3a, 0xef,
-    0x39, 0xef, 0x3b, 0xef, 0x3c, 0xef, 0x3d, 0xef, 0x3e, 0xef, 0x3f, 0xef, 0x41, 0xef, 0x41, 0xef, 0x43, 0xef, 0x43, 0xef,
-    0x45, 0xef, 0x46, 0xef, 0x47, 0xef, 0x48, 0xef, 0x49, 0xef, 0x4b, 0xef, 0x4b, 0xef, 0xcb, 0xf7, 0x1e, 0x1e, 0x51, 0x1c,
-    0x82, 0x1c, 0x6f, 0x1c, 0x74, 0x1c, 0x6f, 0x1c, 0x6e, 0x1c, 0x6c, 0x1c, 0x6a, 0x1c, 0x68, 0x1c, 0xb0, 0x18, 0xbc, 0xf2,
-    0x64, 0xed, 0x22, 0xf0, 0xe7, 0xee, 0x76, 0xef, 0x37, 0xef, 0x55, 0xef, 0x49, 0xef, 0x50, 0xef, 0x4f, 0xef, 0x51, 0xef,
-    0x51, 0xef, 0x53, 0xef, 0x54, 0xef, 0x55, 0xef, 0x56, 0xef, 0x57, 0xef, 0x58, 0xef, 0x5a, 0xef, 0x5a, 0xef, 0x5c, 0xef,
-    0x5d, 0xef, 0x5e, 0xef, 0x5f, 0xef, 0x60, 0xef, 0x61, 0xef, 0x63, 0xef, 0x8, 0xf2, 0x1b, 0x13, 0xe, 0x20, 0xc0, 0x1a,
-    0x17, 0x1d, 0x8, 0x1c, 0x7f, 0x1c, 0x47, 0x1c, 0x5d, 0x1c, 0x50, 0x1c, 0x53, 0x1c, 0xba, 0x1a, 0x74, 0xfe, 0xe7, 0xe9,
-    0xc2, 0xf1, 0x4f, 0xee, 0xdb, 0xef, 0x2b, 0xef, 0x7b, 0xef, 0x59, 0xef, 0x6a, 0xef, 0x64, 0xef, 0x68, 0xef, 0x68, 0xef,
-    0x6a, 0xef, 0x6b, 0xef, 0x6c, 0xef, 0x6d, 0xef, 0x6e, 0xef, 0x6f, 0xef, 0x71, 0xef, 0x71, 0xef, 0x73, 0xef, 0x73, 0xef,
-    0x75, 0xef, 0x76, 0xef, 0x77, 0xef, 0x78, 0xef, 0x79, 0xef, 0x1c, 0xf2, 0xd, 0x13, 0xf3, 0x1f, 0xab, 0x1a, 0xff, 0x1c,
-    0xf2, 0x1b, 0x68, 0x1c, 0x30, 0x1c, 0x46, 0x1c, 0x39, 0x1c, 0x3c, 0x1c, 0x1e, 0x1a, 0x95, 0xfb, 0xe9, 0xea, 0x74, 0xf1,
-    0x93, 0xee, 0xde, 0xef, 0x4b, 0xef, 0x8e, 0xef, 0x72, 0xef, 0x80, 0xef, 0x7c, 0xef, 0x7f, 0xef, 0x7f, 0xef, 0x81, 0xef,
-    0x82, 0xef, 0x83, 0xef, 0x84, 0xef, 0x85, 0xef, 0x86, 0xef, 0x88, 0xef, 0x88, 0xef, 0x8a, 0xef, 0x8a, 0xef, 0x8c, 0xef,
-    0x8d, 0xef, 0x8e, 0xef, 0x8f, 0xef, 0x90, 0xef, 0xf5, 0xf7, 0xd5, 0x1d, 0xd, 0x1c, 0x3d, 0x1c, 0x2a, 0x1c, 0x2f, 0x1c,
-    0x2a, 0x1c, 0x29, 0x1c, 0x28, 0x1c, 0x26, 0x1c, 0x24, 0x1c, 0xa8, 0x11, 0xd7, 0xec, 0x41, 0xf0, 0x41, 0xef, 0xb0, 0xef,
-    0x80, 0xef, 0x97, 0xef, 0x8e, 0xef, 0x94, 0xef, 0x93, 0xef, 0x95, 0xef, 0x95, 0xef, 0x97, 0xef, 0x98, 0xef, 0x99, 0xef,
-    0x9a, 0xef, 0x9b, 0xef, 0x9c, 0xef, 0x9e, 0xef, 0x9e, 0xef, 0xa0, 0xef, 0xa0, 0xef, 0xa2, 0xef, 0xa3, 0xef, 0xa4, 0xef,
-    0xa5, 0xef, 0xa6, 0xef, 0x38, 0xf1, 0x31, 0xd, 0x84, 0x21, 0xbf, 0x19, 0x27, 0x1d, 0xa0, 0x1b, 0x4b, 0x1c, 0xfc, 0x1b,
-    0x1c, 0x1c, 0xb, 0x1c, 0x10, 0x1c, 0x6f, 0x19, 0xc9, 0xf8, 0x2, 0xec, 0x3c, 0xf1, 0xee, 0xee, 0xf6, 0xef, 0x82, 0xef,
-    0xb8, 0xef, 0xa1, 0xef, 0xad, 0xef, 0xa9, 0xef, 0xac, 0xef, 0xad, 0xef, 0xae, 0xef, 0xaf, 0xef, 0xb0, 0xef, 0xb1, 0xef,
-    0xb3, 0xef, 0xb3, 0xef, 0xb5, 0xef, 0xb5, 0xef, 0xb7, 0xef, 0xb8, 0xef, 0xb9, 0xef, 0xba, 0xef, 0xbb, 0xef, 0xbc, 0xef,
-    0x42, 0xf0, 0x6d, 0x7, 0x2d, 0x23, 0xe9, 0x18, 0x66, 0x1d, 0x63, 0x1b, 0x45, 0x1c, 0xdd, 0x1b, 0xa, 0x1c, 0xf3, 0x1b,
-    0xfb, 0x1b, 0xe0, 0x19, 0xb5, 0xfb, 0x3a, 0xeb, 0xb2, 0xf1, 0xd8, 0xee, 0x20, 0xf0, 0x8f, 0xef, 0xd2, 0xef, 0xb5, 0xef,
-    0xc4, 0xef, 0xbe, 0xef, 0xc3, 0xef, 0xc2, 0xef, 0xc4, 0xef, 0xc5, 0xef, 0xc6, 0xef, 0xc7, 0xef, 0xc9, 0xef, 0xc9, 0xef,
-    0xcb, 0xef, 0xcb, 0xef, 0xcd, 0xef, 0xce, 0xef, 0xcf, 0xef, 0xd0, 0xef, 0xd1, 0xef, 0xd2, 0xef, 0xe6, 0xf1, 0xfd, 0xf,
-    0x6b, 0x20, 0xf7, 0x19, 0xcd, 0x1c, 0x86, 0x1b, 0x14, 0x1c, 0xd3, 0x1b, 0xee, 0x1b, 0xdf, 0x1b, 0xe2, 0x1b, 0xa9, 0x15,
-    0x43, 0xef, 0x65, 0xef, 0x5, 0xf0, 0xb8, 0xef, 0xdc, 0xef, 0xce, 0xef, 0xd5, 0xef, 0xd4, 0xef, 0xd6, 0xef, 0xd7, 0xef,
-    0xd8, 0xef, 0xd9, 0xef, 0xda, 0xef, 0xdc, 0xef, 0xdc, 0xef, 0xde, 0xef, 0xde, 0xef, 0xe0, 0xef, 0xe1, 0xef, 0xe2, 0xef,
-    0xe3, 0xef, 0xe4, 0xef, 0xe5, 0xef, 0xe6, 0xef, 0xe8, 0xef, 0xe8, 0xef, 0x3d, 0xfa, 0x84, 0x1e, 0x26, 0x1b, 0x22, 0x1c,
-    0xb4, 0x1b, 0xe1, 0x1b, 0xca, 0x1b, 0xd2, 0x1b, 0xcc, 0x1b, 0xcd, 0x1b, 0x45, 0x1b, 0x51, 0x4, 0xcd, 0xe8, 0xfa, 0xf2,
-    0x86, 0xee, 0x84, 0xf0, 0xa2, 0xef, 0x8, 0xf0, 0xdc, 0xef, 0xf1, 0xef, 0xea, 0xef, 0xee, 0xef, 0xee, 0xef, 0xf0, 0xef,
-    0xf0, 0xef, 0xf2, 0xef, 0xf2, 0xef, 0xf4, 0xef, 0xf5, 0xef, 0xf6, 0xef, 0xf7, 0xef, 0xf8, 0xef, 0xf9, 0xef, 0xfb, 0xef,
-    0xfb, 0xef, 0xfd, 0xef, 0xfd, 0xef, 0x98, 0xf3, 0x6a, 0x18, 0x97, 0x1d, 0xec, 0x1a, 0x1e, 0x1c, 0x92, 0x1b, 0xcf, 0x1b,
-    0xb1, 0x1b, 0xbc, 0x1b, 0xb4, 0x1b, 0xb5, 0x1b, 0x42, 0xb, 0x28, 0xea, 0x52, 0xf2, 0xf1, 0xee, 0x73, 0xf0, 0xc8, 0xef,
-    0x16, 0xf0, 0xf5, 0xef, 0x5, 0xf0, 0xff, 0xef, 0x3, 0xf0, 0x3, 0xf0, 0x5, 0xf0, 0x6, 0xf0, 0x7, 0xf0, 0x8, 0xf0,
-    0x9, 0xf0, 0xa, 0xf0, 0xb, 0xf0, 0xd, 0xf0, 0xd, 0xf0, 0xf, 0xf0, 0xf, 0xf0, 0x11, 0xf0, 0x12, 0xf0, 0x13, 0xf0,
-    0xaa, 0xf3, 0x57, 0x18, 0x7f, 0x1d, 0xd7, 0x1a, 0x8, 0x1c, 0x7c, 0x1b, 0xb8, 0x1b, 0x9b, 0x1b, 0xa6, 0x1b, 0x9e, 0x1b,
-    0x9f, 0x1b, 0x24, 0x7, 0x29, 0xe8, 0x7e, 0xf3, 0x8a, 0xee, 0xc0, 0xf0, 0xc4, 0xef, 0x36, 0xf0, 0x6, 0xf0, 0x1d, 0xf0,
-    0x14, 0xf0, 0x19, 0xf0, 0x18, 0xf0, 0x1b, 0xf0, 0x1b, 0xf0, 0x1d, 0xf0, 0x1d, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x21, 0xf0,
-    0x22, 0xf0, 0x23, 0xf0, 0x24, 0xf0, 0x25, 0xf0, 0x26, 0xf0, 0x27, 0xf0, 0x28, 0xf0, 0x5e, 0xfa, 0x39, 0x1e, 0xe5, 0x1a,
-    0xdf, 0x1b, 0x73, 0x1b, 0x9f, 0x1b, 0x88, 0x1b, 0x90, 0x1b, 0x89, 0x1b, 0x8a, 0x1b, 0xfa, 0x18, 0x15, 0xf9, 0x99, 0xec,
-    0xb5, 0xf1, 0x74, 0xef, 0x76, 0xf0, 0x5, 0xf0, 0x38, 0xf0, 0x23, 0xf0, 0x2f, 0xf0, 0x2b, 0xf0, 0x2e, 0xf0, 0x2e, 0xf0,
-    0x30, 0xf0, 0x30, 0xf0, 0x32, 0xf0, 0x33, 0xf0, 0x34, 0xf0, 0x35, 0xf0, 0x36, 0xf0, 0x37, 0xf0, 0x38, 0xf0, 0x3a, 0xf0,
-    0x3a, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x46, 0xf2, 0xc9, 0xf, 0xe6, 0x1f, 0x91, 0x19, 0x5a, 0x1c, 0x19, 0x1b, 0xa6, 0x1b,
-    0x64, 0x1b, 0x7f, 0x1b, 0x70, 0x1b, 0x73, 0x1b, 0x29, 0x9, 0x6d, 0xe9, 0x15, 0xf3, 0xf6, 0xee, 0xcc, 0xf0, 0xfc, 0xef,
-    0x5a, 0xf0, 0x32, 0xf0, 0x45, 0xf0, 0x3e, 0xf0, 0x43, 0xf0, 0x42, 0xf0, 0x44, 0xf0, 0x45, 0xf0, 0x46, 0xf0, 0x47, 0xf0,
-    0x48, 0xf0, 0x4a, 0xf0, 0x4a, 0xf0, 0x4c, 0xf0, 0x4c, 0xf0, 0x4e, 0xf0, 0x4e, 0xf0, 0x50, 0xf0, 0x51, 0xf0, 0xd4, 0xf0,
-    0x5f, 0x7, 0x61, 0x22, 0x64, 0x18, 0xc1, 0x1c, 0xcc, 0x1a, 0xa8, 0x1b, 0x43, 0x1b, 0x6d, 0x1b, 0x58, 0x1b, 0x60, 0x1b,
-    0x30, 0xd, 0x9d, 0xeb, 0x12, 0xf2, 0x88, 0xef, 0xa9, 0xf0, 0x29, 0xf0, 0x64, 0xf0, 0x4b, 0xf0, 0x57, 0xf0, 0x53, 0xf0,
-    0x57, 0xf0, 0x57, 0xf0, 0x59, 0xf0, 0x59, 0xf0, 0x5b, 0xf0, 0x5b, 0xf0, 0x5d, 0xf0, 0x5d, 0xf0, 0x5f, 0xf0, 0x60, 0xf0,
-    0x61, 0xf0, 0x62, 0xf0, 0x63, 0xf0, 0x64, 0xf0, 0x65, 0xf0, 0x68, 0xf1, 0x24, 0xa, 0x69, 0x21, 0xae, 0x18, 0x81, 0x1c,
-    0xc9, 0x1a, 0x8a, 0x1b, 0x31, 0x1b, 0x56, 0x1b, 0x43, 0x1b, 0x49, 0x1b, 0x21, 0x9, 0xa3, 0xe9, 0x39, 0xf3, 0x20, 0xef,
-    0xf4, 0xf0, 0x25, 0xf0, 0x83, 0xf0, 0x5b, 0xf0, 0x6e, 0xf0, 0x67, 0xf0, 0x6b, 0xf0, 0x6b, 0xf0, 0x6d, 0xf0, 0x6e, 0xf0,
-    0x6f, 0xf0, 0x70, 0xf0, 0x71, 0xf0, 0x72, 0xf0, 0x73, 0xf0, 0x74, 0xf0, 0x75, 0xf0, 0x77, 0xf0, 0x77, 0xf0, 0x79, 0xf0,
-    0x79, 0xf0, 0xff, 0xf3, 0xf9, 0x17, 0x8, 0x1d, 0x6e, 0x1a, 0x98, 0x1b, 0x11, 0x1b, 0x4a, 0x1b, 0x2e, 0x1b, 0x37, 0x1b,
-    0x30, 0x1b, 0xae, 0x18, 0x44, 0xf9, 0xf9, 0xec, 0x0, 0xf2, 0xc8, 0xef, 0xc7, 0xf0, 0x57, 0xf0, 0x8a, 0xf0, 0x75, 0xf0,
-    0x80, 0xf0, 0x7c, 0xf0, 0x80, 0xf0, 0x7f, 0xf0, 0x82, 0xf0, 0x82, 0xf0, 0x84, 0xf0, 0x84, 0xf0, 0x86, 0xf0, 0x86, 0xf0,
-    0x88, 0xf0, 0x88, 0xf0, 0x8a, 0xf0, 0x8b, 0xf0, 0x8c, 0xf0, 0x8d, 0xf0, 0x8e, 0xf0, 0x94, 0x4, 0xe5, 0x22, 0xcd, 0x17,
-    0xa6, 0x1c, 0x7a, 0x1a, 0x6f, 0x1b, 0xff, 0x1a, 0x2e, 0x1b, 0x16, 0x1b, 0x1e, 0x1b, 0x19, 0x7, 0xd2, 0xe8, 0xe5, 0xf3,
-    0xe, 0xef, 0x37, 0xf1, 0x41, 0xf0, 0xb0, 0xf0, 0x80, 0xf0, 0x97, 0xf0, 0x8e, 0xf0, 0x95, 0xf0, 0x93, 0xf0, 0x95, 0xf0,
-    0x96, 0xf0, 0x97, 0xf0, 0x98, 0xf0, 0x99, 0xf0, 0x9a, 0xf0, 0x9b, 0xf0, 0x9d, 0xf0, 0x9d, 0xf0, 0x9f, 0xf0, 0x9f, 0xf0,
-    0xa1, 0xf0, 0xa1, 0xf0, 0x9a, 0xfe, 0xb4, 0x1f, 0x55, 0x19, 0xd5, 0x1b, 0xb9, 0x1a, 0x34, 0x1b, 0xfb, 0x1a, 0x11, 0x1b,
-    0x5, 0x1b, 0x7, 0x1b, 0x13, 0xb, 0xf9, 0xea, 0xe4, 0xf2, 0x9d, 0xef, 0x13, 0xf1, 0x6d, 0xf0, 0xb9, 0xf0, 0x99, 0xf0,
-    0xa9, 0xf0, 0xa3, 0xf0, 0xa7, 0xf0, 0xa7, 0xf0, 0xa9, 0xf0, 0xa9, 0xf0, 0xab, 0xf0, 0xab, 0xf0, 0xad, 0xf0, 0xae, 0xf0,
-    0xaf, 0xf0, 0xb0, 0xf0, 0xb1, 0xf0, 0xb2, 0xf0, 0xb3, 0xf0, 0xb4, 0xf0, 0xb5, 0xf0, 0x9b, 0x0, 0xa1, 0x20, 0xba, 0x18,
-    0xfd, 0x1b, 0x87, 0x1a, 0x2b, 0x1b, 0xdf, 0x1a, 0xfe, 0x1a, 0xef, 0x1a, 0xf2, 0x1a, 0x15, 0x7, 0x8, 0xe9, 0x5, 0xf4,
-    0x38, 0xef, 0x5d, 0xf1, 0x69, 0xf0, 0xd8, 0xf0, 0xa8, 0xf0, 0xbf, 0xf0, 0xb6, 0xf0, 0xbb, 0xf0, 0xba, 0xf0, 0xbd, 0xf0,
-    0xbd, 0xf0, 0xbf, 0xf0, 0xbf, 0xf0, 0xc1, 0xf0, 0xc1, 0xf0, 0xc3, 0xf0, 0xc3, 0xf0, 0xc5, 0xf0, 0xc5, 0xf0, 0xc7, 0xf0,
-    0xc7, 0xf0, 0x46, 0xf2, 0xc5, 0xc, 0x9, 0x20, 0xab, 0x18, 0xe6, 0x1b, 0x72, 0x1a, 0x15, 0x1b, 0xc9, 0x1a, 0xe9, 0x1a,
-    0xd8, 0x1a, 0xe6, 0x17, 0xb7, 0xf6, 0x2c, 0xee, 0xed, 0xf1, 0x42, 0xf0, 0x2, 0xf1, 0xae, 0xf0, 0xd5, 0xf0, 0xc5, 0xf0,
-    0xcf, 0xf0, 0xcb, 0xf0, 0xcf, 0xf0, 0xce, 0xf0, 0xd0, 0xf0, 0xd1, 0xf0, 0xd2, 0xf0, 0xd3, 0xf0, 0xd4, 0xf0, 0xd5, 0xf0,
-    0xd6, 0xf0, 0xd7, 0xf0, 0xd9, 0xf0, 0xd9, 0xf0, 0xdb, 0xf0, 0xdb, 0xf0, 0xb9, 0xfa, 0x5f, 0x1d, 0x29, 0x1a, 0x1a, 0x1b,
-    0xb1, 0x1a, 0xdb, 0x1a, 0xc6, 0x1a, 0xcc, 0x1a, 0xc7, 0x1a, 0xc7, 0x1a, 0xa, 0x9, 0x3f, 0xea, 0x9f, 0xf3, 0x9e, 0xef,
-    0x67, 0xf1, 0x9d, 0xf0, 0xf8, 0xf0, 0xd1, 0xf0, 0xe4, 0xf0, 0xdd, 0xf0, 0xe1, 0xf0, 0xe1, 0xf0, 0xe3, 0xf0, 0xe3, 0xf0,
-    0xe5, 0xf0, 0xe6, 0xf0, 0xe7, 0xf0, 0xe8, 0xf0, 0xe9, 0xf0, 0xea, 0xf0, 0xeb, 0xf0, 0xec, 0xf0, 0xed, 0xf0, 0xee, 0xf0,
-    0x5f, 0xf4, 0x8c, 0x17, 0x7e, 0x1c, 0xf3, 0x19, 0x16, 0x1b, 0x90, 0x1a, 0xc9, 0x1a, 0xad, 0x1a, 0xb8, 0x1a, 0xb0, 0x1a,
-    0xea, 0xe, 0x5f, 0xed, 0x1c, 0xf2, 0x67, 0xf0, 0x28, 0xf1, 0xd3, 0xf0, 0xfb, 0xf0, 0xeb, 0xf0, 0xf4, 0xf0, 0xf1, 0xf0,
-    0xf4, 0xf0, 0xf4, 0xf0, 0xf6, 0xf0, 0xf6, 0xf0, 0xf8, 0xf0, 0xf8, 0xf0, 0xfa, 0xf0, 0xfa, 0xf0, 0xfc, 0xf0, 0xfd, 0xf0,
-    0xfe, 0xf0, 0xff, 0xf0, 0x0, 0xf1, 0x1, 0xf1, 0x6f, 0xf4, 0x79, 0x17, 0x68, 0x1c, 0xde, 0x19, 0x1, 0x1b, 0x7b, 0x1a,
-    0xb4, 0x1a, 0x98, 0x1a, 0xa2, 0x1a, 0x9b, 0x1a, 0xec, 0xc, 0x74, 0xec, 0xb4, 0xf2, 0x3f, 0xf0, 0x56, 0xf1, 0xda, 0xf0,
-    0x13, 0xf1, 0xfb, 0xf0, 0x8, 0xf1, 0x4, 0xf1, 0x7, 0xf1, 0x7, 0xf1, 0x9, 0xf1, 0x9, 0xf1, 0xb, 0xf1, 0xb, 0xf1,
-    0xd, 0xf1, 0xd, 0xf1, 0xf, 0xf1, 0xf, 0xf1, 0x11, 0xf1, 0x11, 0xf1, 0x13, 0xf1, 0x14, 0xf1, 0xe2, 0xf8, 0x19, 0x1c,
-    0x71, 0x1a, 0x9d, 0x1a, 0x8c, 0x1a, 0x91, 0x1a, 0x8c, 0x1a, 0x8b, 0x1a, 0x89, 0x1a, 0xa, 0x1a, 0x5b, 0x4, 0x5f, 0xea,
-    0xfa, 0xf3, 0xc6, 0xef, 0xa7, 0xf1, 0xd2, 0xf0, 0x32, 0xf1, 0x9, 0xf1, 0x1d, 0xf1, 0x16, 0xf1, 0x1a, 0xf1, 0x1a, 0xf1,
-    0x1c, 0xf1, 0x1c, 0xf1, 0x1e, 0xf1, 0x1e, 0xf1, 0x20, 0xf1, 0x20, 0xf1, 0x22, 0xf1, 0x22, 0xf1, 0x24, 0xf1, 0x24, 0xf1,
-    0x26, 0xf1, 0xa2, 0xf1, 0x44, 0x7, 0x2c, 0x21, 0x98, 0x17, 0xc8, 0x1b, 0xe7, 0x19, 0xbb, 0x1a, 0x59, 0x1a, 0x82, 0x1a,
-    0x6e, 0x1a, 0xa2, 0x14, 0x9f, 0xf0, 0xc2, 0xf0, 0x55, 0xf1, 0xf, 0xf1, 0x30, 0xf1, 0x22, 0xf1, 0x2a, 0xf1, 0x28, 0xf1,
-    0x2a, 0xf1, 0x2b, 0xf1, 0x2d, 0xf1, 0x2d, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1, 0x31, 0xf1, 0x31, 0xf1, 0x33, 0xf1, 0x33, 0xf1,
-    0x35, 0xf1, 0x35, 0xf1, 0x37, 0xf1, 0x37, 0xf1, 0x39, 0xf1, 0xd7, 0xfc, 0xea, 0x1d, 0x3e, 0x19, 0xeb, 0x1a, 0x2d, 0x1a,
-    0x7f, 0x1a, 0x57, 0x1a, 0x66, 0x1a, 0x5c, 0x1a, 0xf3, 0x17, 0xb0, 0xf9, 0xda, 0xed, 0xb1, 0xf2, 0x8e, 0xf0, 0x83, 0xf1,
-    0x17, 0xf1, 0x49, 0xf1, 0x34, 0xf1, 0x3f, 0xf1, 0x3b, 0xf1, 0x3f, 0xf1, 0x3e, 0xf1, 0x41, 0xf1, 0x41, 0xf1, 0x43, 0xf1,
-    0x43, 0xf1, 0x45, 0xf1, 0x45, 0xf1, 0x47, 0xf1, 0x47, 0xf1, 0x49, 0xf1, 0x49, 0xf1, 0x4b, 0xf1, 0x2, 0xf9, 0xd6, 0x1b,
-    0x33, 0x1a, 0x5f, 0x1a, 0x4e, 0x1a, 0x51, 0x1a, 0x4d, 0x1a, 0x4c, 0x1a, 0x4b, 0x1a, 0x5b, 0x18, 0x63, 0xfc, 0x1d, 0xed,
-    0x1c, 0xf3, 0x78, 0xf0, 0xa7, 0xf1, 0x21, 0xf1, 0x5f, 0xf1, 0x44, 0xf1, 0x52, 0xf1, 0x4d, 0xf1, 0x51, 0xf1, 0x50, 0xf1,
-    0x52, 0xf1, 0x53, 0xf1, 0x54, 0xf1, 0x55, 0xf1, 0x57, 0xf1, 0x57, 0xf1, 0x59, 0xf1, 0x59, 0xf1, 0x5b, 0xf1, 0x5b, 0xf1,
-    0x5d, 0xf1, 0xe5, 0xfc, 0xb9, 0x1d, 0x17, 0x19, 0xc1, 0x1a, 0x4, 0x1a, 0x54, 0x1a, 0x2d, 0x1a, 0x3c, 0x1a, 0x34, 0x1a,
-    0xd9, 0x16, 0x7a, 0xf4, 0xa5, 0xef, 0x1f, 0xf2, 0x3, 0xf1, 0x83, 0xf1, 0x4b, 0xf1, 0x66, 0xf1, 0x5b, 0xf1, 0x62, 0xf1,
-    0x60, 0xf1, 0x62, 0xf1, 0x63, 0xf1, 0x64, 0xf1, 0x65, 0xf1, 0x66, 0xf1, 0x67, 0xf1, 0x69, 0xf1, 0x69, 0xf1, 0x6b, 0xf1,
-    0x6b, 0xf1, 0x6d, 0xf1, 0x6d, 0xf1, 0xe9, 0xf1, 0x38, 0x7, 0xc1, 0x20, 0x4e, 0x17, 0x70, 0x1b, 0x96, 0x19, 0x67, 0x1a,
-    0x7, 0x1a, 0x2f, 0x1a, 0x1a, 0x1a, 0xbe, 0xc, 0xfa, 0xec, 0x17, 0xf3, 0xb0, 0xf0, 0xc1, 0xf1, 0x48, 0xf1, 0x80, 0xf1,
-    0x68, 0xf1, 0x74, 0xf1, 0x70, 0xf1, 0x74, 0xf1, 0x74, 0xf1, 0x76, 0xf1, 0x76, 0xf1, 0x78, 0xf1, 0x78, 0xf1, 0x7a, 0xf1,
-    0x7a, 0xf1, 0x7c, 0xf1, 0x7c, 0xf1, 0x7e, 0xf1, 0x7e, 0xf1, 0x80, 0xf1, 0x3a, 0xf7, 0x99, 0x1a, 0x78, 0x1a, 0xe5, 0x19,
-    0x2b, 0x1a, 0x7, 0x1a, 0x15, 0x1a, 0xd, 0x1a, 0xe, 0x1a, 0x2f, 0x17, 0x39, 0xf7, 0xfb, 0xee, 0x9b, 0xf2, 0xff, 0xf0,
-    0xb8, 0xf1, 0x67, 0xf1, 0x8d, 0xf1, 0x7d, 0xf1, 0x86, 0xf1, 0x83, 0xf1, 0x86, 0xf1, 0x86, 0xf1, 0x88, 0xf1, 0x88, 0xf1,
-    0x8a, 0xf1, 0x8a, 0xf1, 0x8c, 0xf1, 0x8c, 0xf1, 0x8e, 0xf1, 0x8e, 0xf1, 0x90, 0xf1, 0x90, 0xf1, 0xf2, 0xf3, 0xae, 0x11,
-    0x52, 0x1d, 0x8d, 0x18, 0xa7, 0x1a, 0xb3, 0x19, 0x1d, 0x1a, 0xec, 0x19, 0xff, 0x19, 0x88, 0x18, 0x1f, 0xff, 0xa4, 0xec,
-    0xb4, 0xf3, 0x9b, 0xf0, 0xfd, 0xf1, 0x61, 0xf1, 0xa8, 0xf1, 0x8a, 0xf1, 0x99, 0xf1, 0x93, 0xf1, 0x97, 0xf1, 0x97, 0xf1,
-    0x99, 0xf1, 0x99, 0xf1, 0x9b, 0xf1, 0x9b, 0xf1, 0x9d, 0xf1, 0x9d, 0xf1, 0x9f, 0xf1, 0x9f, 0xf1, 0xa1, 0xf1, 0xa1, 0xf1,
-    0x87, 0xf3, 0x5, 0xf, 0x8, 0x1e, 0x22, 0x18, 0xba, 0x1a, 0x8e, 0x19, 0x11, 0x1a, 0xd4, 0x19, 0xed, 0x19, 0x74, 0x18,
-    0x25, 0xff, 0xba, 0xec, 0xc4, 0xf3, 0xac, 0xf0, 0xf, 0xf2, 0x72, 0xf1, 0xba, 0xf1, 0x9b, 0xf1, 0xaa, 0xf1, 0xa5, 0xf1,
-    0xa9, 0xf1, 0xa8, 0xf1, 0xaa, 0xf1, 0xab, 0xf1, 0xac, 0xf1, 0xad, 0xf1, 0xae, 0xf1, 0xaf, 0xf1, 0xb0, 0xf1, 0xb1, 0xf1,
-    0xb2, 0xf1, 0xb3, 0xf1, 0x88, 0xf4, 0x2f, 0x14, 0x55, 0x1c, 0xbf, 0x18, 0x55, 0x1a, 0x9d, 0x19, 0xed, 0x19, 0xc6, 0x19,
-    0xd5, 0x19, 0xf8, 0x16, 0x5d, 0xf7, 0x36, 0xef, 0xcb, 0xf2, 0x35, 0xf1, 0xeb, 0xf1, 0x9c, 0xf1, 0xc0, 0xf1, 0xb2, 0xf1,
-    0xb9, 0xf1, 0xb8, 0xf1, 0xba, 0xf1, 0xba, 0xf1, 0xbc, 0xf1, 0xbc, 0xf1, 0xbe, 0xf1, 0xbe, 0xf1, 0xc0, 0xf1, 0xc0, 0xf1,
-    0xc2, 0xf1, 0xc2, 0xf1, 0xc4, 0xf1, 0xc4, 0xf1, 0x2c, 0xfb, 0x34, 0x1c, 0x23, 0x19, 0x8, 0x1a, 0xa5, 0x19, 0xce, 0x19,
-    0xb9, 0x19, 0xbf, 0x19, 0xba, 0x19, 0x75, 0xe, 0x5d, 0xee, 0xe5, 0xf2, 0x44, 0xf1, 0xfb, 0xf1, 0xac, 0xf1, 0xd0, 0xf1,
-    0xc2, 0xf1, 0xc9, 0xf1, 0xc8, 0xf1, 0xca, 0xf1, 0xca, 0xf1, 0xcc, 0xf1, 0xcc, 0xf1, 0xce, 0xf1, 0xce, 0xf1, 0xd0, 0xf1,
-    0xd0, 0xf1, 0xd2, 0xf1, 0xd2, 0xf1, 0xd4, 0xf1, 0xd4, 0xf1, 0xb5, 0xf3, 0xe6, 0xe, 0xc0, 0x1d, 0xea, 0x17, 0x7a, 0x1a,
-    0x53, 0x19, 0xd4, 0x19, 0x98, 0x19, 0xb0, 0x19, 0xd4, 0x16, 0x75, 0xf7, 0x5d, 0xef, 0xeb, 0xf2, 0x57, 0xf1, 0xd, 0xf2,
-    0xbd, 0xf1, 0xe2, 0xf1, 0xd3, 0xf1, 0xdb, 0xf1, 0xd9, 0xf1, 0xdb, 0xf1, 0xdc, 0xf1, 0xdd, 0xf1, 0xde, 0xf1, 0xdf, 0xf1,
-    0xe0, 0xf1, 0xe1, 0xf1, 0xe2, 0xf1, 0xe3, 0xf1, 0xe4, 0xf1, 0xe5, 0xf1, 0xe6, 0xf1, 0x91, 0x4, 0xd3, 0x20, 0x7d, 0x16,
-    0x1, 0x1b, 0xfb, 0x18, 0xdf, 0x19, 0x76, 0x19, 0xa3, 0x19, 0x26, 0x18, 0x38, 0xff, 0xf, 0xed, 0x0, 0xf4, 0xf4, 0xf0,
-    0x51, 0xf2, 0xb6, 0xf1, 0xfd, 0xf1, 0xdf, 0xf1, 0xee, 0xf1, 0xe8, 0xf1, 0xec, 0xf1, 0xec, 0xf1, 0xee, 0xf1, 0xee, 0xf1,
-    0xf0, 0xf1, 0xf0, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf4, 0xf1, 0xf4, 0xf1, 0xf6, 0xf1, 0xf6, 0xf1, 0xb5, 0x2, 0xc4, 0x1f,
-    0xec, 0x16, 0xb2, 0x1a, 0x1, 0x19, 0xbf, 0x19, 0x68, 0x19, 0x8d, 0x19, 0x8c, 0x18, 0xcc, 0x1, 0x59, 0xec, 0x65, 0xf4,
-    0xde, 0xf0, 0x72, 0xf2, 0xbf, 0xf1, 0x11, 0xf2, 0xee, 0xf1, 0xff, 0xf1, 0xf9, 0xf1, 0xfd, 0xf1, 0xfc, 0xf1, 0xfe, 0xf1,
-    0xff, 0xf1, 0x0, 0xf2, 0x1, 0xf2, 0x2, 0xf2, 0x3, 0xf2, 0x4, 0xf2, 0x5, 0xf2, 0x6, 0xf2, 0x7e, 0xf2, 0x1e, 0x7,
-    0xd5, 0x1f, 0xb1, 0x16, 0xb0, 0x1a, 0xe5, 0x18, 0xaf, 0x19, 0x52, 0x19, 0x7a, 0x19, 0x15, 0x17, 0x25, 0xfa, 0xcb, 0xee,
-    0x70, 0xf3, 0x63, 0xf1, 0x4f, 0xf2, 0xe7, 0xf1, 0x17, 0xf2, 0x3, 0xf2, 0xd, 0xf2, 0xa, 0xf2, 0xd, 0xf2, 0xd, 0xf2,
-    0xf, 0xf2, 0xf, 0xf2, 0x11, 0xf2, 0x11, 0xf2, 0x13, 0xf2, 0x13, 0xf2, 0x15, 0xf2, 0x15, 0xf2, 0x17, 0xf2, 0xdc, 0xf4,
-    0xd6, 0x13, 0xd0, 0x1b, 0x4d, 0x18, 0xdb, 0x19, 0x27, 0x19, 0x74, 0x19, 0x4f, 0x19, 0x5d, 0x19, 0x1b, 0x10, 0xb4, 0xef,
-    0xb4, 0xf2, 0xd2, 0xf1, 0x34, 0xf2, 0xa, 0xf2, 0x1e, 0xf2, 0x17, 0xf2, 0x1b, 0xf2, 0x1a, 0xf2, 0x1c, 0xf2, 0x1d, 0xf2,
-    0x1e, 0xf2, 0x1f, 0xf2, 0x20, 0xf2, 0x21, 0xf2, 0x22, 0xf2, 0x23, 0xf2, 0x24, 0xf2, 0x25, 0xf2, 0x26, 0xf2, 0x27, 0xf2,
-    0xe0, 0x0, 0x86, 0x1e, 0x35, 0x17, 0x3b, 0x1a, 0xe1, 0x18, 0x78, 0x19, 0x32, 0x19, 0x4f, 0x19, 0x69, 0x17, 0xbf, 0xfc,
-    0x2a, 0xee, 0xe3, 0xf3, 0x5f, 0xf1, 0x80, 0xf2, 0x0, 0xf2, 0x3b, 0xf2, 0x22, 0xf2, 0x2e, 0xf2, 0x2a, 0xf2, 0x2e, 0xf2,
-    0x2d, 0xf2, 0x2f, 0xf2, 0x30, 0xf2, 0x31, 0xf2, 0x32, 0xf2, 0x33, 0xf2, 0x34, 0xf2, 0x35, 0xf2, 0x36, 0xf2, 0x36, 0xf2,
-    0xb8, 0xf7, 0xb7, 0x19, 0x98, 0x19, 0xc, 0x19, 0x4d, 0x19, 0x2c, 0x19, 0x38, 0x19, 0x31, 0x19, 0x32, 0x19, 0xde, 0x6,
-    0x23, 0xeb, 0x46, 0xf5, 0xd8, 0xf0, 0xd3, 0xf2, 0xf2, 0xf1, 0x57, 0xf2, 0x2c, 0xf2, 0x40, 0xf2, 0x39, 0xf2, 0x3d, 0xf2,
-    0x3d, 0xf2, 0x3f, 0xf2, 0x3f, 0xf2, 0x41, 0xf2, 0x41, 0xf2, 0x43, 0xf2, 0x43, 0xf2, 0x45, 0xf2, 0x45, 0xf2, 0x47, 0xf2,
-    0x79, 0xf5, 0x2e, 0x16, 0xc8, 0x1a, 0x6a, 0x18, 0x79, 0x19, 0xfd, 0x18, 0x32, 0x19, 0x17, 0x19, 0x21, 0x19, 0xad, 0x8,
-    0x2a, 0xec, 0xd6, 0xf4, 0x21, 0xf1, 0xc9, 0xf2, 0xd, 0xf2, 0x62, 0xf2, 0x3e, 0xf2, 0x4f, 0xf2, 0x49, 0xf2, 0x4d, 0xf2,
-    0x4d, 0xf2, 0x4f, 0xf2, 0x4f, 0xf2, 0x51, 0xf2, 0x51, 0xf2, 0x53, 0xf2, 0x53, 0xf2, 0x54, 0xf2, 0x55, 0xf2, 0x56, 0xf2,
-    0xfb, 0xf5, 0xa0, 0x18, 0xee, 0x19, 0xac, 0x18, 0x40, 0x19, 0xfa, 0x18, 0x16, 0x19, 0x8, 0x19, 0xb, 0x19, 0xd8, 0x6,
-    0x4f, 0xeb, 0x61, 0xf5, 0xfa, 0xf0, 0xf1, 0xf2, 0x12, 0xf2, 0x77, 0xf2, 0x4b, 0xf2, 0x60, 0xf2, 0x58, 0xf2, 0x5d, 0xf2,
-    0x5c, 0xf2, 0x5e, 0xf2, 0x5f, 0xf2, 0x60, 0xf2, 0x61, 0xf2, 0x62, 0xf2, 0x63, 0xf2, 0x64, 0xf2, 0x65, 0xf2, 0x66, 0xf2,
-    0x79, 0xfb, 0x59, 0x1b, 0x64, 0x18, 0x41, 0x19, 0xe0, 0x18, 0x8, 0x19, 0xf4, 0x18, 0xfa, 0x18, 0x25, 0x17, 0xd7, 0xfc,
-    0x78, 0xee, 0x1c, 0xf4, 0xa1, 0xf1, 0xbd, 0xf2, 0x40, 0xf2, 0x79, 0xf2, 0x61, 0xf2, 0x6d, 0xf2, 0x69, 0xf2, 0x6d, 0xf2,
-    0x6c, 0xf2, 0x6e, 0xf2, 0x6e, 0xf2, 0x70, 0xf2, 0x70, 0xf2, 0x72, 0xf2, 0x72, 0xf2, 0x74, 0xf2, 0x74, 0xf2, 0xe9, 0xf2,
-    0x8, 0x7, 0x24, 0x1f, 0x3a, 0x16, 0x1f, 0x1a, 0x60, 0x18, 0x24, 0x19, 0xcb, 0x18, 0xf0, 0x18, 0xd5, 0xf, 0x20, 0xf0,
-    0xe, 0xf3, 0x33, 0xf2, 0x92, 0xf2, 0x69, 0xf2, 0x7d, 0xf2, 0x75, 0xf2, 0x79, 0xf2, 0x79, 0xf2, 0x7b, 0xf2, 0x7b, 0xf2,
-    0x7d, 0xf2, 0x7d, 0xf2, 0x7f, 0xf2, 0x7f, 0xf2, 0x81, 0xf2, 0x81, 0xf2, 0x83, 0xf2, 0x83, 0xf2, 0x85, 0xf2, 0xba, 0xf9,
-    0x41, 0x1a, 0xba, 0x18, 0xe2, 0x18, 0xd3, 0x18, 0xd6, 0x18, 0xd2, 0x18, 0xd1, 0x18, 0x90, 0x16, 0x67, 0xfa, 0x62, 0xef,
-    0xe4, 0xf3, 0xe7, 0xf1, 0xcb, 0xf2, 0x66, 0xf2, 0x94, 0xf2, 0x81, 0xf2, 0x8b, 0xf2, 0x88, 0xf2, 0x8b, 0xf2, 0x8b, 0xf2,
-    0x8d, 0xf2, 0x8d, 0xf2, 0x8f, 0xf2, 0x8f, 0xf2, 0x91, 0xf2, 0x91, 0xf2, 0x92, 0xf2, 0x93, 0xf2, 0x45, 0xf5, 0x62, 0x13,
-    0x22, 0x1b, 0xba, 0x17, 0x3c, 0x19, 0x8c, 0x18, 0xd8, 0x18, 0xb4, 0x18, 0x4f, 0x18, 0x51, 0x4, 0x69, 0xec, 0x3f, 0xf5,
-    0x61, 0xf1, 0x1c, 0xf3, 0x57, 0xf2, 0xb1, 0xf2, 0x8a, 0xf2, 0x9d, 0xf2, 0x96, 0xf2, 0x9a, 0xf2, 0x9a, 0xf2, 0x9c, 0xf2,
-    0x9c, 0xf2, 0x9e, 0xf2, 0x9e, 0xf2, 0x9f, 0xf2, 0xa0, 0xf2, 0xa1, 0xf2, 0xa2, 0xf2, 0x6d, 0xf4, 0x64, 0xe, 0x93, 0x1c,
-    0x1, 0x17, 0x73, 0x19, 0x58, 0x18, 0xd4, 0x18, 0x9b, 0x18, 0xb1, 0x18, 0xc6, 0x6, 0xbb, 0xeb, 0x9f, 0xf5, 0x4c, 0xf1,
-    0x3b, 0xf3, 0x5f, 0xf2, 0xc3, 0xf2, 0x98, 0xf2, 0xac, 0xf2, 0xa5, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xab, 0xf2, 0xab, 0xf2,
-    0xac, 0xf2, 0xad, 0xf2, 0xae, 0xf2, 0xaf, 0xf2, 0xb0, 0xf2, 0xb1, 0xf2, 0xec, 0xf4, 0xd0, 0x10, 0xba, 0x1b, 0x42, 0x17,
-    0x3b, 0x19, 0x56, 0x18, 0xb9, 0x18, 0x8b, 0x18, 0xb9, 0x17, 0xdb, 0x1, 0x54, 0xed, 0x6, 0xf5, 0xa6, 0xf1, 0x28, 0xf3,
-    0x7d, 0xf2, 0xcb, 0xf2, 0xaa, 0xf2, 0xba, 0xf2, 0xb4, 0xf2, 0xb8, 0xf2, 0xb8, 0xf2, 0xba, 0xf2, 0xba, 0xf2, 0xbc, 0xf2,
-    0xbc, 0xf2, 0xbd, 0xf2, 0xbe, 0xf2, 0xbf, 0xf2, 0xc0, 0xf2, 0xc1, 0xf2, 0xc2, 0xf2, 0xc3, 0xf2, 0xc4, 0xf2, 0xc5, 0xf2,
-    0xc6, 0xf2, 0xc6, 0xf2, 0xc8, 0xf2, 0xc8, 0xf2, 0xca, 0xf2, 0xca, 0xf2, 0xcc, 0xf2, 0xcc, 0xf2, 0xc4, 0x2, 0x7c, 0x1e,
-    0xb, 0x16, 0xa5, 0x19, 0x8, 0x18, 0xbd, 0x18, 0x6a, 0x18, 0x8d, 0x18, 0x7b, 0x18, 0x80, 0x18, 0x7b, 0x18, 0xb6, 0x16,
-    0xfd, 0xfc, 0xf4, 0xee, 0x76, 0xf4, 0xa, 0xf2, 0x20, 0xf3, 0xa5, 0xf2, 0xdd, 0xf2, 0xc6, 0xf2, 0xd2, 0xf2, 0xce, 0xf2,
-    0xd1, 0xf2, 0xd1, 0xf2, 0xd2, 0xf2, 0xd3, 0xf2, 0xd4, 0xf2, 0xd5, 0xf2, 0xd6, 0xf2, 0xd7, 0xf2, 0xd8, 0xf2, 0xd9, 0xf2,
-    0xda, 0xf2, 0xda, 0xf2, 0xdc, 0xf2, 0xdc, 0xf2, 0xde, 0xf2, 0xde, 0xf2, 0xe0, 0xf2, 0xe0, 0xf2, 0xe2, 0xf2, 0xc5, 0x2,
-    0x59, 0x1e, 0xf2, 0x15, 0x89, 0x19, 0xed, 0x17, 0xa2, 0x18, 0x4f, 0x18, 0x72, 0x18, 0x60, 0x18, 0x65, 0x18, 0x60, 0x18,
-    0x2b, 0x16, 0x99, 0xfa, 0xcd, 0xef, 0x37, 0xf4, 0x44, 0xf2, 0x24, 0xf3, 0xc2, 0xf2, 0xef, 0xf2, 0xdc, 0xf2, 0xe6, 0xf2,
-    0xe3, 0xf2, 0xe6, 0xf2, 0xe5, 0xf2, 0xe7, 0xf2, 0xe8, 0xf2, 0xe9, 0xf2, 0xea, 0xf2, 0xeb, 0xf2, 0xec, 0xf2, 0xed, 0xf2,
-    0xee, 0xf2, 0xee, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf4, 0xf2, 0xf4, 0xf2, 0xf6, 0xf2, 0xb7, 0xf4,
-    0x36, 0xe, 0x21, 0x1c, 0xaa, 0x16, 0x11, 0x19, 0xfb, 0x17, 0x74, 0x18, 0x3c, 0x18, 0x52, 0x18, 0x46, 0x18, 0x48, 0x18,
-    0x46, 0x18, 0xbe, 0xd, 0xc7, 0xef, 0x2, 0xf4, 0x7d, 0xf2, 0x28, 0xf3, 0xdd, 0xf2, 0x0, 0xf3, 0xf2, 0xf2, 0xf9, 0xf2,
-    0xf8, 0xf2, 0xfa, 0xf2, 0xfa, 0xf2, 0xfc, 0xf2, 0xfc, 0xf2, 0xfd, 0xf2, 0xfe, 0xf2, 0xff, 0xf2, 0x0, 0xf3, 0x1, 0xf3,
-    0x2, 0xf3, 0x3, 0xf3, 0x4, 0xf3, 0x5, 0xf3, 0x5, 0xf3, 0x7, 0xf3, 0x7, 0xf3, 0x9, 0xf3, 0x9, 0xf3, 0xb, 0xf3,
-    0x6, 0x1, 0x2e, 0x1d, 0x3a, 0x16, 0x1a, 0x19, 0xd1, 0x17, 0x61, 0x18, 0x1e, 0x18, 0x3a, 0x18, 0x2b, 0x18, 0x2e, 0x18,
-    0x2b, 0x18, 0xad, 0x14, 0x76, 0xf3, 0x37, 0xf2, 0x69, 0xf3, 0xdc, 0xf2, 0x1c, 0xf3, 0x1, 0xf3, 0xf, 0xf3, 0xa, 0xf3,
-    0xe, 0xf3, 0xd, 0xf3, 0xf, 0xf3, 0xf, 0xf3, 0x11, 0xf3, 0x11, 0xf3, 0x13, 0xf3, 0x13, 0xf3, 0x15, 0xf3, 0x15, 0xf3,
-    0x16, 0xf3, 0x17, 0xf3, 0x18, 0xf3, 0x19, 0xf3, 0x1a, 0xf3, 0x1b, 0xf3, 0x1c, 0xf3, 0x1d, 0xf3, 0x1d, 0xf3, 0x1f, 0xf3,
-    0x4b, 0xff, 0x29, 0x1c, 0x9a, 0x16, 0xc8, 0x18, 0xd0, 0x17, 0x3c, 0x18, 0x8, 0x18, 0x1d, 0x18, 0x11, 0x18, 0x14, 0x18,
-    0x10, 0x18, 0x96, 0x14, 0x8a, 0xf3, 0x4d, 0xf2, 0x7e, 0xf3, 0xf0, 0xf2, 0x31, 0xf3, 0x16, 0xf3, 0x23, 0xf3, 0x1f, 0xf3,
-    0x22, 0xf3, 0x21, 0xf3, 0x23, 0xf3, 0x24, 0xf3, 0x25, 0xf3, 0x26, 0xf3, 0x27, 0xf3, 0x28, 0xf3, 0x28, 0xf3, 0x2a, 0xf3,
-    0x2a, 0xf3, 0x2c, 0xf3, 0x2c, 0xf3, 0x2e, 0xf3, 0x2e, 0xf3, 0x2f, 0xf3, 0x30, 0xf3, 0x31, 0xf3, 0x32, 0xf3, 0xa2, 0xf3,
-    0xe4, 0x6, 0xf7, 0x1d, 0x6e, 0x15, 0x2a, 0x19, 0x7c, 0x17, 0x3a, 0x18, 0xe2, 0x17, 0x7, 0x18, 0xf4, 0x17, 0xfa, 0x17,
-    0xf5, 0x17, 0xdc, 0xb, 0x2d, 0xef, 0xb1, 0xf4, 0x86, 0xf2, 0x7d, 0xf3, 0x10, 0xf3, 0x42, 0xf3, 0x2d, 0xf3, 0x37, 0xf3,
-    0x34, 0xf3, 0x37, 0xf3, 0x37, 0xf3, 0x39, 0xf3, 0x39, 0xf3, 0x3b, 0xf3, 0x3b, 0xf3, 0x3c, 0xf3, 0x3d, 0xf3, 0x3e, 0xf3,
-    0x3f, 0xf3, 0x40, 0xf3, 0x41, 0xf3, 0x42, 0xf3, 0x42, 0xf3, 0x44, 0xf3, 0x44, 0xf3, 0x46, 0xf3, 0x46, 0xf3, 0x2b, 0xfa,
-    0x42, 0x19, 0xca, 0x17, 0xf2, 0x17, 0xe4, 0x17, 0xe6, 0x17, 0xe2, 0x17, 0xe2, 0x17, 0xe0, 0x17, 0xde, 0x17, 0xdc, 0x17,
-    0x6b, 0x14, 0xb1, 0xf3, 0x77, 0xf2, 0xa5, 0xf3, 0x18, 0xf3, 0x59, 0xf3, 0x3e, 0xf3, 0x4b, 0xf3, 0x47, 0xf3, 0x4a, 0xf3,
-    0x4a, 0xf3, 0x4b, 0xf3, 0x4c, 0xf3, 0x4d, 0xf3, 0x4e, 0xf3, 0x4f, 0xf3, 0x50, 0xf3, 0x50, 0xf3, 0x52, 0xf3, 0x52, 0xf3,
-    0x54, 0xf3, 0x54, 0xf3, 0x56, 0xf3, 0x56, 0xf3, 0x57, 0xf3, 0x58, 0xf3, 0x59, 0xf3, 0x5a, 0xf3, 0xc8, 0xf6, 0x63, 0x17,
-    0x9c, 0x18, 0x6e, 0x17, 0xf9, 0x17, 0xb7, 0x17, 0xd2, 0x17, 0xc4, 0x17, 0xc7, 0x17, 0xc3, 0x17, 0xc2, 0x17, 0xc2, 0x14,
-    0x20, 0xf6, 0xd2, 0xf1, 0x7, 0xf4, 0xa, 0xf3, 0x7c, 0xf3, 0x4a, 0xf3, 0x62, 0xf3, 0x59, 0xf3, 0x5e, 0xf3, 0x5d, 0xf3,
-    0x5f, 0xf3, 0x5f, 0xf3, 0x61, 0xf3, 0x61, 0xf3, 0x63, 0xf3, 0x63, 0xf3, 0x65, 0xf3, 0x65, 0xf3, 0x66, 0xf3, 0x67, 0xf3,
-    0x68, 0xf3, 0x69, 0xf3, 0x6a, 0xf3, 0x6a, 0xf3, 0x6c, 0xf3, 0x6c, 0xf3, 0x6e, 0xf3, 0xf5, 0xfb, 0xea, 0x19, 0x23, 0x17,
-    0xf2, 0x17, 0x97, 0x17, 0xbd, 0x17, 0xa9, 0x17, 0xaf, 0x17, 0xaa, 0x17, 0xaa, 0x17, 0xa8, 0x17, 0x6f, 0xd, 0x57, 0xf0,
-    0x72, 0xf4, 0xf8, 0xf2, 0x9f, 0xf3, 0x56, 0xf3, 0x78, 0xf3, 0x6a, 0xf3, 0x71, 0xf3, 0x70, 0xf3, 0x72, 0xf3, 0x72, 0xf3,
-    0x74, 0xf3, 0x74, 0xf3, 0x75, 0xf3, 0x76, 0xf3, 0x77, 0xf3, 0x78, 0xf3, 0x79, 0xf3, 0x7a, 0xf3, 0x7a, 0xf3, 0x7c, 0xf3,
-    0x7c, 0xf3, 0x7e, 0xf3, 0x7e, 0xf3, 0x7f, 0xf3, 0x80, 0xf3, 0xc7, 0xf4, 0x7d, 0xb, 0x1, 0x1c, 0xb0, 0x15, 0x75, 0x18,
-    0x35, 0x17, 0xc2, 0x17, 0x80, 0x17, 0x9b, 0x17, 0x8c, 0x17, 0x91, 0x17, 0x6e, 0x15, 0xec, 0xfa, 0x8b, 0xf0, 0xcb, 0xf4,
-    0xea, 0xf2, 0xc2, 0xf3, 0x63, 0xf3, 0x8e, 0xf3, 0x7d, 0xf3, 0x86, 0xf3, 0x83, 0xf3, 0x85, 0xf3, 0x86, 0xf3, 0x87, 0xf3,
-    0x88, 0xf3, 0x89, 0xf3, 0x8a, 0xf3, 0x8a, 0xf3, 0x8c, 0xf3, 0x8c, 0xf3, 0x8e, 0xf3, 0x8e, 0xf3, 0x8f, 0xf3, 0x90, 0xf3,
-    0x91, 0xf3, 0x92, 0xf3, 0x93, 0xf3, 0x94, 0xf3, 0x78, 0x4, 0x7, 0x1e, 0xad, 0x14, 0xc2, 0x18, 0xee, 0x16, 0xbc, 0x17,
-    0x5d, 0x17, 0x86, 0x17, 0x71, 0x17, 0x77, 0x17, 0x2e, 0x16, 0x9d, 0xff, 0x33, 0xef, 0x79, 0xf5, 0xb8, 0xf2, 0xf3, 0xf3,
-    0x68, 0xf3, 0xa8, 0xf3, 0x8d, 0xf3, 0x9a, 0xf3, 0x95, 0xf3, 0x99, 0xf3, 0x98, 0xf3, 0x9a, 0xf3, 0x9b, 0xf3, 0x9b, 0xf3,
-    0x9d, 0xf3, 0x9d, 0xf3, 0x9f, 0xf3, 0x9f, 0xf3, 0xa0, 0xf3, 0xa1, 0xf3, 0xa2, 0xf3, 0xa3, 0xf3, 0xa4, 0xf3, 0xa5, 0xf3,
-    0xa5, 0xf3, 0x12, 0xf4, 0xc5, 0x6, 0x2f, 0x1d, 0xe5, 0x14, 0x85, 0x18, 0xe4, 0x16, 0x9b, 0x17, 0x47, 0x17, 0x6a, 0x17,
-    0x58, 0x17, 0x5d, 0x17, 0x40, 0x15, 0xff, 0xfa, 0xb8, 0xf0, 0xed, 0xf4, 0x12, 0xf3, 0xe7, 0xf3, 0x89, 0xf3, 0xb4, 0xf3,
-    0xa2, 0xf3, 0xab, 0xf3, 0xa9, 0xf3, 0xab, 0xf3, 0xac, 0xf3, 0xad, 0xf3, 0xad, 0xf3, 0xaf, 0xf3, 0xaf, 0xf3, 0xb1, 0xf3,
-    0xb1, 0xf3, 0xb2, 0xf3, 0xb3, 0xf3, 0xb4, 0xf3, 0xb5, 0xf3, 0xb6, 0xf3, 0xb7, 0xf3, 0xb7, 0xf3, 0xb8, 0xf3, 0xa7, 0xf6,
-    0x96, 0x14, 0xcb, 0x18, 0xa1, 0x16, 0x99, 0x17, 0x27, 0x17, 0x57, 0x17, 0x3f, 0x17, 0x48, 0x17, 0x41, 0x17, 0x42, 0x17,
-    0x8e, 0xb, 0xd7, 0xef, 0x2b, 0xf5, 0x12, 0xf3, 0x1, 0xf4, 0x97, 0xf3, 0xc8, 0xf3, 0xb4, 0xf3, 0xbe, 0xf3, 0xba, 0xf3,
-    0xbe, 0xf3, 0xbd, 0xf3, 0xbf, 0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc1, 0xf3, 0xc2, 0xf3, 0xc3, 0xf3, 0xc4, 0xf3, 0xc5, 0xf3,
-    0xc6, 0xf3, 0xc7, 0xf3, 0xc8, 0xf3, 0xc9, 0xf3, 0xca, 0xf3, 0xca, 0xf3, 0x36, 0xf4, 0xbc, 0x6, 0xee, 0x1c, 0xb8, 0x14,
-    0x4f, 0x18, 0xb2, 0x16, 0x67, 0x17, 0x15, 0x17, 0x37, 0x17, 0x25, 0x17, 0x2a, 0x17, 0xd3, 0x13, 0x33, 0xf4, 0x3, 0xf3,
-    0x27, 0xf4, 0x9f, 0xf3, 0xdd, 0xf3, 0xc3, 0xf3, 0xd0, 0xf3, 0xcc, 0xf3, 0xcf, 0xf3, 0xcf, 0xf3, 0xd0, 0xf3, 0xd1, 0xf3,
-    0xd2, 0xf3, 0xd3, 0xf3, 0xd4, 0xf3, 0xd4, 0xf3, 0xd5, 0xf3, 0xd6, 0xf3, 0xd7, 0xf3, 0xd8, 0xf3, 0xd9, 0xf3, 0xda, 0xf3,
-    0xdb, 0xf3, 0xdc, 0xf3, 0xdd, 0xf3, 0xdd, 0xf3, 0x6f, 0x4, 0x82, 0x1d, 0x54, 0x14, 0x56, 0x18, 0x8b, 0x16, 0x55, 0x17,
-    0xf8, 0x16, 0x20, 0x17, 0xb, 0x17, 0x11, 0x17, 0xbe, 0x13, 0x45, 0xf4, 0x15, 0xf3, 0x39, 0xf4, 0xb2, 0xf3, 0xf0, 0xf3,
-    0xd5, 0xf3, 0xe3, 0xf3, 0xdd, 0xf3, 0xe1, 0xf3, 0xe1, 0xf3, 0xe2, 0xf3, 0xe3, 0xf3, 0xe4, 0xf3, 0xe5, 0xf3, 0xe6, 0xf3,
-    0xe7, 0xf3, 0xe8, 0xf3, 0xe8, 0xf3, 0xe9, 0xf3, 0xea, 0xf3, 0xeb, 0xf3, 0xec, 0xf3, 0xed, 0xf3, 0xee, 0xf3, 0xef, 0xf3,
-    0x2d, 0xf5, 0x3d, 0xb, 0x47, 0x1b, 0x26, 0x15, 0xd5, 0x17, 0x9f, 0x16, 0x28, 0x17, 0xe7, 0x16, 0x2, 0x17, 0xf4, 0x16,
-    0xf7, 0x16, 0x13, 0xd, 0xf4, 0xf0, 0xeb, 0xf4, 0x80, 0xf3, 0x1f, 0xf4, 0xd9, 0xf3, 0xfa, 0xf3, 0xec, 0xf3, 0xf4, 0xf3,
-    0xf2, 0xf3, 0xf4, 0xf3, 0xf4, 0xf3, 0xf5, 0xf3, 0xf6, 0xf3, 0xf7, 0xf3, 0xf8, 0xf3, 0xf9, 0xf3, 0xfa, 0xf3, 0xfb, 0xf3,
-    0xfc, 0xf3, 0xfc, 0xf3, 0xfd, 0xf3, 0xfe, 0xf3, 0xff, 0xf3, 0x0, 0xf4, 0x1, 0xf4, 0x92, 0xfa, 0x31, 0x18, 0xcc, 0x16,
-    0xf1, 0x16, 0xe3, 0x16, 0xe6, 0x16, 0xe2, 0x16, 0xe1, 0x16, 0xdf, 0x16, 0xde, 0x16, 0x38, 0x15, 0x70, 0xfd, 0x73, 0xf0,
-    0x8e, 0xf5, 0x4e, 0xf3, 0x50, 0xf4, 0xde, 0xf3, 0x12, 0xf4, 0xfc, 0xf3, 0x7, 0xf4, 0x3, 0xf4, 0x7, 0xf4, 0x6, 0xf4,
-    0x8, 0xf4, 0x8, 0xf4, 0x9, 0xf4, 0xa, 0xf4, 0xb, 0xf4, 0xc, 0xf4, 0xd, 0xf4, 0xe, 0xf4, 0xf, 0xf4, 0x10, 0xf4,
-    0x11, 0xf4, 0x11, 0xf4, 0x12, 0xf4, 0x1e, 0xf6, 0xa8, 0xf, 0xa8, 0x19, 0x8f, 0x15, 0x5e, 0x17, 0x8c, 0x16, 0xe7, 0x16,
-    0xbc, 0x16, 0xcd, 0x16, 0xc2, 0x16, 0x5d, 0x16, 0x34, 0x4, 0x76, 0xee, 0x80, 0xf6, 0xfb, 0xf2, 0x8e, 0xf4, 0xdb, 0xf3,
-    0x2d, 0xf4, 0xa, 0xf4, 0x1b, 0xf4, 0x14, 0xf4, 0x18, 0xf4, 0x18, 0xf4, 0x19, 0xf4, 0x1a, 0xf4, 0x1b, 0xf4, 0x1c, 0xf4,
-    0x1d, 0xf4, 0x1e, 0xf4, 0x1e, 0xf4, 0x1f, 0xf4, 0x20, 0xf4, 0x21, 0xf4, 0x22, 0xf4, 0x23, 0xf4, 0x24, 0xf4, 0x2d, 0xf6,
-    0x98, 0xf, 0x8b, 0x19, 0x78, 0x15, 0x44, 0x17, 0x73, 0x16, 0xcf, 0x16, 0xa3, 0x16, 0xb4, 0x16, 0xaa, 0x16, 0xdc, 0x15,
-    0xf6, 0x1, 0x3e, 0xef, 0x43, 0xf6, 0x2f, 0xf3, 0x91, 0xf4, 0xf3, 0xf3, 0x3b, 0xf4, 0x1d, 0xf4, 0x2c, 0xf4, 0x26, 0xf4,
-    0x2a, 0xf4, 0x29, 0xf4, 0x2b, 0xf4, 0x2c, 0xf4, 0x2c, 0xf4, 0x2d, 0xf4, 0x2e, 0xf4, 0x2f, 0xf4, 0x30, 0xf4, 0x31, 0xf4,
-    0x32, 0xf4, 0x33, 0xf4, 0x34, 0xf4, 0x34, 0xf4, 0x35, 0xf4, 0x11, 0xf9, 0xd, 0x17, 0xf0, 0x16, 0x75, 0x16, 0xaf, 0x16,
-    0x91, 0x16, 0x9d, 0x16, 0x95, 0x16, 0x96, 0x16, 0x93, 0x16, 0xbf, 0x13, 0xd4, 0xf6, 0xc3, 0xf2, 0xda, 0xf4, 0xea, 0xf3,
-    0x57, 0xf4, 0x27, 0xf4, 0x3e, 0xf4, 0x35, 0xf4, 0x3a, 0xf4, 0x39, 0xf4, 0x3b, 0xf4, 0x3b, 0xf4, 0x3c, 0xf4, 0x3d, 0xf4,
-    0x3e, 0xf4, 0x3f, 0xf4, 0x40, 0xf4, 0x41, 0xf4, 0x42, 0xf4, 0x42, 0xf4, 0x43, 0xf4, 0x44, 0xf4, 0x45, 0xf4, 0x46, 0xf4,
-    0xae, 0xf4, 0x98, 0x6, 0xf, 0x1c, 0x1f, 0x14, 0x97, 0x17, 0x8, 0x16, 0xb8, 0x16, 0x66, 0x16, 0x89, 0x16, 0x77, 0x16,
-    0x7c, 0x16, 0x64, 0x6, 0x10, 0xee, 0xf5, 0xf6, 0x13, 0xf3, 0xce, 0xf4, 0xa, 0xf4, 0x63, 0xf4, 0x3d, 0xf4, 0x4f, 0xf4,
-    0x48, 0xf4, 0x4c, 0xf4, 0x4c, 0xf4, 0x4d, 0xf4, 0x4e, 0xf4, 0x4f, 0xf4, 0x50, 0xf4, 0x51, 0xf4, 0x51, 0xf4, 0x52, 0xf4,
-    0x53, 0xf4, 0x54, 0xf4, 0x55, 0xf4, 0x56, 0xf4, 0x57, 0xf4, 0x58, 0xf4, 0x8f, 0xff, 0x27, 0x1a, 0x8, 0x15, 0xa, 0x17,
-    0x25, 0x16, 0x88, 0x16, 0x59, 0x16, 0x6c, 0x16, 0x61, 0x16, 0x63, 0x16, 0x2e, 0xb, 0x9f, 0xf0, 0xbb, 0xf5, 0xb9, 0xf3,
-    0x9d, 0xf4, 0x39, 0xf4, 0x67, 0xf4, 0x54, 0xf4, 0x5d, 0xf4, 0x5a, 0xf4, 0x5d, 0xf4, 0x5d, 0xf4, 0x5e, 0xf4, 0x5f, 0xf4,
-    0x60, 0xf4, 0x61, 0xf4, 0x61, 0xf4, 0x62, 0xf4, 0x63, 0xf4, 0x64, 0xf4, 0x65, 0xf4, 0x66, 0xf4, 0x67, 0xf4, 0x68, 0xf4,
-    0x68, 0xf4, 0x93, 0xff, 0xa, 0x1a, 0xf2, 0x14, 0xf1, 0x16, 0xd, 0x16, 0x70, 0x16, 0x41, 0x16, 0x54, 0x16, 0x49, 0x16,
-    0x4b, 0x16, 0xf4, 0x7, 0x12, 0xef, 0xa5, 0xf6, 0x68, 0xf3, 0xda, 0xf4, 0x36, 0xf4, 0x81, 0xf4, 0x60, 0xf4, 0x70, 0xf4,
-    0x6a, 0xf4, 0x6e, 0xf4, 0x6e, 0xf4, 0x6f, 0xf4, 0x70, 0xf4, 0x71, 0xf4, 0x72, 0xf4, 0x72, 0xf4, 0x73, 0xf4, 0x74, 0xf4,
-    0x75, 0xf4, 0x76, 0xf4, 0x77, 0xf4, 0x78, 0xf4, 0x79, 0xf4, 0x79, 0xf4, 0x5a, 0x4, 0x5f, 0x1c, 0x95, 0x13, 0x6c, 0x17,
-    0xb2, 0x15, 0x76, 0x16, 0x1b, 0x16, 0x41, 0x16, 0x2e, 0x16, 0x6a, 0x15, 0xf7, 0x1, 0xb2, 0xef, 0x8c, 0xf6, 0x8a, 0xf3,
-    0xe3, 0xf4, 0x4a, 0xf4, 0x90, 0xf4, 0x72, 0xf4, 0x81, 0xf4, 0x7b, 0xf4, 0x7f, 0xf4, 0x7f, 0xf4, 0x80, 0xf4, 0x81, 0xf4,
-    0x82, 0xf4, 0x83, 0xf4, 0x83, 0xf4, 0x84, 0xf4, 0x85, 0xf4, 0x86, 0xf4, 0x87, 0xf4, 0x88, 0xf4, 0x89, 0xf4, 0x89, 0xf4,
-    0x4e, 0xf7, 0x95, 0x13, 0x8d, 0x17, 0x82, 0x15, 0x6c, 0x16, 0x0, 0x16, 0x2f, 0x16, 0x17, 0x16, 0x1f, 0x16, 0x1a, 0x16,
-    0x36, 0xe, 0x7e, 0xf2, 0x10, 0xf5, 0x4f, 0xf4, 0xa3, 0xf4, 0x7f, 0xf4, 0x90, 0xf4, 0x8a, 0xf4, 0x8e, 0xf4, 0x8d, 0xf4,
-    0x8e, 0xf4, 0x8f, 0xf4, 0x90, 0xf4, 0x91, 0xf4, 0x92, 0xf4, 0x93, 0xf4, 0x94, 0xf4, 0x94, 0xf4, 0x95, 0xf4, 0x96, 0xf4,
-    0x97, 0xf4, 0x98, 0xf4, 0x99, 0xf4, 0x9a, 0xf4, 0x63, 0xf5, 0xaa, 0x8, 0xcb, 0x1a, 0xfd, 0x13, 0xf8, 0x16, 0xa1, 0x15,
-    0x37, 0x16, 0xf2, 0x15, 0xe, 0x16, 0xff, 0x15, 0x45, 0x13, 0x26, 0xf7, 0x33, 0xf3, 0x3a, 0xf5, 0x51, 0xf4, 0xbb, 0xf4,
-    0x8c, 0xf4, 0xa2, 0xf4, 0x9a, 0xf4, 0x9f, 0xf4, 0x9e, 0xf4, 0x9f, 0xf4, 0xa0, 0xf4, 0xa1, 0xf4, 0xa2, 0xf4, 0xa3, 0xf4,
-    0xa4, 0xf4, 0xa5, 0xf4, 0xa5, 0xf4, 0xa6, 0xf4, 0xa7, 0xf4, 0xa8, 0xf4, 0xa9, 0xf4, 0xaa, 0xf4, 0xf, 0xf5, 0x79, 0x6,
-    0x57, 0x1b, 0x9f, 0x13, 0xff, 0x16, 0x7b, 0x15, 0x26, 0x16, 0xd7, 0x15, 0xf8, 0x15, 0xe7, 0x15, 0x30, 0x13, 0x33, 0xf7,
-    0x45, 0xf3, 0x4a, 0xf5, 0x61, 0xf4, 0xcb, 0xf4, 0x9d, 0xf4, 0xb3, 0xf4, 0xaa, 0xf4, 0xaf, 0xf4, 0xae, 0xf4, 0xb0, 0xf4,
-    0xb0, 0xf4, 0xb1, 0xf4, 0xb2, 0xf4, 0xb3, 0xf4, 0xb4, 0xf4, 0xb5, 0xf4, 0xb6, 0xf4, 0xb6, 0xf4, 0xb7, 0xf4, 0xb8, 0xf4,
-    0xb9, 0xf4, 0xba, 0xf4, 0xe6, 0xf5, 0xbf, 0xa, 0xe7, 0x19, 0x1c, 0x14, 0xa5, 0x16, 0x81, 0x15, 0x1, 0x16, 0xc5, 0x15,
-    0xde, 0x15, 0xd0, 0x15, 0x9b, 0xf, 0x82, 0xf3, 0xd5, 0xf4, 0xb1, 0xf4, 0xbd, 0xf4, 0xb9, 0xf4, 0xbd, 0xf4, 0xbc, 0xf4,
-    0xbd, 0xf4, 0xbe, 0xf4, 0xbf, 0xf4, 0xc0, 0xf4, 0xc1, 0xf4, 0xc2, 0xf4, 0xc2, 0xf4, 0xc3, 0xf4, 0xc4, 0xf4, 0xc5, 0xf4,
-    0xc6, 0xf4, 0xc7, 0xf4, 0xc8, 0xf4, 0xc8, 0xf4, 0xc9, 0xf4, 0xca, 0xf4, 0x71, 0xf9, 0x31, 0x16, 0x15, 0x16, 0x9f, 0x15,
-    0xd6, 0x15, 0xba, 0x15, 0xc5, 0x15, 0xbd, 0x15, 0xbe, 0x15, 0x59, 0x15, 0x1c, 0x4, 0x76, 0xef, 0x19, 0xf7, 0xc1, 0xf3,
-    0x40, 0xf5, 0x96, 0xf4, 0xe3, 0xf4, 0xc2, 0xf4, 0xd3, 0xf4, 0xcc, 0xf4, 0xd0, 0xf4, 0xd0, 0xf4, 0xd1, 0xf4, 0xd2, 0xf4,
-    0xd3, 0xf4, 0xd4, 0xf4, 0xd4, 0xf4, 0xd5, 0xf4, 0xd6, 0xf4, 0xd7, 0xf4, 0xd8, 0xf4, 0xd9, 0xf4, 0xda, 0xf4, 0x9f, 0xf5,
-    0x8b, 0x8, 0x56, 0x1a, 0xa9, 0x13, 0x94, 0x16, 0x45, 0x15, 0xd8, 0x15, 0x94, 0x15, 0xb0, 0x15, 0xa1, 0x15, 0xf0, 0xd,
-    0xda, 0xf2, 0x5e, 0xf5, 0xa0, 0xf4, 0xf3, 0xf4, 0xd0, 0xf4, 0xe0, 0xf4, 0xda, 0xf4, 0xde, 0xf4, 0xde, 0xf4, 0xdf, 0xf4,
-    0xe0, 0xf4, 0xe1, 0xf4, 0xe1, 0xf4, 0xe2, 0xf4, 0xe3, 0xf4, 0xe4, 0xf4, 0xe5, 0xf4, 0xe6, 0xf4, 0xe6, 0xf4, 0xe7, 0xf4,
-    0xe8, 0xf4, 0xe9, 0xf4, 0xea, 0xf4, 0xbe, 0x2, 0xbd, 0x1a, 0x6f, 0x13, 0x8c, 0x16, 0x27, 0x15, 0xc4, 0x15, 0x7b, 0x15,
-    0x9a, 0x15, 0x89, 0x15, 0xf5, 0x10, 0x80, 0xf4, 0x9b, 0xf4, 0xf, 0xf5, 0xd8, 0xf4, 0xf2, 0xf4, 0xe8, 0xf4, 0xed, 0xf4,
-    0xec, 0xf4, 0xee, 0xf4, 0xee, 0xf4, 0xef, 0xf4, 0xf0, 0xf4, 0xf1, 0xf4, 0xf2, 0xf4, 0xf3, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4,
-    0xf5, 0xf4, 0xf6, 0xf4, 0xf7, 0xf4, 0xf8, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0x44, 0x4, 0x6a, 0x1b, 0xf1, 0x12, 0xa4, 0x16,
-    0xfb, 0x14, 0xb6, 0x15, 0x60, 0x15, 0x84, 0x15, 0x72, 0x15, 0xd5, 0xd, 0xfe, 0xf2, 0x7c, 0xf5, 0xc1, 0xf4, 0x11, 0xf5,
-    0xef, 0xf4, 0x0, 0xf5, 0xf9, 0xf4, 0xfd, 0xf4, 0xfd, 0xf4, 0xfe, 0xf4, 0xff, 0xf4, 0x0, 0xf5, 0x1, 0xf5, 0x1, 0xf5,
-    0x2, 0xf5, 0x3, 0xf5, 0x4, 0xf5, 0x5, 0xf5, 0x6, 0xf5, 0x7, 0xf5, 0x7, 0xf5, 0x8, 0xf5, 0x8f, 0xf6, 0xa6, 0xc,
-    0xb5, 0x18, 0xf8, 0x13, 0xd, 0x16, 0x1c, 0x15, 0x86, 0x15, 0x54, 0x15, 0x67, 0x15, 0x5d, 0x15, 0x2d, 0x6, 0x28, 0xef,
-    0x93, 0xf7, 0xe5, 0xf3, 0x8b, 0xf5, 0xd0, 0xf4, 0x24, 0xf5, 0x0, 0xf5, 0x11, 0xf5, 0xb, 0xf5, 0xf, 0xf5, 0xe, 0xf5,
-    0xf, 0xf5, 0x10, 0xf5, 0x11, 0xf5, 0x12, 0xf5, 0x13, 0xf5, 0x14, 0xf5, 0x15, 0xf5, 0x15, 0xf5, 0x16, 0xf5, 0x17, 0xf5,
-    0x18, 0xf5, 0xab, 0xfc, 0x49, 0x17, 0xd0, 0x14, 0x8a, 0x15, 0x38, 0x15, 0x5a, 0x15, 0x48, 0x15, 0x4d, 0x15, 0x49, 0x15,
-    0x42, 0x12, 0x77, 0xf5, 0x62, 0xf4, 0x6d, 0xf5, 0xf1, 0xf4, 0x29, 0xf5, 0x12, 0xf5, 0x1e, 0xf5, 0x19, 0xf5, 0x1d, 0xf5,
-    0x1c, 0xf5, 0x1e, 0xf5, 0x1e, 0xf5, 0x1f, 0xf5, 0x20, 0xf5, 0x21, 0xf5, 0x22, 0xf5, 0x23, 0xf5, 0x23, 0xf5, 0x24, 0xf5,
-    0x25, 0xf5, 0x26, 0xf5, 0x27, 0xf5, 0x6b, 0xf7, 0xb5, 0x10, 0x38, 0x17, 0x5a, 0x14, 0x9f, 0x15, 0xb, 0x15, 0x4b, 0x15,
-    0x2c, 0x15, 0x37, 0x15, 0xaf, 0x13, 0xd4, 0xfd, 0xe3, 0xf1, 0x94, 0xf6, 0x83, 0xf4, 0x70, 0xf5, 0x8, 0xf5, 0x38, 0xf5,
-    0x23, 0xf5, 0x2e, 0xf5, 0x2a, 0xf5, 0x2d, 0xf5, 0x2d, 0xf5, 0x2e, 0xf5, 0x2f, 0xf5, 0x30, 0xf5, 0x31, 0xf5, 0x31, 0xf5,
-    0x32, 0xf5, 0x33, 0xf5, 0x34, 0xf5, 0x35, 0xf5, 0x36, 0xf5, 0xb7, 0xf6, 0x7f, 0xc, 0x66, 0x18, 0xb8, 0x13, 0xc6, 0x15,
-    0xd9, 0x14, 0x40, 0x15, 0x11, 0x15, 0x23, 0x15, 0xf8, 0x13, 0xea, 0xff, 0x53, 0xf1, 0xe7, 0xf6, 0x74, 0xf4, 0x8d, 0xf5,
-    0x11, 0xf5, 0x49, 0xf5, 0x31, 0xf5, 0x3d, 0xf5, 0x39, 0xf5, 0x3c, 0xf5, 0x3c, 0xf5, 0x3d, 0xf5, 0x3e, 0xf5, 0x3f, 0xf5,
-    0x40, 0xf5, 0x40, 0xf5, 0x41, 0xf5, 0x42, 0xf5, 0x43, 0xf5, 0x44, 0xf5, 0x45, 0xf5, 0x23, 0xf7, 0x83, 0xe, 0xa8, 0x17,
-    0xe9, 0x13, 0x90, 0x15, 0xd1, 0x14, 0x24, 0x15, 0xfc, 0x14, 0xb, 0x15, 0x85, 0x13, 0xde, 0xfd, 0x9, 0xf2, 0xaf, 0xf6,
-    0xa3, 0xf4, 0x8d, 0xf5, 0x26, 0xf5, 0x55, 0xf5, 0x42, 0xf5, 0x4b, 0xf5, 0x49, 0xf5, 0x4a, 0xf5, 0x4b, 0xf5, 0x4c, 0xf5,
-    0x4d, 0xf5, 0x4e, 0xf5, 0x4f, 0xf5, 0x4f, 0xf5, 0x50, 0xf5, 0x51, 0xf5, 0x52, 0xf5, 0x53, 0xf5, 0x54, 0xf5, 0xcb, 0xf9,
-    0x5e, 0x15, 0x44, 0x15, 0xd2, 0x14, 0x8, 0x15, 0xec, 0x14, 0xf6, 0x14, 0xef, 0x14, 0xf0, 0x14, 0x79, 0x10, 0xee, 0xf4,
-    0x7, 0xf5, 0x79, 0xf5, 0x42, 0xf5, 0x5c, 0xf5, 0x52, 0xf5, 0x57, 0xf5, 0x56, 0xf5, 0x58, 0xf5, 0x59, 0xf5, 0x59, 0xf5,
-    0x5a, 0xf5, 0x5b, 0xf5, 0x5c, 0xf5, 0x5d, 0xf5, 0x5e, 0xf5, 0x5e, 0xf5, 0x5f, 0xf5, 0x60, 0xf5, 0x61, 0xf5, 0x62, 0xf5,
-    0xc1, 0xf5, 0x3c, 0x6, 0xf9, 0x19, 0xac, 0x12, 0xdd, 0x15, 0x6e, 0x14, 0xf, 0x15, 0xc5, 0x14, 0xe4, 0x14, 0x16, 0x14,
-    0xfc, 0x1, 0xec, 0xf0, 0x51, 0xf7, 0x85, 0xf4, 0xc5, 0xf5, 0x37, 0xf5, 0x78, 0xf5, 0x5c, 0xf5, 0x6a, 0xf5, 0x65, 0xf5,
-    0x69, 0xf5, 0x68, 0xf5, 0x69, 0xf5, 0x6a, 0xf5, 0x6b, 0xf5, 0x6c, 0xf5, 0x6d, 0xf5, 0x6d, 0xf5, 0x6e, 0xf5, 0x6f, 0xf5,
-    0x70, 0xf5, 0x71, 0xf5, 0x49, 0xfe, 0x76, 0x17, 0xe8, 0x13, 0x2d, 0x15, 0x9e, 0x14, 0xda, 0x14, 0xbd, 0x14, 0xc8, 0x14,
-    0xc0, 0x14, 0xfc, 0x8, 0x44, 0xf1, 0x1d, 0xf7, 0xb2, 0xf4, 0xc6, 0xf5, 0x4c, 0xf5, 0x84, 0xf5, 0x6b, 0xf5, 0x78, 0xf5,
-    0x73, 0xf5, 0x77, 0xf5, 0x76, 0xf5, 0x78, 0xf5, 0x78, 0xf5, 0x79, 0xf5, 0x7a, 0xf5, 0x7b, 0xf5, 0x7c, 0xf5, 0x7c, 0xf5,
-    0x7d, 0xf5, 0x7e, 0xf5, 0x7f, 0xf5, 0x5e, 0xfb, 0xdb, 0x15, 0x9b, 0x14, 0xbd, 0x14, 0xb0, 0x14, 0xb2, 0x14, 0xb0, 0x14,
-    0xae, 0x14, 0xac, 0x14, 0x69, 0xa, 0x18, 0xf2, 0xc5, 0xf6, 0xef, 0xf4, 0xbf, 0xf5, 0x64, 0xf5, 0x8d, 0xf5, 0x7c, 0xf5,
-    0x85, 0xf5, 0x82, 0xf5, 0x85, 0xf5, 0x85, 0xf5, 0x86, 0xf5, 0x87, 0xf5, 0x88, 0xf5, 0x88, 0xf5, 0x89, 0xf5, 0x8a, 0xf5,
-    0x8b, 0xf5, 0x8c, 0xf5, 0x8c, 0xf5, 0x8d, 0xf5, 0xdb, 0xfc, 0x84, 0x16, 0x22, 0x14, 0xd3, 0x14, 0x86, 0x14, 0xa5, 0x14,
-    0x95, 0x14, 0x9a, 0x14, 0x95, 0x14, 0x76, 0x7, 0xaa, 0xf0, 0x9a, 0xf7, 0xa3, 0xf4, 0xf6, 0xf5, 0x60, 0xf5, 0xa4, 0xf5,
-    0x87, 0xf5, 0x95, 0xf5, 0x90, 0xf5, 0x94, 0xf5, 0x93, 0xf5, 0x94, 0xf5, 0x95, 0xf5, 0x96, 0xf5, 0x97, 0xf5, 0x98, 0xf5,
-    0x98, 0xf5, 0x99, 0xf5, 0x9a, 0xf5, 0x9b, 0xf5, 0x9c, 0xf5, 0xb2, 0x2, 0x68, 0x19, 0x7e, 0x12, 0x71, 0x15, 0x1f, 0x14,
-    0xb3, 0x14, 0x6f, 0x14, 0x8b, 0x14, 0x8, 0x13, 0xfa, 0xfd, 0x76, 0xf2, 0xfb, 0xf6, 0xfe, 0xf4, 0xe3, 0xf5, 0x7d, 0xf5,
-    0xac, 0xf5, 0x98, 0xf5, 0xa2, 0xf5, 0x9f, 0xf5, 0xa2, 0xf5, 0xa1, 0xf5, 0xa3, 0xf5, 0xa4, 0xf5, 0xa4, 0xf5, 0xa5, 0xf5,
-    0xa6, 0xf5, 0xa7, 0xf5, 0xa8, 0xf5, 0xa8, 0xf5, 0xa9, 0xf5, 0xd6, 0xf7, 0x1c, 0x10, 0x5c, 0x16, 0x9a, 0x13, 0xd3, 0x14,
-    0x45, 0x14, 0x81, 0x14, 0x65, 0x14, 0x6e, 0x14, 0xbc, 0xb, 0xd, 0xf3, 0x88, 0xf6, 0x48, 0xf5, 0xd5, 0xf5, 0x98, 0xf5,
-    0xb4, 0xf5, 0xa8, 0xf5, 0xaf, 0xf5, 0xad, 0xf5, 0xaf, 0xf5, 0xb0, 0xf5, 0xb0, 0xf5, 0xb1, 0xf5, 0xb2, 0xf5, 0xb3, 0xf5,
-    0xb4, 0xf5, 0xb5, 0xf5, 0xb5, 0xf5, 0xb6, 0xf5, 0xb7, 0xf5, 0xb8, 0xf5, 0x21, 0x4, 0xef, 0x19, 0xf4, 0x11, 0x70, 0x15,
-    0xe0, 0x13, 0x90, 0x14, 0x40, 0x14, 0x60, 0x14, 0x28, 0x12, 0xc, 0xfa, 0xd1, 0xf3, 0x8f, 0xf6, 0x57, 0xf5, 0xe3, 0xf5,
-    0xa6, 0xf5, 0xc3, 0xf5, 0xb7, 0xf5, 0xbe, 0xf5, 0xbb, 0xf5, 0xbe, 0xf5, 0xbe, 0xf5, 0xbf, 0xf5, 0xc0, 0xf5, 0xc1, 0xf5,
-    0xc1, 0xf5, 0xc2, 0xf5, 0xc3, 0xf5, 0xc4, 0xf5, 0xc5, 0xf5, 0xc5, 0xf5, 0xd0, 0xff, 0x9d, 0x17, 0x9, 0x13, 0xd4, 0x14,
-    0x7, 0x14, 0x60, 0x14, 0x36, 0x14, 0x47, 0x14, 0xcd, 0x12, 0x7, 0xfe, 0xaa, 0xf2, 0x20, 0xf7, 0x2a, 0xf5, 0xb, 0xf6,
-    0xa8, 0xf5, 0xd6, 0xf5, 0xc2, 0xf5, 0xcc, 0xf5, 0xc9, 0xf5, 0xcc, 0xf5, 0xcb, 0xf5, 0xcd, 0xf5, 0xcd, 0xf5, 0xce, 0xf5,
-    0xcf, 0xf5, 0xd0, 0xf5, 0xd1, 0xf5, 0xd1, 0xf5, 0xd2, 0xf5, 0xd3, 0xf5, 0xd2, 0xff, 0x84, 0x17, 0xf4, 0x12, 0xbe, 0x14,
-    0xf2, 0x13, 0x4b, 0x14, 0x20, 0x14, 0x31, 0x14, 0x5f, 0x12, 0x14, 0xfc, 0x57, 0xf3, 0xea, 0xf6, 0x56, 0xf5, 0xc, 0xf6,
-    0xbc, 0xf5, 0xe0, 0xf5, 0xd2, 0xf5, 0xd9, 0xf5, 0xd7, 0xf5, 0xd9, 0xf5, 0xd9, 0xf5, 0xda, 0xf5, 0xdb, 0xf5, 0xdc, 0xf5,
-    0xdd, 0xf5, 0xdd, 0xf5, 0xde, 0xf5, 0xdf, 0xf5, 0xe0, 0xf5, 0xe1, 0xf5, 0xac, 0x2, 0xe1, 0x18, 0x1e, 0x12, 0x0, 0x15,
-    0xb5, 0x13, 0x46, 0x14, 0x3, 0x14, 0x1f, 0x14, 0x39, 0x11, 0x3d, 0xf6, 0x36, 0xf5, 0x30, 0xf6, 0xbd, 0xf5, 0xf2, 0xf5,
-    0xdb, 0xf5, 0xe7, 0xf5, 0xe2, 0xf5, 0xe6, 0xf5, 0xe5, 0xf5, 0xe6, 0xf5, 0xe7, 0xf5, 0xe8, 0xf5, 0xe9, 0xf5, 0xea, 0xf5,
-    0xea, 0xf5, 0xeb, 0xf5, 0xec, 0xf5, 0xed, 0xf5, 0xee, 0xf5, 0x58, 0xf7, 0xe2, 0xb, 0x18, 0x17, 0xb0, 0x12, 0xa0, 0x14,
-    0xc0, 0x13, 0x22, 0x14, 0xf3, 0x13, 0x6, 0x14, 0xae, 0x8, 0xed, 0xf1, 0x8a, 0xf7, 0x37, 0xf5, 0x40, 0xf6, 0xcb, 0xf5,
-    0x1, 0xf6, 0xea, 0xf5, 0xf5, 0xf5, 0xf1, 0xf5, 0xf4, 0xf5, 0xf4, 0xf5, 0xf5, 0xf5, 0xf6, 0xf5, 0xf7, 0xf5, 0xf7, 0xf5,
-    0xf8, 0xf5, 0xf9, 0xf5, 0xfa, 0xf5, 0xfb, 0xf5, 0xfb, 0xf5, 0x70, 0xfe, 0x7f, 0x16, 0x19, 0x13, 0x51, 0x14, 0xc6, 0x13,
-    0x2, 0x14, 0xe4, 0x13, 0xef, 0x13, 0xcd, 0x11, 0x36, 0xfa, 0x21, 0xf4, 0xce, 0xf6, 0x9d, 0xf5, 0x26, 0xf6, 0xeb, 0xf5,
-    0x6, 0xf6, 0xfb, 0xf5, 0x2, 0xf6, 0xff, 0xf5, 0x2, 0xf6, 0x2, 0xf6, 0x3, 0xf6, 0x4, 0xf6, 0x4, 0xf6, 0x5, 0xf6,
-    0x6, 0xf6, 0x7, 0xf6, 0x8, 0xf6, 0x8, 0xf6, 0x7e, 0xf8, 0x97, 0x11, 0x1d, 0x15, 0x4d, 0x13, 0x1c, 0x14, 0xbd, 0x13,
-    0xe5, 0x13, 0xd1, 0x13, 0x24, 0x13, 0xf5, 0x1, 0xd1, 0xf1, 0xde, 0xf7, 0x37, 0xf5, 0x67, 0xf6, 0xe1, 0xf5, 0x1d, 0xf6,
-    0x4, 0xf6, 0x10, 0xf6, 0xc, 0xf6, 0xf, 0xf6, 0xf, 0xf6, 0x10, 0xf6, 0x11, 0xf6, 0x11, 0xf6, 0x12, 0xf6, 0x13, 0xf6,
-    0x14, 0xf6, 0x15, 0xf6, 0x15, 0xf6, 0xd5, 0xf7, 0xab, 0xd, 0x37, 0x16, 0xb7, 0x12, 0x41, 0x14, 0x8f, 0x13, 0xdc, 0x13,
-    0xb7, 0x13, 0x6c, 0x13, 0xe0, 0x3, 0x4b, 0xf1, 0x2a, 0xf8, 0x28, 0xf5, 0x80, 0xf6, 0xe8, 0xf5, 0x2d, 0xf6, 0xf, 0xf6,
-    0x1e, 0xf6, 0x18, 0xf6, 0x1c, 0xf6, 0x1c, 0xf6, 0x1d, 0xf6, 0x1e, 0xf6, 0x1e, 0xf6, 0x1f, 0xf6, 0x20, 0xf6, 0x21, 0xf6,
-    0x22, 0xf6, 0x22, 0xf6, 0xe0, 0xf7, 0x9d, 0xd, 0x20, 0x16, 0xa3, 0x12, 0x2c, 0x14, 0x7a, 0x13, 0xc7, 0x13, 0xa2, 0x13,
-    0xfe, 0x12, 0xf3, 0x1, 0xf5, 0xf1, 0xf3, 0xf7, 0x54, 0xf5, 0x80, 0xf6, 0xfb, 0xf5, 0x38, 0xf6, 0x1e, 0xf6, 0x2a, 0xf6,
-    0x26, 0xf6, 0x29, 0xf6, 0x29, 0xf6, 0x2a, 0xf6, 0x2b, 0xf6, 0x2c, 0xf6, 0x2c, 0xf6, 0x2d, 0xf6, 0x2e, 0xf6, 0x2f, 0xf6,
-    0x30, 0xf6, 0x30, 0xf6, 0x31, 0xf6, 0x32, 0xf6, 0x33, 0xf6, 0x34, 0xf6, 0x34, 0xf6, 0x35, 0xf6, 0x36, 0xf6, 0x37, 0xf6,
-    0x37, 0xf6, 0x38, 0xf6, 0x39, 0xf6, 0x3a, 0xf6, 0x46, 0x1, 0x85, 0x17, 0x7, 0x12, 0x4c, 0x14, 0x47, 0x13, 0xba, 0x13,
-    0x84, 0x13, 0x9a, 0x13, 0x8e, 0x13, 0x90, 0x13, 0x8e, 0x13, 0x83, 0x12, 0x10, 0x0, 0xa7, 0xf2, 0xc6, 0xf7, 0x87, 0xf5,
-    0x88, 0xf6, 0x17, 0xf6, 0x4a, 0xf6, 0x35, 0xf6, 0x3f, 0xf6, 0x3c, 0xf6, 0x3f, 0xf6, 0x3e, 0xf6, 0x40, 0xf6, 0x40, 0xf6,
-    0x41, 0xf6, 0x42, 0xf6, 0x43, 0xf6, 0x44, 0xf6, 0x44, 0xf6, 0x45, 0xf6, 0x46, 0xf6, 0x47, 0xf6, 0x47, 0xf6, 0x48, 0xf6,
-    0x49, 0xf6, 0x4a, 0xf6, 0x4b, 0xf6, 0x4b, 0xf6, 0x4c, 0xf6, 0xe8, 0xff, 0xab, 0x16, 0x4b, 0x12, 0x2, 0x14, 0x3e, 0x13,
-    0x93, 0x13, 0x6a, 0x13, 0x7b, 0x13, 0x70, 0x13, 0x74, 0x13, 0x6f, 0x13, 0x68, 0x12, 0x12, 0x0, 0xbe, 0xf2, 0xd7, 0xf7,
-    0x9a, 0xf5, 0x9b, 0xf6, 0x29, 0xf6, 0x5d, 0xf6, 0x47, 0xf6, 0x52, 0xf6, 0x4e, 0xf6, 0x51, 0xf6, 0x51, 0xf6, 0x52, 0xf6,
-    0x53, 0xf6, 0x54, 0xf6, 0x54, 0xf6, 0x55, 0xf6, 0x56, 0xf6, 0x57, 0xf6, 0x58, 0xf6, 0x58, 0xf6, 0x59, 0xf6, 0x5a, 0xf6,
-    0x5b, 0xf6, 0x5b, 0xf6, 0x5c, 0xf6, 0x5d, 0xf6, 0x5e, 0xf6, 0xb6, 0xf6, 0xe1, 0x5, 0xf, 0x18, 0x55, 0x11, 0x46, 0x14,
-    0xf4, 0x12, 0x88, 0x13, 0x44, 0x13, 0x60, 0x13, 0x51, 0x13, 0x56, 0x13, 0x51, 0x13, 0x3c, 0xf, 0x1, 0xf6, 0x17, 0xf6,
-    0x80, 0xf6, 0x4d, 0xf6, 0x66, 0xf6, 0x5c, 0xf6, 0x61, 0xf6, 0x60, 0xf6, 0x61, 0xf6, 0x62, 0xf6, 0x63, 0xf6, 0x64, 0xf6,
-    0x65, 0xf6, 0x65, 0xf6, 0x66, 0xf6, 0x67, 0xf6, 0x68, 0xf6, 0x68, 0xf6, 0x69, 0xf6, 0x6a, 0xf6, 0x6b, 0xf6, 0x6c, 0xf6,
-    0x6c, 0xf6, 0x6d, 0xf6, 0x6e, 0xf6, 0x6f, 0xf6, 0x6f, 0xf6, 0x70, 0xf6, 0xdc, 0xfb, 0x50, 0x14, 0x2a, 0x13, 0x48, 0x13,
-    0x3c, 0x13, 0x3e, 0x13, 0x3c, 0x13, 0x3a, 0x13, 0x39, 0x13, 0x37, 0x13, 0x35, 0x13, 0x31, 0x12, 0x16, 0x0, 0xef, 0xf2,
-    0xf6, 0xf7, 0xc1, 0xf5, 0xbe, 0xf6, 0x4e, 0xf6, 0x81, 0xf6, 0x6b, 0xf6, 0x77, 0xf6, 0x72, 0xf6, 0x76, 0xf6, 0x75, 0xf6,
-    0x76, 0xf6, 0x77, 0xf6, 0x78, 0xf6, 0x79, 0xf6, 0x79, 0xf6, 0x7a, 0xf6, 0x7b, 0xf6, 0x7c, 0xf6, 0x7d, 0xf6, 0x7d, 0xf6,
-    0x7e, 0xf6, 0x7f, 0xf6, 0x80, 0xf6, 0x80, 0xf6, 0x81, 0xf6, 0x82, 0xf6, 0x34, 0xf9, 0xd0, 0x12, 0xc5, 0x13, 0xd7, 0x12,
-    0x44, 0x13, 0x11, 0x13, 0x26, 0x13, 0x1a, 0x13, 0x1d, 0x13, 0x19, 0x13, 0x19, 0x13, 0x15, 0x12, 0x19, 0x0, 0x6, 0xf3,
-    0x5, 0xf8, 0xd4, 0xf5, 0xcf, 0xf6, 0x60, 0xf6, 0x93, 0xf6, 0x7d, 0xf6, 0x88, 0xf6, 0x84, 0xf6, 0x88, 0xf6, 0x87, 0xf6,
-    0x88, 0xf6, 0x89, 0xf6, 0x8a, 0xf6, 0x8a, 0xf6, 0x8b, 0xf6, 0x8c, 0xf6, 0x8d, 0xf6, 0x8e, 0xf6, 0x8e, 0xf6, 0x8f, 0xf6,
-    0x90, 0xf6, 0x91, 0xf6, 0x91, 0xf6, 0x92, 0xf6, 0x93, 0xf6, 0x94, 0xf6, 0x44, 0xfd, 0xc3, 0x14, 0x94, 0x12, 0x37, 0x13,
-    0xef, 0x12, 0xd, 0x13, 0xfd, 0x12, 0x2, 0x13, 0xfd, 0x12, 0xfe, 0x12, 0xfa, 0x12, 0xa4, 0x10, 0xbe, 0xf8, 0x62, 0xf5,
-    0x1c, 0xf7, 0x55, 0xf6, 0xaf, 0xf6, 0x89, 0xf6, 0x9a, 0xf6, 0x94, 0xf6, 0x98, 0xf6, 0x97, 0xf6, 0x99, 0xf6, 0x99, 0xf6,
-    0x9a, 0xf6, 0x9b, 0xf6, 0x9c, 0xf6, 0x9c, 0xf6, 0x9d, 0xf6, 0x9e, 0xf6, 0x9f, 0xf6, 0x9f, 0xf6, 0xa0, 0xf6, 0xa1, 0xf6,
-    0xa2, 0xf6, 0xa3, 0xf6, 0xa3, 0xf6, 0xa4, 0xf6, 0xa5, 0xf6, 0xa5, 0xf7, 0x6d, 0x9, 0x5c, 0x16, 0x6a, 0x11, 0x94, 0x13,
-    0x9a, 0x12, 0x7, 0x13, 0xd5, 0x12, 0xe8, 0x12, 0xde, 0x12, 0xe0, 0x12, 0xdd, 0x12, 0x9a, 0x5, 0x84, 0xf1, 0xdd, 0xf8,
-    0xa6, 0xf5, 0x16, 0xf7, 0x73, 0xf6, 0xbd, 0xf6, 0x9d, 0xf6, 0xad, 0xf6, 0xa7, 0xf6, 0xab, 0xf6, 0xaa, 0xf6, 0xab, 0xf6,
-    0xac, 0xf6, 0xad, 0xf6, 0xae, 0xf6, 0xae, 0xf6, 0xaf, 0xf6, 0xb0, 0xf6, 0xb1, 0xf6, 0xb1, 0xf6, 0xb2, 0xf6, 0xb3, 0xf6,
-    0xb4, 0xf6, 0xb4, 0xf6, 0xb5, 0xf6, 0xb6, 0xf6, 0xb7, 0xf6, 0xeb, 0x3, 0xe8, 0x17, 0x97, 0x10, 0xc9, 0x13, 0x5a, 0x12,
-    0xfb, 0x12, 0xb1, 0x12, 0xd0, 0x12, 0xc0, 0x12, 0xc5, 0x12, 0xc0, 0x12, 0xe4, 0x6, 0x4b, 0xf2, 0x90, 0xf8, 0xe3, 0xf5,
-    0x14, 0xf7, 0x8d, 0xf6, 0xcb, 0xf6, 0xb0, 0xf6, 0xbd, 0xf6, 0xb9, 0xf6, 0xbc, 0xf6, 0xbb, 0xf6, 0xbc, 0xf6, 0xbd, 0xf6,
-    0xbe, 0xf6, 0xbf, 0xf6, 0xc0, 0xf6, 0xc0, 0xf6, 0xc1, 0xf6, 0xc2, 0xf6, 0xc3, 0xf6, 0xc3, 0xf6, 0xc4, 0xf6, 0xc5, 0xf6,
-    0xc6, 0xf6, 0xc6, 0xf6, 0xc7, 0xf6, 0x70, 0xf7, 0x86, 0x7, 0xa5, 0x16, 0xf9, 0x10, 0x74, 0x13, 0x56, 0x12, 0xd3, 0x12,
-    0x9a, 0x12, 0xb0, 0x12, 0xa5, 0x12, 0xa7, 0x12, 0xfd, 0x11, 0xef, 0x1, 0xd4, 0xf2, 0x7e, 0xf8, 0x3, 0xf6, 0x1f, 0xf7,
-    0xa1, 0xf6, 0xdb, 0xf6, 0xc2, 0xf6, 0xce, 0xf6, 0xca, 0xf6, 0xcd, 0xf6, 0xcd, 0xf6, 0xce, 0xf6, 0xcf, 0xf6, 0xcf, 0xf6,
-    0xd0, 0xf6, 0xd1, 0xf6, 0xd2, 0xf6, 0xd2, 0xf6, 0xd3, 0xf6, 0xd4, 0xf6, 0xd5, 0xf6, 0xd5, 0xf6, 0xd6, 0xf6, 0xd7, 0xf6,
-    0xd8, 0xf6, 0xd9, 0xf6, 0xc2, 0xfa, 0xef, 0x12, 0xd7, 0x12, 0x73, 0x12, 0xa2, 0x12, 0x8a, 0x12, 0x92, 0x12, 0x8d, 0x12,
-    0x8d, 0x12, 0x8b, 0x12, 0x89, 0x12, 0x53, 0xd, 0xd4, 0xf5, 0xef, 0xf6, 0xd0, 0xf6, 0xdc, 0xf6, 0xd7, 0xf6, 0xdb, 0xf6,
-    0xda, 0xf6, 0xdb, 0xf6, 0xdc, 0xf6, 0xdd, 0xf6, 0xde, 0xf6, 0xde, 0xf6, 0xdf, 0xf6, 0xe0, 0xf6, 0xe1, 0xf6, 0xe1, 0xf6,
-    0xe2, 0xf6, 0xe3, 0xf6, 0xe4, 0xf6, 0xe5, 0xf6, 0xe5, 0xf6, 0xe6, 0xf6, 0xe7, 0xf6, 0xe8, 0xf6, 0xe8, 0xf6, 0xe9, 0xf6,
-    0x88, 0xf8, 0xcc, 0xc, 0xba, 0x14, 0x7a, 0x11, 0xe9, 0x12, 0x42, 0x12, 0x8b, 0x12, 0x67, 0x12, 0x76, 0x12, 0x6d, 0x12,
-    0x6f, 0x12, 0xd6, 0xf, 0x3b, 0xf7, 0x4e, 0xf6, 0x31, 0xf7, 0xc8, 0xf6, 0xf8, 0xf6, 0xe4, 0xf6, 0xee, 0xf6, 0xeb, 0xf6,
-    0xed, 0xf6, 0xee, 0xf6, 0xee, 0xf6, 0xef, 0xf6, 0xf0, 0xf6, 0xf1, 0xf6, 0xf1, 0xf6, 0xf2, 0xf6, 0xf3, 0xf6, 0xf4, 0xf6,
-    0xf4, 0xf6, 0xf5, 0xf6, 0xf6, 0xf6, 0xf7, 0xf6, 0xf7, 0xf6, 0xf8, 0xf6, 0xf9, 0xf6, 0xfa, 0xf6, 0x97, 0xf8, 0xb9, 0xc,
-    0x9a, 0x14, 0x60, 0x11, 0xcc, 0x12, 0x27, 0x12, 0x6f, 0x12, 0x4b, 0x12, 0x5a, 0x12, 0x51, 0x12, 0x53, 0x12, 0x75, 0xe,
-    0xa2, 0xf6, 0xb8, 0xf6, 0x1a, 0xf7, 0xeb, 0xf6, 0x1, 0xf7, 0xf8, 0xf6, 0xfd, 0xf6, 0xfc, 0xf6, 0xfe, 0xf6, 0xfe, 0xf6,
-    0xff, 0xf6, 0x0, 0xf7, 0x1, 0xf7, 0x1, 0xf7, 0x2, 0xf7, 0x3, 0xf7, 0x4, 0xf7, 0x4, 0xf7, 0x5, 0xf7, 0x6, 0xf7,
-    0x7, 0xf7, 0x7, 0xf7, 0x8, 0xf7, 0x9, 0xf7, 0xa, 0xf7, 0xa, 0xf7, 0x29, 0xfc, 0x42, 0x13, 0x2a, 0x12, 0x48, 0x12,
-    0x3c, 0x12, 0x3e, 0x12, 0x3b, 0x12, 0x3a, 0x12, 0x38, 0x12, 0x37, 0x12, 0x35, 0x12, 0xb7, 0x6, 0xc3, 0xf2, 0xd5, 0xf8,
-    0x3d, 0xf6, 0x66, 0xf7, 0xe2, 0xf6, 0x1e, 0xf7, 0x5, 0xf7, 0x11, 0xf7, 0xd, 0xf7, 0x10, 0xf7, 0xf, 0xf7, 0x11, 0xf7,
-    0x11, 0xf7, 0x12, 0xf7, 0x13, 0xf7, 0x14, 0xf7, 0x14, 0xf7, 0x15, 0xf7, 0x16, 0xf7, 0x17, 0xf7, 0x17, 0xf7, 0x18, 0xf7,
-    0x19, 0xf7, 0x1a, 0xf7, 0x1a, 0xf7, 0xf, 0xf8, 0x13, 0x9, 0x70, 0x15, 0xb6, 0x10, 0xc7, 0x12, 0xd9, 0x11, 0x41, 0x12,
-    0x10, 0x12, 0x25, 0x12, 0x19, 0x12, 0x1b, 0x12, 0x6, 0xd, 0x1c, 0xf6, 0x31, 0xf7, 0x13, 0xf7, 0x1d, 0xf7, 0x1a, 0xf7,
-    0x1d, 0xf7, 0x1d, 0xf7, 0x1e, 0xf7, 0x1e, 0xf7, 0x1f, 0xf7, 0x20, 0xf7, 0x21, 0xf7, 0x21, 0xf7, 0x22, 0xf7, 0x23, 0xf7,
-    0x24, 0xf7, 0x24, 0xf7, 0x25, 0xf7, 0x26, 0xf7, 0x27, 0xf7, 0x27, 0xf7, 0x28, 0xf7, 0x29, 0xf7, 0x2a, 0xf7, 0x2a, 0xf7,
-    0x7c, 0xf7, 0x8b, 0x5, 0x62, 0x16, 0x27, 0x10, 0xe0, 0x12, 0xa7, 0x11, 0x30, 0x12, 0xf1, 0x11, 0xb, 0x12, 0xfd, 0x11,
-    0x1, 0x12, 0x34, 0xe, 0xd5, 0xf6, 0xea, 0xf6, 0x4a, 0xf7, 0x1c, 0xf7, 0x32, 0xf7, 0x29, 0xf7, 0x2e, 0xf7, 0x2d, 0xf7,
-    0x2f, 0xf7, 0x2f, 0xf7, 0x30, 0xf7, 0x31, 0xf7, 0x32, 0xf7, 0x32, 0xf7, 0x33, 0xf7, 0x34, 0xf7, 0x34, 0xf7, 0x35, 0xf7,
-    0x36, 0xf7, 0x37, 0xf7, 0x37, 0xf7, 0x38, 0xf7, 0x39, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x2c, 0xf8, 0xf9, 0x8, 0x2f, 0x15,
-    0x83, 0x10, 0x8f, 0x12, 0xa3, 0x11, 0xa, 0x12, 0xda, 0x11, 0xed, 0x11, 0xe2, 0x11, 0xe6, 0x11, 0x5d, 0xa, 0xf7, 0xf4,
-    0xfb, 0xf7, 0xe6, 0xf6, 0x60, 0xf7, 0x2b, 0xf7, 0x44, 0xf7, 0x3a, 0xf7, 0x3f, 0xf7, 0x3e, 0xf7, 0x3f, 0xf7, 0x40, 0xf7,
-    0x41, 0xf7, 0x42, 0xf7, 0x42, 0xf7, 0x43, 0xf7, 0x44, 0xf7, 0x45, 0xf7, 0x45, 0xf7, 0x46, 0xf7, 0x47, 0xf7, 0x48, 0xf7,
-    0x48, 0xf7, 0x49, 0xf7, 0x4a, 0xf7, 0x4b, 0xf7, 0x9, 0xfb, 0x2a, 0x12, 0x12, 0x12, 0xb4, 0x11, 0xe0, 0x11, 0xc9, 0x11,
-    0xd1, 0x11, 0xcc, 0x11, 0xcb, 0x11, 0xca, 0x11, 0xd9, 0x10, 0x2e, 0x0, 0x11, 0xf4, 0xb1, 0xf8, 0xaa, 0xf6, 0x93, 0xf7,
-    0x2c, 0xf7, 0x5b, 0xf7, 0x47, 0xf7, 0x51, 0xf7, 0x4d, 0xf7, 0x51, 0xf7, 0x50, 0xf7, 0x51, 0xf7, 0x52, 0xf7, 0x52, 0xf7,
-    0x53, 0xf7, 0x54, 0xf7, 0x55, 0xf7, 0x55, 0xf7, 0x56, 0xf7, 0x57, 0xf7, 0x58, 0xf7, 0x58, 0xf7, 0x59, 0xf7, 0x5a, 0xf7,
-    0x49, 0xf8, 0xdf, 0x8, 0xef, 0x14, 0x52, 0x10, 0x57, 0x12, 0x6e, 0x11, 0xd4, 0x11, 0xa3, 0x11, 0xb8, 0x11, 0xac, 0x11,
-    0xaf, 0x11, 0x8a, 0x6, 0x35, 0xf3, 0x18, 0xf9, 0x94, 0xf6, 0xb3, 0xf7, 0x34, 0xf7, 0x6d, 0xf7, 0x55, 0xf7, 0x61, 0xf7,
-    0x5d, 0xf7, 0x60, 0xf7, 0x5f, 0xf7, 0x61, 0xf7, 0x61, 0xf7, 0x62, 0xf7, 0x63, 0xf7, 0x63, 0xf7, 0x64, 0xf7, 0x65, 0xf7,
-    0x66, 0xf7, 0x66, 0xf7, 0x67, 0xf7, 0x68, 0xf7, 0x69, 0xf7, 0x69, 0xf7, 0x8, 0xf8, 0x21, 0x7, 0x54, 0x15, 0x0, 0x10,
-    0x55, 0x12, 0x49, 0x11, 0xbd, 0x11, 0x88, 0x11, 0x9d, 0x11, 0x92, 0x11, 0x94, 0x11, 0x80, 0x6, 0x4c, 0xf3, 0x24, 0xf9,
-    0xa4, 0xf6, 0xc2, 0xf7, 0x44, 0xf7, 0x7d, 0xf7, 0x64, 0xf7, 0x71, 0xf7, 0x6c, 0xf7, 0x70, 0xf7, 0x6f, 0xf7, 0x70, 0xf7,
-    0x71, 0xf7, 0x72, 0xf7, 0x72, 0xf7, 0x73, 0xf7, 0x74, 0xf7, 0x75, 0xf7, 0x75, 0xf7, 0x76, 0xf7, 0x77, 0xf7, 0x77, 0xf7,
-    0x78, 0xf7, 0x79, 0xf7, 0x1, 0xf9, 0x26, 0xc, 0xa5, 0x13, 0x92, 0x10, 0xed, 0x11, 0x50, 0x11, 0x93, 0x11, 0x73, 0x11,
-    0x7f, 0x11, 0x78, 0x11, 0x8e, 0x10, 0x32, 0x0, 0x4f, 0xf4, 0xda, 0xf8, 0xdb, 0xf6, 0xc0, 0xf7, 0x5b, 0xf7, 0x89, 0xf7,
-    0x76, 0xf7, 0x7f, 0xf7, 0x7d, 0xf7, 0x7e, 0xf7, 0x7f, 0xf7, 0x80, 0xf7, 0x80, 0xf7, 0x81, 0xf7, 0x82, 0xf7, 0x83, 0xf7,
-    0x83, 0xf7, 0x84, 0xf7, 0x85, 0xf7, 0x86, 0xf7, 0x86, 0xf7, 0x87, 0xf7, 0x88, 0xf7, 0x89, 0xf7, 0xd5, 0xfe, 0x9d, 0x13,
-    0xac, 0x10, 0xba, 0x11, 0x42, 0x11, 0x75, 0x11, 0x5c, 0x11, 0x65, 0x11, 0x5e, 0x11, 0x60, 0x11, 0x4b, 0xb, 0xf6, 0xf5,
-    0xf0, 0xf7, 0x5c, 0xf7, 0x9c, 0xf7, 0x81, 0xf7, 0x8e, 0xf7, 0x89, 0xf7, 0x8d, 0xf7, 0x8c, 0xf7, 0x8d, 0xf7, 0x8e, 0xf7,
-    0x8f, 0xf7, 0x8f, 0xf7, 0x90, 0xf7, 0x91, 0xf7, 0x92, 0xf7, 0x92, 0xf7, 0x93, 0xf7, 0x94, 0xf7, 0x94, 0xf7, 0x95, 0xf7,
-    0x96, 0xf7, 0x97, 0xf7, 0x97, 0xf7, 0xb6, 0xf9, 0x58, 0xf, 0x62, 0x12, 0xd1, 0x10, 0x85, 0x11, 0x32, 0x11, 0x54, 0x11,
-    0x43, 0x11, 0x48, 0x11, 0x44, 0x11, 0x27, 0xf, 0x8e, 0xf9, 0x84, 0xf6, 0x13, 0xf8, 0x60, 0xf7, 0xb2, 0xf7, 0x8e, 0xf7,
-    0x9f, 0xf7, 0x98, 0xf7, 0x9c, 0xf7, 0x9c, 0xf7, 0x9d, 0xf7, 0x9e, 0xf7, 0x9e, 0xf7, 0x9f, 0xf7, 0xa0, 0xf7, 0xa1, 0xf7,
-    0xa1, 0xf7, 0xa2, 0xf7, 0xa3, 0xf7, 0xa3, 0xf7, 0xa4, 0xf7, 0xa5, 0xf7, 0xa6, 0xf7, 0xa6, 0xf7, 0x74, 0xf9, 0x99, 0xd,
-    0xc9, 0x12, 0x80, 0x10, 0x83, 0x11, 0xd, 0x11, 0x3f, 0x11, 0x27, 0x11, 0x2f, 0x11, 0x2a, 0x11, 0x10, 0xf, 0x9a, 0xf9,
-    0x95, 0xf6, 0x21, 0xf8, 0x70, 0xf7, 0xc0, 0xf7, 0x9d, 0xf7, 0xae, 0xf7, 0xa7, 0xf7, 0xab, 0xf7, 0xab, 0xf7, 0xac, 0xf7,
-    0xad, 0xf7, 0xad, 0xf7, 0xae, 0xf7, 0xaf, 0xf7, 0xb0, 0xf7, 0xb0, 0xf7, 0xb1, 0xf7, 0xb2, 0xf7, 0xb2, 0xf7, 0xb3, 0xf7,
-    0xb4, 0xf7, 0xb5, 0xf7, 0xb5, 0xf7, 0x19, 0xfa, 0xd0, 0x10, 0xa9, 0x11, 0xd6, 0x10, 0x37, 0x11, 0x9, 0x11, 0x1b, 0x11,
-    0x11, 0x11, 0x13, 0x11, 0x10, 0x11, 0x1b, 0xb, 0x2a, 0xf6, 0x1c, 0xf8, 0x8a, 0xf7, 0xc9, 0xf7, 0xae, 0xf7, 0xbb, 0xf7,
-    0xb7, 0xf7, 0xba, 0xf7, 0xb9, 0xf7, 0xba, 0xf7, 0xbb, 0xf7, 0xbc, 0xf7, 0xbc, 0xf7, 0xbd, 0xf7, 0xbe, 0xf7, 0xbf, 0xf7,
-    0xbf, 0xf7, 0xc0, 0xf7, 0xc1, 0xf7, 0xc2, 0xf7, 0xc2, 0xf7, 0xc3, 0xf7, 0xc4, 0xf7, 0xc4, 0xf7, 0x72, 0x2, 0xfa, 0x14,
-    0x55, 0xf, 0xbd, 0x11, 0xa9, 0x10, 0x22, 0x11, 0xea, 0x10, 0x0, 0x11, 0xf5, 0x10, 0x60, 0x10, 0xd9, 0x1, 0x33, 0xf4,
-    0x51, 0xf9, 0x13, 0xf7, 0x14, 0xf8, 0xa2, 0xf7, 0xd7, 0xf7, 0xc0, 0xf7, 0xcb, 0xf7, 0xc7, 0xf7, 0xca, 0xf7, 0xca, 0xf7,
-    0xcb, 0xf7, 0xcc, 0xf7, 0xcc, 0xf7, 0xcd, 0xf7, 0xce, 0xf7, 0xce, 0xf7, 0xcf, 0xf7, 0xd0, 0xf7, 0xd1, 0xf7, 0xd1, 0xf7,
-    0xd2, 0xf7, 0xd3, 0xf7, 0x5c, 0xfb, 0x38, 0x11, 0x23, 0x11, 0xc8, 0x10, 0xf3, 0x10, 0xdd, 0x10, 0xe5, 0x10, 0xde, 0x10,
-    0xe0, 0x10, 0xdc, 0x10, 0x9f, 0x8, 0x17, 0xf5, 0xd8, 0xf8, 0x5f, 0xf7, 0x7, 0xf8, 0xbd, 0xf7, 0xdf, 0xf7, 0xd1, 0xf7,
-    0xd8, 0xf7, 0xd6, 0xf7, 0xd8, 0xf7, 0xd9, 0xf7, 0xd9, 0xf7, 0xda, 0xf7, 0xdb, 0xf7, 0xdb, 0xf7, 0xdc, 0xf7, 0xdd, 0xf7,
-    0xde, 0xf7, 0xde, 0xf7, 0xdf, 0xf7, 0xe0, 0xf7, 0xe0, 0xf7, 0xe1, 0xf7, 0xef, 0xf9, 0xe7, 0xe, 0xd8, 0x11, 0x54, 0x10,
-    0x2, 0x11, 0xb1, 0x10, 0xd3, 0x10, 0xc2, 0x10, 0xc7, 0x10, 0xc3, 0x10, 0x94, 0x8, 0x2a, 0xf5, 0xe6, 0xf8, 0x6e, 0xf7,
-    0x15, 0xf8, 0xcc, 0xf7, 0xed, 0xf7, 0xe0, 0xf7, 0xe7, 0xf7, 0xe5, 0xf7, 0xe6, 0xf7, 0xe7, 0xf7, 0xe8, 0xf7, 0xe8, 0xf7,
-    0xe9, 0xf7, 0xea, 0xf7, 0xeb, 0xf7, 0xeb, 0xf7, 0xec, 0xf7, 0xed, 0xf7, 0xed, 0xf7, 0xee, 0xf7, 0xef, 0xf7, 0xf0, 0xf7,
-    0x44, 0xfa, 0x6b, 0x10, 0x3f, 0x11, 0x72, 0x10, 0xcf, 0x10, 0xa3, 0x10, 0xb5, 0x10, 0xaa, 0x10, 0xad, 0x10, 0xa9, 0x10,
-    0xa, 0x5, 0x73, 0xf3, 0xe2, 0xf9, 0x11, 0xf7, 0x54, 0xf8, 0xc5, 0xf7, 0x6, 0xf8, 0xea, 0xf7, 0xf7, 0xf7, 0xf3, 0xf7,
-    0xf6, 0xf7, 0xf5, 0xf7, 0xf6, 0xf7, 0xf7, 0xf7, 0xf8, 0xf7, 0xf8, 0xf7, 0xf9, 0xf7, 0xfa, 0xf7, 0xfb, 0xf7, 0xfb, 0xf7,
-    0xfc, 0xf7, 0xfd, 0xf7, 0xfd, 0xf7, 0xfe, 0xf7, 0x3f, 0x1, 0xe3, 0x13, 0x49, 0xf, 0x2f, 0x11, 0x55, 0x10, 0xb4, 0x10,
-    0x88, 0x10, 0x99, 0x10, 0x90, 0x10, 0x20, 0xf, 0xd, 0xfd, 0xfb, 0xf5, 0xe0, 0xf8, 0x99, 0xf7, 0x2c, 0xf8, 0xec, 0xf7,
-    0xa, 0xf8, 0xfd, 0xf7, 0x4, 0xf8, 0x2, 0xf8, 0x3, 0xf8, 0x4, 0xf8, 0x5, 0xf8, 0x5, 0xf8, 0x6, 0xf8, 0x7, 0xf8,
-    0x8, 0xf8, 0x8, 0xf8, 0x9, 0xf8, 0xa, 0xf8, 0xa, 0xf8, 0xb, 0xf8, 0xc, 0xf8, 0x10, 0xfa, 0xa3, 0xe, 0x88, 0x11,
-    0xa, 0x10, 0xb5, 0x10, 0x66, 0x10, 0x87, 0x10, 0x76, 0x10, 0x7c, 0x10, 0x77, 0x10, 0xfd, 0x4, 0x9d, 0xf3, 0xf8, 0xf9,
-    0x31, 0xf7, 0x6e, 0xf8, 0xe2, 0xf7, 0x22, 0xf8, 0x6, 0xf8, 0x14, 0xf8, 0xf, 0xf8, 0x12, 0xf8, 0x12, 0xf8, 0x13, 0xf8,
-    0x13, 0xf8, 0x14, 0xf8, 0x15, 0xf8, 0x15, 0xf8, 0x16, 0xf8, 0x17, 0xf8, 0x18, 0xf8, 0x18, 0xf8, 0x19, 0xf8, 0x1a, 0xf8,
-    0xf5, 0xf8, 0x40, 0x8, 0x5e, 0x13, 0x1e, 0xf, 0xfa, 0x10, 0x24, 0x10, 0x81, 0x10, 0x55, 0x10, 0x67, 0x10, 0x5d, 0x10,
-    0x88, 0x9, 0x9, 0xf6, 0xcb, 0xf8, 0xcd, 0xf7, 0x3d, 0xf8, 0xd, 0xf8, 0x23, 0xf8, 0x1a, 0xf8, 0x1f, 0xf8, 0x1e, 0xf8,
-    0x1f, 0xf8, 0x20, 0xf8, 0x21, 0xf8, 0x21, 0xf8, 0x22, 0xf8, 0x23, 0xf8, 0x23, 0xf8, 0x24, 0xf8, 0x25, 0xf8, 0x25, 0xf8,
-    0x26, 0xf8, 0x27, 0xf8, 0x28, 0xf8, 0x2, 0xf9, 0x35, 0x8, 0x41, 0x13, 0x6, 0xf, 0xe1, 0x10, 0xc, 0x10, 0x68, 0x10,
-    0x3d, 0x10, 0x4e, 0x10, 0x44, 0x10, 0x36, 0x7, 0xf1, 0xf4, 0x72, 0xf9, 0x96, 0xf7, 0x6a, 0xf8, 0xd, 0xf8, 0x37, 0xf8,
-    0x25, 0xf8, 0x2e, 0xf8, 0x2b, 0xf8, 0x2e, 0xf8, 0x2d, 0xf8, 0x2f, 0xf8, 0x2f, 0xf8, 0x30, 0xf8, 0x31, 0xf8, 0x31, 0xf8,
-    0x32, 0xf8, 0x33, 0xf8, 0x33, 0xf8, 0x34, 0xf8, 0x35, 0xf8, 0x36, 0xf8, 0xe7, 0xf9, 0xd4, 0xc, 0xb3, 0x11, 0x8e, 0xf,
-    0x81, 0x10, 0x12, 0x10, 0x41, 0x10, 0x2a, 0x10, 0x32, 0x10, 0xe5, 0xf, 0x5c, 0x3, 0x56, 0xf4, 0xe5, 0xf9, 0x76, 0xf7,
-    0x8c, 0xf8, 0x12, 0xf8, 0x49, 0xf8, 0x31, 0xf8, 0x3d, 0xf8, 0x39, 0xf8, 0x3c, 0xf8, 0x3b, 0xf8, 0x3d, 0xf8, 0x3d, 0xf8,
-    0x3e, 0xf8, 0x3f, 0xf8, 0x3f, 0xf8, 0x40, 0xf8, 0x41, 0xf8, 0x41, 0xf8, 0x42, 0xf8, 0x43, 0xf8, 0x43, 0xf8, 0x1e, 0x0,
-    0xb9, 0x12, 0x24, 0xf, 0x8c, 0x10, 0xeb, 0xf, 0x30, 0x10, 0xf, 0x10, 0x1c, 0x10, 0x14, 0x10, 0xba, 0xc, 0xf6, 0xf7,
-    0xb, 0xf8, 0x60, 0xf8, 0x37, 0xf8, 0x4b, 0xf8, 0x43, 0xf8, 0x47, 0xf8, 0x47, 0xf8, 0x48, 0xf8, 0x48, 0xf8, 0x49, 0xf8,
-    0x4a, 0xf8, 0x4b, 0xf8, 0x4b, 0xf8, 0x4c, 0xf8, 0x4d, 0xf8, 0x4d, 0xf8, 0x4e, 0xf8, 0x4f, 0xf8, 0x4f, 0xf8, 0x50, 0xf8,
-    0x51, 0xf8, 0x44, 0xfa, 0x37, 0xe, 0x5, 0x11, 0x93, 0xf, 0x37, 0x10, 0xec, 0xf, 0xb, 0x10, 0xfb, 0xf, 0x0, 0x10,
-    0xdf, 0xe, 0xba, 0xfe, 0xe9, 0xf5, 0x5f, 0xf9, 0xd9, 0xf7, 0x88, 0xf8, 0x3b, 0xf8, 0x5e, 0xf8, 0x50, 0xf8, 0x57, 0xf8,
-    0x55, 0xf8, 0x56, 0xf8, 0x57, 0xf8, 0x58, 0xf8, 0x59, 0xf8, 0x59, 0xf8, 0x5a, 0xf8, 0x5b, 0xf8, 0x5b, 0xf8, 0x5c, 0xf8,
-    0x5d, 0xf8, 0x5d, 0xf8, 0x5e, 0xf8, 0x7a, 0xf9, 0x8d, 0x9, 0x54, 0x12, 0xe1, 0xe, 0x64, 0x10, 0xb6, 0xf, 0x0, 0x10,
-    0xde, 0xf, 0xea, 0xf, 0x56, 0xf, 0xcb, 0x1, 0x9, 0xf5, 0xd2, 0xf9, 0xb9, 0xf7, 0xaa, 0xf8, 0x3f, 0xf8, 0x70, 0xf8,
-    0x5b, 0xf8, 0x66, 0xf8, 0x62, 0xf8, 0x65, 0xf8, 0x64, 0xf8, 0x65, 0xf8, 0x66, 0xf8, 0x67, 0xf8, 0x67, 0xf8, 0x68, 0xf8,
-    0x69, 0xf8, 0x69, 0xf8, 0x6a, 0xf8, 0x6b, 0xf8, 0x6c, 0xf8, 0x86, 0xf9, 0x7f, 0x9, 0x38, 0x12, 0xca, 0xe, 0x4b, 0x10,
-    0x9d, 0xf, 0xe9, 0xf, 0xc5, 0xf, 0xd3, 0xf, 0xf8, 0xe, 0x45, 0x0, 0x93, 0xf5, 0xaa, 0xf9, 0xde, 0xf7, 0xad, 0xf8,
-    0x51, 0xf8, 0x7c, 0xf8, 0x69, 0xf8, 0x73, 0xf8, 0x6f, 0xf8, 0x72, 0xf8, 0x72, 0xf8, 0x73, 0xf8, 0x73, 0xf8, 0x74, 0xf8,
-    0x75, 0xf8, 0x75, 0xf8, 0x76, 0xf8, 0x77, 0xf8, 0x78, 0xf8, 0x78, 0xf8, 0x79, 0xf8, 0xa9, 0xfa, 0x79, 0xf, 0x40, 0x10,
-    0x80, 0xf, 0xd7, 0xf, 0xae, 0xf, 0xbe, 0xf, 0xb5, 0xf, 0xb7, 0xf, 0x85, 0xd, 0xbf, 0xf8, 0xf7, 0xf7, 0xb7, 0xf8,
-    0x5e, 0xf8, 0x87, 0xf8, 0x76, 0xf8, 0x7e, 0xf8, 0x7c, 0xf8, 0x7d, 0xf8, 0x7e, 0xf8, 0x7f, 0xf8, 0x7f, 0xf8, 0x80, 0xf8,
-    0x81, 0xf8, 0x82, 0xf8, 0x82, 0xf8, 0x83, 0xf8, 0x84, 0xf8, 0x84, 0xf8, 0x85, 0xf8, 0x86, 0xf8, 0x86, 0xf8, 0x4f, 0x2,
-    0x4a, 0x13, 0x1f, 0xe, 0x52, 0x10, 0x56, 0xf, 0xc4, 0xf, 0x91, 0xf, 0xa6, 0xf, 0x9a, 0xf, 0xc5, 0x4, 0x54, 0xf4,
-    0x58, 0xfa, 0xb7, 0xf7, 0xe4, 0xf8, 0x5f, 0xf8, 0x9b, 0xf8, 0x82, 0xf8, 0x8e, 0xf8, 0x89, 0xf8, 0x8d, 0xf8, 0x8c, 0xf8,
-    0x8d, 0xf8, 0x8e, 0xf8, 0x8e, 0xf8, 0x8f, 0xf8, 0x90, 0xf8, 0x90, 0xf8, 0x91, 0xf8, 0x92, 0xf8, 0x92, 0xf8, 0x93, 0xf8,
-    0xd1, 0xfb, 0xd9, 0xf, 0xc5, 0xf, 0x72, 0xf, 0x98, 0xf, 0x85, 0xf, 0x8b, 0xf, 0x86, 0xf, 0x87, 0xf, 0x20, 0xa,
-    0x2f, 0xf7, 0xf0, 0xf8, 0x6d, 0xf8, 0xa5, 0xf8, 0x8d, 0xf8, 0x99, 0xf8, 0x95, 0xf8, 0x98, 0xf8, 0x97, 0xf8, 0x98, 0xf8,
-    0x99, 0xf8, 0x9a, 0xf8, 0x9a, 0xf8, 0x9b, 0xf8, 0x9c, 0xf8, 0x9d, 0xf8, 0x9d, 0xf8, 0x9e, 0xf8, 0x9f, 0xf8, 0x9f, 0xf8,
-    0xa0, 0xf8, 0x3d, 0xfa, 0x3e, 0xc, 0xe0, 0x10, 0xd5, 0xe, 0xbd, 0xf, 0x53, 0xf, 0x7f, 0xf, 0x6a, 0xf, 0x72, 0xf,
-    0x35, 0xc, 0x58, 0xf8, 0x69, 0xf8, 0xbc, 0xf8, 0x95, 0xf8, 0xa7, 0xf8, 0xa0, 0xf8, 0xa4, 0xf8, 0xa4, 0xf8, 0xa5, 0xf8,
-    0xa5, 0xf8, 0xa6, 0xf8, 0xa7, 0xf8, 0xa7, 0xf8, 0xa8, 0xf8, 0xa9, 0xf8, 0xa9, 0xf8, 0xaa, 0xf8, 0xab, 0xf8, 0xab, 0xf8,
-    0xac, 0xf8, 0xad, 0xf8, 0x46, 0xfa, 0x2b, 0xc, 0xc6, 0x10, 0xbf, 0xe, 0xa4, 0xf, 0x3c, 0xf, 0x68, 0xf, 0x53, 0xf,
-    0x59, 0xf, 0x12, 0xb, 0xd9, 0xf7, 0xbf, 0xf8, 0xa8, 0xf8, 0xb0, 0xf8, 0xae, 0xf8, 0xaf, 0xf8, 0xb0, 0xf8, 0xb1, 0xf8,
-    0xb1, 0xf8, 0xb2, 0xf8, 0xb3, 0xf8, 0xb3, 0xf8, 0xb4, 0xf8, 0xb5, 0xf8, 0xb6, 0xf8, 0xb6, 0xf8, 0xb7, 0xf8, 0xb8, 0xf8,
-    0xb8, 0xf8, 0xb9, 0xf8, 0xba, 0xf8, 0xe8, 0xfb, 0x91, 0xf, 0x7d, 0xf, 0x2c, 0xf, 0x52, 0xf, 0x3e, 0xf, 0x45, 0xf,
-    0x40, 0xf, 0x40, 0xf, 0xd6, 0x7, 0x45, 0xf6, 0xa7, 0xf9, 0x52, 0xf8, 0xe9, 0xf8, 0xa7, 0xf8, 0xc5, 0xf8, 0xb9, 0xf8,
-    0xbf, 0xf8, 0xbe, 0xf8, 0xbf, 0xf8, 0xc0, 0xf8, 0xc0, 0xf8, 0xc1, 0xf8, 0xc2, 0xf8, 0xc2, 0xf8, 0xc3, 0xf8, 0xc4, 0xf8,
-    0xc4, 0xf8, 0xc5, 0xf8, 0xc6, 0xf8, 0xc6, 0xf8, 0x42, 0x2, 0xb8, 0x12, 0xb5, 0xd, 0xd7, 0xf, 0xe2, 0xe, 0x4e, 0xf,
-    0x1b, 0xf, 0x30, 0xf, 0x17, 0xe, 0xd7, 0xfe, 0x80, 0xf6, 0xc6, 0xf9, 0x56, 0xf8, 0xfb, 0xf8, 0xb2, 0xf8, 0xd3, 0xf8,
-    0xc6, 0xf8, 0xcc, 0xf8, 0xcb, 0xf8, 0xcc, 0xf8, 0xcd, 0xf8, 0xcd, 0xf8, 0xce, 0xf8, 0xcf, 0xf8, 0xcf, 0xf8, 0xd0, 0xf8,
-    0xd1, 0xf8, 0xd1, 0xf8, 0xd2, 0xf8, 0xd3, 0xf8, 0xeb, 0xfa, 0xd7, 0xe, 0x96, 0xf, 0xde, 0xe, 0x31, 0xf, 0xa, 0xf,
-    0x19, 0xf, 0x10, 0xf, 0x12, 0xf, 0xb3, 0x6, 0xdc, 0xf5, 0x4, 0xfa, 0x4c, 0xf8, 0x10, 0xf9, 0xba, 0xf8, 0xe1, 0xf8,
-    0xd1, 0xf8, 0xd9, 0xf8, 0xd7, 0xf8, 0xd8, 0xf8, 0xd9, 0xf8, 0xda, 0xf8, 0xda, 0xf8, 0xdb, 0xf8, 0xdc, 0xf8, 0xdc, 0xf8,
-    0xdd, 0xf8, 0xde, 0xf8, 0xde, 0xf8, 0xdf, 0xf8, 0xea, 0xf9, 0x3, 0x9, 0x43, 0x11, 0x5, 0xe, 0x71, 0xf, 0xcd, 0xe,
-    0x13, 0xf, 0xf2, 0xe, 0xff, 0xe, 0xc5, 0x9, 0x88, 0xf7, 0x38, 0xf9, 0xba, 0xf8, 0xf1, 0xf8, 0xd9, 0xf8, 0xe5, 0xf8,
-    0xe1, 0xf8, 0xe4, 0xf8, 0xe3, 0xf8, 0xe4, 0xf8, 0xe5, 0xf8, 0xe6, 0xf8, 0xe6, 0xf8, 0xe7, 0xf8, 0xe8, 0xf8, 0xe9, 0xf8,
-    0xe9, 0xf8, 0xea, 0xf8, 0xeb, 0xf8, 0xeb, 0xf8, 0xb3, 0xf9, 0x89, 0x7, 0x99, 0x11, 0xc0, 0xd, 0x6f, 0xf, 0xac, 0xe,
-    0x1, 0xf, 0xd9, 0xe, 0xe9, 0xe, 0xb7, 0x9, 0x98, 0xf7, 0x44, 0xf9, 0xc7, 0xf8, 0xfd, 0xf8, 0xe7, 0xf8, 0xf1, 0xf8,
-    0xee, 0xf8, 0xf0, 0xf8, 0xf0, 0xf8, 0xf1, 0xf8, 0xf2, 0xf8, 0xf2, 0xf8, 0xf3, 0xf8, 0xf4, 0xf8, 0xf4, 0xf8, 0xf5, 0xf8,
-    0xf6, 0xf8, 0xf6, 0xf8, 0xf7, 0xf8, 0xf8, 0xf8, 0x41, 0xfa, 0x53, 0xa, 0x9e, 0x10, 0xa, 0xe, 0x2d, 0xf, 0xa9, 0xe,
-    0xe1, 0xe, 0xc6, 0xe, 0xd0, 0xe, 0x95, 0x6, 0x11, 0xf6, 0x22, 0xfa, 0x75, 0xf8, 0x34, 0xf9, 0xe0, 0xf8, 0x6, 0xf9,
-    0xf6, 0xf8, 0xfe, 0xf8, 0xfc, 0xf8, 0xfd, 0xf8, 0xfe, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0x0, 0xf9, 0x1, 0xf9, 0x1, 0xf9,
-    0x2, 0xf9, 0x3, 0xf9, 0x3, 0xf9, 0x4, 0xf9, 0x1a, 0xfd, 0x8a, 0xf, 0xac, 0xe, 0xc2, 0xe, 0xb9, 0xe, 0xbb, 0xe,
-    0xb8, 0xe, 0xb7, 0xe, 0xf2, 0xd, 0x4c, 0x0, 0x61, 0xf6, 0x2b, 0xfa, 0x82, 0xf8, 0x40, 0xf9, 0xec, 0xf8, 0x13, 0xf9,
-    0x2, 0xf9, 0xb, 0xf9, 0x8, 0xf9, 0xa, 0xf9, 0xa, 0xf9, 0xb, 0xf9, 0xc, 0xf9, 0xc, 0xf9, 0xd, 0xf9, 0xe, 0xf9,
-    0xe, 0xf9, 0xf, 0xf9, 0x10, 0xf9, 0x51, 0xf9, 0x9d, 0x4, 0x25, 0x12, 0x23, 0xd, 0x53, 0xf, 0x57, 0xe, 0xc5, 0xe,
-    0x92, 0xe, 0xa7, 0xe, 0x8a, 0x9, 0xc3, 0xf7, 0x67, 0xf9, 0xec, 0xf8, 0x21, 0xf9, 0xb, 0xf9, 0x16, 0xf9, 0x12, 0xf9,
-    0x15, 0xf9, 0x14, 0xf9, 0x15, 0xf9, 0x16, 0xf9, 0x17, 0xf9, 0x17, 0xf9, 0x18, 0xf9, 0x19, 0xf9, 0x19, 0xf9, 0x1a, 0xf9,
-    0x1b, 0xf9, 0x1b, 0xf9, 0x1c, 0xf9, 0x27, 0xfe, 0xdf, 0xf, 0x3a, 0xe, 0xb4, 0xe, 0x7e, 0xe, 0x94, 0xe, 0x88, 0xe,
-    0x8c, 0xe, 0x5, 0xd, 0x24, 0xfc, 0xc9, 0xf7, 0xb4, 0xf9, 0xda, 0xf8, 0x3c, 0xf9, 0x11, 0xf9, 0x25, 0xf9, 0x1d, 0xf9,
-    0x22, 0xf9, 0x21, 0xf9, 0x22, 0xf9, 0x23, 0xf9, 0x23, 0xf9, 0x24, 0xf9, 0x25, 0xf9, 0x25, 0xf9, 0x26, 0xf9, 0x27, 0xf9,
-    0x27, 0xf9, 0x28, 0xf9, 0x29, 0xfb, 0x3b, 0xe, 0xf2, 0xe, 0x41, 0xe, 0x91, 0xe, 0x6c, 0xe, 0x7a, 0xe, 0x72, 0xe,
-    0x73, 0xd, 0xec, 0xfe, 0xfe, 0xf6, 0x1c, 0xfa, 0xbc, 0xf8, 0x5a, 0xf9, 0x15, 0xf9, 0x34, 0xf9, 0x28, 0xf9, 0x2e, 0xf9,
-    0x2c, 0xf9, 0x2e, 0xf9, 0x2e, 0xf9, 0x2f, 0xf9, 0x30, 0xf9, 0x30, 0xf9, 0x31, 0xf9, 0x32, 0xf9, 0x32, 0xf9, 0x33, 0xf9,
-    0x34, 0xf9, 0x32, 0xfb, 0x26, 0xe, 0xdb, 0xe, 0x2c, 0xe, 0x7b, 0xe, 0x55, 0xe, 0x64, 0xe, 0x5c, 0xe, 0x5f, 0xd,
-    0xef, 0xfe, 0xe, 0xf7, 0x25, 0xfa, 0xc9, 0xf8, 0x66, 0xf9, 0x21, 0xf9, 0x40, 0xf9, 0x34, 0xf9, 0x3a, 0xf9, 0x38, 0xf9,
-    0x3a, 0xf9, 0x3a, 0xf9, 0x3b, 0xf9, 0x3c, 0xf9, 0x3c, 0xf9, 0x3d, 0xf9, 0x3e, 0xf9, 0x3e, 0xf9, 0x3f, 0xf9, 0x40, 0xf9,
-    0x35, 0xfd, 0x14, 0xf, 0x3c, 0xe, 0x53, 0xe, 0x4a, 0xe, 0x4b, 0xe, 0x48, 0xe, 0x48, 0xe, 0x46, 0xe, 0x45, 0xe,
-    0x43, 0xe, 0x42, 0xe, 0x5b, 0x6, 0x73, 0xf6, 0x5f, 0xfa, 0xc0, 0xf8, 0x79, 0xf9, 0x28, 0xf9, 0x4d, 0xf9, 0x3d, 0xf9,
-    0x45, 0xf9, 0x43, 0xf9, 0x44, 0xf9, 0x45, 0xf9, 0x46, 0xf9, 0x46, 0xf9, 0x47, 0xf9, 0x48, 0xf9, 0x48, 0xf9, 0x49, 0xf9,
-    0x4a, 0xf9, 0x4a, 0xf9, 0x4b, 0xf9, 0x4c, 0xf9, 0x4c, 0xf9, 0x4d, 0xf9, 0x4e, 0xf9, 0x4e, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9,
-    0x50, 0xf9, 0xc9, 0xfa, 0x3c, 0xb, 0x79, 0xf, 0x9b, 0xd, 0x6f, 0xe, 0xd, 0xe, 0x37, 0xe, 0x22, 0xe, 0x2a, 0xe,
-    0x24, 0xe, 0x25, 0xe, 0x22, 0xe, 0x43, 0x8, 0x8b, 0xf7, 0xe8, 0xf9, 0xe, 0xf9, 0x6f, 0xf9, 0x45, 0xf9, 0x58, 0xf9,
-    0x51, 0xf9, 0x55, 0xf9, 0x54, 0xf9, 0x55, 0xf9, 0x56, 0xf9, 0x56, 0xf9, 0x57, 0xf9, 0x58, 0xf9, 0x58, 0xf9, 0x59, 0xf9,
-    0x5a, 0xf9, 0x5a, 0xf9, 0x5b, 0xf9, 0x5c, 0xf9, 0x5c, 0xf9, 0x5d, 0xf9, 0x5e, 0xf9, 0x5e, 0xf9, 0x5f, 0xf9, 0x60, 0xf9,
-    0x60, 0xf9, 0x61, 0xf9, 0x14, 0xfb, 0x7b, 0xc, 0xed, 0xe, 0xaa, 0xd, 0x3a, 0xe, 0xf7, 0xd, 0x13, 0xe, 0x5, 0xe,
-    0x9, 0xe, 0x5, 0xe, 0x5, 0xe, 0x3, 0xe, 0x41, 0x6, 0xa1, 0xf6, 0x7c, 0xfa, 0xe4, 0xf8, 0x99, 0xf9, 0x4a, 0xf9,
-    0x6e, 0xf9, 0x5f, 0xf9, 0x67, 0xf9, 0x64, 0xf9, 0x66, 0xf9, 0x67, 0xf9, 0x67, 0xf9, 0x68, 0xf9, 0x69, 0xf9, 0x69, 0xf9,
-    0x6a, 0xf9, 0x6a, 0xf9, 0x6b, 0xf9, 0x6c, 0xf9, 0x6c, 0xf9, 0x6d, 0xf9, 0x6e, 0xf9, 0x6e, 0xf9, 0x6f, 0xf9, 0x70, 0xf9,
-    0x70, 0xf9, 0x71, 0xf9, 0x72, 0xf9, 0x26, 0x1, 0xab, 0x10, 0xd7, 0xc, 0x6b, 0xe, 0xb5, 0xd, 0x5, 0xe, 0xdf, 0xd,
-    0xee, 0xd, 0xe6, 0xd, 0xe7, 0xd, 0xe5, 0xd, 0x73, 0xc, 0x55, 0xfc, 0x2d, 0xf8, 0x1, 0xfa, 0x32, 0xf9, 0x90, 0xf9,
-    0x66, 0xf9, 0x7a, 0xf9, 0x72, 0xf9, 0x76, 0xf9, 0x76, 0xf9, 0x77, 0xf9, 0x77, 0xf9, 0x78, 0xf9, 0x79, 0xf9, 0x79, 0xf9,
-    0x7a, 0xf9, 0x7b, 0xf9, 0x7b, 0xf9, 0x7c, 0xf9, 0x7c, 0xf9, 0x7d, 0xf9, 0x7e, 0xf9, 0x7e, 0xf9, 0x7f, 0xf9, 0x80, 0xf9,
-    0x80, 0xf9, 0x81, 0xf9, 0x82, 0xf9, 0x53, 0xfd, 0x90, 0xe, 0xc0, 0xd, 0xd6, 0xd, 0xcd, 0xd, 0xce, 0xd, 0xcb, 0xd,
-    0xcb, 0xd, 0xc9, 0xd, 0xc8, 0xd, 0xc6, 0xd, 0xd2, 0xc, 0xfe, 0xfe, 0x72, 0xf7, 0x69, 0xfa, 0x1b, 0xf9, 0xb1, 0xf9,
-    0x6f, 0xf9, 0x8d, 0xf9, 0x81, 0xf9, 0x87, 0xf9, 0x86, 0xf9, 0x87, 0xf9, 0x88, 0xf9, 0x88, 0xf9, 0x89, 0xf9, 0x89, 0xf9,
-    0x8a, 0xf9, 0x8b, 0xf9, 0x8b, 0xf9, 0x8c, 0xf9, 0x8d, 0xf9, 0x8d, 0xf9, 0x8e, 0xf9, 0x8f, 0xf9, 0x8f, 0xf9, 0x90, 0xf9,
-    0x90, 0xf9, 0x91, 0xf9, 0x92, 0xf9, 0x4d, 0xfe, 0xec, 0xe, 0x60, 0xd, 0xd4, 0xd, 0xa1, 0xd, 0xb5, 0xd, 0xaa, 0xd,
-    0xad, 0xd, 0xaa, 0xd, 0xa9, 0xd, 0xa8, 0xd, 0x3c, 0xc, 0x68, 0xfc, 0x54, 0xf8, 0x20, 0xfa, 0x53, 0xf9, 0xb0, 0xf9,
-    0x87, 0xf9, 0x9a, 0xf9, 0x93, 0xf9, 0x97, 0xf9, 0x96, 0xf9, 0x97, 0xf9, 0x98, 0xf9, 0x98, 0xf9, 0x99, 0xf9, 0x9a, 0xf9,
-    0x9a, 0xf9, 0x9b, 0xf9, 0x9c, 0xf9, 0x9c, 0xf9, 0x9d, 0xf9, 0x9d, 0xf9, 0x9e, 0xf9, 0x9f, 0xf9, 0x9f, 0xf9, 0xa0, 0xf9,
-    0xa1, 0xf9, 0xa1, 0xf9, 0xde, 0xf9, 0x4d, 0x4, 0xcd, 0x10, 0x2d, 0xc, 0x32, 0xe, 0x4a, 0xd, 0xaf, 0xd, 0x80, 0xd,
-    0x93, 0xd, 0x89, 0xd, 0x8b, 0xd, 0x88, 0xd, 0xd, 0x6, 0xfb, 0xf6, 0xb3, 0xfa, 0x2a, 0xf9, 0xd8, 0xf9, 0x8c, 0xf9,
-    0xaf, 0xf9, 0xa0, 0xf9, 0xa8, 0xf9, 0xa5, 0xf9, 0xa7, 0xf9, 0xa7, 0xf9, 0xa8, 0xf9, 0xa9, 0xf9, 0xa9, 0xf9, 0xaa, 0xf9,
-    0xab, 0xf9, 0xab, 0xf9, 0xac, 0xf9, 0xac, 0xf9, 0xad, 0xf9, 0xae, 0xf9, 0xae, 0xf9, 0xaf, 0xf9, 0xb0, 0xf9, 0xb0, 0xf9,
-    0xb1, 0xf9, 0xb2, 0xf9, 0x45, 0xff, 0x23, 0xf, 0xe6, 0xc, 0xb2, 0xd, 0x58, 0xd, 0x7d, 0xd, 0x6b, 0xd, 0x71, 0xd,
-    0x6c, 0xd, 0x6d, 0xd, 0x6a, 0xd, 0xb5, 0x9, 0xf9, 0xf8, 0xc2, 0xf9, 0xad, 0xf9, 0xb5, 0xf9, 0xb2, 0xf9, 0xb4, 0xf9,
-    0xb5, 0xf9, 0xb5, 0xf9, 0xb6, 0xf9, 0xb6, 0xf9, 0xb7, 0xf9, 0xb8, 0xf9, 0xb8, 0xf9, 0xb9, 0xf9, 0xba, 0xf9, 0xba, 0xf9,
-    0xbb, 0xf9, 0xbc, 0xf9, 0xbc, 0xf9, 0xbd, 0xf9, 0xbd, 0xf9, 0xbe, 0xf9, 0xbf, 0xf9, 0xbf, 0xf9, 0xc0, 0xf9, 0xc1, 0xf9,
-    0xc1, 0xf9, 0x47, 0xff, 0x2, 0xf, 0xc8, 0xc, 0x94, 0xd, 0x3a, 0xd, 0x5f, 0xd, 0x4d, 0xd, 0x53, 0xd, 0x4e, 0xd,
-    0x4f, 0xd, 0x4c, 0xd, 0xb5, 0x8, 0x91, 0xf8, 0x11, 0xfa, 0xa1, 0xf9, 0xd1, 0xf9, 0xbc, 0xf9, 0xc7, 0xf9, 0xc3, 0xf9,
-    0xc5, 0xf9, 0xc6, 0xf9, 0xc6, 0xf9, 0xc7, 0xf9, 0xc7, 0xf9, 0xc8, 0xf9, 0xc9, 0xf9, 0xc9, 0xf9, 0xca, 0xf9, 0xcb, 0xf9,
-    0xcb, 0xf9, 0xcc, 0xf9, 0xcc, 0xf9, 0xcd, 0xf9, 0xce, 0xf9, 0xce, 0xf9, 0xcf, 0xf9, 0xd0, 0xf9, 0xd0, 0xf9, 0xc, 0xfa,
-    0x32, 0x4, 0x5d, 0x10, 0xdc, 0xb, 0xd3, 0xd, 0xf1, 0xc, 0x54, 0xd, 0x26, 0xd, 0x38, 0xd, 0x2f, 0xd, 0x31, 0xd,
-    0xb9, 0xc, 0x92, 0x1, 0x13, 0xf7, 0x3, 0xfb, 0x49, 0xf9, 0xf, 0xfa, 0xb8, 0xf9, 0xe0, 0xf9, 0xce, 0xf9, 0xd7, 0xf9,
-    0xd4, 0xf9, 0xd6, 0xf9, 0xd7, 0xf9, 0xd7, 0xf9, 0xd8, 0xf9, 0xd9, 0xf9, 0xd9, 0xf9, 0xda, 0xf9, 0xda, 0xf9, 0xdb, 0xf9,
-    0xdc, 0xf9, 0xdc, 0xf9, 0xdd, 0xf9, 0xde, 0xf9, 0xde, 0xf9, 0xdf, 0xf9, 0xdf, 0xf9, 0xe0, 0xf9, 0x7e, 0xfd, 0xd1, 0xd,
-    0xc, 0xd, 0x1f, 0xd, 0x18, 0xd, 0x19, 0xd, 0x16, 0xd, 0x16, 0xd, 0x14, 0xd, 0x13, 0xd, 0x11, 0xd, 0xa8, 0x7,
-    0x3f, 0xf8, 0x6c, 0xfa, 0xa4, 0xf9, 0xfc, 0xf9, 0xd6, 0xf9, 0xe8, 0xf9, 0xe1, 0xf9, 0xe5, 0xf9, 0xe4, 0xf9, 0xe5, 0xf9,
-    0xe6, 0xf9, 0xe6, 0xf9, 0xe7, 0xf9, 0xe8, 0xf9, 0xe8, 0xf9, 0xe9, 0xf9, 0xea, 0xf9, 0xea, 0xf9, 0xeb, 0xf9, 0xeb, 0xf9,
-    0xec, 0xf9, 0xed, 0xf9, 0xed, 0xf9, 0xee, 0xf9, 0xef, 0xf9, 0xef, 0xf9, 0xbb, 0xfb, 0xc6, 0xc, 0x69, 0xd, 0xcb, 0xc,
-    0x13, 0xd, 0xf1, 0xc, 0xfe, 0xc, 0xf6, 0xc, 0xf8, 0xc, 0xf5, 0xc, 0xf4, 0xc, 0x7b, 0x8, 0xc8, 0xf8, 0x3d, 0xfa,
-    0xcf, 0xf9, 0xff, 0xf9, 0xeb, 0xf9, 0xf5, 0xf9, 0xf1, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf4, 0xf9, 0xf5, 0xf9, 0xf6, 0xf9,
-    0xf6, 0xf9, 0xf7, 0xf9, 0xf8, 0xf9, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xf9, 0xfb, 0xf9, 0xfb, 0xf9, 0xfc, 0xf9,
-    0xfd, 0xf9, 0xfd, 0xf9, 0xfe, 0xf9, 0xfe, 0xf9, 0x6f, 0xfe, 0x7, 0xe, 0x94, 0xc, 0x0, 0xd, 0xd1, 0xc, 0xe3, 0xc,
-    0xda, 0xc, 0xdc, 0xc, 0xd9, 0xc, 0xd8, 0xc, 0xd7, 0xc, 0xfb, 0x3, 0x93, 0xf6, 0x7a, 0xfb, 0x56, 0xf9, 0x4b, 0xfa,
-    0xdf, 0xf9, 0x10, 0xfa, 0xfb, 0xf9, 0x6, 0xfa, 0x1, 0xfa, 0x5, 0xfa, 0x4, 0xfa, 0x5, 0xfa, 0x6, 0xfa, 0x6, 0xfa,
-    0x7, 0xfa, 0x7, 0xfa, 0x8, 0xfa, 0x9, 0xfa, 0x9, 0xfa, 0xa, 0xfa, 0xb, 0xfa, 0xb, 0xfa, 0xc, 0xfa, 0xc, 0xfa,
-    0xd, 0xfa, 0x7e, 0xfa, 0x46, 0x5, 0x6a, 0xf, 0x9d, 0xb, 0x46, 0xd, 0x86, 0xc, 0xda, 0xc, 0xb3, 0xc, 0xc2, 0xc,
-    0xba, 0xc, 0xbb, 0xc, 0xf8, 0xa, 0x45, 0xfa, 0xa5, 0xf9, 0x3f, 0xfa, 0xf9, 0xf9, 0x19, 0xfa, 0xc, 0xfa, 0x12, 0xfa,
-    0x11, 0xfa, 0x12, 0xfa, 0x12, 0xfa, 0x13, 0xfa, 0x14, 0xfa, 0x14, 0xfa, 0x15, 0xfa, 0x16, 0xfa, 0x16, 0xfa, 0x17, 0xfa,
-    0x17, 0xfa, 0x18, 0xfa, 0x19, 0xfa, 0x19, 0xfa, 0x1a, 0xfa, 0x1b, 0xfa, 0x1b, 0xfa, 0x1c, 0xfa, 0x1c, 0xfa, 0x15, 0x1,
-    0x20, 0xf, 0xa9, 0xb, 0x16, 0xd, 0x73, 0xc, 0xb9, 0xc, 0x98, 0xc, 0xa5, 0xc, 0x9d, 0xc, 0x9f, 0xc, 0x85, 0xb,
-    0xec, 0xfd, 0x9a, 0xf8, 0xc8, 0xfa, 0xd1, 0xf9, 0x40, 0xfa, 0xf, 0xfa, 0x26, 0xfa, 0x1d, 0xfa, 0x22, 0xfa, 0x21, 0xfa,
-    0x22, 0xfa, 0x22, 0xfa, 0x23, 0xfa, 0x24, 0xfa, 0x24, 0xfa, 0x25, 0xfa, 0x26, 0xfa, 0x26, 0xfa, 0x27, 0xfa, 0x27, 0xfa,
-    0x28, 0xfa, 0x29, 0xfa, 0x29, 0xfa, 0x2a, 0xfa, 0x2a, 0xfa, 0x2b, 0xfa, 0x14, 0x1, 0xfe, 0xe, 0x8e, 0xb, 0xf9, 0xc,
-    0x56, 0xc, 0x9d, 0xc, 0x7b, 0xc, 0x88, 0xc, 0x80, 0xc, 0x82, 0xc, 0xfe, 0xa, 0x93, 0xfb, 0x67, 0xf9, 0x85, 0xfa,
-    0x4, 0xfa, 0x3f, 0xfa, 0x26, 0xfa, 0x32, 0xfa, 0x2d, 0xfa, 0x30, 0xfa, 0x30, 0xfa, 0x31, 0xfa, 0x31, 0xfa, 0x32, 0xfa,
-    0x32, 0xfa, 0x33, 0xfa, 0x34, 0xfa, 0x34, 0xfa, 0x35, 0xfa, 0x36, 0xfa, 0x36, 0xfa, 0x37, 0xfa, 0x37, 0xfa, 0x38, 0xfa,
-    0x39, 0xfa, 0x39, 0xfa, 0xa7, 0xfa, 0x25, 0x5, 0x2, 0xf, 0x4e, 0xb, 0xec, 0xc, 0x32, 0xc, 0x83, 0xc, 0x5d, 0xc,
-    0x6c, 0xc, 0x64, 0xc, 0x65, 0xc, 0x44, 0x7, 0xaf, 0xf8, 0xbe, 0xfa, 0x1, 0xfa, 0x54, 0xfa, 0x31, 0xfa, 0x41, 0xfa,
-    0x3b, 0xfa, 0x3f, 0xfa, 0x3e, 0xfa, 0x3f, 0xfa, 0x3f, 0xfa, 0x40, 0xfa, 0x41, 0xfa, 0x41, 0xfa, 0x42, 0xfa, 0x42, 0xfa,
-    0x43, 0xfa, 0x44, 0xfa, 0x44, 0xfa, 0x45, 0xfa, 0x46, 0xfa, 0x46, 0xfa, 0x47, 0xfa, 0x47, 0xfa, 0x48, 0xfa, 0xad, 0xfd,
-    0xfc, 0xc, 0x43, 0xc, 0x55, 0xc, 0x4d, 0xc, 0x4f, 0xc, 0x4c, 0xc, 0x4c, 0xc, 0x4a, 0xc, 0x49, 0xc, 0x38, 0xb,
-    0xfd, 0xfd, 0xd1, 0xf8, 0xee, 0xfa, 0xff, 0xf9, 0x6b, 0xfa, 0x3c, 0xfa, 0x52, 0xfa, 0x49, 0xfa, 0x4d, 0xfa, 0x4d, 0xfa,
-    0x4e, 0xfa, 0x4e, 0xfa, 0x4f, 0xfa, 0x4f, 0xfa, 0x50, 0xfa, 0x51, 0xfa, 0x51, 0xfa, 0x52, 0xfa, 0x52, 0xfa, 0x53, 0xfa,
-    0x54, 0xfa, 0x54, 0xfa, 0x55, 0xfa, 0x56, 0xfa, 0x56, 0xfa, 0xcf, 0xfb, 0xd8, 0xa, 0xf5, 0xc, 0xdf, 0xb, 0x5a, 0xc,
-    0x21, 0xc, 0x39, 0xc, 0x2c, 0xc, 0x30, 0xc, 0x2c, 0xc, 0x8b, 0xb, 0x52, 0x0, 0x2c, 0xf8, 0x49, 0xfb, 0xeb, 0xf9,
-    0x89, 0xfa, 0x43, 0xfa, 0x63, 0xfa, 0x56, 0xfa, 0x5c, 0xfa, 0x5b, 0xfa, 0x5c, 0xfa, 0x5c, 0xfa, 0x5d, 0xfa, 0x5e, 0xfa,
-    0x5e, 0xfa, 0x5f, 0xfa, 0x5f, 0xfa, 0x60, 0xfa, 0x61, 0xfa, 0x61, 0xfa, 0x62, 0xfa, 0x62, 0xfa, 0x63, 0xfa, 0x64, 0xfa,
-    0x64, 0xfa, 0xf, 0xfc, 0xe5, 0xb, 0x7d, 0xc, 0xea, 0xb, 0x2c, 0xc, 0xd, 0xc, 0x19, 0xc, 0x11, 0xc, 0x13, 0xc,
-    0x11, 0xc, 0x5, 0xb, 0x9, 0xfe, 0xf3, 0xf8, 0x8, 0xfb, 0x1d, 0xfa, 0x87, 0xfa, 0x58, 0xfa, 0x6e, 0xfa, 0x65, 0xfa,
-    0x6a, 0xfa, 0x69, 0xfa, 0x6a, 0xfa, 0x6b, 0xfa, 0x6b, 0xfa, 0x6c, 0xfa, 0x6d, 0xfa, 0x6d, 0xfa, 0x6e, 0xfa, 0x6e, 0xfa,
-    0x6f, 0xfa, 0x70, 0xfa, 0x70, 0xfa, 0x71, 0xfa, 0x71, 0xfa, 0x72, 0xfa, 0x73, 0xfa, 0x38, 0x0, 0xe8, 0xd, 0x45, 0xb,
-    0x4e, 0xc, 0xd7, 0xb, 0xa, 0xc, 0xf1, 0xb, 0xfa, 0xb, 0xf5, 0xb, 0xf5, 0xb, 0xd6, 0x7, 0x63, 0xf9, 0xba, 0xfa,
-    0x55, 0xfa, 0x81, 0xfa, 0x6f, 0xfa, 0x78, 0xfa, 0x75, 0xfa, 0x77, 0xfa, 0x77, 0xfa, 0x78, 0xfa, 0x78, 0xfa, 0x79, 0xfa,
-    0x7a, 0xfa, 0x7a, 0xfa, 0x7b, 0xfa, 0x7b, 0xfa, 0x7c, 0xfa, 0x7d, 0xfa, 0x7d, 0xfa, 0x7e, 0xfa, 0x7e, 0xfa, 0x7f, 0xfa,
-    0x80, 0xfa, 0x80, 0xfa, 0xba, 0xfb, 0x6e, 0x9, 0xf5, 0xc, 0x67, 0xb, 0x16, 0xc, 0xc7, 0xb, 0xe8, 0xb, 0xd7, 0xb,
-    0xdd, 0xb, 0xd8, 0xb, 0xa0, 0xa, 0xf4, 0xfc, 0x6f, 0xf9, 0xfb, 0xfa, 0x4c, 0xfa, 0x9b, 0xfa, 0x78, 0xfa, 0x89, 0xfa,
-    0x82, 0xfa, 0x86, 0xfa, 0x85, 0xfa, 0x86, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0x88, 0xfa, 0x89, 0xfa, 0x89, 0xfa, 0x8a, 0xfa,
-    0x8a, 0xfa, 0x8b, 0xfa, 0x8b, 0xfa, 0x8c, 0xfa, 0x8d, 0xfa, 0x8d, 0xfa, 0x8e, 0xfa, 0x29, 0xfb, 0xff, 0x5, 0xdf, 0xd,
-    0xdc, 0xa, 0x2d, 0xc, 0x95, 0xb, 0xd7, 0xb, 0xb8, 0xb, 0xc3, 0xb, 0xbd, 0xb, 0xef, 0xa, 0x35, 0xff, 0xd0, 0xf8,
-    0x53, 0xfb, 0x38, 0xfa, 0xb7, 0xfa, 0x80, 0xfa, 0x99, 0xfa, 0x8e, 0xfa, 0x94, 0xfa, 0x92, 0xfa, 0x94, 0xfa, 0x94, 0xfa,
-    0x95, 0xfa, 0x96, 0xfa, 0x96, 0xfa, 0x97, 0xfa, 0x97, 0xfa, 0x98, 0xfa, 0x99, 0xfa, 0x99, 0xfa, 0x9a, 0xfa, 0x9a, 0xfa,
-    0x9b, 0xfa, 0x9c, 0xfa, 0x69, 0xfb, 0xd, 0x7, 0x68, 0xd, 0xe8, 0xa, 0x1, 0xc, 0x81, 0xb, 0xb8, 0xb, 0x9e, 0xb,
-    0xa7, 0xb, 0xa2, 0xb, 0x6f, 0xa, 0x4, 0xfd, 0x8f, 0xf9, 0x15, 0xfb, 0x68, 0xfa, 0xb6, 0xfa, 0x94, 0xfa, 0xa4, 0xfa,
-    0x9e, 0xfa, 0xa2, 0xfa, 0xa0, 0xfa, 0xa2, 0xfa, 0xa2, 0xfa, 0xa3, 0xfa, 0xa3, 0xfa, 0xa4, 0xfa, 0xa5, 0xfa, 0xa5, 0xfa,
-    0xa6, 0xfa, 0xa6, 0xfa, 0xa7, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa9, 0xfa, 0xa9, 0xfa, 0xc, 0xfd, 0xc7, 0xb, 0xb9, 0xb,
-    0x7b, 0xb, 0x97, 0xb, 0x88, 0xb, 0x8d, 0xb, 0x89, 0xb, 0x89, 0xb, 0x87, 0xb, 0xc6, 0x6, 0x3c, 0xf9, 0x25, 0xfb,
-    0x75, 0xfa, 0xc3, 0xfa, 0xa1, 0xfa, 0xb2, 0xfa, 0xaa, 0xfa, 0xaf, 0xfa, 0xad, 0xfa, 0xaf, 0xfa, 0xb0, 0xfa, 0xb0, 0xfa,
-    0xb1, 0xfa, 0xb1, 0xfa, 0xb2, 0xfa, 0xb2, 0xfa, 0xb3, 0xfa, 0xb4, 0xfa, 0xb4, 0xfa, 0xb5, 0xfa, 0xb5, 0xfa, 0xb6, 0xfa,
-    0xb7, 0xfa, 0xe9, 0xfa, 0xac, 0x3, 0x2a, 0xe, 0x48, 0xa, 0xfa, 0xb, 0x36, 0xb, 0x8c, 0xb, 0x64, 0xb, 0x74, 0xb,
-    0x6b, 0xb, 0x72, 0xa, 0x28, 0xfe, 0x5a, 0xf9, 0x52, 0xfb, 0x74, 0xfa, 0xd8, 0xfa, 0xac, 0xfa, 0xc0, 0xfa, 0xb8, 0xfa,
-    0xbd, 0xfa, 0xbb, 0xfa, 0xbd, 0xfa, 0xbd, 0xfa, 0xbe, 0xfa, 0xbf, 0xfa, 0xbf, 0xfa, 0xc0, 0xfa, 0xc0, 0xfa, 0xc1, 0xfa,
-    0xc1, 0xfa, 0xc2, 0xfa, 0xc3, 0xfa, 0xc3, 0xfa, 0xc4, 0xfa, 0xc4, 0xfa, 0x3a, 0x0, 0x2a, 0xd, 0xac, 0xa, 0xa6, 0xb,
-    0x36, 0xb, 0x65, 0xb, 0x4f, 0xb, 0x57, 0xb, 0x52, 0xb, 0xee, 0xa, 0x65, 0x1, 0x6d, 0xf8, 0xca, 0xfb, 0x52, 0xfa,
-    0xfa, 0xfa, 0xb0, 0xfa, 0xd2, 0xfa, 0xc3, 0xfa, 0xcb, 0xfa, 0xc9, 0xfa, 0xca, 0xfa, 0xcb, 0xfa, 0xcb, 0xfa, 0xcc, 0xfa,
-    0xcc, 0xfa, 0xcd, 0xfa, 0xce, 0xfa, 0xce, 0xfa, 0xcf, 0xfa, 0xcf, 0xfa, 0xd0, 0xfa, 0xd1, 0xfa, 0xd1, 0xfa, 0xd2, 0xfa,
-    0x3a, 0x0, 0xc, 0xd, 0x93, 0xa, 0x8a, 0xb, 0x1b, 0xb, 0x4b, 0xb, 0x34, 0xb, 0x3c, 0xb, 0x37, 0xb, 0xa4, 0xa,
-    0x52, 0x0, 0xd4, 0xf8, 0xb1, 0xfb, 0x70, 0xfa, 0x0, 0xfb, 0xc1, 0xfa, 0xde, 0xfa, 0xd2, 0xfa, 0xd8, 0xfa, 0xd6, 0xfa,
-    0xd7, 0xfa, 0xd8, 0xfa, 0xd9, 0xfa, 0xd9, 0xfa, 0xda, 0xfa, 0xda, 0xfa, 0xdb, 0xfa, 0xdc, 0xfa, 0xdc, 0xfa, 0xdd, 0xfa,
-    0xdd, 0xfa, 0xde, 0xfa, 0xde, 0xfa, 0xdf, 0xfa, 0x86, 0x2, 0x1a, 0xe, 0xdd, 0x9, 0xb6, 0xb, 0xe1, 0xa, 0x3f, 0xb,
-    0x13, 0xb, 0x25, 0xb, 0x1b, 0xb, 0xc8, 0x9, 0x1d, 0xfc, 0x32, 0xfa, 0x2e, 0xfb, 0xbd, 0xfa, 0xf1, 0xfa, 0xdb, 0xfa,
-    0xe5, 0xfa, 0xe2, 0xfa, 0xe4, 0xfa, 0xe4, 0xfa, 0xe5, 0xfa, 0xe5, 0xfa, 0xe6, 0xfa, 0xe7, 0xfa, 0xe7, 0xfa, 0xe8, 0xfa,
-    0xe8, 0xfa, 0xe9, 0xfa, 0xe9, 0xfa, 0xea, 0xfa, 0xeb, 0xfa, 0xeb, 0xfa, 0xec, 0xfa, 0x3f, 0xfc, 0xd1, 0x9, 0xb7, 0xb,
-    0xbc, 0xa, 0x2c, 0xb, 0xf8, 0xa, 0xd, 0xb, 0x2, 0xb, 0x5, 0xb, 0x3, 0xb, 0x34, 0x4, 0x65, 0xf8, 0xfd, 0xfb,
-    0x75, 0xfa, 0x23, 0xfb, 0xd7, 0xfa, 0xfa, 0xfa, 0xeb, 0xfa, 0xf2, 0xfa, 0xf0, 0xfa, 0xf2, 0xfa, 0xf2, 0xfa, 0xf3, 0xfa,
-    0xf3, 0xfa, 0xf4, 0xfa, 0xf4, 0xfa, 0xf5, 0xfa, 0xf6, 0xfa, 0xf6, 0xfa, 0xf7, 0xfa, 0xf7, 0xfa, 0xf8, 0xfa, 0xf9, 0xfa,
-    0x59, 0xfb, 0x8d, 0x4, 0x34, 0xd, 0xf5, 0x9, 0x5f, 0xb, 0xbc, 0xa, 0x3, 0xb, 0xe1, 0xa, 0xef, 0xa, 0xe7, 0xa,
-    0x2a, 0x7, 0x2, 0xfa, 0x3a, 0xfb, 0xdf, 0xfa, 0x7, 0xfb, 0xf6, 0xfa, 0xfe, 0xfa, 0xfc, 0xfa, 0xfd, 0xfa, 0xfe, 0xfa,
-    0xfe, 0xfa, 0xff, 0xfa, 0x0, 0xfb, 0x0, 0xfb, 0x1, 0xfb, 0x1, 0xfb, 0x2, 0xfb, 0x2, 0xfb, 0x3, 0xfb, 0x4, 0xfb,
-    0x4, 0xfb, 0x5, 0xfb, 0x5, 0xfb, 0x6, 0xfb, 0x75, 0x2, 0xb7, 0xd, 0x98, 0x9, 0x64, 0xb, 0x94, 0xa, 0xf0, 0xa,
-    0xc5, 0xa, 0xd6, 0xa, 0xcd, 0xa, 0xd7, 0x7, 0x73, 0xfa, 0x14, 0xfb, 0x3, 0xfb, 0x9, 0xfb, 0x7, 0xfb, 0x9, 0xfb,
-    0xa, 0xfb, 0xa, 0xfb, 0xb, 0xfb, 0xb, 0xfb, 0xc, 0xfb, 0xc, 0xfb, 0xd, 0xfb, 0xe, 0xfb, 0xe, 0xfb, 0xf, 0xfb,
-    0xf, 0xfb, 0x10, 0xfb, 0x10, 0xfb, 0x11, 0xfb, 0x12, 0xfb, 0x12, 0xfb, 0x71, 0xfb, 0x77, 0x4, 0xf6, 0xc, 0xc5, 0x9,
-    0x2a, 0xb, 0x89, 0xa, 0xcf, 0xa, 0xae, 0xa, 0xbb, 0xa, 0xb3, 0xa, 0x91, 0x5, 0x5e, 0xf9, 0xb8, 0xfb, 0xcb, 0xfa,
-    0x35, 0xfb, 0x7, 0xfb, 0x1c, 0xfb, 0x13, 0xfb, 0x18, 0xfb, 0x17, 0xfb, 0x18, 0xfb, 0x19, 0xfb, 0x19, 0xfb, 0x1a, 0xfb,
-    0x1a, 0xfb, 0x1b, 0xfb, 0x1c, 0xfb, 0x1c, 0xfb, 0x1d, 0xfb, 0x1d, 0xfb, 0x1e, 0xfb, 0x1e, 0xfb, 0x1f, 0xfb, 0x66, 0xfc,
-    0x74, 0x9, 0x4b, 0xb, 0x57, 0xa, 0xc4, 0xa, 0x91, 0xa, 0xa6, 0xa, 0x9b, 0xa, 0x9e, 0xa, 0xf, 0xa, 0x52, 0x0,
-    0x3e, 0xf9, 0xf3, 0xfb, 0xc3, 0xfa, 0x4c, 0xfb, 0xf, 0xfb, 0x2c, 0xfb, 0x1f, 0xfb, 0x26, 0xfb, 0x23, 0xfb, 0x25, 0xfb,
-    0x26, 0xfb, 0x26, 0xfb, 0x27, 0xfb, 0x27, 0xfb, 0x28, 0xfb, 0x28, 0xfb, 0x29, 0xfb, 0x2a, 0xfb, 0x2a, 0xfb, 0x2b, 0xfb,
-    0x2b, 0xfb, 0x2c, 0xfb, 0xac, 0x1, 0xf6, 0xc, 0x85, 0x9, 0xfc, 0xa, 0x54, 0xa, 0x9d, 0xa, 0x7b, 0xa, 0x88, 0xa,
-    0x80, 0xa, 0x30, 0x6, 0xdf, 0xf9, 0x9d, 0xfb, 0xfc, 0xfa, 0x44, 0xfb, 0x25, 0xfb, 0x33, 0xfb, 0x2e, 0xfb, 0x31, 0xfb,
-    0x31, 0xfb, 0x31, 0xfb, 0x32, 0xfb, 0x33, 0xfb, 0x33, 0xfb, 0x34, 0xfb, 0x34, 0xfb, 0x35, 0xfb, 0x35, 0xfb, 0x36, 0xfb,
-    0x36, 0xfb, 0x37, 0xfb, 0x38, 0xfb, 0x38, 0xfb, 0xcb, 0xfe, 0x5e, 0xb, 0x33, 0xa, 0x8a, 0xa, 0x63, 0xa, 0x72, 0xa,
-    0x6a, 0xa, 0x6b, 0xa, 0x69, 0xa, 0x45, 0x8, 0x9, 0xfb, 0x15, 0xfb, 0x4c, 0xfb, 0x32, 0xfb, 0x3f, 0xfb, 0x3a, 0xfb,
-    0x3c, 0xfb, 0x3d, 0xfb, 0x3d, 0xfb, 0x3e, 0xfb, 0x3e, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x40, 0xfb, 0x41, 0xfb, 0x41, 0xfb,
-    0x42, 0xfb, 0x42, 0xfb, 0x43, 0xfb, 0x43, 0xfb, 0x44, 0xfb, 0x45, 0xfb, 0x1a, 0xfe, 0xe6, 0xa, 0x4b, 0xa, 0x5a, 0xa,
-    0x54, 0xa, 0x54, 0xa, 0x53, 0xa, 0x51, 0xa, 0x50, 0xa, 0x30, 0x8, 0x15, 0xfb, 0x22, 0xfb, 0x58, 0xfb, 0x3f, 0xfb,
-    0x4b, 0xfb, 0x46, 0xfb, 0x49, 0xfb, 0x49, 0xfb, 0x4a, 0xfb, 0x4a, 0xfb, 0x4b, 0xfb, 0x4b, 0xfb, 0x4c, 0xfb, 0x4c, 0xfb,
-    0x4d, 0xfb, 0x4e, 0xfb, 0x4e, 0xfb, 0x4f, 0xfb, 0x4f, 0xfb, 0x50, 0xfb, 0x50, 0xfb, 0x51, 0xfb, 0x86, 0xff, 0x83, 0xb,
-    0xd2, 0x9, 0x6d, 0xa, 0x27, 0xa, 0x44, 0xa, 0x35, 0xa, 0x3a, 0xa, 0x36, 0xa, 0x3, 0x6, 0xe, 0xfa, 0xbe, 0xfb,
-    0x24, 0xfb, 0x68, 0xfb, 0x4b, 0xfb, 0x58, 0xfb, 0x53, 0xfb, 0x56, 0xfb, 0x56, 0xfb, 0x57, 0xfb, 0x57, 0xfb, 0x58, 0xfb,
-    0x58, 0xfb, 0x59, 0xfb, 0x59, 0xfb, 0x5a, 0xfb, 0x5a, 0xfb, 0x5b, 0xfb, 0x5c, 0xfb, 0x5c, 0xfb, 0x5d, 0xfb, 0x89, 0xfb,
-    0x46, 0x3, 0x89, 0xc, 0x1b, 0x9, 0x9a, 0xa, 0xee, 0x9, 0x39, 0xa, 0x16, 0xa, 0x23, 0xa, 0xc4, 0x9, 0x47, 0x1,
-    0x48, 0xf9, 0x47, 0xfc, 0xf7, 0xfa, 0x8e, 0xfb, 0x4b, 0xfb, 0x6a, 0xfb, 0x5d, 0xfb, 0x64, 0xfb, 0x61, 0xfb, 0x63, 0xfb,
-    0x64, 0xfb, 0x64, 0xfb, 0x65, 0xfb, 0x65, 0xfb, 0x66, 0xfb, 0x66, 0xfb, 0x67, 0xfb, 0x67, 0xfb, 0x68, 0xfb, 0x69, 0xfb,
-    0x69, 0xfb, 0x2a, 0xfe, 0x97, 0xa, 0x0, 0xa, 0x10, 0xa, 0x8, 0xa, 0xa, 0xa, 0x8, 0xa, 0x7, 0xa, 0x5, 0xa,
-    0x96, 0x6, 0x87, 0xfa, 0xa6, 0xfb, 0x52, 0xfb, 0x77, 0xfb, 0x67, 0xfb, 0x6f, 0xfb, 0x6c, 0xfb, 0x6e, 0xfb, 0x6e, 0xfb,
-    0x6f, 0xfb, 0x6f, 0xfb, 0x70, 0xfb, 0x71, 0xfb, 0x71, 0xfb, 0x72, 0xfb, 0x72, 0xfb, 0x73, 0xfb, 0x73, 0xfb, 0x74, 0xfb,
-    0x74, 0xfb, 0x75, 0xfb, 0x7b, 0xfc, 0xe9, 0x7, 0xda, 0xa, 0x8d, 0x9, 0x20, 0xa, 0xdc, 0x9, 0xf9, 0x9, 0xea, 0x9,
-    0xef, 0x9, 0xe1, 0x7, 0x48, 0xfb, 0x54, 0xfb, 0x88, 0xfb, 0x70, 0xfb, 0x7b, 0xfb, 0x77, 0xfb, 0x79, 0xfb, 0x7a, 0xfb,
-    0x7a, 0xfb, 0x7b, 0xfb, 0x7b, 0xfb, 0x7c, 0xfb, 0x7c, 0xfb, 0x7d, 0xfb, 0x7e, 0xfb, 0x7e, 0xfb, 0x7f, 0xfb, 0x7f, 0xfb,
-    0x80, 0xfb, 0x80, 0xfb, 0x81, 0xfb, 0x59, 0xfc, 0xe7, 0x6, 0x8, 0xb, 0x57, 0x9, 0x15, 0xa, 0xbe, 0x9, 0xe3, 0x9,
-    0xd1, 0x9, 0xd7, 0x9, 0x7a, 0x8, 0xad, 0xfb, 0x32, 0xfb, 0xa9, 0xfb, 0x72, 0xfb, 0x8c, 0xfb, 0x81, 0xfb, 0x86, 0xfb,
-    0x85, 0xfb, 0x86, 0xfb, 0x87, 0xfb, 0x87, 0xfb, 0x88, 0xfb, 0x88, 0xfb, 0x89, 0xfb, 0x8a, 0xfb, 0x8a, 0xfb, 0x8b, 0xfb,
-    0x8b, 0xfb, 0x8c, 0xfb, 0x8c, 0xfb, 0x8d, 0xfb, 0xb8, 0xfc, 0xae, 0x8, 0x5c, 0xa, 0x7e, 0x9, 0xe0, 0x9, 0xb2, 0x9,
-    0xc5, 0x9, 0xbb, 0x9, 0xbd, 0x9, 0x66, 0x6, 0xb1, 0xfa, 0xc8, 0xfb, 0x76, 0xfb, 0x9a, 0xfb, 0x8b, 0xfb, 0x93, 0xfb,
-    0x90, 0xfb, 0x92, 0xfb, 0x92, 0xfb, 0x93, 0xfb, 0x93, 0xfb, 0x94, 0xfb, 0x94, 0xfb, 0x95, 0xfb, 0x95, 0xfb, 0x96, 0xfb,
-    0x97, 0xfb, 0x97, 0xfb, 0x98, 0xfb, 0x98, 0xfb, 0x99, 0xfb, 0x90, 0xff, 0xde, 0xa, 0x44, 0x9, 0xd7, 0x9, 0x95, 0x9,
-    0xb0, 0x9, 0xa2, 0x9, 0xa7, 0x9, 0x79, 0x9, 0x22, 0x2, 0x55, 0xf9, 0x97, 0xfc, 0x2a, 0xfb, 0xcd, 0xfb, 0x86, 0xfb,
-    0xa6, 0xfb, 0x99, 0xfb, 0x9f, 0xfb, 0x9d, 0xfb, 0x9f, 0xfb, 0x9f, 0xfb, 0xa0, 0xfb, 0xa0, 0xfb, 0xa1, 0xfb, 0xa1, 0xfb,
-    0xa2, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0x4c, 0xfc, 0xcd, 0x5, 0xfe, 0xa, 0xf4, 0x8, 0xd8, 0x9,
-    0x70, 0x9, 0x9d, 0x9, 0x87, 0x9, 0x8f, 0x9, 0xec, 0x6, 0x24, 0xfb, 0xb1, 0xfb, 0xa2, 0xfb, 0xa8, 0xfb, 0xa6, 0xfb,
-    0xa8, 0xfb, 0xa9, 0xfb, 0xa9, 0xfb, 0xaa, 0xfb, 0xaa, 0xfb, 0xab, 0xfb, 0xab, 0xfb, 0xac, 0xfb, 0xac, 0xfb, 0xad, 0xfb,
-    0xad, 0xfb, 0xae, 0xfb, 0xaf, 0xfb, 0xaf, 0xfb, 0xb0, 0xfb, 0xb0, 0xfb, 0x86, 0x1, 0xa7, 0xb, 0x91, 0x8, 0xe1, 0x9,
-    0x4a, 0x9, 0x8c, 0x9, 0x6d, 0x9, 0x78, 0x9, 0x7a, 0x8, 0xa4, 0xfd, 0xd7, 0xfa, 0x12, 0xfc, 0x87, 0xfb, 0xc6, 0xfb,
-    0xaa, 0xfb, 0xb8, 0xfb, 0xb3, 0xfb, 0xb5, 0xfb, 0xb6, 0xfb, 0xb6, 0xfb, 0xb7, 0xfb, 0xb7, 0xfb, 0xb8, 0xfb, 0xb8, 0xfb,
-    0xb9, 0xfb, 0xb9, 0xfb, 0xba, 0xfb, 0xbb, 0xfb, 0xbb, 0xfb, 0xbc, 0xfb, 0x3a, 0x0, 0xe1, 0xa, 0xd4, 0x8, 0xa0, 0x9,
-    0x45, 0x9, 0x6c, 0x9, 0x59, 0x9, 0x5f, 0x9, 0xb7, 0x8, 0x6d, 0xff, 0x5a, 0xfa, 0x59, 0xfc, 0x78, 0xfb, 0xdd, 0xfb,
-    0xb1, 0xfb, 0xc5, 0xfb, 0xbd, 0xfb, 0xc2, 0xfb, 0xc0, 0xfb, 0xc2, 0xfb, 0xc2, 0xfb, 0xc3, 0xfb, 0xc3, 0xfb, 0xc4, 0xfb,
-    0xc4, 0xfb, 0xc5, 0xfb, 0xc5, 0xfb, 0xc6, 0xfb, 0xc7, 0xfb, 0xc7, 0xfb, 0x3a, 0x0, 0xc6, 0xa, 0xbd, 0x8, 0x88, 0x9,
-    0x2d, 0x9, 0x54, 0x9, 0x41, 0x9, 0x48, 0x9, 0x79, 0x8, 0x8f, 0xfe, 0xaf, 0xfa, 0x45, 0xfc, 0x92, 0xfb, 0xe3, 0xfb,
-    0xbf, 0xfb, 0xd0, 0xfb, 0xc9, 0xfb, 0xcd, 0xfb, 0xcc, 0xfb, 0xcd, 0xfb, 0xce, 0xfb, 0xce, 0xfb, 0xcf, 0xfb, 0xcf, 0xfb,
-    0xd0, 0xfb, 0xd0, 0xfb, 0xd1, 0xfb, 0xd1, 0xfb, 0xd2, 0xfb, 0xd3, 0xfb, 0x1c, 0x2, 0xa3, 0xb, 0x25, 0x8, 0xab, 0x9,
-    0xfb, 0x8, 0x48, 0x9, 0x24, 0x9, 0x32, 0x9, 0x49, 0x7, 0xaa, 0xfb, 0xb3, 0xfb, 0xe4, 0xfb, 0xce, 0xfb, 0xd8, 0xfb,
-    0xd5, 0xfb, 0xd7, 0xfb, 0xd7, 0xfb, 0xd8, 0xfb, 0xd8, 0xfb, 0xd9, 0xfb, 0xd9, 0xfb, 0xda, 0xfb, 0xda, 0xfb, 0xdb, 0xfb,
-    0xdb, 0xfb, 0xdc, 0xfb, 0xdc, 0xfb, 0xdd, 0xfb, 0xdd, 0xfb, 0xcd, 0xfc, 0x3e, 0x7, 0xef, 0x9, 0xbf, 0x8, 0x44, 0x9,
-    0x7, 0x9, 0x20, 0x9, 0x13, 0x9, 0x17, 0x9, 0xdf, 0x2, 0x7a, 0xf9, 0xe9, 0xfc, 0x69, 0xfb, 0x15, 0xfc, 0xc9, 0xfb,
-    0xec, 0xfb, 0xdd, 0xfb, 0xe5, 0xfb, 0xe2, 0xfb, 0xe4, 0xfb, 0xe4, 0xfb, 0xe5, 0xfb, 0xe5, 0xfb, 0xe6, 0xfb, 0xe6, 0xfb,
-    0xe7, 0xfb, 0xe7, 0xfb, 0xe8, 0xfb, 0xe8, 0xfb, 0xe9, 0xfb, 0x75, 0x1, 0x15, 0xb, 0x27, 0x8, 0x66, 0x9, 0xd7, 0x8,
-    0x15, 0x9, 0xf7, 0x8, 0x3, 0x9, 0x87, 0x6, 0x70, 0xfb, 0xf5, 0xfb, 0xe7, 0xfb, 0xed, 0xfb, 0xeb, 0xfb, 0xed, 0xfb,
-    0xed, 0xfb, 0xee, 0xfb, 0xee, 0xfb, 0xef, 0xfb, 0xef, 0xfb, 0xf0, 0xfb, 0xf0, 0xfb, 0xf1, 0xfb, 0xf1, 0xfb, 0xf2, 0xfb,
-    0xf2, 0xfb, 0xf3, 0xfb, 0xf3, 0xfb, 0xf4, 0xfb, 0x1, 0xff, 0xb8, 0x9, 0xb9, 0x8, 0x3, 0x9, 0xe2, 0x8, 0xef, 0x8,
-    0xe7, 0x8, 0xe9, 0x8, 0xfd, 0x7, 0xca, 0xfd, 0x28, 0xfb, 0x51, 0xfc, 0xcd, 0xfb, 0x9, 0xfc, 0xf0, 0xfb, 0xfb, 0xfb,
-    0xf7, 0xfb, 0xf9, 0xfb, 0xfa, 0xfb, 0xfa, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfb, 0xfc, 0xfb, 0xfd, 0xfb, 0xfd, 0xfb,
-    0xfe, 0xfb, 0xfe, 0xfb, 0xff, 0xfb, 0xce, 0xfd, 0x0, 0x9, 0xf5, 0x8, 0xc7, 0x8, 0xdc, 0x8, 0xd0, 0x8, 0xd4, 0x8,
-    0xd0, 0x8, 0x10, 0x8, 0xa4, 0xfe, 0xf5, 0xfa, 0x77, 0xfc, 0xcd, 0xfb, 0x19, 0xfc, 0xf8, 0xfb, 0x7, 0xfc, 0x2, 0xfc,
-    0x4, 0xfc, 0x5, 0xfc, 0x5, 0xfc, 0x6, 0xfc, 0x6, 0xfc, 0x7, 0xfc, 0x7, 0xfc, 0x8, 0xfc, 0x8, 0xfc, 0x9, 0xfc,
-    0xa, 0xfc, 0xa, 0xfc, 0x6e, 0xfe, 0x38, 0x9, 0xb5, 0x8, 0xc2, 0x8, 0xbd, 0x8, 0xbd, 0x8, 0xbb, 0x8, 0xba, 0x8,
-    0xae, 0x7, 0x4, 0xfd, 0x84, 0xfb, 0x49, 0xfc, 0xf1, 0xfb, 0x19, 0xfc, 0x8, 0xfc, 0x10, 0xfc, 0xe, 0xfc, 0xf, 0xfc,
-    0x10, 0xfc, 0x10, 0xfc, 0x11, 0xfc, 0x11, 0xfc, 0x12, 0xfc, 0x12, 0xfc, 0x13, 0xfc, 0x13, 0xfc, 0x14, 0xfc, 0x15, 0xfc,
-    0x15, 0xfc, 0x16, 0xfc, 0x16, 0xfc, 0x17, 0xfc, 0x17, 0xfc, 0x18, 0xfc, 0x18, 0xfc, 0x19, 0xfc, 0x19, 0xfc, 0x1a, 0xfc,
-    0x1a, 0xfc, 0x1b, 0xfc, 0x1b, 0xfc, 0xb2, 0xfc, 0x3d, 0x5, 0xe7, 0x9, 0x12, 0x8, 0xde, 0x8, 0x82, 0x8, 0xa9, 0x8,
-    0x96, 0x8, 0x9d, 0x8, 0x98, 0x8, 0x98, 0x8, 0x97, 0x8, 0xd4, 0x6, 0xf5, 0xfb, 0xff, 0xfb, 0x2c, 0xfc, 0x18, 0xfc,
-    0x22, 0xfc, 0x1e, 0xfc, 0x20, 0xfc, 0x20, 0xfc, 0x21, 0xfc, 0x21, 0xfc, 0x22, 0xfc, 0x22, 0xfc, 0x23, 0xfc, 0x24, 0xfc,
-    0x24, 0xfc, 0x25, 0xfc, 0x25, 0xfc, 0x26, 0xfc, 0x26, 0xfc, 0x27, 0xfc, 0x27, 0xfc, 0x28, 0xfc, 0x28, 0xfc, 0x29, 0xfc,
-    0x29, 0xfc, 0x2a, 0xfc, 0x2a, 0xfc, 0x2b, 0xfc, 0xbf, 0xfc, 0x2a, 0x5, 0xc1, 0x9, 0xf3, 0x7, 0xbd, 0x8, 0x61, 0x8,
-    0x89, 0x8, 0x75, 0x8, 0x7d, 0x8, 0x77, 0x8, 0x78, 0x8, 0x76, 0x8, 0x25, 0x6, 0xba, 0xfb, 0x37, 0xfc, 0x2a, 0xfc,
-    0x2f, 0xfc, 0x2d, 0xfc, 0x2f, 0xfc, 0x2f, 0xfc, 0x30, 0xfc, 0x30, 0xfc, 0x31, 0xfc, 0x31, 0xfc, 0x32, 0xfc, 0x32, 0xfc,
-    0x33, 0xfc, 0x34, 0xfc, 0x34, 0xfc, 0x35, 0xfc, 0x35, 0xfc, 0x36, 0xfc, 0x36, 0xfc, 0x37, 0xfc, 0x37, 0xfc, 0x38, 0xfc,
-    0x38, 0xfc, 0x39, 0xfc, 0x39, 0xfc, 0x3a, 0xfc, 0x3a, 0xfc, 0xf1, 0xfd, 0x87, 0x8, 0x7d, 0x8, 0x50, 0x8, 0x65, 0x8,
-    0x59, 0x8, 0x5d, 0x8, 0x59, 0x8, 0x59, 0x8, 0x58, 0x8, 0x56, 0x8, 0x31, 0x8, 0xdc, 0x1, 0x48, 0xfa, 0x16, 0xfd,
-    0xdb, 0xfb, 0x69, 0xfc, 0x2a, 0xfc, 0x47, 0xfc, 0x3b, 0xfc, 0x41, 0xfc, 0x3f, 0xfc, 0x40, 0xfc, 0x41, 0xfc, 0x42, 0xfc,
-    0x42, 0xfc, 0x43, 0xfc, 0x43, 0xfc, 0x44, 0xfc, 0x44, 0xfc, 0x45, 0xfc, 0x45, 0xfc, 0x46, 0xfc, 0x46, 0xfc, 0x47, 0xfc,
-    0x47, 0xfc, 0x48, 0xfc, 0x48, 0xfc, 0x49, 0xfc, 0x49, 0xfc, 0xb6, 0xfc, 0x3c, 0x4, 0xb5, 0x9, 0x9c, 0x7, 0x87, 0x8,
-    0x1c, 0x8, 0x4a, 0x8, 0x34, 0x8, 0x3c, 0x8, 0x37, 0x8, 0x37, 0x8, 0x36, 0x8, 0x49, 0x4, 0xfe, 0xfa, 0xc9, 0xfc,
-    0x14, 0xfc, 0x65, 0xfc, 0x42, 0xfc, 0x52, 0xfc, 0x4c, 0xfc, 0x50, 0xfc, 0x4e, 0xfc, 0x50, 0xfc, 0x50, 0xfc, 0x51, 0xfc,
-    0x51, 0xfc, 0x52, 0xfc, 0x52, 0xfc, 0x53, 0xfc, 0x53, 0xfc, 0x54, 0xfc, 0x54, 0xfc, 0x55, 0xfc, 0x55, 0xfc, 0x56, 0xfc,
-    0x56, 0xfc, 0x57, 0xfc, 0x57, 0xfc, 0x58, 0xfc, 0x58, 0xfc, 0xa0, 0xfc, 0x69, 0x3, 0xcb, 0x9, 0x65, 0x7, 0x71, 0x8,
-    0xf8, 0x7, 0x2d, 0x8, 0x13, 0x8, 0x1d, 0x8, 0x17, 0x8, 0x18, 0x8, 0x16, 0x8, 0x39, 0x4, 0x13, 0xfb, 0xd5, 0xfc,
-    0x24, 0xfc, 0x74, 0xfc, 0x51, 0xfc, 0x62, 0xfc, 0x5a, 0xfc, 0x5f, 0xfc, 0x5d, 0xfc, 0x5f, 0xfc, 0x5f, 0xfc, 0x60, 0xfc,
-    0x60, 0xfc, 0x61, 0xfc, 0x61, 0xfc, 0x62, 0xfc, 0x62, 0xfc, 0x63, 0xfc, 0x63, 0xfc, 0x64, 0xfc, 0x64, 0xfc, 0x65, 0xfc,
-    0x65, 0xfc, 0x66, 0xfc, 0x66, 0xfc, 0x67, 0xfc, 0x67, 0xfc, 0x39, 0xfd, 0x5d, 0x6, 0xb8, 0x8, 0xae, 0x7, 0x22, 0x8,
-    0xed, 0x7, 0x3, 0x8, 0xf7, 0x7, 0xfb, 0x7, 0xf8, 0x7, 0xf7, 0x7, 0xb1, 0x7, 0x9, 0x1, 0xc6, 0xfa, 0x20, 0xfd,
-    0x18, 0xfc, 0x8f, 0xfc, 0x5a, 0xfc, 0x73, 0xfc, 0x68, 0xfc, 0x6e, 0xfc, 0x6c, 0xfc, 0x6e, 0xfc, 0x6e, 0xfc, 0x6f, 0xfc,
-    0x6f, 0xfc, 0x70, 0xfc, 0x70, 0xfc, 0x71, 0xfc, 0x71, 0xfc, 0x72, 0xfc, 0x72, 0xfc, 0x73, 0xfc, 0x73, 0xfc, 0x74, 0xfc,
-    0x74, 0xfc, 0x75, 0xfc, 0x75, 0xfc, 0x76, 0xfc, 0x76, 0xfc, 0x4c, 0x1, 0xad, 0x9, 0x1f, 0x7, 0x35, 0x8, 0xb8, 0x7,
-    0xee, 0x7, 0xd4, 0x7, 0xde, 0x7, 0xd8, 0x7, 0xd9, 0x7, 0xd7, 0x7, 0x19, 0x4, 0x3a, 0xfb, 0xf0, 0xfc, 0x44, 0xfc,
-    0x91, 0xfc, 0x6f, 0xfc, 0x7f, 0xfc, 0x79, 0xfc, 0x7c, 0xfc, 0x7c, 0xfc, 0x7c, 0xfc, 0x7d, 0xfc, 0x7d, 0xfc, 0x7e, 0xfc,
-    0x7e, 0xfc, 0x7f, 0xfc, 0x7f, 0xfc, 0x80, 0xfc, 0x80, 0xfc, 0x81, 0xfc, 0x81, 0xfc, 0x82, 0xfc, 0x82, 0xfc, 0x83, 0xfc,
-    0x83, 0xfc, 0x84, 0xfc, 0x84, 0xfc, 0x85, 0xfc, 0x38, 0x0, 0xfc, 0x8, 0x4b, 0x7, 0xf3, 0x7, 0xa8, 0x7, 0xc8, 0x7,
-    0xb8, 0x7, 0xbe, 0x7, 0xb9, 0x7, 0xba, 0x7, 0xb8, 0x7, 0x8f, 0x4, 0x93, 0xfb, 0xd8, 0xfc, 0x64, 0xfc, 0x97, 0xfc,
-    0x82, 0xfc, 0x8c, 0xfc, 0x88, 0xfc, 0x8a, 0xfc, 0x8b, 0xfc, 0x8b, 0xfc, 0x8c, 0xfc, 0x8c, 0xfc, 0x8d, 0xfc, 0x8d, 0xfc,
-    0x8e, 0xfc, 0x8e, 0xfc, 0x8f, 0xfc, 0x8f, 0xfc, 0x90, 0xfc, 0x90, 0xfc, 0x91, 0xfc, 0x91, 0xfc, 0x92, 0xfc, 0x92, 0xfc,
-    0x93, 0xfc, 0x93, 0xfc, 0x94, 0xfc, 0xc6, 0x1, 0xa5, 0x9, 0xc2, 0x6, 0x5, 0x8, 0x73, 0x7, 0xb2, 0x7, 0x95, 0x7,
-    0xa0, 0x7, 0x9a, 0x7, 0x9a, 0x7, 0x99, 0x7, 0x6b, 0x2, 0x95, 0xfa, 0x74, 0xfd, 0x32, 0xfc, 0xc3, 0xfc, 0x83, 0xfc,
-    0xa1, 0xfc, 0x94, 0xfc, 0x9a, 0xfc, 0x98, 0xfc, 0x9a, 0xfc, 0x9a, 0xfc, 0x9b, 0xfc, 0x9b, 0xfc, 0x9c, 0xfc, 0x9c, 0xfc,
-    0x9d, 0xfc, 0x9d, 0xfc, 0x9e, 0xfc, 0x9e, 0xfc, 0x9f, 0xfc, 0x9f, 0xfc, 0xa0, 0xfc, 0xa0, 0xfc, 0xa1, 0xfc, 0xa1, 0xfc,
-    0xa2, 0xfc, 0xa8, 0xfd, 0x64, 0x7, 0xc0, 0x7, 0x65, 0x7, 0x8f, 0x7, 0x7a, 0x7, 0x82, 0x7, 0x7d, 0x7, 0x7d, 0x7,
-    0x7c, 0x7, 0x7b, 0x7, 0x70, 0x5, 0x3e, 0xfc, 0xad, 0xfc, 0xa1, 0xfc, 0xa6, 0xfc, 0xa4, 0xfc, 0xa6, 0xfc, 0xa6, 0xfc,
-    0xa7, 0xfc, 0xa7, 0xfc, 0xa8, 0xfc, 0xa8, 0xfc, 0xa9, 0xfc, 0xa9, 0xfc, 0xaa, 0xfc, 0xaa, 0xfc, 0xab, 0xfc, 0xab, 0xfc,
-    0xac, 0xfc, 0xac, 0xfc, 0xad, 0xfc, 0xad, 0xfc, 0xae, 0xfc, 0xae, 0xfc, 0xaf, 0xfc, 0xaf, 0xfc, 0xb0, 0xfc, 0x31, 0xfd,
-    0x7f, 0x4, 0x7c, 0x8, 0xea, 0x6, 0x9a, 0x7, 0x4a, 0x7, 0x6c, 0x7, 0x5b, 0x7, 0x61, 0x7, 0x5c, 0x7, 0x5d, 0x7,
-    0x7b, 0x6, 0x82, 0xfd, 0x40, 0xfc, 0xe6, 0xfc, 0x9c, 0xfc, 0xbe, 0xfc, 0xaf, 0xfc, 0xb7, 0xfc, 0xb4, 0xfc, 0xb6, 0xfc,
-    0xb6, 0xfc, 0xb7, 0xfc, 0xb7, 0xfc, 0xb8, 0xfc, 0xb8, 0xfc, 0xb9, 0xfc, 0xb9, 0xfc, 0xba, 0xfc, 0xba, 0xfc, 0xbb, 0xfc,
-    0xbb, 0xfc, 0xbc, 0xfc, 0xbc, 0xfc, 0xbd, 0xfc, 0xbd, 0xfc, 0xbe, 0xfc, 0xbe, 0xfc, 0x5d, 0xfd, 0x1b, 0x5, 0x23, 0x8,
-    0xe5, 0x6, 0x70, 0x7, 0x30, 0x7, 0x4b, 0x7, 0x3e, 0x7, 0x42, 0x7, 0x3e, 0x7, 0x3e, 0x7, 0xc2, 0x5, 0x9e, 0xfc,
-    0xa7, 0xfc, 0xcd, 0xfc, 0xbc, 0xfc, 0xc4, 0xfc, 0xc1, 0xfc, 0xc3, 0xfc, 0xc3, 0xfc, 0xc4, 0xfc, 0xc4, 0xfc, 0xc5, 0xfc,
-    0xc5, 0xfc, 0xc6, 0xfc, 0xc6, 0xfc, 0xc7, 0xfc, 0xc7, 0xfc, 0xc8, 0xfc, 0xc8, 0xfc, 0xc9, 0xfc, 0xc9, 0xfc, 0xca, 0xfc,
-    0xca, 0xfc, 0xcb, 0xfc, 0xcb, 0xfc, 0xcc, 0xfc, 0xcc, 0xfc, 0x3c, 0xff, 0xca, 0x7, 0xff, 0x6, 0x39, 0x7, 0x1e, 0x7,
-    0x29, 0x7, 0x22, 0x7, 0x24, 0x7, 0x22, 0x7, 0x20, 0x7, 0x1, 0x7, 0x9a, 0x1, 0x24, 0xfb, 0x87, 0xfd, 0x7c, 0xfc,
-    0xf5, 0xfc, 0xbf, 0xfc, 0xd8, 0xfc, 0xcd, 0xfc, 0xd3, 0xfc, 0xd1, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd4, 0xfc, 0xd4, 0xfc,
-    0xd5, 0xfc, 0xd5, 0xfc, 0xd6, 0xfc, 0xd6, 0xfc, 0xd7, 0xfc, 0xd7, 0xfc, 0xd8, 0xfc, 0xd8, 0xfc, 0xd9, 0xfc, 0xd9, 0xfc,
-    0xda, 0xfc, 0xda, 0xfc, 0x74, 0xfd, 0xf1, 0x4, 0xe1, 0x7, 0xac, 0x6, 0x33, 0x7, 0xf5, 0x6, 0xf, 0x7, 0x2, 0x7,
-    0x6, 0x7, 0x2, 0x7, 0x2, 0x7, 0x24, 0x4, 0xff, 0xfb, 0x27, 0xfd, 0xbc, 0xfc, 0xec, 0xfc, 0xd7, 0xfc, 0xe1, 0xfc,
-    0xde, 0xfc, 0xdf, 0xfc, 0xe0, 0xfc, 0xe0, 0xfc, 0xe1, 0xfc, 0xe1, 0xfc, 0xe2, 0xfc, 0xe2, 0xfc, 0xe3, 0xfc, 0xe3, 0xfc,
-    0xe4, 0xfc, 0xe4, 0xfc, 0xe5, 0xfc, 0xe5, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0xfc, 0xe7, 0xfc, 0xe8, 0xfc, 0x42, 0xfd,
-    0x90, 0x3, 0x26, 0x8, 0x64, 0x6, 0x28, 0x7, 0xcf, 0x6, 0xf5, 0x6, 0xe3, 0x6, 0xe9, 0x6, 0xe4, 0x6, 0xe5, 0x6,
-    0x8b, 0x4, 0x4f, 0xfc, 0x13, 0xfd, 0xd9, 0xfc, 0xf3, 0xfc, 0xe8, 0xfc, 0xee, 0xfc, 0xec, 0xfc, 0xed, 0xfc, 0xee, 0xfc,
-    0xee, 0xfc, 0xef, 0xfc, 0xef, 0xfc, 0xf0, 0xfc, 0xf0, 0xfc, 0xf1, 0xfc, 0xf1, 0xfc, 0xf2, 0xfc, 0xf2, 0xfc, 0xf3, 0xfc,
-    0xf3, 0xfc, 0xf4, 0xfc, 0xf4, 0xfc, 0xf5, 0xfc, 0xf5, 0xfc, 0xf6, 0xfc, 0xa7, 0xfd, 0x6c, 0x5, 0x6b, 0x7, 0x89, 0x6,
-    0xed, 0x6, 0xbe, 0x6, 0xd2, 0x6, 0xc7, 0x6, 0xca, 0x6, 0xc8, 0x6, 0xc7, 0x6, 0xa0, 0x2, 0x6c, 0xfb, 0x9e, 0xfd,
-    0xaf, 0xfc, 0x1a, 0xfd, 0xeb, 0xfc, 0x0, 0xfd, 0xf8, 0xfc, 0xfc, 0xfc, 0xfb, 0xfc, 0xfc, 0xfc, 0xfd, 0xfc, 0xfd, 0xfc,
-    0xfd, 0xfc, 0xfe, 0xfc, 0xfe, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x0, 0xfd, 0x0, 0xfd, 0x1, 0xfd, 0x1, 0xfd, 0x2, 0xfd,
-    0x2, 0xfd, 0x3, 0xfd, 0x3, 0xfd, 0x33, 0x0, 0xc1, 0x7, 0x4c, 0x6, 0xdd, 0x6, 0x9c, 0x6, 0xb7, 0x6, 0xaa, 0x6,
-    0xae, 0x6, 0xab, 0x6, 0xaa, 0x6, 0xde, 0x5, 0xc2, 0xfd, 0x9e, 0xfc, 0x34, 0xfd, 0xf1, 0xfc, 0x10, 0xfd, 0x3, 0xfd,
-    0xa, 0xfd, 0x7, 0xfd, 0x9, 0xfd, 0x9, 0xfd, 0xa, 0xfd, 0xa, 0xfd, 0xb, 0xfd, 0xb, 0xfd, 0xc, 0xfd, 0xc, 0xfd,
-    0xd, 0xfd, 0xd, 0xfd, 0xe, 0xfd, 0xe, 0xfd, 0xf, 0xfd, 0xf, 0xfd, 0x10, 0xfd, 0x10, 0xfd, 0x11, 0xfd, 0xf6, 0xfd,
-    0x7a, 0x6, 0xca, 0x6, 0x7b, 0x6, 0x9e, 0x6, 0x8d, 0x6, 0x93, 0x6, 0x8e, 0x6, 0x8f, 0x6, 0x8d, 0x6, 0x1b, 0x6,
-    0xa3, 0xff, 0x1c, 0xfc, 0x7f, 0xfd, 0xe3, 0xfc, 0x2a, 0xfd, 0xb, 0xfd, 0x19, 0xfd, 0x14, 0xfd, 0x16, 0xfd, 0x17, 0xfd,
-    0x17, 0xfd, 0x18, 0xfd, 0x18, 0xfd, 0x19, 0xfd, 0x19, 0xfd, 0x1a, 0xfd, 0x1a, 0xfd, 0x1b, 0xfd, 0x1b, 0xfd, 0x1c, 0xfd,
-    0x1c, 0xfd, 0x1c, 0xfd, 0x1d, 0xfd, 0x1d, 0xfd, 0x1e, 0xfd, 0xe3, 0xfd, 0xc1, 0x5, 0xdc, 0x6, 0x4a, 0x6, 0x8a, 0x6,
-    0x6c, 0x6, 0x78, 0x6, 0x71, 0x6, 0x72, 0x6, 0x70, 0x6, 0x0, 0x6, 0xa5, 0xff, 0x2e, 0xfc, 0x8a, 0xfd, 0xf2, 0xfc,
-    0x37, 0xfd, 0x18, 0xfd, 0x27, 0xfd, 0x21, 0xfd, 0x25, 0xfd, 0x23, 0xfd, 0x25, 0xfd, 0x25, 0xfd, 0x26, 0xfd, 0x26, 0xfd,
-    0x27, 0xfd, 0x27, 0xfd, 0x27, 0xfd, 0x28, 0xfd, 0x28, 0xfd, 0x29, 0xfd, 0x29, 0xfd, 0x2a, 0xfd, 0x2a, 0xfd, 0x2b, 0xfd,
-    0x2b, 0xfd, 0x54, 0xff, 0xeb, 0x6, 0x36, 0x6, 0x69, 0x6, 0x52, 0x6, 0x5b, 0x6, 0x56, 0x6, 0x56, 0x6, 0x55, 0x6,
-    0x53, 0x6, 0x9, 0x5, 0x10, 0xfd, 0x18, 0xfd, 0x38, 0xfd, 0x2a, 0xfd, 0x31, 0xfd, 0x2f, 0xfd, 0x30, 0xfd, 0x31, 0xfd,
-    0x31, 0xfd, 0x31, 0xfd, 0x32, 0xfd, 0x32, 0xfd, 0x33, 0xfd, 0x33, 0xfd, 0x34, 0xfd, 0x34, 0xfd, 0x35, 0xfd, 0x35, 0xfd,
-    0x36, 0xfd, 0x36, 0xfd, 0x37, 0xfd, 0x37, 0xfd, 0x38, 0xfd, 0x38, 0xfd, 0x8a, 0xfd, 0x37, 0x3, 0x58, 0x7, 0xc3, 0x5,
-    0x74, 0x6, 0x23, 0x6, 0x46, 0x6, 0x35, 0x6, 0x3b, 0x6, 0x36, 0x6, 0x1, 0x6, 0xd3, 0x0, 0xf5, 0xfb, 0xc8, 0xfd,
-    0xfc, 0xfc, 0x58, 0xfd, 0x30, 0xfd, 0x42, 0xfd, 0x3b, 0xfd, 0x3f, 0xfd, 0x3d, 0xfd, 0x3f, 0xfd, 0x3f, 0xfd, 0x40, 0xfd,
-    0x40, 0xfd, 0x41, 0xfd, 0x41, 0xfd, 0x42, 0xfd, 0x42, 0xfd, 0x43, 0xfd, 0x43, 0xfd, 0x44, 0xfd, 0x44, 0xfd, 0x45, 0xfd,
-    0x45, 0xfd, 0x46, 0xfd, 0x5, 0x1, 0x88, 0x7, 0x8c, 0x5, 0x64, 0x6, 0x2, 0x6, 0x2c, 0x6, 0x18, 0x6, 0x1f, 0x6,
-    0x1a, 0x6, 0x1b, 0x6, 0x5f, 0x2, 0xe4, 0xfb, 0xdd, 0xfd, 0x6, 0xfd, 0x66, 0xfd, 0x3c, 0xfd, 0x50, 0xfd, 0x47, 0xfd,
-    0x4c, 0xfd, 0x4a, 0xfd, 0x4c, 0xfd, 0x4c, 0xfd, 0x4d, 0xfd, 0x4d, 0xfd, 0x4e, 0xfd, 0x4e, 0xfd, 0x4f, 0xfd, 0x4f, 0xfd,
-    0x50, 0xfd, 0x50, 0xfd, 0x51, 0xfd, 0x51, 0xfd, 0x51, 0xfd, 0x52, 0xfd, 0x52, 0xfd, 0x98, 0x0, 0x30, 0x7, 0x8e, 0x5,
-    0x3a, 0x6, 0xec, 0x5, 0xd, 0x6, 0xfd, 0x5, 0x3, 0x6, 0xfe, 0x5, 0xff, 0x5, 0xec, 0x1, 0xc2, 0xfb, 0x3, 0xfe,
-    0x8, 0xfd, 0x78, 0xfd, 0x47, 0xfd, 0x5e, 0xfd, 0x54, 0xfd, 0x59, 0xfd, 0x57, 0xfd, 0x59, 0xfd, 0x59, 0xfd, 0x5a, 0xfd,
-    0x5a, 0xfd, 0x5b, 0xfd, 0x5b, 0xfd, 0x5c, 0xfd, 0x5c, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5e, 0xfd, 0x5e, 0xfd,
-    0x5f, 0xfd, 0x79, 0xfd, 0xf2, 0x1, 0x4c, 0x7, 0x50, 0x5, 0x2d, 0x6, 0xc9, 0x5, 0xf4, 0x5, 0xe0, 0x5, 0xe7, 0x5,
-    0xe2, 0x5, 0x96, 0x5, 0x3b, 0x0, 0x59, 0xfc, 0xd5, 0xfd, 0x2f, 0xfd, 0x7a, 0xfd, 0x59, 0xfd, 0x68, 0xfd, 0x62, 0xfd,
-    0x66, 0xfd, 0x64, 0xfd, 0x66, 0xfd, 0x66, 0xfd, 0x67, 0xfd, 0x67, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-    0x69, 0xfd, 0x6a, 0xfd, 0x6a, 0xfd, 0x6b, 0xfd, 0x6b, 0xfd, 0x6c, 0xfd, 0x36, 0xfe, 0xb6, 0x5, 0xfd, 0x5, 0xb7, 0x5,
-    0xd7, 0x5, 0xc7, 0x5, 0xcd, 0x5, 0xc8, 0x5, 0xc8, 0x5, 0xc7, 0x5, 0x6b, 0x3, 0xb9, 0xfc, 0xaa, 0xfd, 0x55, 0xfd,
-    0x7b, 0xfd, 0x6b, 0xfd, 0x72, 0xfd, 0x70, 0xfd, 0x71, 0xfd, 0x72, 0xfd, 0x72, 0xfd, 0x73, 0xfd, 0x73, 0xfd, 0x74, 0xfd,
-    0x74, 0xfd, 0x75, 0xfd, 0x75, 0xfd, 0x75, 0xfd, 0x76, 0xfd, 0x76, 0xfd, 0x77, 0xfd, 0x77, 0xfd, 0x78, 0xfd, 0x78, 0xfd,
-    0xc3, 0xfd, 0xf0, 0x2, 0xb3, 0x6, 0x42, 0x5, 0xe3, 0x5, 0x9a, 0x5, 0xb9, 0x5, 0xaa, 0x5, 0xaf, 0x5, 0xab, 0x5,
-    0xe7, 0x4, 0x93, 0xfd, 0x4c, 0xfd, 0x91, 0xfd, 0x72, 0xfd, 0x80, 0xfd, 0x7b, 0xfd, 0x7e, 0xfd, 0x7e, 0xfd, 0x7e, 0xfd,
-    0x7f, 0xfd, 0x7f, 0xfd, 0x80, 0xfd, 0x80, 0xfd, 0x81, 0xfd, 0x81, 0xfd, 0x82, 0xfd, 0x82, 0xfd, 0x82, 0xfd, 0x83, 0xfd,
-    0x83, 0xfd, 0x84, 0xfd, 0x84, 0xfd, 0x85, 0xfd, 0xb5, 0xfd, 0x5d, 0x2, 0xbd, 0x6, 0x18, 0x5, 0xcf, 0x5, 0x7b, 0x5,
-    0x9f, 0x5, 0x8d, 0x5, 0x94, 0x5, 0x8f, 0x5, 0xcf, 0x4, 0x9f, 0xfd, 0x5b, 0xfd, 0x9c, 0xfd, 0x7f, 0xfd, 0x8d, 0xfd,
-    0x87, 0xfd, 0x8b, 0xfd, 0x89, 0xfd, 0x8b, 0xfd, 0x8b, 0xfd, 0x8c, 0xfd, 0x8c, 0xfd, 0x8d, 0xfd, 0x8d, 0xfd, 0x8e, 0xfd,
-    0x8e, 0xfd, 0x8e, 0xfd, 0x8f, 0xfd, 0x8f, 0xfd, 0x90, 0xfd, 0x90, 0xfd, 0x91, 0xfd, 0x91, 0xfd, 0xf1, 0xfd, 0x58, 0x3,
-    0x4a, 0x6, 0x21, 0x5, 0xa3, 0x5, 0x67, 0x5, 0x81, 0x5, 0x73, 0x5, 0x78, 0x5, 0x74, 0x5, 0x9a, 0x3, 0x19, 0xfd,
-    0xb4, 0xfd, 0x87, 0xfd, 0x9a, 0xfd, 0x93, 0xfd, 0x97, 0xfd, 0x95, 0xfd, 0x97, 0xfd, 0x97, 0xfd, 0x98, 0xfd, 0x98, 0xfd,
-    0x99, 0xfd, 0x99, 0xfd, 0x9a, 0xfd, 0x9a, 0xfd, 0x9b, 0xfd, 0x9b, 0xfd, 0x9b, 0xfd, 0x9c, 0xfd, 0x9c, 0xfd, 0x9d, 0xfd,
-    0x9d, 0xfd, 0x9e, 0xfd, 0x13, 0xff, 0xab, 0x5, 0x5a, 0x5, 0x62, 0x5, 0x5e, 0x5, 0x5f, 0x5, 0x5d, 0x5, 0x5c, 0x5,
-    0x5a, 0x5, 0x2b, 0x5, 0xb7, 0x0, 0x88, 0xfc, 0x1a, 0xfe, 0x6b, 0xfd, 0xba, 0xfd, 0x97, 0xfd, 0xa8, 0xfd, 0xa0, 0xfd,
-    0xa4, 0xfd, 0xa4, 0xfd, 0xa4, 0xfd, 0xa5, 0xfd, 0xa5, 0xfd, 0xa6, 0xfd, 0xa6, 0xfd, 0xa7, 0xfd, 0xa7, 0xfd, 0xa8, 0xfd,
-    0xa8, 0xfd, 0xa8, 0xfd, 0xa9, 0xfd, 0xa9, 0xfd, 0xaa, 0xfd, 0xee, 0xfd, 0xb8, 0x2, 0x33, 0x6, 0xdf, 0x4, 0x72, 0x5,
-    0x2f, 0x5, 0x4c, 0x5, 0x3d, 0x5, 0x42, 0x5, 0x3e, 0x5, 0x1c, 0x3, 0x8, 0xfd, 0xe3, 0xfd, 0x96, 0xfd, 0xb8, 0xfd,
-    0xa9, 0xfd, 0xb1, 0xfd, 0xae, 0xfd, 0xb0, 0xfd, 0xb0, 0xfd, 0xb0, 0xfd, 0xb1, 0xfd, 0xb1, 0xfd, 0xb2, 0xfd, 0xb2, 0xfd,
-    0xb3, 0xfd, 0xb3, 0xfd, 0xb4, 0xfd, 0xb4, 0xfd, 0xb5, 0xfd, 0xb5, 0xfd, 0xb5, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0x38, 0x1,
-    0x87, 0x6, 0x95, 0x4, 0x6d, 0x5, 0xb, 0x5, 0x35, 0x5, 0x21, 0x5, 0x28, 0x5, 0x23, 0x5, 0xbf, 0x3, 0x72, 0xfd,
-    0xc0, 0xfd, 0xb7, 0xfd, 0xbb, 0xfd, 0xb9, 0xfd, 0xbb, 0xfd, 0xbb, 0xfd, 0xbc, 0xfd, 0xbc, 0xfd, 0xbd, 0xfd, 0xbd, 0xfd,
-    0xbd, 0xfd, 0xbe, 0xfd, 0xbe, 0xfd, 0xbf, 0xfd, 0xbf, 0xfd, 0xc0, 0xfd, 0xc0, 0xfd, 0xc1, 0xfd, 0xc1, 0xfd, 0xc2, 0xfd,
-    0xc2, 0xfd, 0xc2, 0xfd, 0x32, 0x1, 0x65, 0x6, 0x7d, 0x4, 0x51, 0x5, 0xf1, 0x4, 0x1a, 0x5, 0x6, 0x5, 0xe, 0x5,
-    0x9, 0x5, 0x54, 0x3, 0x53, 0xfd, 0xe2, 0xfd, 0xb9, 0xfd, 0xcb, 0xfd, 0xc4, 0xfd, 0xc8, 0xfd, 0xc6, 0xfd, 0xc8, 0xfd,
-    0xc8, 0xfd, 0xc9, 0xfd, 0xc9, 0xfd, 0xca, 0xfd, 0xca, 0xfd, 0xca, 0xfd, 0xcb, 0xfd, 0xcb, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd,
-    0xcd, 0xfd, 0xcd, 0xfd, 0xce, 0xfd, 0xce, 0xfd, 0x25, 0xfe, 0x7, 0x3, 0xb1, 0x5, 0xa4, 0x4, 0x19, 0x5, 0xe3, 0x4,
-    0xfa, 0x4, 0xee, 0x4, 0xf2, 0x4, 0xef, 0x4, 0x97, 0x1, 0x85, 0xfc, 0x61, 0xfe, 0x91, 0xfd, 0xef, 0xfd, 0xc6, 0xfd,
-    0xd8, 0xfd, 0xd1, 0xfd, 0xd5, 0xfd, 0xd3, 0xfd, 0xd5, 0xfd, 0xd5, 0xfd, 0xd6, 0xfd, 0xd6, 0xfd, 0xd7, 0xfd, 0xd7, 0xfd,
-    0xd8, 0xfd, 0xd8, 0xfd, 0xd8, 0xfd, 0xd9, 0xfd, 0xd9, 0xfd, 0xda, 0xfd, 0xda, 0xfd, 0x7f, 0xff, 0x4a, 0x5, 0xc0, 0x4,
-    0xe6, 0x4, 0xd5, 0x4, 0xdb, 0x4, 0xd7, 0x4, 0xd8, 0x4, 0xd5, 0x4, 0x2d, 0x4, 0xf1, 0xfd, 0xb6, 0xfd, 0xef, 0xfd,
-    0xd6, 0xfd, 0xe1, 0xfd, 0xde, 0xfd, 0xdf, 0xfd, 0xe0, 0xfd, 0xe0, 0xfd, 0xe1, 0xfd, 0xe1, 0xfd, 0xe1, 0xfd, 0xe2, 0xfd,
-    0xe2, 0xfd, 0xe3, 0xfd, 0xe3, 0xfd, 0xe4, 0xfd, 0xe4, 0xfd, 0xe5, 0xfd, 0xe5, 0xfd, 0xe5, 0xfd, 0xe6, 0xfd, 0x62, 0xfe,
-    0xca, 0x3, 0x2f, 0x5, 0x91, 0x4, 0xd5, 0x4, 0xb6, 0x4, 0xc2, 0x4, 0xbb, 0x4, 0xbd, 0x4, 0x69, 0x4, 0xc1, 0xff,
-    0x37, 0xfd, 0x37, 0xfe, 0xc7, 0xfd, 0xf9, 0xfd, 0xe3, 0xfd, 0xee, 0xfd, 0xea, 0xfd, 0xec, 0xfd, 0xec, 0xfd, 0xed, 0xfd,
-    0xed, 0xfd, 0xee, 0xfd, 0xee, 0xfd, 0xee, 0xfd, 0xef, 0xfd, 0xef, 0xfd, 0xf0, 0xfd, 0xf0, 0xfd, 0xf1, 0xfd, 0xf1, 0xfd,
-    0xf2, 0xfd, 0x42, 0xfe, 0xd7, 0x2, 0x56, 0x5, 0x5a, 0x4, 0xc8, 0x4, 0x96, 0x4, 0xab, 0x4, 0xa0, 0x4, 0xa3, 0x4,
-    0x65, 0x4, 0x31, 0x0, 0x24, 0xfd, 0x4f, 0xfe, 0xcc, 0xfd, 0x8, 0xfe, 0xed, 0xfd, 0xfb, 0xfd, 0xf5, 0xfd, 0xf8, 0xfd,
-    0xf8, 0xfd, 0xf8, 0xfd, 0xf9, 0xfd, 0xf9, 0xfd, 0xfa, 0xfd, 0xfa, 0xfd, 0xfb, 0xfd, 0xfb, 0xfd, 0xfb, 0xfd, 0xfc, 0xfd,
-    0xfc, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0x60, 0xfe, 0x34, 0x3, 0x18, 0x5, 0x51, 0x4, 0xa8, 0x4, 0x7f, 0x4, 0x90, 0x4,
-    0x87, 0x4, 0x8a, 0x4, 0x38, 0x4, 0xc4, 0xff, 0x56, 0xfd, 0x4b, 0xfe, 0xdf, 0xfd, 0x10, 0xfe, 0xfb, 0xfd, 0x5, 0xfe,
-    0x2, 0xfe, 0x3, 0xfe, 0x4, 0xfe, 0x4, 0xfe, 0x5, 0xfe, 0x5, 0xfe, 0x5, 0xfe, 0x6, 0xfe, 0x6, 0xfe, 0x7, 0xfe,
-    0x7, 0xfe, 0x8, 0xfe, 0x8, 0xfe, 0x8, 0xfe, 0x9, 0xfe, 0xf1, 0xfe, 0x8a, 0x4, 0x84, 0x4, 0x6c, 0x4, 0x76, 0x4,
-    0x70, 0x4, 0x71, 0x4, 0x6f, 0x4, 0x6f, 0x4, 0x87, 0x3, 0xf8, 0xfd, 0xfc, 0xfd, 0x13, 0xfe, 0x9, 0xfe, 0xe, 0xfe,
-    0xd, 0xfe, 0xe, 0xfe, 0xe, 0xfe, 0xf, 0xfe, 0xf, 0xfe, 0x10, 0xfe, 0x10, 0xfe, 0x11, 0xfe, 0x11, 0xfe, 0x12, 0xfe,
-    0x12, 0xfe, 0x12, 0xfe, 0x13, 0xfe, 0x13, 0xfe, 0x14, 0xfe, 0x14, 0xfe, 0x27, 0xfe, 0x70, 0x1, 0x5f, 0x5, 0xea, 0x3,
-    0x8b, 0x4, 0x42, 0x4, 0x62, 0x4, 0x52, 0x4, 0x58, 0x4, 0x2e, 0x4, 0x96, 0x0, 0x35, 0xfd, 0x7a, 0xfe, 0xeb, 0xfd,
-    0x2c, 0xfe, 0x10, 0xfe, 0x1d, 0xfe, 0x18, 0xfe, 0x1a, 0xfe, 0x1b, 0xfe, 0x1b, 0xfe, 0x1b, 0xfe, 0x1c, 0xfe, 0x1c, 0xfe,
-    0x1d, 0xfe, 0x1d, 0xfe, 0x1e, 0xfe, 0x1e, 0xfe, 0x1f, 0xfe, 0x1f, 0xfe, 0x1f, 0xfe, 0x20, 0xfe, 0xda, 0xff, 0xc8, 0x4,
-    0x15, 0x4, 0x54, 0x4, 0x37, 0x4, 0x42, 0x4, 0x3c, 0x4, 0x3d, 0x4, 0x3b, 0x4, 0xf0, 0x1, 0x53, 0xfd, 0x75, 0xfe,
-    0xfe, 0xfd, 0x34, 0xfe, 0x1c, 0xfe, 0x28, 0xfe, 0x23, 0xfe, 0x26, 0xfe, 0x26, 0xfe, 0x26, 0xfe, 0x27, 0xfe, 0x27, 0xfe,
-    0x28, 0xfe, 0x28, 0xfe, 0x28, 0xfe, 0x29, 0xfe, 0x29, 0xfe, 0x2a, 0xfe, 0x2a, 0xfe, 0x2b, 0xfe, 0x2b, 0xfe, 0x4b, 0xff,
-    0x62, 0x4, 0x23, 0x4, 0x29, 0x4, 0x26, 0x4, 0x26, 0x4, 0x24, 0x4, 0x24, 0x4, 0x22, 0x4, 0x2d, 0x2, 0x86, 0xfd,
-    0x6d, 0xfe, 0x13, 0xfe, 0x3b, 0xfe, 0x2a, 0xfe, 0x32, 0xfe, 0x2f, 0xfe, 0x31, 0xfe, 0x31, 0xfe, 0x32, 0xfe, 0x32, 0xfe,
-    0x32, 0xfe, 0x33, 0xfe, 0x33, 0xfe, 0x34, 0xfe, 0x34, 0xfe, 0x35, 0xfe, 0x35, 0xfe, 0x35, 0xfe, 0x36, 0xfe, 0x36, 0xfe,
-    0x97, 0xff, 0x6b, 0x4, 0xf7, 0x3, 0x18, 0x4, 0x9, 0x4, 0xe, 0x4, 0xb, 0x4, 0xb, 0x4, 0x9, 0x4, 0x94, 0x1,
-    0x4e, 0xfd, 0x9c, 0xfe, 0xe, 0xfe, 0x4d, 0xfe, 0x32, 0xfe, 0x3f, 0xfe, 0x3a, 0xfe, 0x3c, 0xfe, 0x3c, 0xfe, 0x3d, 0xfe,
-    0x3d, 0xfe, 0x3e, 0xfe, 0x3e, 0xfe, 0x3f, 0xfe, 0x3f, 0xfe, 0x3f, 0xfe, 0x40, 0xfe, 0x40, 0xfe, 0x41, 0xfe, 0x41, 0xfe,
-    0x42, 0xfe, 0xab, 0x0, 0xdd, 0x4, 0x96, 0x3, 0x20, 0x4, 0xe1, 0x3, 0xfc, 0x3, 0xee, 0x3, 0xf3, 0x3, 0xab, 0x3,
-    0xcd, 0xff, 0xb0, 0xfd, 0x86, 0xfe, 0x28, 0xfe, 0x53, 0xfe, 0x40, 0xfe, 0x49, 0xfe, 0x46, 0xfe, 0x47, 0xfe, 0x48, 0xfe,
-    0x48, 0xfe, 0x49, 0xfe, 0x49, 0xfe, 0x49, 0xfe, 0x4a, 0xfe, 0x4a, 0xfe, 0x4b, 0xfe, 0x4b, 0xfe, 0x4c, 0xfe, 0x4c, 0xfe,
-    0x4c, 0xfe, 0xb1, 0xfe, 0x15, 0x3, 0x36, 0x4, 0xb6, 0x3, 0xed, 0x3, 0xd3, 0x3, 0xde, 0x3, 0xd7, 0x3, 0xd9, 0x3,
-    0x47, 0x2, 0xd7, 0xfd, 0x77, 0xfe, 0x3e, 0xfe, 0x58, 0xfe, 0x4d, 0xfe, 0x52, 0xfe, 0x51, 0xfe, 0x52, 0xfe, 0x53, 0xfe,
-    0x53, 0xfe, 0x53, 0xfe, 0x54, 0xfe, 0x54, 0xfe, 0x55, 0xfe, 0x55, 0xfe, 0x56, 0xfe, 0x56, 0xfe, 0x56, 0xfe, 0x57, 0xfe,
-    0x57, 0xfe, 0x58, 0xfe, 0xe5, 0x0, 0xc2, 0x4, 0x57, 0x3, 0xf4, 0x3, 0xad, 0x3, 0xcb, 0x3, 0xbc, 0x3, 0xc2, 0x3,
-    0x5c, 0x3, 0x1e, 0xff, 0x5, 0xfe, 0x80, 0xfe, 0x4a, 0xfe, 0x64, 0xfe, 0x58, 0xfe, 0x5e, 0xfe, 0x5c, 0xfe, 0x5d, 0xfe,
-    0x5e, 0xfe, 0x5e, 0xfe, 0x5f, 0xfe, 0x5f, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x60, 0xfe, 0x61, 0xfe, 0x61, 0xfe, 0x62, 0xfe,
-    0x62, 0xfe, 0x63, 0xfe, 0x20, 0x0, 0x40, 0x4, 0x75, 0x3, 0xc4, 0x3, 0xa0, 0x3, 0xae, 0x3, 0xa7, 0x3, 0xa8, 0x3,
-    0x67, 0x3, 0xd0, 0xff, 0xdd, 0xfd, 0xa1, 0xfe, 0x4b, 0xfe, 0x73, 0xfe, 0x61, 0xfe, 0x6a, 0xfe, 0x67, 0xfe, 0x68, 0xfe,
-    0x69, 0xfe, 0x69, 0xfe, 0x6a, 0xfe, 0x6a, 0xfe, 0x6a, 0xfe, 0x6b, 0xfe, 0x6b, 0xfe, 0x6c, 0xfe, 0x6c, 0xfe, 0x6c, 0xfe,
-    0x6d, 0xfe, 0x6d, 0xfe, 0x20, 0x0, 0x25, 0x4, 0x5e, 0x3, 0xab, 0x3, 0x87, 0x3, 0x96, 0x3, 0x8e, 0x3, 0x90, 0x3,
-    0x41, 0x3, 0x7e, 0xff, 0x4, 0xfe, 0xa0, 0xfe, 0x5c, 0xfe, 0x7a, 0xfe, 0x6e, 0xfe, 0x74, 0xfe, 0x72, 0xfe, 0x73, 0xfe,
-    0x74, 0xfe, 0x74, 0xfe, 0x74, 0xfe, 0x75, 0xfe, 0x75, 0xfe, 0x76, 0xfe, 0x76, 0xfe, 0x77, 0xfe, 0x77, 0xfe, 0x77, 0xfe,
-    0x78, 0xfe, 0x78, 0xfe, 0x98, 0x0, 0x47, 0x4, 0x26, 0x3, 0xa0, 0x3, 0x69, 0x3, 0x80, 0x3, 0x74, 0x3, 0x78, 0x3,
-    0xfe, 0x2, 0x8a, 0xfe, 0x5e, 0xfe, 0x89, 0xfe, 0x76, 0xfe, 0x7f, 0xfe, 0x7c, 0xfe, 0x7d, 0xfe, 0x7e, 0xfe, 0x7e, 0xfe,
-    0x7e, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x80, 0xfe, 0x80, 0xfe, 0x81, 0xfe, 0x81, 0xfe, 0x81, 0xfe, 0x82, 0xfe, 0x82, 0xfe,
-    0x83, 0xfe, 0xbd, 0xfe, 0x12, 0x2, 0xe4, 0x3, 0x2b, 0x3, 0x7b, 0x3, 0x56, 0x3, 0x65, 0x3, 0x5e, 0x3, 0x5f, 0x3,
-    0x8c, 0x1, 0xe0, 0xfd, 0xc8, 0xfe, 0x68, 0xfe, 0x94, 0xfe, 0x81, 0xfe, 0x8a, 0xfe, 0x87, 0xfe, 0x88, 0xfe, 0x89, 0xfe,
-    0x89, 0xfe, 0x8a, 0xfe, 0x8a, 0xfe, 0x8b, 0xfe, 0x8b, 0xfe, 0x8b, 0xfe, 0x8c, 0xfe, 0x8c, 0xfe, 0x8d, 0xfe, 0x8d, 0xfe,
-    0x8d, 0xfe, 0xe5, 0xff, 0xb3, 0x3, 0x29, 0x3, 0x5a, 0x3, 0x43, 0x3, 0x4c, 0x3, 0x47, 0x3, 0x48, 0x3, 0xf1, 0x2,
-    0x3a, 0xff, 0x46, 0xfe, 0xb1, 0xfe, 0x82, 0xfe, 0x98, 0xfe, 0x8f, 0xfe, 0x94, 0xfe, 0x92, 0xfe, 0x93, 0xfe, 0x94, 0xfe,
-    0x94, 0xfe, 0x95, 0xfe, 0x95, 0xfe, 0x95, 0xfe, 0x96, 0xfe, 0x96, 0xfe, 0x97, 0xfe, 0x97, 0xfe, 0x97, 0xfe, 0x98, 0xfe,
-    0xf9, 0xfe, 0xdb, 0x2, 0x65, 0x3, 0x1c, 0x3, 0x3d, 0x3, 0x2d, 0x3, 0x33, 0x3, 0x2e, 0x3, 0x13, 0x3, 0x6f, 0x0,
-    0xf4, 0xfd, 0xe3, 0xfe, 0x7c, 0xfe, 0xaa, 0xfe, 0x96, 0xfe, 0xa0, 0xfe, 0x9c, 0xfe, 0x9e, 0xfe, 0x9e, 0xfe, 0x9f, 0xfe,
-    0x9f, 0xfe, 0x9f, 0xfe, 0xa0, 0xfe, 0xa0, 0xfe, 0xa1, 0xfe, 0xa1, 0xfe, 0xa2, 0xfe, 0xa2, 0xfe, 0xa2, 0xfe, 0xd9, 0xfe,
-    0xe6, 0x1, 0x91, 0x3, 0xe8, 0x2, 0x32, 0x3, 0x10, 0x3, 0x1e, 0x3, 0x16, 0x3, 0x18, 0x3, 0xff, 0x0, 0xd7, 0xfd,
-    0xff, 0xfe, 0x7e, 0xfe, 0xb8, 0xfe, 0x9f, 0xfe, 0xaa, 0xfe, 0xa7, 0xfe, 0xa8, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe,
-    0xaa, 0xfe, 0xaa, 0xfe, 0xab, 0xfe, 0xab, 0xfe, 0xac, 0xfe, 0xac, 0xfe, 0xac, 0xfe, 0xad, 0xfe, 0xe1, 0xfe, 0xd9, 0x1,
-    0x76, 0x3, 0xd2, 0x2, 0x19, 0x3, 0xf8, 0x2, 0x6, 0x3, 0xff, 0x2, 0xf3, 0x2, 0xb1, 0x0, 0xfd, 0xfd, 0xfd, 0xfe,
-    0x8f, 0xfe, 0xc0, 0xfe, 0xaa, 0xfe, 0xb5, 0xfe, 0xb1, 0xfe, 0xb3, 0xfe, 0xb3, 0xfe, 0xb4, 0xfe, 0xb4, 0xfe, 0xb4, 0xfe,
-    0xb5, 0xfe, 0xb5, 0xfe, 0xb6, 0xfe, 0xb6, 0xfe, 0xb6, 0xfe, 0xb7, 0xfe, 0xb7, 0xfe, 0xb8, 0xfe, 0xb8, 0xfe, 0xb8, 0xfe,
-    0xb9, 0xfe, 0xb9, 0xfe, 0xba, 0xfe, 0xba, 0xfe, 0xbb, 0xfe, 0xbb, 0xfe, 0xbb, 0xfe, 0xbc, 0xfe, 0xbc, 0xfe, 0xbd, 0xfe,
-    0x1a, 0x0, 0x59, 0x3, 0xb8, 0x2, 0xf6, 0x2, 0xd9, 0x2, 0xe4, 0x2, 0xde, 0x2, 0xdf, 0x2, 0xde, 0x2, 0xdd, 0x2,
-    0xdc, 0x2, 0xc3, 0x2, 0x64, 0x0, 0x2b, 0xfe, 0x2, 0xff, 0xa3, 0xfe, 0xce, 0xfe, 0xbc, 0xfe, 0xc5, 0xfe, 0xc2, 0xfe,
-    0xc3, 0xfe, 0xc4, 0xfe, 0xc4, 0xfe, 0xc4, 0xfe, 0xc5, 0xfe, 0xc5, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc7, 0xfe,
-    0xc7, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc9, 0xfe, 0xc9, 0xfe, 0xca, 0xfe, 0xca, 0xfe, 0xca, 0xfe, 0xcb, 0xfe,
-    0xcb, 0xfe, 0xea, 0xff, 0x19, 0x3, 0xa5, 0x2, 0xce, 0x2, 0xba, 0x2, 0xc2, 0x2, 0xbd, 0x2, 0xbe, 0x2, 0xbc, 0x2,
-    0xbc, 0x2, 0xba, 0x2, 0xa2, 0x2, 0x5f, 0x0, 0x41, 0xfe, 0xd, 0xff, 0xb4, 0xfe, 0xdc, 0xfe, 0xcb, 0xfe, 0xd3, 0xfe,
-    0xd0, 0xfe, 0xd2, 0xfe, 0xd2, 0xfe, 0xd3, 0xfe, 0xd3, 0xfe, 0xd4, 0xfe, 0xd4, 0xfe, 0xd4, 0xfe, 0xd5, 0xfe, 0xd5, 0xfe,
-    0xd6, 0xfe, 0xd6, 0xfe, 0xd6, 0xfe, 0xd7, 0xfe, 0xd7, 0xfe, 0xd8, 0xfe, 0xd8, 0xfe, 0xd8, 0xfe, 0xd9, 0xfe, 0xd9, 0xfe,
-    0xda, 0xfe, 0xda, 0xfe, 0xa1, 0x0, 0x51, 0x3, 0x54, 0x2, 0xc1, 0x2, 0x90, 0x2, 0xa5, 0x2, 0x9a, 0x2, 0x9d, 0x2,
-    0x9b, 0x2, 0x9a, 0x2, 0x99, 0x2, 0x3f, 0x2, 0xe9, 0xfe, 0xc8, 0xfe, 0xe8, 0xfe, 0xda, 0xfe, 0xe1, 0xfe, 0xde, 0xfe,
-    0xe0, 0xfe, 0xe0, 0xfe, 0xe1, 0xfe, 0xe1, 0xfe, 0xe1, 0xfe, 0xe2, 0xfe, 0xe2, 0xfe, 0xe3, 0xfe, 0xe3, 0xfe, 0xe3, 0xfe,
-    0xe4, 0xfe, 0xe4, 0xfe, 0xe5, 0xfe, 0xe5, 0xfe, 0xe5, 0xfe, 0xe6, 0xfe, 0xe6, 0xfe, 0xe7, 0xfe, 0xe7, 0xfe, 0xe7, 0xfe,
-    0xe8, 0xfe, 0xe8, 0xfe, 0x6a, 0xff, 0x8c, 0x2, 0x89, 0x2, 0x7a, 0x2, 0x81, 0x2, 0x7c, 0x2, 0x7d, 0x2, 0x7b, 0x2,
-    0x7b, 0x2, 0x79, 0x2, 0x79, 0x2, 0x63, 0x2, 0x57, 0x0, 0x6b, 0xfe, 0x24, 0xff, 0xd4, 0xfe, 0xf8, 0xfe, 0xe9, 0xfe,
-    0xf0, 0xfe, 0xee, 0xfe, 0xef, 0xfe, 0xef, 0xfe, 0xf0, 0xfe, 0xf0, 0xfe, 0xf1, 0xfe, 0xf1, 0xfe, 0xf1, 0xfe, 0xf2, 0xfe,
-    0xf2, 0xfe, 0xf3, 0xfe, 0xf3, 0xfe, 0xf3, 0xfe, 0xf4, 0xfe, 0xf4, 0xfe, 0xf5, 0xfe, 0xf5, 0xfe, 0xf5, 0xfe, 0xf6, 0xfe,
-    0xf6, 0xfe, 0xf7, 0xfe, 0x3e, 0xff, 0x1d, 0x2, 0x84, 0x2, 0x4e, 0x2, 0x65, 0x2, 0x5a, 0x2, 0x5d, 0x2, 0x5b, 0x2,
-    0x5a, 0x2, 0x59, 0x2, 0x58, 0x2, 0x43, 0x2, 0x52, 0x0, 0x81, 0xfe, 0x2f, 0xff, 0xe4, 0xfe, 0x6, 0xff, 0xf7, 0xfe,
-    0xff, 0xfe, 0xfc, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0x0, 0xff, 0x0, 0xff,
-    0x1, 0xff, 0x1, 0xff, 0x1, 0xff, 0x2, 0xff, 0x2, 0xff, 0x3, 0xff, 0x3, 0xff, 0x3, 0xff, 0x4, 0xff, 0x4, 0xff,
-    0x5, 0xff, 0x5, 0xff, 0xa0, 0xff, 0x5e, 0x2, 0x3c, 0x2, 0x3f, 0x2, 0x3d, 0x2, 0x3c, 0x2, 0x3b, 0x2, 0x3b, 0x2,
-    0x39, 0x2, 0x39, 0x2, 0x37, 0x2, 0xfd, 0x1, 0x7c, 0xff, 0xd6, 0xfe, 0x20, 0xff, 0x0, 0xff, 0xe, 0xff, 0x9, 0xff,
-    0xb, 0xff, 0xb, 0xff, 0xc, 0xff, 0xc, 0xff, 0xd, 0xff, 0xd, 0xff, 0xd, 0xff, 0xe, 0xff, 0xe, 0xff, 0xf, 0xff,
-    0xf, 0xff, 0xf, 0xff, 0x10, 0xff, 0x10, 0xff, 0x10, 0xff, 0x11, 0xff, 0x11, 0xff, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff,
-    0x13, 0xff, 0x25, 0xff, 0xe7, 0x0, 0x8e, 0x2, 0xee, 0x1, 0x33, 0x2, 0x13, 0x2, 0x20, 0x2, 0x19, 0x2, 0x1a, 0x2,
-    0x19, 0x2, 0x18, 0x2, 0x17, 0x2, 0xd1, 0x0, 0x9e, 0xfe, 0x4a, 0xff, 0x1, 0xff, 0x22, 0xff, 0x14, 0xff, 0x1b, 0xff,
-    0x18, 0xff, 0x1a, 0xff, 0x1a, 0xff, 0x1a, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1d, 0xff,
-    0x1d, 0xff, 0x1e, 0xff, 0x1e, 0xff, 0x1e, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x20, 0xff, 0x20, 0xff, 0x20, 0xff, 0x21, 0xff,
-    0x21, 0xff, 0x58, 0x0, 0x73, 0x2, 0xce, 0x1, 0x13, 0x2, 0xf3, 0x1, 0x0, 0x2, 0xf9, 0x1, 0xfb, 0x1, 0xf9, 0x1,
-    0xf8, 0x1, 0xf7, 0x1, 0xe8, 0x0, 0xc4, 0xfe, 0x4c, 0xff, 0x15, 0xff, 0x2d, 0xff, 0x23, 0xff, 0x28, 0xff, 0x26, 0xff,
-    0x28, 0xff, 0x28, 0xff, 0x28, 0xff, 0x29, 0xff, 0x29, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0x2b, 0xff, 0x2b, 0xff,
-    0x2c, 0xff, 0x2c, 0xff, 0x2c, 0xff, 0x2d, 0xff, 0x2d, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2f, 0xff, 0x36, 0xff,
-    0x9f, 0x0, 0x4f, 0x2, 0xae, 0x1, 0xf3, 0x1, 0xd4, 0x1, 0xe0, 0x1, 0xd9, 0x1, 0xdb, 0x1, 0xd9, 0x1, 0xd9, 0x1,
-    0xcf, 0x1, 0x6d, 0x0, 0xc5, 0xfe, 0x63, 0xff, 0x1f, 0xff, 0x3d, 0xff, 0x30, 0xff, 0x37, 0xff, 0x34, 0xff, 0x36, 0xff,
-    0x36, 0xff, 0x36, 0xff, 0x37, 0xff, 0x37, 0xff, 0x38, 0xff, 0x38, 0xff, 0x38, 0xff, 0x39, 0xff, 0x39, 0xff, 0x3a, 0xff,
-    0x3a, 0xff, 0x3a, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3d, 0xff, 0x79, 0xff, 0xb9, 0x1,
-    0xce, 0x1, 0xb8, 0x1, 0xc1, 0x1, 0xbc, 0x1, 0xbd, 0x1, 0xbb, 0x1, 0xba, 0x1, 0xba, 0x1, 0xb8, 0x1, 0x5f, 0x1,
-    0x39, 0xff, 0x3a, 0xff, 0x44, 0xff, 0x40, 0xff, 0x42, 0xff, 0x42, 0xff, 0x43, 0xff, 0x43, 0xff, 0x44, 0xff, 0x44, 0xff,
-    0x44, 0xff, 0x45, 0xff, 0x45, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46, 0xff, 0x47, 0xff, 0x47, 0xff, 0x47, 0xff, 0x48, 0xff,
-    0x48, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x60, 0xff, 0xd8, 0x0, 0xe9, 0x1, 0x80, 0x1,
-    0xad, 0x1, 0x98, 0x1, 0xa0, 0x1, 0x9b, 0x1, 0x9c, 0x1, 0x9a, 0x1, 0x9a, 0x1, 0x6f, 0x1, 0xa0, 0xff, 0x2a, 0xff,
-    0x5f, 0xff, 0x47, 0xff, 0x53, 0xff, 0x4e, 0xff, 0x51, 0xff, 0x51, 0xff, 0x51, 0xff, 0x52, 0xff, 0x52, 0xff, 0x52, 0xff,
-    0x53, 0xff, 0x53, 0xff, 0x53, 0xff, 0x54, 0xff, 0x54, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x56, 0xff, 0x56, 0xff,
-    0x57, 0xff, 0x57, 0xff, 0x57, 0xff, 0x58, 0xff, 0x6b, 0xff, 0xc8, 0x0, 0xc5, 0x1, 0x64, 0x1, 0x8d, 0x1, 0x79, 0x1,
-    0x81, 0x1, 0x7c, 0x1, 0x7d, 0x1, 0x7b, 0x1, 0x7b, 0x1, 0x4d, 0x1, 0x85, 0xff, 0x45, 0xff, 0x67, 0xff, 0x58, 0xff,
-    0x5f, 0xff, 0x5d, 0xff, 0x5e, 0xff, 0x5e, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x60, 0xff, 0x60, 0xff, 0x61, 0xff,
-    0x61, 0xff, 0x61, 0xff, 0x62, 0xff, 0x62, 0xff, 0x63, 0xff, 0x63, 0xff, 0x63, 0xff, 0x64, 0xff, 0x64, 0xff, 0x64, 0xff,
-    0x65, 0xff, 0x65, 0xff, 0x95, 0xff, 0x5e, 0x1, 0x6e, 0x1, 0x5c, 0x1, 0x63, 0x1, 0x5f, 0x1, 0x60, 0x1, 0x5e, 0x1,
-    0x5d, 0x1, 0x5d, 0x1, 0x5b, 0x1, 0xb7, 0x0, 0x32, 0xff, 0x7e, 0xff, 0x61, 0xff, 0x6e, 0xff, 0x69, 0xff, 0x6b, 0xff,
-    0x6c, 0xff, 0x6c, 0xff, 0x6c, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6f, 0xff, 0x6f, 0xff,
-    0x6f, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x71, 0xff, 0x71, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x78, 0xff,
-    0x6c, 0x0, 0x8f, 0x1, 0x23, 0x1, 0x51, 0x1, 0x3b, 0x1, 0x44, 0x1, 0x3f, 0x1, 0x40, 0x1, 0x3e, 0x1, 0x3d, 0x1,
-    0x12, 0x1, 0x7c, 0xff, 0x6c, 0xff, 0x7b, 0xff, 0x76, 0xff, 0x78, 0xff, 0x78, 0xff, 0x79, 0xff, 0x79, 0xff, 0x79, 0xff,
-    0x7a, 0xff, 0x7a, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7b, 0xff, 0x7c, 0xff, 0x7c, 0xff, 0x7c, 0xff, 0x7d, 0xff, 0x7d, 0xff,
-    0x7e, 0xff, 0x7e, 0xff, 0x7e, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0x80, 0xff, 0x32, 0x0, 0x69, 0x1, 0x9, 0x1,
-    0x31, 0x1, 0x1e, 0x1, 0x25, 0x1, 0x21, 0x1, 0x22, 0x1, 0x20, 0x1, 0x1f, 0x1, 0xfc, 0x0, 0xa3, 0xff, 0x72, 0xff,
-    0x8c, 0xff, 0x81, 0xff, 0x86, 0xff, 0x85, 0xff, 0x86, 0xff, 0x86, 0xff, 0x87, 0xff, 0x87, 0xff, 0x87, 0xff, 0x88, 0xff,
-    0x88, 0xff, 0x89, 0xff, 0x89, 0xff, 0x89, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8a, 0xff, 0x8b, 0xff, 0x8b, 0xff, 0x8b, 0xff,
-    0x8c, 0xff, 0x8c, 0xff, 0x8d, 0xff, 0x91, 0xff, 0x57, 0x0, 0x45, 0x1, 0xec, 0x0, 0x12, 0x1, 0x0, 0x1, 0x7, 0x1,
-    0x3, 0x1, 0x3, 0x1, 0x1, 0x1, 0x2, 0x1, 0xbb, 0x0, 0x83, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff,
-    0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x94, 0xff, 0x94, 0xff, 0x95, 0xff, 0x95, 0xff, 0x95, 0xff, 0x96, 0xff, 0x96, 0xff,
-    0x96, 0xff, 0x97, 0xff, 0x97, 0xff, 0x98, 0xff, 0x98, 0xff, 0x98, 0xff, 0x99, 0xff, 0x99, 0xff, 0x99, 0xff, 0x9a, 0xff,
-    0xb5, 0xff, 0xd0, 0x0, 0xf8, 0x0, 0xe2, 0x0, 0xeb, 0x0, 0xe6, 0x0, 0xe7, 0x0, 0xe5, 0x0, 0xe4, 0x0, 0xe4, 0x0,
-    0xde, 0x0, 0x35, 0x0, 0x69, 0xff, 0xb5, 0xff, 0x95, 0xff, 0xa3, 0xff, 0x9d, 0xff, 0xa1, 0xff, 0x9f, 0xff, 0xa1, 0xff,
-    0xa1, 0xff, 0xa1, 0xff, 0xa2, 0xff, 0xa2, 0xff, 0xa2, 0xff, 0xa3, 0xff, 0xa3, 0xff, 0xa4, 0xff, 0xa4, 0xff, 0xa4, 0xff,
-    0xa5, 0xff, 0xa5, 0xff, 0xa5, 0xff, 0xa6, 0xff, 0xa6, 0xff, 0xa7, 0xff, 0xaa, 0xff, 0x44, 0x0, 0xfc, 0x0, 0xb6, 0x0,
-    0xd4, 0x0, 0xc5, 0x0, 0xcb, 0x0, 0xc7, 0x0, 0xc8, 0x0, 0xc6, 0x0, 0xc5, 0x0, 0x68, 0x0, 0x8b, 0xff, 0xb6, 0xff,
-    0xa7, 0xff, 0xae, 0xff, 0xab, 0xff, 0xad, 0xff, 0xad, 0xff, 0xad, 0xff, 0xae, 0xff, 0xae, 0xff, 0xae, 0xff, 0xaf, 0xff,
-    0xaf, 0xff, 0xb0, 0xff, 0xb0, 0xff, 0xb0, 0xff, 0xb1, 0xff, 0xb1, 0xff, 0xb1, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0xb3, 0xff,
-    0xb3, 0xff, 0xb3, 0xff, 0xb4, 0xff, 0x29, 0x0, 0xdd, 0x0, 0x9a, 0x0, 0xb6, 0x0, 0xa8, 0x0, 0xad, 0x0, 0xaa, 0x0,
-    0xaa, 0x0, 0xa8, 0x0, 0xa9, 0x0, 0x57, 0x0, 0x9e, 0xff, 0xc1, 0xff, 0xb4, 0xff, 0xbb, 0xff, 0xb8, 0xff, 0xb9, 0xff,
-    0xba, 0xff, 0xba, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbc, 0xff, 0xbc, 0xff, 0xbc, 0xff, 0xbd, 0xff, 0xbd, 0xff,
-    0xbd, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc7, 0xff, 0x4c, 0x0,
-    0xaa, 0x0, 0x85, 0x0, 0x94, 0x0, 0x8d, 0x0, 0x8e, 0x0, 0x8d, 0x0, 0x8c, 0x0, 0x8b, 0x0, 0x88, 0x0, 0x20, 0x0,
-    0xa4, 0xff, 0xd3, 0xff, 0xbe, 0xff, 0xc8, 0xff, 0xc5, 0xff, 0xc6, 0xff, 0xc7, 0xff, 0xc7, 0xff, 0xc7, 0xff, 0xc8, 0xff,
-    0xc8, 0xff, 0xc8, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xc9, 0xff, 0xca, 0xff, 0xca, 0xff, 0xcb, 0xff, 0xcb, 0xff, 0xcb, 0xff,
-    0xcc, 0xff, 0xcc, 0xff, 0xcc, 0xff, 0xcd, 0xff, 0xec, 0xff, 0x7b, 0x0, 0x73, 0x0, 0x73, 0x0, 0x72, 0x0, 0x71, 0x0,
-    0x70, 0x0, 0x70, 0x0, 0x6e, 0x0, 0x6e, 0x0, 0x56, 0x0, 0xce, 0xff, 0xcf, 0xff, 0xd2, 0xff, 0xd2, 0xff, 0xd2, 0xff,
-    0xd3, 0xff, 0xd3, 0xff, 0xd3, 0xff, 0xd4, 0xff, 0xd4, 0xff, 0xd4, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xd6, 0xff, 0xd6, 0xff,
-    0xd6, 0xff, 0xd7, 0xff, 0xd7, 0xff, 0xd7, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd8, 0xff, 0xd9, 0xff, 0xd9, 0xff, 0xe0, 0xff,
-    0x3d, 0x0, 0x62, 0x0, 0x52, 0x0, 0x57, 0x0, 0x54, 0x0, 0x54, 0x0, 0x52, 0x0, 0x53, 0x0, 0x51, 0x0, 0x4a, 0x0,
-    0xf5, 0xff, 0xd4, 0xff, 0xe2, 0xff, 0xdc, 0xff, 0xe0, 0xff, 0xde, 0xff, 0xdf, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff,
-    0xe1, 0xff, 0xe1, 0xff, 0xe2, 0xff, 0xe2, 0xff, 0xe2, 0xff, 0xe3, 0xff, 0xe3, 0xff, 0xe3, 0xff, 0xe4, 0xff, 0xe4, 0xff,
-    0xe4, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xea, 0xff, 0x23, 0x0, 0x43, 0x0, 0x36, 0x0, 0x3a, 0x0, 0x37, 0x0,
-    0x38, 0x0, 0x36, 0x0, 0x35, 0x0, 0x35, 0x0, 0x2f, 0x0, 0xf8, 0xff, 0xe3, 0xff, 0xed, 0xff, 0xea, 0xff, 0xeb, 0xff,
-    0xeb, 0xff, 0xec, 0xff, 0xec, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xee, 0xff, 0xee, 0xff, 0xee, 0xff, 0xef, 0xff,
-    0xef, 0xff, 0xef, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf1, 0xff, 0xf2, 0xff, 0xf5, 0xff,
-    0x18, 0x0, 0x21, 0x0, 0x1b, 0x0, 0x1d, 0x0, 0x1b, 0x0, 0x1a, 0x0, 0x1a, 0x0, 0x18, 0x0, 0x18, 0x0, 0x14, 0x0,
-    0xf6, 0xff, 0xf6, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff,
-    0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff,
-    0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x2, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0 };
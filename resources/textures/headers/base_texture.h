@@ -1,5662 +0,0 @@
-////////////////////////////////////////////////////////////////////////////////////////
-//                                                                                    //
-// ImageAsCode exporter v1.0 - Image pixel data exported as an array of bytes         //
-//                                                                                    //
-// more info and bugs-report:  github.com/raysan5/raylib                              //
-// feedback and support:       ray[at]raylib.com                                      //
-//                                                                                    //
-// Copyright (c) 2018-2024 Ramon Santamaria (@raysan5)                                //
-//                                                                                    //
-////////////////////////////////////////////////////////////////////////////////////////
-
-// Image data information
-#define BASE_TEXTURE_WIDTH    336
-#define BASE_TEXTURE_HEIGHT   112
-#define BASE_TEXTURE_FORMAT   4          // raylib internal pixel format
-
-static unsigned char BASE_TEXTURE_DATA[112896] = { 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38,
-0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54,
-0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47,
-0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0x54, 0x38, 0x47, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b,
-0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd,
-0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4,
-0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0xe4, 0xfd, 0x8b, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c,
-0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf,
-0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59,
-0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6,
-0x59, 0x9c, 0xe6, 0x59, 0x9c, 0xe6, 0x59, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73,
-0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e, 0x73, 0xbf, 0x2e,
-0x73, 0xbf, 0x2e, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55,
-0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22,
-0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80,
-0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0x55, 0x80, 0x22, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8,
-0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7,
-0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c,
-0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xd7, 0xa8, 0x4c, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8,
-0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde,
-0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95,
-0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95, 0xde, 0xd8, 0x95 };
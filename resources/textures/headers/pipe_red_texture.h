@@ -1,3345 +0,0 @@
-////////////////////////////////////////////////////////////////////////////////////////
-//                                                                                    //
-// ImageAsCode exporter v1.0 - Image pixel data exported as an array of bytes         //
-//                                                                                    //
-// more info and bugs-report:  github.com/raysan5/raylib                              //
-// feedback and support:       ray[at]raylib.com                                      //
-//                                                                                    //
-// Copyright (c) 2018-2024 Ramon Santamaria (@raysan5)                                //
-//                                                                                    //
-////////////////////////////////////////////////////////////////////////////////////////
-
-// Image data information
-#define PIPE_RED_TEXTURE_WIDTH    52
-#define PIPE_RED_TEXTURE_HEIGHT   320
-#define PIPE_RED_TEXTURE_FORMAT   7          // raylib internal pixel format
-
-static unsigned char PIPE_RED_TEXTURE_DATA[66560] = { 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xf0, 0x92, 0x77, 0xff, 0xf0, 0x92, 0x77, 0xff, 0xf6,
-0x97, 0x7d, 0xff, 0xf6, 0x97, 0x7d, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xff, 0xa0, 0x88, 0xff, 0xff,
-0xa0, 0x88, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xfe,
-0x9f, 0x82, 0xff, 0xfe, 0x9f, 0x82, 0xff, 0xf7, 0x98, 0x7d, 0xff, 0xf7, 0x98, 0x7d, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xfd,
-0x9c, 0x82, 0xff, 0xf6, 0x97, 0x7d, 0xff, 0xf6, 0x97, 0x7d, 0xff, 0xf0, 0x92, 0x77, 0xff, 0xf0, 0x92, 0x77, 0xff, 0xe7,
-0x8e, 0x71, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe0, 0x8b, 0x6b, 0xff, 0xe0, 0x8b, 0x6b, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xd7,
-0x83, 0x63, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xc7, 0x7a, 0x55, 0xff, 0xc7, 0x7a, 0x55, 0xff, 0xbe,
-0x74, 0x4f, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xb6, 0x6f, 0x48, 0xff, 0xb6, 0x6f, 0x48, 0xff, 0xad, 0x69, 0x42, 0xff, 0xad,
-0x69, 0x42, 0xff, 0xa7, 0x65, 0x3b, 0xff, 0xa7, 0x65, 0x3b, 0xff, 0x9e, 0x5e, 0x35, 0xff, 0x9e, 0x5e, 0x35, 0xff, 0x99,
-0x5b, 0x30, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x93, 0x58, 0x2c, 0xff, 0x93, 0x58, 0x2c, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xf0,
-0x92, 0x77, 0xff, 0xf0, 0x92, 0x77, 0xff, 0xf6, 0x97, 0x7d, 0xff, 0xf6, 0x97, 0x7d, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xfd,
-0x9c, 0x82, 0xff, 0xff, 0xa0, 0x88, 0xff, 0xff, 0xa0, 0x88, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa2, 0x89, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xfe, 0x9f, 0x82, 0xff, 0xfe, 0x9f, 0x82, 0xff, 0xf7, 0x98, 0x7d, 0xff, 0xf7,
-0x98, 0x7d, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xf6, 0x97, 0x7d, 0xff, 0xf6, 0x97, 0x7d, 0xff, 0xf0,
-0x92, 0x77, 0xff, 0xf0, 0x92, 0x77, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe0, 0x8b, 0x6b, 0xff, 0xe0,
-0x8b, 0x6b, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xc7,
-0x7a, 0x55, 0xff, 0xc7, 0x7a, 0x55, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xb6, 0x6f, 0x48, 0xff, 0xb6,
-0x6f, 0x48, 0xff, 0xad, 0x69, 0x42, 0xff, 0xad, 0x69, 0x42, 0xff, 0xa7, 0x65, 0x3b, 0xff, 0xa7, 0x65, 0x3b, 0xff, 0x9e,
-0x5e, 0x35, 0xff, 0x9e, 0x5e, 0x35, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x93, 0x58, 0x2c, 0xff, 0x93,
-0x58, 0x2c, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xf7,
-0x98, 0x7d, 0xff, 0xf7, 0x98, 0x7d, 0xff, 0xfe, 0x9f, 0x82, 0xff, 0xfe, 0x9f, 0x82, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xff,
-0xa2, 0x89, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x88, 0xff, 0xff, 0xa0, 0x88, 0xff, 0xfd,
-0x9c, 0x82, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xf6, 0x97, 0x7d, 0xff, 0xf6, 0x97, 0x7d, 0xff, 0xf0, 0x92, 0x77, 0xff, 0xf0,
-0x92, 0x77, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe0, 0x8b, 0x6b, 0xff, 0xe0, 0x8b, 0x6b, 0xff, 0xd7,
-0x83, 0x63, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xc7, 0x7a, 0x55, 0xff, 0xc7,
-0x7a, 0x55, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xb6, 0x6f, 0x48, 0xff, 0xb6, 0x6f, 0x48, 0xff, 0xad,
-0x69, 0x42, 0xff, 0xad, 0x69, 0x42, 0xff, 0xa7, 0x65, 0x3b, 0xff, 0xa7, 0x65, 0x3b, 0xff, 0x9e, 0x5e, 0x35, 0xff, 0x9e,
-0x5e, 0x35, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x93, 0x58, 0x2c, 0xff, 0x93, 0x58, 0x2c, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xf7, 0x98, 0x7d, 0xff, 0xf7, 0x98, 0x7d, 0xff, 0xfe, 0x9f, 0x82, 0xff, 0xfe,
-0x9f, 0x82, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x88, 0xff, 0xff, 0xa0, 0x88, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xf6, 0x97, 0x7d, 0xff, 0xf6,
-0x97, 0x7d, 0xff, 0xf0, 0x92, 0x77, 0xff, 0xf0, 0x92, 0x77, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe0,
-0x8b, 0x6b, 0xff, 0xe0, 0x8b, 0x6b, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xcf,
-0x7f, 0x5c, 0xff, 0xc7, 0x7a, 0x55, 0xff, 0xc7, 0x7a, 0x55, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xb6,
-0x6f, 0x48, 0xff, 0xb6, 0x6f, 0x48, 0xff, 0xad, 0x69, 0x42, 0xff, 0xad, 0x69, 0x42, 0xff, 0xa7, 0x65, 0x3b, 0xff, 0xa7,
-0x65, 0x3b, 0xff, 0x9e, 0x5e, 0x35, 0xff, 0x9e, 0x5e, 0x35, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x93,
-0x58, 0x2c, 0xff, 0x93, 0x58, 0x2c, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xfd, 0x9d, 0x82, 0xff, 0xfd, 0x9d, 0x82, 0xff, 0xff, 0xa0, 0x88, 0xff, 0xff, 0xa0, 0x88, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa3, 0x8a, 0xff, 0xff, 0xa3, 0x8a, 0xff, 0xfe, 0x9d, 0x82, 0xff, 0xfe,
-0x9d, 0x82, 0xff, 0xf7, 0x9a, 0x7e, 0xff, 0xf7, 0x9a, 0x7e, 0xff, 0xf0, 0x93, 0x77, 0xff, 0xf0, 0x93, 0x77, 0xff, 0xe7,
-0x8e, 0x71, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe0, 0x8a, 0x6a, 0xff, 0xe0, 0x8a, 0x6a, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xd7,
-0x83, 0x63, 0xff, 0xd0, 0x80, 0x5d, 0xff, 0xd0, 0x80, 0x5d, 0xff, 0xc7, 0x79, 0x55, 0xff, 0xc7, 0x79, 0x55, 0xff, 0xbe,
-0x74, 0x4f, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xb6, 0x70, 0x48, 0xff, 0xb6, 0x70, 0x48, 0xff, 0xae, 0x69, 0x41, 0xff, 0xae,
-0x69, 0x41, 0xff, 0xa6, 0x62, 0x3a, 0xff, 0xa6, 0x62, 0x3a, 0xff, 0xa0, 0x61, 0x35, 0xff, 0xa0, 0x61, 0x35, 0xff, 0x98,
-0x59, 0x30, 0xff, 0x98, 0x59, 0x30, 0xff, 0x93, 0x58, 0x2c, 0xff, 0x93, 0x58, 0x2c, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xfd, 0x9d, 0x82, 0xff, 0xfd, 0x9d, 0x82, 0xff, 0xff,
-0xa0, 0x88, 0xff, 0xff, 0xa0, 0x88, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa3, 0x8a, 0xff, 0xff,
-0xa3, 0x8a, 0xff, 0xfe, 0x9d, 0x82, 0xff, 0xfe, 0x9d, 0x82, 0xff, 0xf7, 0x9a, 0x7e, 0xff, 0xf7, 0x9a, 0x7e, 0xff, 0xf0,
-0x93, 0x77, 0xff, 0xf0, 0x93, 0x77, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe0, 0x8a, 0x6a, 0xff, 0xe0,
-0x8a, 0x6a, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xd0, 0x80, 0x5d, 0xff, 0xd0, 0x80, 0x5d, 0xff, 0xc7,
-0x79, 0x55, 0xff, 0xc7, 0x79, 0x55, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xb6, 0x70, 0x48, 0xff, 0xb6,
-0x70, 0x48, 0xff, 0xae, 0x69, 0x41, 0xff, 0xae, 0x69, 0x41, 0xff, 0xa6, 0x62, 0x3a, 0xff, 0xa6, 0x62, 0x3a, 0xff, 0xa0,
-0x61, 0x35, 0xff, 0xa0, 0x61, 0x35, 0xff, 0x98, 0x59, 0x30, 0xff, 0x98, 0x59, 0x30, 0xff, 0x93, 0x58, 0x2c, 0xff, 0x93,
-0x58, 0x2c, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xf7, 0x9a, 0x7e, 0xff, 0xf7, 0x9a, 0x7e, 0xff, 0xfe,
-0x9f, 0x82, 0xff, 0xfe, 0x9f, 0x82, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf1, 0x95, 0x77, 0xff, 0xf1, 0x95, 0x77, 0xff, 0xe9, 0x90, 0x71, 0xff, 0xe9,
-0x90, 0x71, 0xff, 0xe0, 0x8b, 0x6b, 0xff, 0xe0, 0x8b, 0x6b, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xcf,
-0x7f, 0x5c, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xc7, 0x79, 0x55, 0xff, 0xc7, 0x79, 0x55, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xbe,
-0x74, 0x4f, 0xff, 0xb6, 0x6f, 0x48, 0xff, 0xb6, 0x6f, 0x48, 0xff, 0xae, 0x69, 0x41, 0xff, 0xae, 0x69, 0x41, 0xff, 0xa6,
-0x65, 0x3b, 0xff, 0xa6, 0x65, 0x3b, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x99,
-0x5b, 0x30, 0xff, 0x94, 0x59, 0x2c, 0xff, 0x94, 0x59, 0x2c, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xf7,
-0x9a, 0x7e, 0xff, 0xf7, 0x9a, 0x7e, 0xff, 0xfe, 0x9f, 0x82, 0xff, 0xfe, 0x9f, 0x82, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xff,
-0xa2, 0x89, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xfd,
-0x9c, 0x82, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf1, 0x95, 0x77, 0xff, 0xf1,
-0x95, 0x77, 0xff, 0xe9, 0x90, 0x71, 0xff, 0xe9, 0x90, 0x71, 0xff, 0xe0, 0x8b, 0x6b, 0xff, 0xe0, 0x8b, 0x6b, 0xff, 0xd7,
-0x83, 0x63, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xc7, 0x79, 0x55, 0xff, 0xc7,
-0x79, 0x55, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xb6, 0x6f, 0x48, 0xff, 0xb6, 0x6f, 0x48, 0xff, 0xae,
-0x69, 0x41, 0xff, 0xae, 0x69, 0x41, 0xff, 0xa6, 0x65, 0x3b, 0xff, 0xa6, 0x65, 0x3b, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x94, 0x59, 0x2c, 0xff, 0x94, 0x59, 0x2c, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xf6, 0x97, 0x7d, 0xff, 0xf6, 0x97, 0x7d, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xfd,
-0x9c, 0x82, 0xff, 0xff, 0xa0, 0x88, 0xff, 0xff, 0xa0, 0x88, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x88, 0xff, 0xff, 0xa0, 0x88, 0xff, 0xfe, 0x9c, 0x81, 0xff, 0xfe, 0x9c, 0x81, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf1, 0x95, 0x77, 0xff, 0xf1, 0x95, 0x77, 0xff, 0xe9, 0x90, 0x71, 0xff, 0xe9, 0x90, 0x71, 0xff, 0xe0,
-0x8a, 0x6b, 0xff, 0xe0, 0x8a, 0x6b, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xcf,
-0x7f, 0x5c, 0xff, 0xc7, 0x79, 0x55, 0xff, 0xc7, 0x79, 0x55, 0xff, 0xbd, 0x73, 0x4f, 0xff, 0xbd, 0x73, 0x4f, 0xff, 0xb6,
-0x6f, 0x48, 0xff, 0xb6, 0x6f, 0x48, 0xff, 0xae, 0x69, 0x41, 0xff, 0xae, 0x69, 0x41, 0xff, 0xa6, 0x62, 0x3a, 0xff, 0xa6,
-0x62, 0x3a, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x93,
-0x58, 0x2c, 0xff, 0x93, 0x58, 0x2c, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xf6, 0x97, 0x7d, 0xff, 0xf6,
-0x97, 0x7d, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xff, 0xa0, 0x88, 0xff, 0xff, 0xa0, 0x88, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x88, 0xff, 0xff, 0xa0, 0x88, 0xff, 0xfe, 0x9c, 0x81, 0xff, 0xfe,
-0x9c, 0x81, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf1, 0x95, 0x77, 0xff, 0xf1, 0x95, 0x77, 0xff, 0xe9,
-0x90, 0x71, 0xff, 0xe9, 0x90, 0x71, 0xff, 0xe0, 0x8a, 0x6b, 0xff, 0xe0, 0x8a, 0x6b, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xd7,
-0x83, 0x63, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xc7, 0x79, 0x55, 0xff, 0xc7, 0x79, 0x55, 0xff, 0xbd,
-0x73, 0x4f, 0xff, 0xbd, 0x73, 0x4f, 0xff, 0xb6, 0x6f, 0x48, 0xff, 0xb6, 0x6f, 0x48, 0xff, 0xae, 0x69, 0x41, 0xff, 0xae,
-0x69, 0x41, 0xff, 0xa6, 0x62, 0x3a, 0xff, 0xa6, 0x62, 0x3a, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x99,
-0x5b, 0x30, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x93, 0x58, 0x2c, 0xff, 0x93, 0x58, 0x2c, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xff,
-0xa0, 0x88, 0xff, 0xff, 0xa0, 0x88, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xff,
-0xa2, 0x89, 0xff, 0xfe, 0x9d, 0x82, 0xff, 0xfe, 0x9d, 0x82, 0xff, 0xf7, 0x98, 0x7d, 0xff, 0xf7, 0x98, 0x7d, 0xff, 0xf1,
-0x96, 0x78, 0xff, 0xf1, 0x96, 0x78, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe0, 0x8b, 0x6b, 0xff, 0xe0,
-0x8b, 0x6b, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xcf, 0x81, 0x5d, 0xff, 0xcf, 0x81, 0x5d, 0xff, 0xc7,
-0x79, 0x55, 0xff, 0xc7, 0x79, 0x55, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xb6, 0x70, 0x48, 0xff, 0xb6,
-0x70, 0x48, 0xff, 0xad, 0x69, 0x42, 0xff, 0xad, 0x69, 0x42, 0xff, 0xa7, 0x63, 0x3a, 0xff, 0xa7, 0x63, 0x3a, 0xff, 0x9e,
-0x61, 0x36, 0xff, 0x9e, 0x61, 0x36, 0xff, 0x98, 0x5b, 0x30, 0xff, 0x98, 0x5b, 0x30, 0xff, 0x93, 0x58, 0x2c, 0xff, 0x93,
-0x58, 0x2c, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xfd,
-0x9c, 0x82, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xff, 0xa0, 0x88, 0xff, 0xff, 0xa0, 0x88, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xfe, 0x9d, 0x82, 0xff, 0xfe, 0x9d, 0x82, 0xff, 0xf7,
-0x98, 0x7d, 0xff, 0xf7, 0x98, 0x7d, 0xff, 0xf1, 0x96, 0x78, 0xff, 0xf1, 0x96, 0x78, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe7,
-0x8e, 0x71, 0xff, 0xe0, 0x8b, 0x6b, 0xff, 0xe0, 0x8b, 0x6b, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xcf,
-0x81, 0x5d, 0xff, 0xcf, 0x81, 0x5d, 0xff, 0xc7, 0x79, 0x55, 0xff, 0xc7, 0x79, 0x55, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xbe,
-0x74, 0x4f, 0xff, 0xb6, 0x70, 0x48, 0xff, 0xb6, 0x70, 0x48, 0xff, 0xad, 0x69, 0x42, 0xff, 0xad, 0x69, 0x42, 0xff, 0xa7,
-0x63, 0x3a, 0xff, 0xa7, 0x63, 0x3a, 0xff, 0x9e, 0x61, 0x36, 0xff, 0x9e, 0x61, 0x36, 0xff, 0x98, 0x5b, 0x30, 0xff, 0x98,
-0x5b, 0x30, 0xff, 0x93, 0x58, 0x2c, 0xff, 0x93, 0x58, 0x2c, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xf7,
-0x98, 0x7d, 0xff, 0xf7, 0x98, 0x7d, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xff, 0x9f, 0x88, 0xff, 0xff,
-0x9f, 0x88, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x89, 0xff, 0xff, 0xa1, 0x89, 0xff, 0xfd,
-0x9b, 0x81, 0xff, 0xfd, 0x9b, 0x81, 0xff, 0xf7, 0x99, 0x7e, 0xff, 0xf7, 0x99, 0x7e, 0xff, 0xf1, 0x95, 0x77, 0xff, 0xf1,
-0x95, 0x77, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe0, 0x8b, 0x6b, 0xff, 0xe0, 0x8b, 0x6b, 0xff, 0xd7,
-0x83, 0x63, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xc7, 0x7a, 0x55, 0xff, 0xc7,
-0x7a, 0x55, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xb6, 0x70, 0x48, 0xff, 0xb6, 0x70, 0x48, 0xff, 0xae,
-0x6a, 0x42, 0xff, 0xae, 0x6a, 0x42, 0xff, 0xa6, 0x64, 0x3b, 0xff, 0xa6, 0x64, 0x3b, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x93, 0x58, 0x2c, 0xff, 0x93, 0x58, 0x2c, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xf7, 0x98, 0x7d, 0xff, 0xf7, 0x98, 0x7d, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xfd,
-0x9c, 0x82, 0xff, 0xff, 0x9f, 0x88, 0xff, 0xff, 0x9f, 0x88, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa1, 0x89, 0xff, 0xff, 0xa1, 0x89, 0xff, 0xfd, 0x9b, 0x81, 0xff, 0xfd, 0x9b, 0x81, 0xff, 0xf7, 0x99, 0x7e, 0xff, 0xf7,
-0x99, 0x7e, 0xff, 0xf1, 0x95, 0x77, 0xff, 0xf1, 0x95, 0x77, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe0,
-0x8b, 0x6b, 0xff, 0xe0, 0x8b, 0x6b, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xcf,
-0x7f, 0x5c, 0xff, 0xc7, 0x7a, 0x55, 0xff, 0xc7, 0x7a, 0x55, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xb6,
-0x70, 0x48, 0xff, 0xb6, 0x70, 0x48, 0xff, 0xae, 0x6a, 0x42, 0xff, 0xae, 0x6a, 0x42, 0xff, 0xa6, 0x64, 0x3b, 0xff, 0xa6,
-0x64, 0x3b, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x93,
-0x58, 0x2c, 0xff, 0x93, 0x58, 0x2c, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xfd, 0x9d, 0x82, 0xff, 0xfd, 0x9d, 0x82, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x89, 0xff, 0xff, 0xa1, 0x89, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xfd,
-0x9c, 0x82, 0xff, 0xf7, 0x98, 0x7d, 0xff, 0xf7, 0x98, 0x7d, 0xff, 0xf0, 0x95, 0x78, 0xff, 0xf0, 0x95, 0x78, 0xff, 0xe7,
-0x8e, 0x71, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe0, 0x8a, 0x6a, 0xff, 0xe0, 0x8a, 0x6a, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xd7,
-0x83, 0x63, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xc7, 0x79, 0x55, 0xff, 0xc7, 0x79, 0x55, 0xff, 0xbe,
-0x74, 0x4f, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xb6, 0x70, 0x48, 0xff, 0xb6, 0x70, 0x48, 0xff, 0xad, 0x69, 0x42, 0xff, 0xad,
-0x69, 0x42, 0xff, 0xa6, 0x64, 0x3b, 0xff, 0xa6, 0x64, 0x3b, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x99,
-0x5b, 0x30, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x94, 0x59, 0x2c, 0xff, 0x94, 0x59, 0x2c, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xfd, 0x9d, 0x82, 0xff, 0xfd, 0x9d, 0x82, 0xff, 0xff,
-0xa2, 0x89, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x89, 0xff, 0xff,
-0xa1, 0x89, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xf7, 0x98, 0x7d, 0xff, 0xf7, 0x98, 0x7d, 0xff, 0xf0,
-0x95, 0x78, 0xff, 0xf0, 0x95, 0x78, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe0, 0x8a, 0x6a, 0xff, 0xe0,
-0x8a, 0x6a, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xc7,
-0x79, 0x55, 0xff, 0xc7, 0x79, 0x55, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xb6, 0x70, 0x48, 0xff, 0xb6,
-0x70, 0x48, 0xff, 0xad, 0x69, 0x42, 0xff, 0xad, 0x69, 0x42, 0xff, 0xa6, 0x64, 0x3b, 0xff, 0xa6, 0x64, 0x3b, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x94, 0x59, 0x2c, 0xff, 0x94,
-0x59, 0x2c, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xf7, 0x99, 0x7e, 0xff, 0xf7, 0x99, 0x7e, 0xff, 0xfd,
-0x9c, 0x82, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xff, 0xa3, 0x8a, 0xff, 0xff, 0xa3, 0x8a, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xfd, 0x9d, 0x82, 0xff, 0xfd, 0x9d, 0x82, 0xff, 0xf7,
-0x99, 0x7e, 0xff, 0xf7, 0x99, 0x7e, 0xff, 0xf0, 0x93, 0x77, 0xff, 0xf0, 0x93, 0x77, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe7,
-0x8e, 0x71, 0xff, 0xe0, 0x8b, 0x6b, 0xff, 0xe0, 0x8b, 0x6b, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xcf,
-0x7f, 0x5c, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xc7, 0x7a, 0x55, 0xff, 0xc7, 0x7a, 0x55, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xbe,
-0x74, 0x4f, 0xff, 0xb5, 0x6f, 0x48, 0xff, 0xb5, 0x6f, 0x48, 0xff, 0xae, 0x6a, 0x42, 0xff, 0xae, 0x6a, 0x42, 0xff, 0xa7,
-0x66, 0x3b, 0xff, 0xa7, 0x66, 0x3b, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x99,
-0x5b, 0x30, 0xff, 0x94, 0x59, 0x2c, 0xff, 0x94, 0x59, 0x2c, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xf7,
-0x99, 0x7e, 0xff, 0xf7, 0x99, 0x7e, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xfd, 0x9c, 0x82, 0xff, 0xff, 0xa3, 0x8a, 0xff, 0xff,
-0xa3, 0x8a, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xff, 0xa2, 0x89, 0xff, 0xfd,
-0x9d, 0x82, 0xff, 0xfd, 0x9d, 0x82, 0xff, 0xf7, 0x99, 0x7e, 0xff, 0xf7, 0x99, 0x7e, 0xff, 0xf0, 0x93, 0x77, 0xff, 0xf0,
-0x93, 0x77, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe7, 0x8e, 0x71, 0xff, 0xe0, 0x8b, 0x6b, 0xff, 0xe0, 0x8b, 0x6b, 0xff, 0xd7,
-0x83, 0x63, 0xff, 0xd7, 0x83, 0x63, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xcf, 0x7f, 0x5c, 0xff, 0xc7, 0x7a, 0x55, 0xff, 0xc7,
-0x7a, 0x55, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xbe, 0x74, 0x4f, 0xff, 0xb5, 0x6f, 0x48, 0xff, 0xb5, 0x6f, 0x48, 0xff, 0xae,
-0x6a, 0x42, 0xff, 0xae, 0x6a, 0x42, 0xff, 0xa7, 0x66, 0x3b, 0xff, 0xa7, 0x66, 0x3b, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x99, 0x5b, 0x30, 0xff, 0x94, 0x59, 0x2c, 0xff, 0x94, 0x59, 0x2c, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa1, 0x86, 0xff, 0xff, 0xa1, 0x86, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab,
-0x66, 0x3e, 0xff, 0xab, 0x66, 0x3e, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x86, 0xff, 0xff, 0xa1, 0x86, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x66, 0x3e, 0xff, 0xab, 0x66, 0x3e, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6,
-0x99, 0x7c, 0xff, 0xff, 0xa1, 0x86, 0xff, 0xff, 0xa1, 0x86, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xff, 0xa1, 0x86, 0xff, 0xff, 0xa1, 0x86, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xdf,
-0x8b, 0x6a, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f,
-0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x99, 0x7c, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf,
-0x8a, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7,
-0x6f, 0x48, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6,
-0x97, 0x7c, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xab, 0x66, 0x3e, 0xff, 0xab, 0x66, 0x3e, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x66, 0x3e, 0xff, 0xab, 0x66, 0x3e, 0xff, 0x9f,
-0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf,
-0x8a, 0x6a, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7,
-0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0x9f, 0x84, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xdf,
-0x8b, 0x6a, 0xff, 0xec, 0x93, 0x74, 0xff, 0xec, 0x93, 0x74, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xec, 0x93, 0x74, 0xff, 0xec, 0x93, 0x74, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x74, 0xff, 0xec, 0x92, 0x74, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x74, 0xff, 0xec,
-0x92, 0x74, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x97, 0x59, 0x2e, 0xff, 0x97,
-0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x97, 0x59, 0x2e, 0xff, 0x97, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x6e, 0x48, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xdf,
-0x8b, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x97, 0x5b, 0x2e, 0xff, 0x97, 0x5b, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x97, 0x5b, 0x2e, 0xff, 0x97, 0x5b, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x6e, 0x48, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xac,
-0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac,
-0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6,
-0x97, 0x7c, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xb7,
-0x6e, 0x48, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xdf,
-0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96,
-0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7,
-0x6f, 0x48, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6,
-0x99, 0x7c, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac,
-0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xec, 0x93, 0x74, 0xff, 0xec, 0x93, 0x74, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96,
-0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x93, 0x74, 0xff, 0xec, 0x93, 0x74, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f,
-0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf7, 0x9b, 0x7d, 0xff, 0xf7,
-0x9b, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xf7, 0x9b, 0x7d, 0xff, 0xf7, 0x9b, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x86, 0xff, 0xff,
-0xa1, 0x86, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa1, 0x86, 0xff, 0xff, 0xa1, 0x86, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96,
-0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xdf,
-0x8b, 0x6a, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x97,
-0x5b, 0x2e, 0xff, 0x97, 0x5b, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x97, 0x5b, 0x2e, 0xff, 0x97, 0x5b, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6,
-0x97, 0x7c, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xdf,
-0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xb7,
-0x6e, 0x48, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac,
-0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6,
-0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac,
-0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x60, 0x37, 0xff, 0x9f, 0x60, 0x37, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x60, 0x37, 0xff, 0x9f,
-0x60, 0x37, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6,
-0x99, 0x7c, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac,
-0x6a, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde,
-0x8a, 0x6a, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xdf,
-0x8b, 0x6a, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac,
-0x6a, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x78, 0x53, 0xff, 0xc5, 0x78, 0x53, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x78, 0x53, 0xff, 0xc5,
-0x78, 0x53, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x92, 0x74, 0xff, 0xec, 0x92, 0x74, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x74, 0xff, 0xec, 0x92, 0x74, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf,
-0x8b, 0x6a, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf7, 0x9b, 0x7d, 0xff, 0xf7, 0x9b, 0x7d, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff,
-0x9f, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x97, 0x59, 0x2e, 0xff, 0x97, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf7, 0x9b, 0x7d, 0xff, 0xf7,
-0x9b, 0x7d, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x97, 0x59, 0x2e, 0xff, 0x97, 0x59, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf7, 0x98, 0x7c, 0xff, 0xf7,
-0x98, 0x7c, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xb8, 0x70, 0x48, 0xff, 0xb8,
-0x70, 0x48, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9e, 0x5e, 0x36, 0xff, 0x9e, 0x5e, 0x36, 0xff, 0x97,
-0x5b, 0x2e, 0xff, 0x97, 0x5b, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf7, 0x98, 0x7c, 0xff, 0xf7, 0x98, 0x7c, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5,
-0x79, 0x53, 0xff, 0xb8, 0x70, 0x48, 0xff, 0xb8, 0x70, 0x48, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9e,
-0x5e, 0x36, 0xff, 0x9e, 0x5e, 0x36, 0xff, 0x97, 0x5b, 0x2e, 0xff, 0x97, 0x5b, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x6f, 0x48, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xde, 0x89, 0x6a, 0xff, 0xde, 0x89, 0x6a, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6,
-0x99, 0x7c, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde, 0x89, 0x6a, 0xff, 0xde, 0x89, 0x6a, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf,
-0x8a, 0x6a, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xd1,
-0x81, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6,
-0x97, 0x7c, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xec, 0x92, 0x74, 0xff, 0xec, 0x92, 0x74, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xec,
-0x92, 0x74, 0xff, 0xec, 0x92, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5,
-0x79, 0x53, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x55, 0x29, 0xff, 0x8f,
-0x55, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf,
-0x8a, 0x6a, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x55, 0x29, 0xff, 0x8f, 0x55, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xc5, 0x78, 0x53, 0xff, 0xc5, 0x78, 0x53, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5, 0x78, 0x53, 0xff, 0xc5, 0x78, 0x53, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xb8,
-0x6f, 0x48, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0x9f, 0x84, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96,
-0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac,
-0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96,
-0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x55, 0x29, 0xff, 0x8f,
-0x55, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xc5,
-0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x55, 0x29, 0xff, 0x8f, 0x55, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5,
-0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xb7,
-0x6e, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc5,
-0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac,
-0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6,
-0x97, 0x7c, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xdf,
-0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96,
-0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf,
-0x8a, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7,
-0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7,
-0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x66, 0x3e, 0xff, 0xab,
-0x66, 0x3e, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6,
-0x97, 0x7c, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xab, 0x66, 0x3e, 0xff, 0xab, 0x66, 0x3e, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x99, 0x7c, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6,
-0x97, 0x7c, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5,
-0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6,
-0x97, 0x7c, 0xff, 0xec, 0x93, 0x74, 0xff, 0xec, 0x93, 0x74, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc5,
-0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xec, 0x93, 0x74, 0xff, 0xec, 0x93, 0x74, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7,
-0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xec, 0x92, 0x74, 0xff, 0xec, 0x92, 0x74, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x93, 0x74, 0xff, 0xec, 0x93, 0x74, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xec,
-0x92, 0x74, 0xff, 0xec, 0x92, 0x74, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x93, 0x74, 0xff, 0xec, 0x93, 0x74, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb8, 0x70, 0x48, 0xff, 0xb8,
-0x70, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xb8, 0x70, 0x48, 0xff, 0xb8, 0x70, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xdf,
-0x8b, 0x6a, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb8,
-0x6f, 0x48, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xf7, 0x9b, 0x7d, 0xff, 0xf7, 0x9b, 0x7d, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x97,
-0x59, 0x2e, 0xff, 0x97, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf7, 0x9b, 0x7d, 0xff, 0xf7, 0x9b, 0x7d, 0xff, 0xff,
-0x9f, 0x84, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x97, 0x59, 0x2e, 0xff, 0x97, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf7, 0x98, 0x7c, 0xff, 0xf7, 0x98, 0x7c, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xb8, 0x70, 0x48, 0xff, 0xb8, 0x70, 0x48, 0xff, 0xac,
-0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9e, 0x5e, 0x36, 0xff, 0x9e, 0x5e, 0x36, 0xff, 0x97, 0x5b, 0x2e, 0xff, 0x97,
-0x5b, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf7,
-0x98, 0x7c, 0xff, 0xf7, 0x98, 0x7c, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xb8,
-0x70, 0x48, 0xff, 0xb8, 0x70, 0x48, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9e, 0x5e, 0x36, 0xff, 0x9e,
-0x5e, 0x36, 0xff, 0x97, 0x5b, 0x2e, 0xff, 0x97, 0x5b, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xb8,
-0x6f, 0x48, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde,
-0x89, 0x6a, 0xff, 0xde, 0x89, 0x6a, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f,
-0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde, 0x89, 0x6a, 0xff, 0xde, 0x89, 0x6a, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xdf,
-0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7,
-0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde,
-0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xec, 0x92, 0x74, 0xff, 0xec, 0x92, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xec, 0x92, 0x74, 0xff, 0xec,
-0x92, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde,
-0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f,
-0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5,
-0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xdf,
-0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd1,
-0x81, 0x5f, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf6,
-0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xec, 0x92, 0x74, 0xff, 0xec,
-0x92, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde,
-0x8a, 0x6a, 0xff, 0xec, 0x92, 0x74, 0xff, 0xec, 0x92, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde,
-0x8a, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f,
-0x62, 0x37, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5,
-0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x55, 0x29, 0xff, 0x8f, 0x55, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf,
-0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac,
-0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x55, 0x29, 0xff, 0x8f, 0x55, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5, 0x78, 0x53, 0xff, 0xc5, 0x78, 0x53, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5, 0x78, 0x53, 0xff, 0xc5,
-0x78, 0x53, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x6f, 0x48, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96,
-0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde,
-0x8a, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f,
-0x62, 0x37, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac,
-0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5,
-0x79, 0x53, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x55, 0x29, 0xff, 0x8f, 0x55, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xd1,
-0x81, 0x5f, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x55, 0x29, 0xff, 0x8f, 0x55, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5,
-0x79, 0x53, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6,
-0x99, 0x7c, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7,
-0x6e, 0x48, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac,
-0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96,
-0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6,
-0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf,
-0x8a, 0x6a, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7,
-0x6f, 0x48, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf,
-0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7,
-0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab,
-0x66, 0x3e, 0xff, 0xab, 0x66, 0x3e, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x66, 0x3e, 0xff, 0xab, 0x66, 0x3e, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5,
-0x79, 0x53, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6,
-0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96,
-0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5,
-0x79, 0x53, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xec, 0x93, 0x74, 0xff, 0xec, 0x93, 0x74, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xec, 0x93, 0x74, 0xff, 0xec,
-0x93, 0x74, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xec, 0x92, 0x74, 0xff, 0xec,
-0x92, 0x74, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xec, 0x93, 0x74, 0xff, 0xec, 0x93, 0x74, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf,
-0x8a, 0x6a, 0xff, 0xec, 0x92, 0x74, 0xff, 0xec, 0x92, 0x74, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x93, 0x74, 0xff, 0xec, 0x93, 0x74, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb8,
-0x70, 0x48, 0xff, 0xb8, 0x70, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb8, 0x70, 0x48, 0xff, 0xb8, 0x70, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf,
-0x8b, 0x6a, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf7, 0x9b, 0x7d, 0xff, 0xf7, 0x9b, 0x7d, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff,
-0x9f, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x97, 0x59, 0x2e, 0xff, 0x97, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf7, 0x9b, 0x7d, 0xff, 0xf7,
-0x9b, 0x7d, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x97, 0x59, 0x2e, 0xff, 0x97, 0x59, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf7, 0x98, 0x7c, 0xff, 0xf7,
-0x98, 0x7c, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xb8, 0x70, 0x48, 0xff, 0xb8,
-0x70, 0x48, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9e, 0x5e, 0x36, 0xff, 0x9e, 0x5e, 0x36, 0xff, 0x97,
-0x5b, 0x2e, 0xff, 0x97, 0x5b, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf7, 0x98, 0x7c, 0xff, 0xf7, 0x98, 0x7c, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5,
-0x79, 0x53, 0xff, 0xb8, 0x70, 0x48, 0xff, 0xb8, 0x70, 0x48, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9e,
-0x5e, 0x36, 0xff, 0x9e, 0x5e, 0x36, 0xff, 0x97, 0x5b, 0x2e, 0xff, 0x97, 0x5b, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x6f, 0x48, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xde, 0x89, 0x6a, 0xff, 0xde, 0x89, 0x6a, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6,
-0x99, 0x7c, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde, 0x89, 0x6a, 0xff, 0xde, 0x89, 0x6a, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf,
-0x8a, 0x6a, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xd1,
-0x81, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6,
-0x97, 0x7c, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xec, 0x92, 0x74, 0xff, 0xec, 0x92, 0x74, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xec,
-0x92, 0x74, 0xff, 0xec, 0x92, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5,
-0x79, 0x53, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x8b, 0x6a, 0xff, 0xdf,
-0x8b, 0x6a, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb8,
-0x6f, 0x48, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf7, 0x9b, 0x7d, 0xff, 0xf7,
-0x9b, 0x7d, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x97, 0x59, 0x2e, 0xff, 0x97, 0x59, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xf7, 0x9b, 0x7d, 0xff, 0xf7, 0x9b, 0x7d, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x97,
-0x59, 0x2e, 0xff, 0x97, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf7, 0x98, 0x7c, 0xff, 0xf7, 0x98, 0x7c, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5,
-0x79, 0x53, 0xff, 0xb8, 0x70, 0x48, 0xff, 0xb8, 0x70, 0x48, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9e,
-0x5e, 0x36, 0xff, 0x9e, 0x5e, 0x36, 0xff, 0x97, 0x5b, 0x2e, 0xff, 0x97, 0x5b, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf7, 0x98, 0x7c, 0xff, 0xf7, 0x98, 0x7c, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xb8, 0x70, 0x48, 0xff, 0xb8, 0x70, 0x48, 0xff, 0xac,
-0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9e, 0x5e, 0x36, 0xff, 0x9e, 0x5e, 0x36, 0xff, 0x97, 0x5b, 0x2e, 0xff, 0x97,
-0x5b, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xb8,
-0x6f, 0x48, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd1,
-0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6,
-0x99, 0x7c, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde, 0x89, 0x6a, 0xff, 0xde, 0x89, 0x6a, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde,
-0x89, 0x6a, 0xff, 0xde, 0x89, 0x6a, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f,
-0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xd1,
-0x81, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6,
-0x97, 0x7c, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xec,
-0x92, 0x74, 0xff, 0xec, 0x92, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7,
-0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xde,
-0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xec, 0x92, 0x74, 0xff, 0xec, 0x92, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde,
-0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f,
-0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf,
-0x8a, 0x6a, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x55, 0x29, 0xff, 0x8f, 0x55, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xac,
-0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x55, 0x29, 0xff, 0x8f, 0x55, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5, 0x78, 0x53, 0xff, 0xc5, 0x78, 0x53, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7,
-0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc5,
-0x78, 0x53, 0xff, 0xc5, 0x78, 0x53, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96,
-0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xb8, 0x6f, 0x48, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0x9f, 0x84, 0xff, 0xff,
-0x9f, 0x84, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xde,
-0x8a, 0x6a, 0xff, 0xde, 0x8a, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f,
-0x62, 0x37, 0xff, 0x9f, 0x62, 0x37, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac,
-0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96,
-0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xc5,
-0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x55, 0x29, 0xff, 0x8f, 0x55, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xd1,
-0x80, 0x5f, 0xff, 0xd1, 0x80, 0x5f, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xd1,
-0x81, 0x5f, 0xff, 0xd1, 0x81, 0x5f, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x55, 0x29, 0xff, 0x8f, 0x55, 0x29, 0xff, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5,
-0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff,
-0x9e, 0x84, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6,
-0x99, 0x7c, 0xff, 0xf6, 0x99, 0x7c, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xff, 0x9e, 0x84, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54,
-0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54,
-0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4,
-0x79, 0x55, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xc4, 0x79, 0x55, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xd1, 0x7f, 0x5e, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4,
-0x77, 0x54, 0xff, 0xc4, 0x77, 0x54, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x54, 0x38, 0x47, 0xff, 0x54, 0x38, 0x47, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6,
-0x97, 0x7c, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xb7, 0x6e, 0x48, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xdf,
-0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc5, 0x79, 0x53, 0xff, 0xc5,
-0x79, 0x53, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0xac, 0x6a, 0x3f, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96,
-0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x99, 0x7d, 0xff, 0xf6, 0x99, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf,
-0x8a, 0x6a, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x96, 0x59, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7,
-0x6f, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf,
-0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4,
-0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xb7, 0x6f, 0x49, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xdf, 0x8a, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xc4, 0x79, 0x54, 0xff, 0xb8, 0x70, 0x49, 0xff, 0xb8,
-0x70, 0x49, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x9f, 0x5f, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab, 0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd1, 0x81, 0x5e, 0xff, 0xd1,
-0x81, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xeb,
-0x90, 0x73, 0xff, 0xeb, 0x90, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xab,
-0x67, 0x3f, 0xff, 0xab, 0x67, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5,
-0x7a, 0x55, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xde, 0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xeb,
-0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf,
-0x8a, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7,
-0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab, 0x69, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xc5, 0x7a, 0x55, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xde,
-0x89, 0x69, 0xff, 0xde, 0x89, 0x69, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xeb, 0x91, 0x73, 0xff, 0xf7, 0x9a, 0x7d, 0xff, 0xf7,
-0x9a, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xdf, 0x8a, 0x6a, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xab, 0x69, 0x3f, 0xff, 0xab,
-0x69, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2,
-0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec,
-0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6,
-0x97, 0x7c, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xab, 0x66, 0x3e, 0xff, 0xab, 0x66, 0x3e, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xb7, 0x6f, 0x48, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xd2, 0x80, 0x5e, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xec, 0x91, 0x73, 0xff, 0xec, 0x91, 0x73, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff,
-0xa1, 0x85, 0xff, 0xff, 0xa1, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xf6, 0x97, 0x7c, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xdf,
-0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xc4, 0x7a, 0x55, 0xff, 0xc4,
-0x7a, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xab, 0x66, 0x3e, 0xff, 0xab, 0x66, 0x3e, 0xff, 0x9f,
-0x61, 0x36, 0xff, 0x9f, 0x61, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff,
-0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb8,
-0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2,
-0x82, 0x5f, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xea, 0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff,
-0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec,
-0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde, 0x88, 0x69, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2,
-0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac,
-0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96,
-0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50,
-0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0, 0x50,
-0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xb8, 0x71, 0x49, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5,
-0x7b, 0x55, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xd2, 0x82, 0x5f, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xdf, 0x89, 0x69, 0xff, 0xea,
-0x91, 0x74, 0xff, 0xea, 0x91, 0x74, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff,
-0xa0, 0x85, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa7, 0x91, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xff, 0xa0, 0x85, 0xff, 0xf6,
-0x98, 0x7d, 0xff, 0xf6, 0x98, 0x7d, 0xff, 0xec, 0x92, 0x73, 0xff, 0xec, 0x92, 0x73, 0xff, 0xde, 0x88, 0x69, 0xff, 0xde,
-0x88, 0x69, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xd2, 0x81, 0x5e, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xc5, 0x7b, 0x55, 0xff, 0xb7,
-0x70, 0x49, 0xff, 0xb7, 0x70, 0x49, 0xff, 0xac, 0x68, 0x3f, 0xff, 0xac, 0x68, 0x3f, 0xff, 0x9e, 0x5f, 0x36, 0xff, 0x9e,
-0x5f, 0x36, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x96, 0x5a, 0x2e, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f, 0x56, 0x29, 0xff, 0x8f,
-0x56, 0x29, 0xff, 0x50, 0x43, 0x61, 0xff, 0x50, 0x43, 0x61, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0 };
@@ -0,0 +1,479 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "AssetCooker.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+#include "AssetIds.hpp"
+#include "JobSystem.hpp"
+#include "Logger.hpp"
+#include "TexturePreprocess.hpp"
+
+namespace {
+    // Bump this whenever the generated header layout or the filtering changes so every asset is cooked again
+    constexpr std::uint64_t cookerFormatVersion = 4;
+
+    constexpr std::uint64_t fnvOffsetBasis = 0xcbf29ce484222325ull;
+    constexpr std::uint64_t fnvPrime = 0x100000001b3ull;
+
+    std::uint64_t fnv1a(const unsigned char *data, const std::size_t size, std::uint64_t hash = fnvOffsetBasis) {
+        for (std::size_t i = 0; i < size; ++i) {
+            hash ^= data[i];
+            hash *= fnvPrime;
+        }
+        return hash;
+    }
+
+    // An empty header defines nothing, it never counts as cooked
+    bool hasCookedHeader(const std::filesystem::path &output) {
+        std::error_code error;
+        return std::filesystem::file_size(output, error) > 0 && !error;
+    }
+
+    // "textures/base.png" -> "BASE" + suffix
+    std::string symbolFor(const std::filesystem::path &source, const std::string &suffix) {
+        std::string symbol = source.stem().string() + suffix;
+        std::ranges::transform(symbol, symbol.begin(), [](const unsigned char c) {
+            return std::isalnum(c) ? static_cast<char>(std::toupper(c)) : '_';
+        });
+        return symbol;
+    }
+
+    void appendBanner(std::string &out, const std::string &source) {
+        out += "//\n";
+        out += "// Generated by flappybara-cook from " + source + ", do not edit.\n";
+        out += "//\n\n";
+    }
+
+    // Emit data as a C array, 20 bytes per line like raylib's exporters
+    void appendByteArray(std::string &out, const std::string &name, const unsigned char *data, const std::size_t size, const bool readOnly = false) {
+        static constexpr char hexDigits[] = "0123456789abcdef";
+
+        out += std::string(readOnly ? "static const unsigned char " : "static unsigned char ") + name + "[" + std::to_string(std::max<std::size_t>(size, 1)) + "] = { ";
+        if (size == 0) {
+            out += "0x0";
+        }
+
+        out.reserve(out.size() + size * 6 + size / 20 * 5 + 8);
+        for (std::size_t i = 0; i < size; ++i) {
+            if (i > 0) {
+                out += (i % 20 == 0) ? ",\n    " : ", ";
+            }
+            out += "0x";
+            if (data[i] >= 0x10) {
+                out += hexDigits[data[i] >> 4];
+            }
+            out += hexDigits[data[i] & 0x0f];
+        }
+        out += " };\n";
+    }
+
+    std::string imageHeader(const std::string &source, const std::string &symbol, const Image &image) {
+        const int mipmaps = std::max(image.mipmaps, 1);
+        const std::size_t size = TexturePreprocess::mipChainSize(image.width, image.height, image.format, mipmaps);
+
+        std::string out;
+        appendBanner(out, source);
+        out += "// Image data information\n";
+        out += "#define " + symbol + "_WIDTH    " + std::to_string(image.width) + "\n";
+        out += "#define " + symbol + "_HEIGHT   " + std::to_string(image.height) + "\n";
+        out += "#define " + symbol + "_FORMAT   " + std::to_string(image.format) + "          // raylib internal pixel format\n";
+        out += "#define " + symbol + "_MIPMAPS  " + std::to_string(mipmaps) + "          // Levels stored back to back in _DATA, alpha is premultiplied\n\n";
+        appendByteArray(out, symbol + "_DATA", static_cast<const unsigned char *>(image.data), size);
+        return out;
+    }
+
+    std::string waveHeader(const std::string &source, const std::string &symbol, const Wave &wave) {
+        const std::size_t size = static_cast<std::size_t>(wave.frameCount) * wave.channels * wave.sampleSize / 8;
+
+        std::string out;
+        appendBanner(out, source);
+        out += "// Wave data information\n";
+        out += "#define " + symbol + "_FRAME_COUNT      " + std::to_string(wave.frameCount) + "\n";
+        out += "#define " + symbol + "_SAMPLE_RATE      " + std::to_string(wave.sampleRate) + "\n";
+        out += "#define " + symbol + "_SAMPLE_SIZE      " + std::to_string(wave.sampleSize) + "\n";
+        out += "#define " + symbol + "_CHANNELS         " + std::to_string(wave.channels) + "\n\n";
+        appendByteArray(out, symbol + "_DATA", static_cast<const unsigned char *>(wave.data), size);
+        return out;
+    }
+
+    // Read-only so the compressed track lands in file-backed pages the streamer can hand back to the OS
+    std::string musicHeader(const std::string &source, const std::string &symbol, const std::vector<unsigned char> &qoa,
+                            const unsigned int sampleRate, const unsigned int channels) {
+        std::string out;
+        appendBanner(out, source);
+        out += "// QOA stream information\n";
+        out += "#define " + symbol + "_SIZE             " + std::to_string(qoa.size()) + "\n";
+        out += "#define " + symbol + "_SAMPLE_RATE      " + std::to_string(sampleRate) + "\n";
+        out += "#define " + symbol + "_CHANNELS         " + std::to_string(channels) + "\n\n";
+        appendByteArray(out, symbol + "_DATA", qoa.data(), qoa.size(), true);
+        return out;
+    }
+
+    std::string maskHeader(const std::string &source, const std::string &symbol, const Collision::Mask &mask) {
+        std::string out;
+        appendBanner(out, source);
+        out += "// Collision mask information, row y has bit x set where cell (x, y) is solid, see Collision::Mask\n";
+        out += "#define " + symbol + "_SIZE             " + std::to_string(Collision::maskSize) + "\n\n";
+        out += "static const unsigned long long " + symbol + "_ROWS[" + std::to_string(Collision::maskSize) + "] = {";
+
+        char word[24];
+        for (std::size_t row = 0; row < mask.rows.size(); ++row) {
+            std::snprintf(word, sizeof(word), "0x%016llxull", static_cast<unsigned long long>(mask.rows[row]));
+            out += (row % 4 == 0) ? "\n    " : " ";
+            out += word;
+            out += ",";
+        }
+        out += "\n};\n";
+        return out;
+    }
+}
+
+AssetCooker::AssetCooker(std::filesystem::path resourcesDir, std::filesystem::path outputDir, std::filesystem::path manifestPath)
+    : resourcesDir(std::move(resourcesDir)), outputDir(std::move(outputDir)), manifestPath(std::move(manifestPath)) {
+    loadManifest();
+}
+
+int AssetCooker::cook(const unsigned int threadCount) {
+    Logger& logger = Logger::getInstance();
+
+    std::vector<CookJob> jobs = collectJobs();
+    std::atomic<int> cooked = 0;
+    std::atomic<int> upToDate = 0;
+    std::atomic<int> failed = 0;
+
+    {
+        JobSystem pool(std::min(threadCount, static_cast<unsigned int>(jobs.size())));
+        pool.parallelFor(jobs.size(), 1, [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                switch (cookJob(jobs[i])) {
+                    case CookResult::Cooked: ++cooked; break;
+                    case CookResult::UpToDate: ++upToDate; break;
+                    case CookResult::Failed: ++failed; break;
+                }
+            }
+        });
+    }
+
+    saveManifest();
+
+    logger.log(LogLevel::INFO, "Cooked " + std::to_string(cooked) + " assets, " + std::to_string(upToDate) +
+        " up to date, " + std::to_string(failed) + " failed.");
+
+    return failed;
+}
+
+std::vector<AssetCooker::CookJob> AssetCooker::collectJobs() const {
+    std::vector<CookJob> jobs;
+
+    const auto addJob = [&](const AssetKind kind, const std::string_view assetPath) {
+        const std::filesystem::path relative(assetPath);
+        const char *suffix = "_AUDIO";
+        const char *headerSuffix = "_audio.h";
+        if (kind == AssetKind::Texture || kind == AssetKind::Atlas) {
+            suffix = "_TEXTURE";
+            headerSuffix = "_texture.h";
+        } else if (kind == AssetKind::Music) {
+            suffix = "_MUSIC";
+            headerSuffix = "_music.h";
+        } else if (kind == AssetKind::CollisionMask) {
+            suffix = "_MASK";
+            headerSuffix = "_mask.h";
+        }
+
+        CookJob job{
+            .kind = kind,
+            // The mask is cooked from the same source as the texture, so it needs its own manifest entry
+            .name = relative.generic_string() + (kind == AssetKind::CollisionMask ? ":mask" : ""),
+            .source = resourcesDir / relative,
+            .output = outputDir / relative.parent_path() / (relative.stem().string() + headerSuffix),
+            .symbol = symbolFor(relative, suffix),
+            .parts = {},
+        };
+        jobs.push_back(std::move(job));
+    };
+
+    for (std::size_t i = 0; i < Assets::textures.size(); ++i) {
+        if (static_cast<TextureId>(i) != TextureId::ParallaxAtlas) {
+            addJob(AssetKind::Texture, Assets::textures[i].path);
+            continue;
+        }
+
+        addJob(AssetKind::Atlas, Assets::textures[i].path);
+        for (const AtlasPart &part : Assets::parallaxAtlasParts) {
+            jobs.back().parts.push_back(resourcesDir / Assets::textures[Assets::index(part.id)].path);
+        }
+    }
+    for (const AssetInfo &asset : Assets::sounds) {
+        addJob(AssetKind::Sound, asset.path);
+    }
+    addJob(AssetKind::Music, Assets::themeSong.path);
+    for (const TextureId id : Assets::collisionMasks) {
+        addJob(AssetKind::CollisionMask, Assets::textures[Assets::index(id)].path);
+    }
+
+    return jobs;
+}
+
+AssetCooker::CookResult AssetCooker::cookJob(CookJob &job) {
+    Logger& logger = Logger::getInstance();
+
+    bool readable = false;
+    job.inputHash = hashSources(job, readable);
+
+    if (!readable) {
+        if (hasCookedHeader(job.output)) {
+            logger.log(LogLevel::WARNING, "Source missing, keeping existing header: " + job.source.string());
+            return CookResult::UpToDate;
+        }
+
+        // Still emit a header so the game builds, the runtime skips sounds with no data. Every picture is on screen
+        // though (the night sky fades in over the day), so a missing one fails the cook instead of drawing nothing.
+        std::string placeholder;
+        switch (job.kind) {
+            case AssetKind::Texture:
+            case AssetKind::Atlas:
+                logger.log(LogLevel::ERROR, "Error: Source missing: " + job.source.string());
+                return CookResult::Failed;
+            case AssetKind::Sound: placeholder = waveHeader(job.name, job.symbol, Wave{}); break;
+            case AssetKind::Music: placeholder = musicHeader(job.name, job.symbol, {}, 0, 0); break;
+            // Solid, so the sprite still collides like its bounding box
+            case AssetKind::CollisionMask: placeholder = maskHeader(job.name, job.symbol, Collision::Mask::solid()); break;
+        }
+        logger.log(LogLevel::WARNING, "Source missing, writing empty placeholder: " + job.source.string());
+        return writeFileAtomically(job.output, placeholder) ? CookResult::Cooked : CookResult::Failed;
+    }
+
+    {
+        std::lock_guard lock(manifestMutex);
+        if (const auto it = manifest.find(job.name); it != manifest.end() && it->second == job.inputHash && hasCookedHeader(job.output)) {
+            return CookResult::UpToDate;
+        }
+    }
+
+    bool ok = false;
+    switch (job.kind) {
+        case AssetKind::Texture: ok = cookTexture(job); break;
+        case AssetKind::Sound: ok = cookSound(job); break;
+        case AssetKind::Music: ok = cookMusic(job); break;
+        case AssetKind::CollisionMask: ok = cookCollisionMask(job); break;
+        case AssetKind::Atlas: ok = cookAtlas(job); break;
+    }
+    if (!ok) {
+        logger.log(LogLevel::ERROR, "Error: Failed to cook " + job.source.string());
+        return CookResult::Failed;
+    }
+
+    std::lock_guard lock(manifestMutex);
+    manifest[job.name] = job.inputHash;
+    logger.log(LogLevel::INFO, "Cooked " + job.name + " -> " + job.output.string());
+    return CookResult::Cooked;
+}
+
+bool AssetCooker::cookTexture(const CookJob &job) {
+    Image image;
+    {
+        std::lock_guard lock(TexturePreprocess::decodeMutex());
+        image = LoadImage(job.source.string().c_str());
+    }
+    if (image.data == nullptr) {
+        return false;
+    }
+
+    // Premultiplying and filtering the mip chain here means the game only has to upload the levels
+    const Image cooked = TexturePreprocess::premultipliedMipChain(image);
+    UnloadImage(image);
+    if (cooked.data == nullptr) {
+        return false;
+    }
+
+    const std::string header = imageHeader(job.name, job.symbol, cooked);
+    UnloadImage(cooked);
+
+    return writeFileAtomically(job.output, header);
+}
+
+bool AssetCooker::cookSound(const CookJob &job) {
+    Wave wave;
+    {
+        std::lock_guard lock(TexturePreprocess::decodeMutex());
+        wave = LoadWave(job.source.string().c_str());
+    }
+    if (wave.data == nullptr) {
+        return false;
+    }
+
+    const std::string header = waveHeader(job.name, job.symbol, wave);
+    UnloadWave(wave);
+
+    return writeFileAtomically(job.output, header);
+}
+
+bool AssetCooker::cookMusic(const CookJob &job) {
+    const std::filesystem::path encoded = job.output.string() + ".qoa";
+    unsigned int sampleRate = 0;
+    unsigned int channels = 0;
+    bool exported = false;
+    {
+        std::lock_guard lock(TexturePreprocess::decodeMutex());
+        Wave wave = LoadWave(job.source.string().c_str());
+        if (wave.data == nullptr) {
+            return false;
+        }
+
+        // QOA only stores 16 bit samples
+        WaveFormat(&wave, static_cast<int>(wave.sampleRate), 16, static_cast<int>(wave.channels));
+        sampleRate = wave.sampleRate;
+        channels = wave.channels;
+        exported = ExportWave(wave, encoded.string().c_str());
+        UnloadWave(wave);
+    }
+    if (!exported) {
+        return false;
+    }
+
+    std::vector<unsigned char> qoa;
+    {
+        std::ifstream file(encoded, std::ios::binary);
+        qoa.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    std::error_code error;
+    std::filesystem::remove(encoded, error);
+
+    if (qoa.empty()) {
+        return false;
+    }
+
+    return writeFileAtomically(job.output, musicHeader(job.name, job.symbol, qoa, sampleRate, channels));
+}
+
+bool AssetCooker::cookCollisionMask(const CookJob &job) {
+    Image image;
+    {
+        std::lock_guard lock(TexturePreprocess::decodeMutex());
+        image = LoadImage(job.source.string().c_str());
+    }
+    if (image.data == nullptr) {
+        return false;
+    }
+
+    const Collision::Mask mask = TexturePreprocess::collisionMask(image);
+    UnloadImage(image);
+
+    return writeFileAtomically(job.output, maskHeader(job.name, job.symbol, mask));
+}
+
+bool AssetCooker::cookAtlas(const CookJob &job) {
+    std::vector<Image> parts;
+    for (const std::filesystem::path &path : job.parts) {
+        Image part;
+        {
+            std::lock_guard lock(TexturePreprocess::decodeMutex());
+            part = LoadImage(path.string().c_str());
+        }
+        if (part.data == nullptr) {
+            break;
+        }
+        parts.push_back(part);
+    }
+
+    Image atlas = parts.size() == job.parts.size() ? TexturePreprocess::parallaxAtlas(parts) : Image{};
+    for (const Image &part : parts) {
+        UnloadImage(part);
+    }
+    if (atlas.data == nullptr) {
+        UnloadImage(atlas);
+        return false;
+    }
+
+    const Image cooked = TexturePreprocess::premultipliedMipChain(atlas);
+    UnloadImage(atlas);
+    if (cooked.data == nullptr) {
+        return false;
+    }
+
+    const std::string header = imageHeader(job.name, job.symbol, cooked);
+    UnloadImage(cooked);
+
+    return writeFileAtomically(job.output, header);
+}
+
+void AssetCooker::loadManifest() {
+    std::ifstream file(manifestPath);
+    std::string name;
+    std::string hash;
+
+    // One "<relative source path> <hex hash>" pair per line
+    while (file >> name >> hash) {
+        manifest[name] = std::stoull(hash, nullptr, 16);
+    }
+}
+
+void AssetCooker::saveManifest() const {
+    std::ostringstream out;
+    for (const auto &[name, hash] : manifest) {
+        out << name << " " << std::hex << hash << std::dec << "\n";
+    }
+
+    if (!writeFileAtomically(manifestPath, out.str())) {
+        Logger::getInstance().log(LogLevel::ERROR, "Error: Failed to write cook manifest: " + manifestPath.string());
+    }
+}
+
+std::uint64_t AssetCooker::hashFile(const std::filesystem::path &path, bool &ok) {
+    std::ifstream file(path, std::ios::binary);
+    ok = file.is_open();
+
+    std::uint64_t hash = fnv1a(reinterpret_cast<const unsigned char *>(&cookerFormatVersion), sizeof(cookerFormatVersion));
+
+    char buffer[64 * 1024];
+    while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+        hash = fnv1a(reinterpret_cast<const unsigned char *>(buffer), static_cast<std::size_t>(file.gcount()), hash);
+    }
+
+    return hash;
+}
+
+std::uint64_t AssetCooker::hashSources(const CookJob &job, bool &ok) {
+    if (job.parts.empty()) {
+        return hashFile(job.source, ok);
+    }
+
+    // The layout is an input too, resizing a part has to cook the atlas again
+    ok = true;
+    std::uint64_t hash = fnv1a(reinterpret_cast<const unsigned char *>(&Assets::parallaxAtlasWidth), sizeof(int));
+    for (std::size_t i = 0; i < job.parts.size(); ++i) {
+        bool readable = false;
+        const std::uint64_t partHash = hashFile(job.parts[i], readable);
+        ok = ok && readable;
+        hash = fnv1a(reinterpret_cast<const unsigned char *>(&partHash), sizeof(partHash), hash);
+        hash = fnv1a(reinterpret_cast<const unsigned char *>(&Assets::parallaxAtlasParts[i].height), sizeof(int), hash);
+    }
+    return hash;
+}
+
+bool AssetCooker::writeFileAtomically(const std::filesystem::path &path, const std::string &contents) {
+    std::error_code error;
+    std::filesystem::create_directories(path.parent_path(), error);
+
+    // Write next to the target and rename, so an interrupted build never leaves a truncated header behind
+    const std::filesystem::path temporary = path.string() + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file.write(contents.data(), static_cast<std::streamsize>(contents.size()))) {
+            return false;
+        }
+    }
+
+    std::filesystem::rename(temporary, path, error);
+    return !error;
+}
@@ -0,0 +1,242 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "AssetWatcher.hpp"
+#include "TexturePreprocess.hpp"
+
+#include <algorithm>
+#include <string_view>
+
+#if FLAPPYBARA_HOT_RELOAD
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    const std::string texturesDirectory = "../resources/textures";
+    const std::string audioDirectory = "../resources/audio";
+
+    // The file name part of an asset path, e.g. "base.png" for "../resources/textures/base.png"
+    std::string_view fileNameOf(const std::string_view path) {
+        return path.substr(path.find_last_of("/\\") + 1);
+    }
+
+    bool inParallaxAtlas(const TextureId id) {
+        return std::ranges::any_of(Assets::parallaxAtlasParts, [id](const AtlasPart &part) { return part.id == id; });
+    }
+
+    // raylib's loaders aren't thread-safe, see TexturePreprocess::decodeMutex()
+    Image decodeImage(const std::string &path) {
+        std::lock_guard lock(TexturePreprocess::decodeMutex());
+        return LoadImage(path.c_str());
+    }
+
+    Wave decodeWave(const std::string &path) {
+        std::lock_guard lock(TexturePreprocess::decodeMutex());
+        return LoadWave(path.c_str());
+    }
+
+    // The atlas again from every part's current file, the game only draws these textures through it
+    Image decodeParallaxAtlas() {
+        std::vector<Image> parts;
+        for (const AtlasPart &part : Assets::parallaxAtlasParts) {
+            const Image decoded = decodeImage(texturesDirectory + "/" + std::string(fileNameOf(Assets::textures[Assets::index(part.id)].path)));
+            if (decoded.data == nullptr) {
+                break;
+            }
+            parts.push_back(decoded);
+        }
+
+        const Image atlas = parts.size() == Assets::parallaxAtlasParts.size() ? TexturePreprocess::parallaxAtlas(parts) : Image{};
+        for (const Image &part : parts) {
+            UnloadImage(part);
+        }
+        return atlas;
+    }
+}
+
+AssetWatcher::AssetWatcher() {
+#if FLAPPYBARA_HOT_RELOAD
+    Logger& logger = Logger::getInstance();
+
+    inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd < 0) {
+        logger.log(LogLevel::WARNING, "Asset hot reload unavailable: inotify_init1 failed.");
+        return;
+    }
+
+    // Editors usually save through a temporary file and a rename, so watch for both.
+    constexpr uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO;
+    for (const std::string &directory : { texturesDirectory, audioDirectory }) {
+        if (inotify_add_watch(inotifyFd, directory.c_str(), mask) < 0) {
+            logger.log(LogLevel::WARNING, "Asset hot reload: failed to watch " + directory);
+        }
+    }
+
+    running = true;
+    worker = std::thread(&AssetWatcher::watchLoop, this);
+    logger.log(LogLevel::INFO, "Asset hot reload watching " + texturesDirectory + " and " + audioDirectory);
+#endif
+}
+
+AssetWatcher::~AssetWatcher() {
+#if FLAPPYBARA_HOT_RELOAD
+    running = false;
+    if (worker.joinable()) {
+        worker.join();
+    }
+    if (inotifyFd >= 0) {
+        close(inotifyFd);
+    }
+    discardPending();
+#endif
+}
+
+void AssetWatcher::watchLoop() {
+#if FLAPPYBARA_HOT_RELOAD
+    // Large enough for a burst of events, aligned as inotify requires
+    alignas(inotify_event) char buffer[4096];
+
+    while (running) {
+        pollfd descriptor{ .fd = inotifyFd, .events = POLLIN, .revents = 0 };
+
+        // Wake up periodically so the destructor never waits long for the thread to notice shutdown
+        if (poll(&descriptor, 1, 100) <= 0) {
+            continue;
+        }
+
+        const ssize_t length = read(inotifyFd, buffer, sizeof(buffer));
+        if (length <= 0) {
+            continue;
+        }
+
+        for (ssize_t offset = 0; offset < length;) {
+            const auto *event = reinterpret_cast<const inotify_event *>(buffer + offset);
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+            if (event->len == 0) {
+                continue;
+            }
+
+            const std::string filename(event->name);
+            if (filename.ends_with(".png")) {
+                decodeFile(texturesDirectory, filename);
+            } else if (filename.ends_with(".wav")) {
+                decodeFile(audioDirectory, filename);
+            }
+        }
+    }
+#endif
+}
+
+void AssetWatcher::decodeFile(const std::string &directory, const std::string &filename) {
+    Logger& logger = Logger::getInstance();
+
+    PendingReload reload;
+    bool known = false;
+
+    if (directory == texturesDirectory) {
+        for (std::size_t i = 0; i < Assets::textures.size(); ++i) {
+            if (fileNameOf(Assets::textures[i].path) == filename) {
+                reload.isTexture = true;
+                reload.textureId = static_cast<TextureId>(i);
+                known = true;
+            }
+        }
+    } else {
+        for (std::size_t i = 0; i < Assets::sounds.size(); ++i) {
+            if (fileNameOf(Assets::sounds[i].path) == filename) {
+                reload.audioId = static_cast<AudioId>(i);
+                known = true;
+            }
+        }
+    }
+
+    if (!known) {
+        logger.log(LogLevel::DEBUG, "Asset hot reload: ignoring untracked file " + filename);
+        return;
+    }
+
+    // Decoding is the expensive part, it happens here on the watcher thread instead of in the game loop
+    const std::string path = directory + "/" + filename;
+    if (reload.isTexture) {
+        const bool atlasPart = inParallaxAtlas(reload.textureId);
+        if (atlasPart) {
+            reload.textureId = TextureId::ParallaxAtlas;
+        }
+
+        const Image decoded = atlasPart ? decodeParallaxAtlas() : decodeImage(path);
+        if (decoded.data == nullptr) {
+            logger.log(LogLevel::ERROR, "Asset hot reload: failed to decode " + path);
+            return;
+        }
+
+        // Match what the cooker embeds, the game draws every texture with premultiplied alpha
+        reload.image = TexturePreprocess::premultipliedMipChain(decoded);
+        UnloadImage(decoded);
+    } else {
+        reload.wave = decodeWave(path);
+        if (reload.wave.data == nullptr) {
+            logger.log(LogLevel::ERROR, "Asset hot reload: failed to decode " + path);
+            return;
+        }
+    }
+
+    logger.log(LogLevel::INFO, "Asset hot reload: decoded " + path);
+
+    std::lock_guard lock(pendingMutex);
+
+    // A file saved twice before the next frame only needs its latest version
+    for (PendingReload &queued : pending) {
+        if (queued.isTexture == reload.isTexture && queued.textureId == reload.textureId && queued.audioId == reload.audioId) {
+            if (queued.isTexture) {
+                UnloadImage(queued.image);
+            } else {
+                UnloadWave(queued.wave);
+            }
+            queued = reload;
+            return;
+        }
+    }
+    pending.push_back(reload);
+}
+
+void AssetWatcher::applyPendingReloads(TextureResourceManager &textureManager, AudioResourceManager &audioManager) {
+#if FLAPPYBARA_HOT_RELOAD
+    std::vector<PendingReload> ready;
+    {
+        // Never block the frame on the watcher thread, a busy lock just means the swap happens next frame
+        std::unique_lock lock(pendingMutex, std::try_to_lock);
+        if (!lock.owns_lock() || pending.empty()) {
+            return;
+        }
+        ready.swap(pending);
+    }
+
+    for (const PendingReload &reload : ready) {
+        if (reload.isTexture) {
+            textureManager.reloadTexture(reload.textureId, reload.image);
+        } else {
+            audioManager.reloadAudio(reload.audioId, reload.wave);
+        }
+    }
+#else
+    (void)textureManager;
+    (void)audioManager;
+#endif
+}
+
+void AssetWatcher::discardPending() {
+    std::lock_guard lock(pendingMutex);
+
+    for (const PendingReload &reload : pending) {
+        if (reload.isTexture) {
+            UnloadImage(reload.image);
+        } else {
+            UnloadWave(reload.wave);
+        }
+    }
+    pending.clear();
+}
@@ -0,0 +1,18 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "AudioBackend.hpp"
+#include "NullAudioBackend.hpp"
+#include "RaylibAudioBackend.hpp"
+
+std::unique_ptr<AudioBackend> createAudioBackend(const AudioBackendKind kind) {
+    switch (kind) {
+        case AudioBackendKind::Null:
+            return std::make_unique<NullAudioBackend>();
+
+        case AudioBackendKind::Raylib:
+        default:
+            return std::make_unique<RaylibAudioBackend>();
+    }
+}
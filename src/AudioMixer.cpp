@@ -0,0 +1,62 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "AudioMixer.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "constants.hpp"
+
+AudioMixer::AudioMixer() {
+    busVolumes.fill(1.0f);
+    gains.fill(1.0f);
+}
+
+void AudioMixer::setMasterVolume(const float volume) {
+    masterVolume = std::clamp(volume, 0.0f, 1.0f);
+}
+
+void AudioMixer::setBusVolume(const AudioBus bus, const float volume) {
+    busVolumes[static_cast<std::size_t>(bus)] = std::clamp(volume, 0.0f, 1.0f);
+}
+
+void AudioMixer::duckMusic(const float holdSeconds) {
+    duckHoldSeconds = std::max(duckHoldSeconds, holdSeconds);
+}
+
+std::uint32_t AudioMixer::update(const float deltaSeconds) {
+    duckHoldSeconds = std::max(0.0f, duckHoldSeconds - deltaSeconds);
+
+    // One-pole smoothing, the gain covers ~63% of the remaining distance every smoothing period
+    const float step = 1.0f - std::exp(-deltaSeconds * 1000.0f / Config::busGainSmoothingMs);
+
+    std::uint32_t changed = 0;
+    for (std::size_t bus = 0; bus < busCount; ++bus) {
+        const float target = targetFor(bus);
+        if (gains[bus] == target) {
+            continue;
+        }
+
+        // Snap once inaudibly close so the voices stop being touched
+        gains[bus] += (target - gains[bus]) * step;
+        if (std::abs(target - gains[bus]) < 0.001f) {
+            gains[bus] = target;
+        }
+        changed |= 1u << bus;
+    }
+    return changed;
+}
+
+float AudioMixer::gain(const AudioBus bus) const {
+    return gains[static_cast<std::size_t>(bus)];
+}
+
+float AudioMixer::targetFor(const std::size_t bus) const {
+    float target = masterVolume * busVolumes[bus];
+    if (bus == static_cast<std::size_t>(AudioBus::Music) && duckHoldSeconds > 0.0f) {
+        target *= Config::musicDuckGain;
+    }
+    return target;
+}
@@ -3,28 +3,66 @@
 //
 
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <iostream>
-#include <filesystem>
+#include <span>
 
 #include "AudioResourceManager.hpp"
 #include "constants.hpp"
 
 // Audio headers
-#include "../resources/audio/headers/spring_audio.h"
-#include "../resources/audio/headers/game_over_audio.h"
-#include "../resources/audio/headers/level_complete_audio.h"
-#include "../resources/audio/headers/score_audio.h"
-#include "../resources/audio/headers/capybara_song_audio.h"
-
-AudioResourceManager::AudioResourceManager() {
-    InitAudioDevice();
+#include "audio/spring_audio.h"
+#include "audio/game_over_audio.h"
+#include "audio/level_complete_audio.h"
+#include "audio/score_audio.h"
+#include "audio/capybara_song_music.h"
+
+static_assert(Config::voicesPerSound >= 1 && Config::maxCachedRawSounds >= 1, "Audio voice pool needs at least one voice and one cache slot");
+
+namespace {
+    // Mixer bus of each predefined sound, indexed by AudioId
+    constexpr std::array<AudioBus, Assets::sounds.size()> soundBuses = {
+        AudioBus::Sfx,      // SpringEffect
+        AudioBus::Sfx,      // GameOver
+        AudioBus::Ui,       // LevelComplete, the menu buttons' click
+        AudioBus::Sfx,      // Score
+    };
+}
+
+AudioResourceManager::AudioResourceManager(std::unique_ptr<AudioBackend> backend) : backend(std::move(backend)) {
+    audioSlots.resize(Assets::sounds.size());
+    for (std::size_t i = 0; i < Assets::sounds.size(); ++i) {
+        audioSlots[i].key = std::string(Assets::sounds[i].key);
+        audioSlots[i].bus = soundBuses[i];
+        slotIndices[audioSlots[i].key] = i;
+    }
+    audioSlots[Assets::index(AudioId::GameOver)].ducksMusic = true;
+
+    // playRawAudio() never grows the slot array past this, so slots never move while the audio thread uses them
+    audioSlots.reserve(Assets::sounds.size() + Config::maxCachedRawSounds);
+
     loadAudioResources();
+
+    audioThread = std::jthread([this](const std::stop_token &stopToken) { audioThreadLoop(stopToken); });
 }
 
 AudioResourceManager::~AudioResourceManager() {
-    UnloadMusicStream(background_game_music);
+    audioThread.request_stop();
+    if (audioThread.joinable()) {
+        audioThread.join();
+    }
+
+    if (droppedCommands > 0) {
+        Logger::getInstance().log(LogLevel::WARNING, "Audio command queue overflowed, dropped " + std::to_string(droppedCommands.load()) + " commands.");
+    }
+
+    if (backend->musicUnderruns() > 0) {
+        Logger::getInstance().log(LogLevel::WARNING, "Background music underran " + std::to_string(backend->musicUnderruns()) + " times.");
+    }
+    backend->closeMusic();
     unloadAllAudio();
-    CloseAudioDevice();
 }
 
 void AudioResourceManager::loadAudioResources() {
@@ -63,136 +101,452 @@ void AudioResourceManager::loadAudioResources() {
         .data = SCORE_AUDIO_DATA
     };
 
-    audioResources["spring-effect"] = LoadSoundFromWave(spring_wave);
-    audioResources["game-over"] = LoadSoundFromWave(game_over_wave);
-    audioResources["level-complete"] = LoadSoundFromWave(level_complete_wave);
-    audioResources["score"] = LoadSoundFromWave(score_wave);
+    createVoices(audioSlots[Assets::index(AudioId::SpringEffect)], spring_wave);
+    createVoices(audioSlots[Assets::index(AudioId::GameOver)], game_over_wave);
+    createVoices(audioSlots[Assets::index(AudioId::LevelComplete)], level_complete_wave);
+    createVoices(audioSlots[Assets::index(AudioId::Score)], score_wave);
 
-    background_game_music = LoadMusicStreamFromMemory(".wav", CAPYBARA_SONG_AUDIO_DATA, CAPYBARA_SONG_AUDIO_FRAME_COUNT);
-    // background_game_music = LoadMusicStream("../resources/audio/capybara_song.wav");
+    // The cooker writes an empty header when the song's source file is missing.
+    // The song is decoded a chunk at a time on the audio thread, nothing is copied out of the embedded data.
+    if constexpr (CAPYBARA_SONG_MUSIC_SIZE > 0) {
+        backend->openMusic(CAPYBARA_SONG_MUSIC_DATA, CAPYBARA_SONG_MUSIC_SIZE);
+    } else {
+        logger.log(LogLevel::WARNING, "Theme song was not cooked, background music disabled.");
+    }
 
     logger.log(LogLevel::INFO, "Audio resources loaded successfully.");
 }
 
 
-void AudioResourceManager::playAudio(const std::string &key) {
-    Logger& logger = Logger::getInstance();
+void AudioResourceManager::post(const AudioCommand &command) {
+    // Never block the game thread on the audio thread, a full queue drops the command
+    if (!commandQueue.tryPush(command)) {
+        droppedCommands.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void AudioResourceManager::postSlot(const AudioCommandType type, const std::size_t slot, const float value) {
+    // Only the game thread changes generations, so reading it here needs no lock
+    post({ .type = type, .slot = static_cast<std::uint32_t>(slot), .value = value, .generation = audioSlots[slot].generation });
+}
+
+void AudioResourceManager::audioThreadLoop(const std::stop_token &stopToken) {
+    auto lastTick = std::chrono::steady_clock::now();
+
+    while (!stopToken.stop_requested()) {
+        const auto now = std::chrono::steady_clock::now();
+        const float deltaSeconds = std::chrono::duration<float>(now - lastTick).count();
+        lastTick = now;
+
+        {
+            std::lock_guard lock(slotMutex);
+            while (const std::optional<AudioCommand> command = commandQueue.tryPop()) {
+                execute(*command);
+            }
+
+            applyBusGains(mixer.update(deltaSeconds));
+        }
+
+        // Refilling here instead of in the frame loop keeps the music going through long frames
+        backend->updateMusic();
 
-    if (Config::disableAudio) {
-        logger.log(LogLevel::WARNING, "Audio disabled in config.");
+        std::this_thread::sleep_for(std::chrono::milliseconds(Config::audioUpdateIntervalMs));
+    }
+}
+
+void AudioResourceManager::execute(const AudioCommand &command) {
+    // A sound command posted before its raw sound slot was reused, it belongs to a sound that is gone
+    const bool soundCommand = command.type == AudioCommandType::Play || command.type == AudioCommandType::Stop ||
+        command.type == AudioCommandType::SetVolume;
+    if (soundCommand && audioSlots[command.slot].generation != command.generation) {
         return;
     }
 
-    if (audioResources.contains(key)) {
-        if (const Sound &sound = audioResources[key]; sound.stream.buffer != nullptr) {
-            logger.log(LogLevel::INFO, "Playing audio: " + key);
-            PlaySound(sound);
-        } else {
-            logger.log(LogLevel::ERROR, "Error: Audio '" + key + "' is not valid!");
+    switch (command.type) {
+        case AudioCommandType::Play:
+            playSlot(audioSlots[command.slot]);
+            break;
+
+        case AudioCommandType::Stop:
+            stopSlot(audioSlots[command.slot]);
+            break;
+
+        case AudioCommandType::SetVolume:
+            audioSlots[command.slot].volume = command.value;
+            applyVoiceVolume(audioSlots[command.slot]);
+            break;
+
+        case AudioCommandType::PlayMusic:
+            backend->playMusic();
+            if (muted || paused) {
+                backend->pauseMusic();
+            }
+            break;
+
+        case AudioCommandType::StopMusic:
+            backend->stopMusic();
+            break;
+
+        case AudioCommandType::SetMusicVolume:
+            musicVolume = command.value;
+            backend->setMusicVolume(musicVolume * mixer.gain(AudioBus::Music));
+            break;
+
+        case AudioCommandType::SetMusicPitch:
+            backend->setMusicPitch(command.value);
+            break;
+
+        case AudioCommandType::SetMasterVolume:
+            mixer.setMasterVolume(command.value);
+            break;
+
+        case AudioCommandType::SetBusVolume:
+            mixer.setBusVolume(static_cast<AudioBus>(command.slot), command.value);
+            break;
+
+        case AudioCommandType::SetMuted:
+            muted = command.value != 0.0f;
+            if (muted) {
+                for (AudioEntry &entry : audioSlots) {
+                    for (Voice &voice : entry.voices) {
+                        backend->stop(voice.handle);
+                        voice.paused = false;
+                    }
+                }
+                backend->pauseMusic();
+            } else if (!paused) {
+                backend->resumeMusic();
+            }
+            break;
+
+        case AudioCommandType::SetPaused:
+            if (paused == (command.value != 0.0f)) {
+                break;
+            }
+            paused = command.value != 0.0f;
+            for (AudioEntry &entry : audioSlots) {
+                for (Voice &voice : entry.voices) {
+                    if (paused && backend->isPlaying(voice.handle)) {
+                        backend->pause(voice.handle);
+                        voice.paused = true;
+                    } else if (!paused && voice.paused) {
+                        backend->resume(voice.handle);
+                        voice.paused = false;
+                    }
+                }
+            }
+            if (paused) {
+                backend->pauseMusic();
+            } else if (!muted) {
+                backend->resumeMusic();
+            }
+            break;
+    }
+}
+
+void AudioResourceManager::applyBusGains(const std::uint32_t changedBuses) {
+    if (changedBuses == 0) {
+        return;
+    }
+
+    for (const AudioEntry &entry : audioSlots) {
+        if (changedBuses & (1u << static_cast<std::uint32_t>(entry.bus))) {
+            applyVoiceVolume(entry);
         }
+    }
+
+    if (changedBuses & (1u << static_cast<std::uint32_t>(AudioBus::Music))) {
+        backend->setMusicVolume(musicVolume * mixer.gain(AudioBus::Music));
+    }
+}
+
+void AudioResourceManager::applyVoiceVolume(const AudioEntry &entry) {
+    const float volume = entry.volume * mixer.gain(entry.bus);
+    for (const Voice &voice : entry.voices) {
+        backend->setVolume(voice.handle, volume);
+    }
+}
+
+void AudioResourceManager::playAudio(const AudioId id) {
+    postSlot(AudioCommandType::Play, Assets::index(id));
+}
+
+void AudioResourceManager::playAudio(const std::string &key) {
+    Logger& logger = Logger::getInstance();
+
+    if (const auto it = slotIndices.find(key); it != slotIndices.end()) {
+        postSlot(AudioCommandType::Play, it->second);
     } else {
         logger.log(LogLevel::ERROR, "Error: Audio key '" + key + "' not found!");
     }
 }
 
+void AudioResourceManager::playSlot(AudioEntry &entry) {
+    // The one mute check, muted sounds never reach a voice
+    if (muted) {
+        return;
+    }
+
+    if (entry.voices.empty()) {
+        Logger::getInstance().log(LogLevel::ERROR, "Error: Audio '" + entry.key + "' is not valid!");
+        return;
+    }
+
+    Voice &voice = acquireVoice(entry);
+    if (backend->isPlaying(voice.handle)) {
+        backend->stop(voice.handle);
+    } else {
+        enforceVoiceCap();
+    }
+
+    voice.startedAt = ++playSerial;
+    voice.paused = false;
+    entry.lastPlayed = playSerial;
+    backend->play(voice.handle);
+
+    if (entry.ducksMusic) {
+        mixer.duckMusic(backend->duration(voice.handle));
+    }
+}
+
+AudioResourceManager::Voice &AudioResourceManager::acquireVoice(AudioEntry &entry) {
+    if (stealPolicy == VoiceStealPolicy::RoundRobin) {
+        Voice &voice = entry.voices[entry.nextVoice];
+        entry.nextVoice = (entry.nextVoice + 1) % entry.voices.size();
+        return voice;
+    }
+
+    Voice *oldest = &entry.voices.front();
+    for (Voice &voice : entry.voices) {
+        if (!backend->isPlaying(voice.handle)) {
+            return voice;
+        }
+        if (voice.startedAt < oldest->startedAt) {
+            oldest = &voice;
+        }
+    }
+    return *oldest;
+}
+
+void AudioResourceManager::enforceVoiceCap() {
+    // A new voice is about to start, stop the globally oldest ones until it fits under the cap
+    while (true) {
+        int active = 0;
+        Voice *oldest = nullptr;
+
+        for (AudioEntry &entry : audioSlots) {
+            for (Voice &voice : entry.voices) {
+                if (!backend->isPlaying(voice.handle)) {
+                    continue;
+                }
+                active++;
+                if (oldest == nullptr || voice.startedAt < oldest->startedAt) {
+                    oldest = &voice;
+                }
+            }
+        }
+
+        if (active < Config::maxActiveVoices || oldest == nullptr) {
+            return;
+        }
+        backend->stop(oldest->handle);
+    }
+}
+
+void AudioResourceManager::setVoiceStealPolicy(const VoiceStealPolicy policy) {
+    stealPolicy = policy;
+}
+
+void AudioResourceManager::stopAudio(const AudioId id) {
+    postSlot(AudioCommandType::Stop, Assets::index(id));
+}
+
 void AudioResourceManager::stopAudio(const std::string &key) {
     Logger& logger = Logger::getInstance();
 
-    if (audioResources.contains(key)) {
-        if (const Sound &sound = audioResources[key]; sound.stream.buffer != nullptr) {
-            logger.log(LogLevel::INFO, "Stopping audio: " + key);
-            StopSound(sound);
-        } else {
-            logger.log(LogLevel::ERROR, "Error: Audio '" + key + "' is not valid!");
-        }
+    if (const auto it = slotIndices.find(key); it != slotIndices.end()) {
+        postSlot(AudioCommandType::Stop, it->second);
     } else {
         logger.log(LogLevel::ERROR, "Error: Audio key '" + key + "' not found!");
     }
 }
 
+void AudioResourceManager::setAudioVolume(const AudioId id, const float volume) {
+    postSlot(AudioCommandType::SetVolume, Assets::index(id), volume);
+}
+
+void AudioResourceManager::stopSlot(const AudioEntry &entry) {
+    if (entry.voices.empty()) {
+        Logger::getInstance().log(LogLevel::ERROR, "Error: Audio '" + entry.key + "' is not valid!");
+        return;
+    }
+
+    for (const Voice &voice : entry.voices) {
+        backend->stop(voice.handle);
+    }
+}
+
+AudioResourceManager::AudioEntry *AudioResourceManager::findSlot(const std::string &key) {
+    const auto it = slotIndices.find(key);
+    return it != slotIndices.end() ? &audioSlots[it->second] : nullptr;
+}
+
+void AudioResourceManager::createVoices(AudioEntry &entry, const Wave &wave) {
+    std::array<VoiceHandle, Config::voicesPerSound> handles{};
+    if (!backend->createVoices(entry.key, wave, handles)) {
+        Logger::getInstance().log(LogLevel::ERROR, "Error: Failed to load audio '" + entry.key + "'");
+        return;
+    }
+
+    entry.voices.resize(handles.size());
+    for (std::size_t i = 0; i < handles.size(); ++i) {
+        entry.voices[i] = { .handle = handles[i], .startedAt = 0 };
+    }
+    entry.nextVoice = 0;
+
+    applyVoiceVolume(entry);
+}
+
+void AudioResourceManager::destroyVoices(AudioEntry &entry) {
+    if (entry.voices.empty()) {
+        return;
+    }
+
+    std::array<VoiceHandle, Config::voicesPerSound> handles{};
+    for (std::size_t i = 0; i < entry.voices.size(); ++i) {
+        handles[i] = entry.voices[i].handle;
+    }
+    backend->destroyVoices(std::span(handles).first(entry.voices.size()));
+    entry.voices.clear();
+}
 
 void AudioResourceManager::unloadAudio(const std::string &key) {
     Logger& logger = Logger::getInstance();
+    std::lock_guard lock(slotMutex);
 
-    if (audioResources.contains(key)) {
+    if (AudioEntry *entry = findSlot(key); entry != nullptr && !entry->voices.empty()) {
         logger.log(LogLevel::INFO, "Unloading audio: " + key);
-        UnloadSound(audioResources[key]);
-        audioResources.erase(key);
+        // Keep the slot so AudioId indices stay stable
+        destroyVoices(*entry);
     } else {
         logger.log(LogLevel::ERROR, "Error: Audio key '" + key + "' not found!");
     }
 }
 
+void AudioResourceManager::reloadAudio(const AudioId id, const Wave &wave) {
+    Logger& logger = Logger::getInstance();
+    std::lock_guard lock(slotMutex);
+    AudioEntry &entry = audioSlots[Assets::index(id)];
+
+    destroyVoices(entry);
+    createVoices(entry, wave);
+    UnloadWave(wave);
+
+    logger.log(LogLevel::INFO, "Reloaded audio: " + entry.key);
+}
+
 void AudioResourceManager::unloadAllAudio() {
     Logger& logger = Logger::getInstance();
     logger.log(LogLevel::INFO, "Unloading all audio resources.");
+    std::lock_guard lock(slotMutex);
 
-    for (const auto &[_, sound] : audioResources) {
-        UnloadSound(sound);
+    for (AudioEntry &entry : audioSlots) {
+        destroyVoices(entry);
     }
-    audioResources.clear();
 
     logger.log(LogLevel::INFO, "All audio resources unloaded.");
 }
 
-void AudioResourceManager::buildAudioHeaders() {
+void AudioResourceManager::playRawAudio(const std::string &key, const Wave &wave, const AudioBus bus) {
     Logger& logger = Logger::getInstance();
 
-    if constexpr (!Config::buildAudioHeaders) {
-        logger.log(LogLevel::INFO, "Audio headers building disabled.");
-        return;
-    }
+    std::unique_lock lock(slotMutex);
+    AudioEntry *entry = findSlot(key);
+    if (entry == nullptr) {
+        logger.log(LogLevel::INFO, "Caching loaded audio file: " + key);
 
-    logger.log(LogLevel::INFO, "Building audio headers.");
+        const std::size_t rawCount = audioSlots.size() - Assets::sounds.size();
+        if (rawCount < Config::maxCachedRawSounds) {
+            slotIndices[key] = audioSlots.size();
+            entry = &audioSlots.emplace_back();
+        } else {
+            // Reuse the slot of the least recently played raw sound
+            const auto victim = std::min_element(audioSlots.begin() + static_cast<std::ptrdiff_t>(Assets::sounds.size()), audioSlots.end(),
+                [](const AudioEntry &a, const AudioEntry &b) { return a.lastPlayed < b.lastPlayed; });
+
+            logger.log(LogLevel::INFO, "Evicting cached audio file: " + victim->key);
+            destroyVoices(*victim);
+            // Commands for the evicted sound may still be queued, the audio thread drops them by generation
+            victim->generation++;
+            slotIndices.erase(victim->key);
+            slotIndices[key] = static_cast<std::size_t>(victim - audioSlots.begin());
+            entry = &*victim;
+        }
+        entry->key = key;
+        entry->bus = bus;
+        entry->volume = 1.0f;
+    }
 
-    const std::string outputDir = "../resources/audio/headers/";
-    if (!std::filesystem::exists(outputDir)) {
-        std::filesystem::create_directories(outputDir);
-        logger.log(LogLevel::INFO, "Created output directory: " + outputDir);
+    if (entry->voices.empty()) {
+        createVoices(*entry, wave);
     }
 
-    for (const auto &[key, path] : predefinedAudioPaths) {
-        const Wave wave = LoadWave(path.c_str());
-        if (!wave.data) {
-            logger.log(LogLevel::ERROR, "Error: Failed to load wave data: " + path);
-            continue;
-        }
+    const auto slot = static_cast<std::size_t>(entry - audioSlots.data());
+    lock.unlock();
 
-        const std::string filename = path.substr(path.find_last_of("/\\") + 1);
-        const std::string sanitizedFilename = filename.substr(0, filename.find_last_of('.')) + "_audio.h";
-        const std::string outputPath = outputDir + sanitizedFilename;
+    postSlot(AudioCommandType::Play, slot);
+}
 
-        logger.log(LogLevel::INFO, "Building header: " + outputPath);
+void AudioResourceManager::playBackgroundMusic() {
+    post({ .type = AudioCommandType::PlayMusic });
+}
 
-        if (!ExportWaveAsCode(wave, outputPath.c_str())) {
-            logger.log(LogLevel::ERROR, "Failed to export wave as C header file: " + outputPath);
-        } else {
-            logger.log(LogLevel::INFO, "Wave exported as C header file successfully: " + outputPath);
-        }
+void AudioResourceManager::stopBackgroundMusic() {
+    post({ .type = AudioCommandType::StopMusic });
+}
 
-        UnloadWave(wave);
-    }
+void AudioResourceManager::setMusicVolume(const float volume) {
+    post({ .type = AudioCommandType::SetMusicVolume, .value = volume });
+}
 
-    logger.log(LogLevel::INFO, "Finished building audio headers.");
+void AudioResourceManager::setMusicPitch(const float pitch) {
+    post({ .type = AudioCommandType::SetMusicPitch, .value = pitch });
 }
 
-void AudioResourceManager::playRawAudio(const std::string &key, const Wave &wave) {
-    Logger& logger = Logger::getInstance();
+void AudioResourceManager::setMasterVolume(const float volume) {
+    post({ .type = AudioCommandType::SetMasterVolume, .value = volume });
+}
 
-    if (!audioResources.contains(key)) {
-        logger.log(LogLevel::INFO, "Caching loaded audio file: " + key);
-        audioResources[key] = LoadSoundFromWave(wave);
-    }
+void AudioResourceManager::setBusVolume(const AudioBus bus, const float volume) {
+    post({ .type = AudioCommandType::SetBusVolume, .slot = static_cast<std::uint32_t>(bus), .value = volume });
+}
 
-    logger.log(LogLevel::INFO, "Playing raw audio: " + key);
-    PlaySound(audioResources[key]);
+void AudioResourceManager::setMuted(const bool mute) {
+    post({ .type = AudioCommandType::SetMuted, .value = mute ? 1.0f : 0.0f });
 }
 
-void AudioResourceManager::playBackgroundMusic() {
-    PlayMusicStream(background_game_music);
+void AudioResourceManager::setPaused(const bool pause) {
+    post({ .type = AudioCommandType::SetPaused, .value = pause ? 1.0f : 0.0f });
+}
+
+void AudioResourceManager::applySettings(const Settings &settings) {
+    setMasterVolume(settings.masterVolume);
+    setBusVolume(AudioBus::Sfx, settings.sfxVolume);
+    setBusVolume(AudioBus::Music, settings.musicVolume);
+    setBusVolume(AudioBus::Ui, settings.uiVolume);
+    setMuted(settings.muted);
 }
 
-Music AudioResourceManager::getBackgroundMusicRef() const {
-    return background_game_music;
+void AudioResourceManager::attachProcessor(const AudioId id, const AudioCallback processor) {
+    std::lock_guard lock(slotMutex);
+    for (const Voice &voice : audioSlots[Assets::index(id)].voices) {
+        backend->attachProcessor(voice.handle, processor);
+    }
 }
 
+void AudioResourceManager::detachProcessor(const AudioId id, const AudioCallback processor) {
+    std::lock_guard lock(slotMutex);
+    for (const Voice &voice : audioSlots[Assets::index(id)].voices) {
+        backend->detachProcessor(voice.handle, processor);
+    }
+}
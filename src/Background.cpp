@@ -0,0 +1,217 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "Background.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "AssetIds.hpp"
+#include "Logger.hpp"
+#include "constants.hpp"
+
+namespace {
+    // raylib's default vertex shader feeds fragTexCoord and fragColor, texture0 is the atlas. The quad covers the
+    // whole background, so fragTexCoord is the position on it. Gradients come from that position rather than the
+    // atlas coordinates, which jump between bands and would pick a tiny mip level along every band edge.
+    constexpr auto parallaxShader = R"(#version 330
+in vec2 fragTexCoord;
+in vec4 fragColor;
+
+uniform sampler2D texture0;
+uniform int layerCount;
+uniform vec4 layerScreen[8];    // top, bottom, repeat, rate
+uniform vec4 layerAtlas[8];     // day top, day bottom, night top, night bottom
+uniform float layerScroll[8];   // How far each layer has scrolled, in atlas widths and wrapped to [0, 1)
+uniform float nightAmount;
+
+out vec4 finalColor;
+
+void main() {
+    int layer = 0;
+    for (int i = 1; i < layerCount; ++i) {
+        if (fragTexCoord.y >= layerScreen[i].x) {
+            layer = i;
+        }
+    }
+
+    vec4 screen = layerScreen[layer];
+    vec4 atlas = layerAtlas[layer];
+    float down = (fragTexCoord.y - screen.x) / (screen.y - screen.x);
+    float across = fragTexCoord.x * screen.z + layerScroll[layer];
+
+    // Keep bilinear filtering from reaching into the neighbouring band
+    float halfTexel = 0.5 / float(textureSize(texture0, 0).y);
+    vec2 dayUv = vec2(across, clamp(mix(atlas.x, atlas.y, down), atlas.x + halfTexel, atlas.y - halfTexel));
+    vec2 nightUv = vec2(across, clamp(mix(atlas.z, atlas.w, down), atlas.z + halfTexel, atlas.w - halfTexel));
+
+    vec2 gradX = vec2(dFdx(fragTexCoord.x) * screen.z, 0.0);
+    vec2 gradY = vec2(0.0, dFdy(fragTexCoord.y) * (atlas.y - atlas.x) / (screen.y - screen.x));
+    vec4 day = textureGrad(texture0, dayUv, gradX, gradY);
+    vec4 night = textureGrad(texture0, nightUv, gradX, gradY);
+    finalColor = mix(day, night, nightAmount) * fragColor;
+}
+)";
+
+    // Rows of the background pictures where each layer starts, the pictures have the same layout by day and night
+    constexpr float pictureHeight = static_cast<float>(Assets::parallaxAtlasParts[0].height);
+    constexpr float cloudsRow = 304.0f;
+    constexpr float cityRow = 336.0f;
+    constexpr float bushesRow = 364.0f;
+
+    // The bottom pipes end where the floor starts, like in Simulation
+    constexpr float floorTop = 0.9f;
+
+    constexpr float dayRow = static_cast<float>(Assets::parallaxAtlasRow(TextureId::BackgroundDay));
+    constexpr float nightRow = static_cast<float>(Assets::parallaxAtlasRow(TextureId::BackgroundNight));
+    constexpr float floorRow = static_cast<float>(Assets::parallaxAtlasRow(TextureId::Floor));
+    constexpr float floorRows = static_cast<float>(Assets::parallaxAtlasParts[2].height);
+
+    // The pictures are stretched over the whole window, the floor keeps its aspect ratio and is tiled across
+    constexpr float windowAspect = static_cast<float>(Config::WindowWidth) / static_cast<float>(Config::WindowHeight);
+    constexpr float floorRepeat = windowAspect / (static_cast<float>(Assets::parallaxAtlasWidth) / floorRows * (1.0f - floorTop));
+
+    // A picture band keeps its place on screen, the part the floor hides is left out
+    constexpr ParallaxLayer pictureLayer(const float firstRow, const float lastRow, const float rate) {
+        return {
+            .top = firstRow / pictureHeight,
+            .rate = rate,
+            .repeat = 1.0f,
+            .dayTop = dayRow + firstRow,
+            .dayBottom = dayRow + lastRow,
+            .nightTop = nightRow + firstRow,
+            .nightBottom = nightRow + lastRow,
+        };
+    }
+
+    constexpr ParallaxLayer defaultLayerTable[] = {
+        pictureLayer(0.0f, cloudsRow, 0.0f),
+        pictureLayer(cloudsRow, cityRow, 0.1f),
+        pictureLayer(cityRow, bushesRow, 0.2f),
+        pictureLayer(bushesRow, floorTop * pictureHeight, 0.4f),
+        { .top = floorTop, .rate = 1.0f, .repeat = floorRepeat,
+          .dayTop = floorRow, .dayBottom = floorRow + floorRows, .nightTop = floorRow, .nightBottom = floorRow + floorRows },
+    };
+
+    static_assert(Background::maxLayers == 8, "The parallax shader's layer arrays hold 8 layers");
+    static_assert(Assets::parallaxAtlasParts[0].id == TextureId::BackgroundDay && Assets::parallaxAtlasParts[2].id == TextureId::Floor,
+                  "Background expects the day picture first and the floor third in the parallax atlas");
+
+    float layerBottom(const ParallaxLayer *layers, const std::size_t count, const std::size_t i) {
+        return i + 1 < count ? layers[i + 1].top : 1.0f;
+    }
+
+    // Where the layer's texture starts after scrolled background widths, in atlas widths. Wrapped in double before it
+    // becomes a float, so the offset keeps its precision however long the run has been going.
+    float layerOffset(const ParallaxLayer &layer, const double scrolled) {
+        const double offset = scrolled * layer.rate * layer.repeat;
+        return static_cast<float>(offset - std::floor(offset));
+    }
+}
+
+Background::Background() {
+    Logger& logger = Logger::getInstance();
+
+    setLayers(defaultLayers());
+
+    m_shader = LoadShaderFromMemory(nullptr, parallaxShader);
+    if (!IsShaderValid(m_shader)) {
+        logger.log(LogLevel::WARNING, "Parallax shader failed to compile, every layer is drawn on its own and day and night don't mix.");
+        return;
+    }
+
+    m_layerScrollLoc = GetShaderLocation(m_shader, "layerScroll");
+    m_nightAmountLoc = GetShaderLocation(m_shader, "nightAmount");
+    m_layerCountLoc = GetShaderLocation(m_shader, "layerCount");
+    m_layerScreenLoc = GetShaderLocation(m_shader, "layerScreen");
+    m_layerAtlasLoc = GetShaderLocation(m_shader, "layerAtlas");
+    logger.log(LogLevel::INFO, "Parallax shader loaded.");
+}
+
+Background::~Background() {
+    if (IsShaderValid(m_shader)) {
+        UnloadShader(m_shader);
+    }
+}
+
+std::span<const ParallaxLayer> Background::defaultLayers() {
+    return defaultLayerTable;
+}
+
+void Background::setLayers(const std::span<const ParallaxLayer> layers) {
+    m_layerCount = std::min(layers.size(), maxLayers);
+    std::copy_n(layers.begin(), m_layerCount, m_layers);
+
+    if (m_atlasHeight > 0) {
+        uploadLayers();
+    }
+}
+
+void Background::uploadLayers() const {
+    if (!IsShaderValid(m_shader)) {
+        return;
+    }
+
+    float screen[maxLayers * 4] = {};
+    float atlas[maxLayers * 4] = {};
+    const float height = static_cast<float>(m_atlasHeight);
+    for (std::size_t i = 0; i < m_layerCount; ++i) {
+        const ParallaxLayer &layer = m_layers[i];
+        screen[i * 4 + 0] = layer.top;
+        screen[i * 4 + 1] = layerBottom(m_layers, m_layerCount, i);
+        screen[i * 4 + 2] = layer.repeat;
+        screen[i * 4 + 3] = layer.rate;
+        atlas[i * 4 + 0] = layer.dayTop / height;
+        atlas[i * 4 + 1] = layer.dayBottom / height;
+        atlas[i * 4 + 2] = layer.nightTop / height;
+        atlas[i * 4 + 3] = layer.nightBottom / height;
+    }
+
+    const int count = static_cast<int>(m_layerCount);
+    SetShaderValue(m_shader, m_layerCountLoc, &count, SHADER_UNIFORM_INT);
+    SetShaderValueV(m_shader, m_layerScreenLoc, screen, SHADER_UNIFORM_VEC4, static_cast<int>(maxLayers));
+    SetShaderValueV(m_shader, m_layerAtlasLoc, atlas, SHADER_UNIFORM_VEC4, static_cast<int>(maxLayers));
+}
+
+void Background::draw(const Texture2D atlas, const double scrolled, const float nightAmount, const Rectangle dest) {
+    if (m_layerCount == 0 || dest.width <= 0.0f) {
+        return;
+    }
+
+    // Layers are tiled sideways by letting their texture coordinates run past the atlas edge, which raylib's
+    // default repeat wrap turns back into the atlas
+    if (IsShaderValid(m_shader)) {
+        if (atlas.height != m_atlasHeight) {
+            m_atlasHeight = atlas.height;
+            uploadLayers();
+        }
+
+        float offsets[maxLayers] = {};
+        for (std::size_t i = 0; i < m_layerCount; ++i) {
+            offsets[i] = layerOffset(m_layers[i], scrolled / dest.width);
+        }
+        const Rectangle source = { 0.0f, 0.0f, static_cast<float>(atlas.width), static_cast<float>(atlas.height) };
+
+        BeginShaderMode(m_shader);
+        SetShaderValueV(m_shader, m_layerScrollLoc, offsets, SHADER_UNIFORM_FLOAT, static_cast<int>(maxLayers));
+        SetShaderValue(m_shader, m_nightAmountLoc, &nightAmount, SHADER_UNIFORM_FLOAT);
+        DrawTexturePro(atlas, source, dest, { 0.0f, 0.0f }, 0.0f, WHITE);
+        EndShaderMode();
+        return;
+    }
+
+    // Fallback, the same offsets through each layer's source rectangle
+    const bool night = nightAmount >= 0.5f;
+    for (std::size_t i = 0; i < m_layerCount; ++i) {
+        const ParallaxLayer &layer = m_layers[i];
+        const float bottom = layerBottom(m_layers, m_layerCount, i);
+        const float firstRow = night ? layer.nightTop : layer.dayTop;
+        const float lastRow = night ? layer.nightBottom : layer.dayBottom;
+        const float tiledWidth = static_cast<float>(atlas.width) * layer.repeat;
+
+        const Rectangle source = { layerOffset(layer, scrolled / dest.width) * static_cast<float>(atlas.width), firstRow, tiledWidth, lastRow - firstRow };
+        const Rectangle band = { dest.x, dest.y + layer.top * dest.height, dest.width, (bottom - layer.top) * dest.height };
+        DrawTexturePro(atlas, source, band, { 0.0f, 0.0f }, 0.0f, WHITE);
+    }
+}
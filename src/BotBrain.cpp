@@ -0,0 +1,200 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "BotBrain.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <fstream>
+
+#include "Logger.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define FLAPPYBARA_SSE2 1
+#else
+#define FLAPPYBARA_SSE2 0
+#endif
+
+namespace {
+    constexpr char genomeMagic[4] = { 'F', 'B', 'G', 'N' };
+    constexpr std::uint32_t genomeVersion = 1;
+
+    constexpr int outputBase = BotBrain::hiddenCount * (BotBrain::inputCount + 1);
+
+    // Rational tanh approximation, exact at 0 and within 2% elsewhere. Saturates at +-3 where it reaches +-1.
+    float fastTanh(float x) {
+        x = std::clamp(x, -3.0f, 3.0f);
+        const float x2 = x * x;
+        return x * (27.0f + x2) / (27.0f + 9.0f * x2);
+    }
+
+    void writeU32(std::ofstream &file, const std::uint32_t value) {
+        const char bytes[4] = {
+            static_cast<char>(value & 0xff), static_cast<char>((value >> 8) & 0xff),
+            static_cast<char>((value >> 16) & 0xff), static_cast<char>((value >> 24) & 0xff)
+        };
+        file.write(bytes, sizeof(bytes));
+    }
+
+    bool readU32(std::ifstream &file, std::uint32_t &value) {
+        unsigned char bytes[4];
+        if (!file.read(reinterpret_cast<char *>(bytes), sizeof(bytes))) {
+            return false;
+        }
+        value = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (static_cast<std::uint32_t>(bytes[3]) << 24);
+        return true;
+    }
+}
+
+namespace BotBrain {
+    Inputs observe(const Simulation &sim) {
+        const Vector2 position = sim.playerPosition();
+        const Rectangle top = sim.topPipe();
+        const Rectangle bottom = sim.bottomPipe();
+
+        const float playerCenter = position.y + Simulation::playerHeight / 2.0f;
+        const float gapCenter = (top.height + bottom.y) / 2.0f;
+
+        return {
+            position.y / Config::WindowHeight,
+            sim.playerSpeed() / Simulation::gravity,
+            (gapCenter - playerCenter) / Config::WindowHeight,
+            (top.x + top.width - position.x) / Config::WindowWidth,
+        };
+    }
+
+    bool decide(const Genome &genome, const Inputs &inputs) {
+        const float *w = genome.weights.data();
+
+        float output = w[outputBase + hiddenCount];
+        for (int h = 0; h < hiddenCount; ++h) {
+            const float *unit = w + h * (inputCount + 1);
+            float sum = unit[inputCount];
+            for (int i = 0; i < inputCount; ++i) {
+                sum += unit[i] * inputs[i];
+            }
+            output += w[outputBase + h] * fastTanh(sum);
+        }
+        return output > 0.0f;
+    }
+
+    void Batch::load(const std::span<const Genome> genomes) {
+        weights.fill(0.0f);
+        const std::size_t count = std::min(genomes.size(), lanes);
+        for (std::size_t lane = 0; lane < count; ++lane) {
+            for (int p = 0; p < parameterCount; ++p) {
+                weights[p * lanes + lane] = genomes[lane].weights[p];
+            }
+        }
+    }
+
+    void Batch::decide(const std::array<Inputs, lanes> &inputs, std::array<bool, lanes> &jump) const {
+#if FLAPPYBARA_SSE2
+        static_assert(lanes % 4 == 0, "SSE path processes four lanes per register");
+
+        const __m128 lo = _mm_set1_ps(-3.0f);
+        const __m128 hi = _mm_set1_ps(3.0f);
+        const __m128 c27 = _mm_set1_ps(27.0f);
+        const __m128 c9 = _mm_set1_ps(9.0f);
+
+        for (std::size_t group = 0; group < lanes; group += 4) {
+            __m128 in[inputCount];
+            for (int i = 0; i < inputCount; ++i) {
+                in[i] = _mm_set_ps(inputs[group + 3][i], inputs[group + 2][i], inputs[group + 1][i], inputs[group][i]);
+            }
+
+            const auto weight = [&](const int parameter) { return _mm_load_ps(&weights[parameter * lanes + group]); };
+
+            __m128 output = weight(outputBase + hiddenCount);
+            for (int h = 0; h < hiddenCount; ++h) {
+                const int unit = h * (inputCount + 1);
+                __m128 sum = weight(unit + inputCount);
+                for (int i = 0; i < inputCount; ++i) {
+                    sum = _mm_add_ps(sum, _mm_mul_ps(weight(unit + i), in[i]));
+                }
+
+                // Same approximation as fastTanh()
+                const __m128 x = _mm_min_ps(_mm_max_ps(sum, lo), hi);
+                const __m128 x2 = _mm_mul_ps(x, x);
+                const __m128 activation = _mm_div_ps(_mm_mul_ps(x, _mm_add_ps(c27, x2)), _mm_add_ps(c27, _mm_mul_ps(c9, x2)));
+
+                output = _mm_add_ps(output, _mm_mul_ps(weight(outputBase + h), activation));
+            }
+
+            const int mask = _mm_movemask_ps(_mm_cmpgt_ps(output, _mm_setzero_ps()));
+            for (std::size_t lane = 0; lane < 4; ++lane) {
+                jump[group + lane] = (mask >> lane) & 1;
+            }
+        }
+#else
+        for (std::size_t lane = 0; lane < lanes; ++lane) {
+            float output = weights[(outputBase + hiddenCount) * lanes + lane];
+            for (int h = 0; h < hiddenCount; ++h) {
+                const int unit = h * (inputCount + 1);
+                float sum = weights[(unit + inputCount) * lanes + lane];
+                for (int i = 0; i < inputCount; ++i) {
+                    sum += weights[(unit + i) * lanes + lane] * inputs[lane][i];
+                }
+                output += weights[(outputBase + h) * lanes + lane] * fastTanh(sum);
+            }
+            jump[lane] = output > 0.0f;
+        }
+#endif
+    }
+
+    bool saveGenome(const std::string &path, const Genome &genome) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            Logger::getInstance().log(LogLevel::ERROR, "Error: Failed to write genome: " + path);
+            return false;
+        }
+
+        file.write(genomeMagic, sizeof(genomeMagic));
+        writeU32(file, genomeVersion);
+        writeU32(file, inputCount);
+        writeU32(file, hiddenCount);
+        for (const float weight : genome.weights) {
+            writeU32(file, std::bit_cast<std::uint32_t>(weight));
+        }
+        writeU32(file, std::bit_cast<std::uint32_t>(genome.fitness));
+        return static_cast<bool>(file);
+    }
+
+    std::optional<Genome> loadGenome(const std::string &path) {
+        Logger& logger = Logger::getInstance();
+
+        std::ifstream file(path, std::ios::binary);
+        char magic[4] = {};
+        std::uint32_t version = 0;
+        std::uint32_t inputs = 0;
+        std::uint32_t hidden = 0;
+
+        if (!file.read(magic, sizeof(magic)) || !std::equal(magic, magic + 4, genomeMagic) ||
+            !readU32(file, version) || !readU32(file, inputs) || !readU32(file, hidden)) {
+            logger.log(LogLevel::ERROR, "Error: Not a genome file: " + path);
+            return std::nullopt;
+        }
+
+        if (version != genomeVersion || inputs != inputCount || hidden != hiddenCount) {
+            logger.log(LogLevel::ERROR, "Error: Genome " + path + " was trained for a different network layout.");
+            return std::nullopt;
+        }
+
+        Genome genome;
+        std::uint32_t bits = 0;
+        for (float &weight : genome.weights) {
+            if (!readU32(file, bits)) {
+                logger.log(LogLevel::ERROR, "Error: Truncated genome file: " + path);
+                return std::nullopt;
+            }
+            weight = std::bit_cast<float>(bits);
+        }
+        if (readU32(file, bits)) {
+            genome.fitness = std::bit_cast<float>(bits);
+        }
+        return genome;
+    }
+}
@@ -0,0 +1,127 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "DifficultyCurve.hpp"
+
+#include <algorithm>
+#include <fstream>
+
+#include "Logger.hpp"
+
+namespace {
+    float lerp(const float a, const float b, const float t) {
+        return a + (b - a) * t;
+    }
+
+    bool parseFloat(const std::string &value, float &out) {
+        try {
+            out = std::stof(value);
+            return true;
+        } catch (const std::exception &) {
+            return false;
+        }
+    }
+}
+
+DifficultyCurve::DifficultyCurve(std::vector<Point> points) : m_points(std::move(points)) {
+    std::ranges::stable_sort(m_points, {}, &Point::score);
+}
+
+DifficultyCurve DifficultyCurve::load(const std::string &path) {
+    Logger& logger = Logger::getInstance();
+
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        logger.log(LogLevel::INFO, "No difficulty file at " + path + ", difficulty stays flat.");
+        return {};
+    }
+
+    std::vector<Point> points;
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        const std::size_t separator = line.find('=');
+        if (line.empty() || line[0] == '#' || separator == std::string::npos) {
+            continue;
+        }
+
+        const std::string key = line.substr(0, separator);
+        const std::string value = line.substr(separator + 1);
+        const std::string where = path + ":" + std::to_string(lineNumber);
+
+        float number = 0.0f;
+        if (!parseFloat(value, number)) {
+            logger.log(LogLevel::WARNING, "Ignoring difficulty value that is not a number at " + where);
+            continue;
+        }
+
+        if (key == "score") {
+            // Each point starts as a copy of the one before it
+            Point point = points.empty() ? Point{} : points.back();
+            point.score = std::max(0, static_cast<int>(number));
+            points.push_back(point);
+            continue;
+        }
+
+        if (points.empty()) {
+            logger.log(LogLevel::WARNING, "Ignoring " + key + " before the first score= line at " + where);
+            continue;
+        }
+
+        DifficultyLevel &level = points.back().level;
+        if (key == "pipe_speed") {
+            level.pipeSpeed = std::max(0.0f, number);
+        } else if (key == "pipe_gap") {
+            level.pipeGap = std::clamp(number, Simulation::playerHeight, Simulation::maxPipeGap);
+        } else if (key == "pipe_spacing") {
+            level.pipeSpacing = std::max(Simulation::minPipeSpacing, number);
+        } else if (key == "gravity") {
+            level.gravity = number;
+        } else if (key == "projectile_rate") {
+            level.projectileRate = std::max(0.0f, number);
+        } else if (key == "music_pitch") {
+            level.musicPitch = std::clamp(number, 0.5f, 2.0f);
+        } else if (key == "night") {
+            level.night = std::clamp(number, 0.0f, 1.0f);
+        } else {
+            logger.log(LogLevel::WARNING, "Ignoring unknown difficulty key " + key + " at " + where);
+        }
+    }
+
+    logger.log(LogLevel::INFO, "Loaded " + std::to_string(points.size()) + " difficulty points from " + path);
+    return DifficultyCurve(std::move(points));
+}
+
+DifficultyLevel DifficultyCurve::at(const int score) const {
+    if (m_points.empty()) {
+        return {};
+    }
+    if (score <= m_points.front().score) {
+        return m_points.front().level;
+    }
+    if (score >= m_points.back().score) {
+        return m_points.back().level;
+    }
+
+    // First point past the score, the one before it is at or below
+    const auto next = std::ranges::upper_bound(m_points, score, {}, &Point::score);
+    const Point &low = *(next - 1);
+    const Point &high = *next;
+    const float t = static_cast<float>(score - low.score) / static_cast<float>(high.score - low.score);
+
+    return {
+        .pipeSpeed = lerp(low.level.pipeSpeed, high.level.pipeSpeed, t),
+        .pipeGap = lerp(low.level.pipeGap, high.level.pipeGap, t),
+        .pipeSpacing = lerp(low.level.pipeSpacing, high.level.pipeSpacing, t),
+        .gravity = lerp(low.level.gravity, high.level.gravity, t),
+        .projectileRate = lerp(low.level.projectileRate, high.level.projectileRate, t),
+        .musicPitch = lerp(low.level.musicPitch, high.level.musicPitch, t),
+        .night = lerp(low.level.night, high.level.night, t),
+    };
+}
+
+const std::vector<DifficultyCurve::Point> &DifficultyCurve::points() const {
+    return m_points;
+}
@@ -0,0 +1,188 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "FlappyBaraEnv.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "BotBrain.hpp"
+#include "Simulation.hpp"
+
+static_assert(FB_ENV_OBSERVATION_SIZE == BotBrain::inputCount, "Observation layout must match BotBrain::observe()");
+
+struct FbEnv {
+    std::vector<Simulation> sims;
+    std::uint64_t nextSeed = 0;
+    int frameSkip = 1;
+
+    // Pixel observations: every environment is drawn into its own tile of one render texture,
+    // so a render is one GPU readback no matter how many environments there are.
+    int pixelWidth = 0;
+    int pixelHeight = 0;
+    int columns = 0;
+    RenderTexture2D target{};
+};
+
+namespace {
+    // Environments with pixel observations alive right now, and whether the library opened the window they share
+    int renderingEnvs = 0;
+    bool ownsWindow = false;
+
+    void writeObservation(const Simulation &sim, float *out) {
+        const BotBrain::Inputs inputs = BotBrain::observe(sim);
+        std::copy(inputs.begin(), inputs.end(), out);
+    }
+
+    void drawSimulation(const Simulation &sim, const float x, const float y, const float scaleX, const float scaleY) {
+        const auto scaled = [&](const Rectangle r) {
+            return Rectangle{ x + r.x * scaleX, y + r.y * scaleY, r.width * scaleX, r.height * scaleY };
+        };
+
+        DrawRectangleRec(scaled({ 0.0f, 0.0f, Config::WindowWidth, Config::WindowHeight }), SKYBLUE);
+        for (std::size_t i = 0; i < sim.pipeCount(); ++i) {
+            DrawRectangleRec(scaled(sim.topPipe(i)), DARKGREEN);
+            DrawRectangleRec(scaled(sim.bottomPipe(i)), DARKGREEN);
+        }
+        DrawRectangleRec(scaled({ 0.0f, sim.floorY(), Config::WindowWidth, Config::WindowHeight - sim.floorY() }), BROWN);
+        DrawRectangleRec(scaled(sim.playerRect()), GOLD);
+    }
+}
+
+extern "C" {
+
+FbEnv *fb_env_create(const int count, const int frameSkip, const int pixelWidth, const int pixelHeight) {
+    if (count <= 0 || frameSkip <= 0 || pixelWidth < 0 || pixelHeight < 0) {
+        return nullptr;
+    }
+
+    auto *env = new FbEnv;
+    env->sims.resize(static_cast<std::size_t>(count));
+    env->frameSkip = frameSkip;
+
+    if (pixelWidth > 0 && pixelHeight > 0) {
+        env->pixelWidth = pixelWidth;
+        env->pixelHeight = pixelHeight;
+
+        if (!IsWindowReady()) {
+            SetTraceLogLevel(LOG_WARNING);
+            SetConfigFlags(FLAG_WINDOW_HIDDEN);
+            InitWindow(1, 1, "flappybara-env");
+            ownsWindow = true;
+        }
+        renderingEnvs++;
+
+        env->columns = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(count))));
+        const int rows = (count + env->columns - 1) / env->columns;
+        env->target = LoadRenderTexture(env->columns * pixelWidth, rows * pixelHeight);
+    }
+
+    return env;
+}
+
+void fb_env_destroy(FbEnv *env) {
+    if (env == nullptr) {
+        return;
+    }
+
+    if (env->pixelWidth > 0) {
+        if (env->target.id != 0) {
+            UnloadRenderTexture(env->target);
+        }
+
+        // A window the process opened itself is left alone
+        renderingEnvs--;
+        if (renderingEnvs == 0 && ownsWindow) {
+            CloseWindow();
+            ownsWindow = false;
+        }
+    }
+    delete env;
+}
+
+int fb_env_count(const FbEnv *env) {
+    return env != nullptr ? static_cast<int>(env->sims.size()) : 0;
+}
+
+void fb_env_reset(FbEnv *env, const uint64_t seed, float *observations) {
+    for (std::size_t i = 0; i < env->sims.size(); ++i) {
+        env->sims[i].reset(seed + i);
+        writeObservation(env->sims[i], observations + i * FB_ENV_OBSERVATION_SIZE);
+    }
+    env->nextSeed = seed + env->sims.size();
+}
+
+int fb_env_step(FbEnv *env, const uint8_t *actions, float *observations, float *rewards, uint8_t *dones) {
+    int finished = 0;
+
+    for (std::size_t i = 0; i < env->sims.size(); ++i) {
+        Simulation &sim = env->sims[i];
+        const int scoreBefore = sim.score();
+
+        for (int tick = 0; tick < env->frameSkip && !sim.isOver(); ++tick) {
+            sim.step(tick == 0 && actions[i] != 0);
+        }
+
+        float reward = static_cast<float>(sim.score() - scoreBefore);
+        if (sim.isOver()) {
+            reward -= 1.0f;
+            dones[i] = 1;
+            finished++;
+            sim.reset(env->nextSeed++);
+        } else {
+            reward += FB_ENV_ALIVE_REWARD;
+            dones[i] = 0;
+        }
+
+        rewards[i] = reward;
+        writeObservation(sim, observations + i * FB_ENV_OBSERVATION_SIZE);
+    }
+
+    return finished;
+}
+
+int fb_env_render(FbEnv *env, uint8_t *pixels) {
+    if (env->target.id == 0) {
+        return 0;
+    }
+
+    const auto width = static_cast<float>(env->pixelWidth);
+    const auto height = static_cast<float>(env->pixelHeight);
+
+    BeginTextureMode(env->target);
+    ClearBackground(BLACK);
+    for (std::size_t i = 0; i < env->sims.size(); ++i) {
+        const auto column = static_cast<int>(i) % env->columns;
+        const auto row = static_cast<int>(i) / env->columns;
+        drawSimulation(env->sims[i], static_cast<float>(column) * width, static_cast<float>(row) * height,
+            width / Config::WindowWidth, height / Config::WindowHeight);
+    }
+    EndTextureMode();
+
+    // Render textures come back bottom row first, flip while splitting the tiles out
+    Image frame = LoadImageFromTexture(env->target.texture);
+    ImageFormat(&frame, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    const auto *source = static_cast<const std::uint8_t *>(frame.data);
+    const std::size_t rowBytes = static_cast<std::size_t>(env->pixelWidth) * 4;
+    const std::size_t frameBytes = rowBytes * static_cast<std::size_t>(env->pixelHeight);
+
+    for (std::size_t i = 0; i < env->sims.size(); ++i) {
+        const auto column = static_cast<std::size_t>(static_cast<int>(i) % env->columns);
+        const auto row = static_cast<std::size_t>(static_cast<int>(i) / env->columns);
+
+        for (int y = 0; y < env->pixelHeight; ++y) {
+            const std::size_t sourceRow = static_cast<std::size_t>(frame.height) - 1 - (row * static_cast<std::size_t>(env->pixelHeight) + static_cast<std::size_t>(y));
+            const std::uint8_t *from = source + sourceRow * static_cast<std::size_t>(frame.width) * 4 + column * rowBytes;
+            std::memcpy(pixels + i * frameBytes + static_cast<std::size_t>(y) * rowBytes, from, rowBytes);
+        }
+    }
+
+    UnloadImage(frame);
+    return 1;
+}
+
+}
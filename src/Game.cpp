@@ -3,21 +3,77 @@
 //
 
 #include "Game.hpp"
+#include <algorithm>
 #include <random>
 
 #define RAYGUI_IMPLEMENTATION
 #include "raygui.h"
 
-Game::Game(GameState &game_state, AudioResourceManager &audioManager, TextureResourceManager &textureManager)
-    : game_state(game_state), audioManager(audioManager), textureManager(textureManager) {
+#include "textures/player_mask.h"
+
+namespace {
+    struct FollowPlayer {
+        using Signature = Ecs::Signature<const PlayerBody, Transform>;
+        const Simulation &sim;
+
+        void operator()(const PlayerBody &, Transform &transform) const {
+            transform.rect = sim.playerRect();
+        }
+    };
+
+    struct FollowPipes {
+        using Signature = Ecs::Signature<const PipeSegment, Transform, Sprite>;
+        const Simulation &sim;
+
+        void operator()(const PipeSegment &segment, Transform &transform, Sprite &sprite) const {
+            sprite.visible = segment.pair < sim.pipeCount();
+            if (sprite.visible) {
+                transform.rect = segment.top ? sim.topPipe(segment.pair) : sim.bottomPipe(segment.pair);
+            }
+        }
+    };
+
+    struct DrawSprites {
+        using Signature = Ecs::Signature<const Transform, const Sprite>;
+        TextureResourceManager &textures;
+
+        void operator()(const Transform &transform, const Sprite &sprite) const {
+            if (!sprite.visible) {
+                return;
+            }
+            const Texture2D texture = textures.getTexture(sprite.texture);
+            const Rectangle source = { 0.0f, 0.0f, static_cast<float>(texture.width), static_cast<float>(texture.height) };
+            DrawTexturePro(texture, source, transform.rect, { 0.0f, 0.0f }, 0.0f, WHITE);
+        }
+    };
+}
+
+Game::Game(GameState &game_state, AudioResourceManager &audioManager, TextureResourceManager &textureManager, Settings &settings)
+    : game_state(game_state), audioManager(audioManager), textureManager(textureManager), settings(settings),
+      m_difficulty(DifficultyCurve::load(Config::difficultyPath)),
+      m_projectiles(Config::maxProjectiles, Config::projectileRadius,
+          // A cell of margin around the screen so projectiles spawn just off the right edge and leave it fully
+          { -Config::projectileCellSize, -Config::projectileCellSize,
+            static_cast<float>(Config::WindowWidth) + 2.0f * Config::projectileCellSize,
+            static_cast<float>(Config::WindowHeight) + 2.0f * Config::projectileCellSize },
+          Config::projectileCellSize) {
 
     Logger& logger = Logger::getInstance();
 
-    m_playerPosition = GlobalVariables::defaultPosition;
-    m_playerSpeed = GlobalVariables::defaultSpeed;
-    m_score = 0;
+    static_assert(PLAYER_MASK_SIZE == Collision::maskSize, "player_mask.h is out of date, re-run flappybara-cook");
+    std::ranges::copy(PLAYER_MASK_ROWS, m_playerMask.rows.begin());
+    m_sim.setPlayerMask(&m_playerMask);
+    m_sim.setDifficulty(&m_difficulty);
+
+    // Archetypes are drawn in the order they were created, pipes first so the player is drawn over them
+    for (std::uint32_t pair = 0; pair < Simulation::maxPipePairs; ++pair) {
+        m_world.create(PipeSegment{ pair, true }, Transform{}, Sprite{ TextureId::PipeGreen });
+        m_world.create(PipeSegment{ pair, false }, Transform{}, Sprite{ TextureId::PipeGreen });
+    }
+    m_world.create(PlayerBody{}, Transform{}, Sprite{ TextureId::Player });
+
     m_gameOverScore = 0;
-    m_pipePassed = false;
+    reset_game();
 
     logger.log(LogLevel::INFO, "Game initialized with default player position and speed.");
 }
@@ -27,182 +83,253 @@ Game::~Game() = default;
 void Game::update() {
     Logger& logger = Logger::getInstance();
 
-    // Apply gravity to player
-    m_playerSpeed += m_gravity * GetFrameTime();
-    m_playerPosition.y += m_playerSpeed * GetFrameTime();
-
-    // logger.log(LogLevel::DEBUG, "Player position updated: Y = " + std::to_string(m_playerPosition.y));
-    // logger.log(LogLevel::DEBUG, "Player speed updated: Speed = " + std::to_string(m_playerSpeed));
-
-    // Jump if space is pressed
-    if (IsKeyPressed(KEY_SPACE)) {
-        m_playerSpeed = m_jumpHeight;
-        // audioManager.playAudio("spring-effect"); // its kinda annoying lol
-        logger.log(LogLevel::INFO, "Player jumped. Current speed: " + std::to_string(m_playerSpeed));
-    }
-
-    // Floor collision
-    const float floorHeight = static_cast<float>(GetScreenHeight()) * 0.1f; // 10% of screen height
-    const float floorY = static_cast<float>(GetScreenHeight()) - floorHeight;
-
-    if (m_playerPosition.y + m_playerHeight >= floorY) {
-        game_state.activity_state = GameActivityState::GAME_OVER;
-        audioManager.playAudio("game-over");
-        logger.log(LogLevel::INFO, "Player collided with the floor. Game over.");
+    if (m_demo && anyInput()) {
+        logger.log(LogLevel::INFO, "Demo interrupted, back to the menu.");
+        m_demo = false;
+        reset_game();
+        game_state.activity_state = GameActivityState::MENU;
         return;
     }
 
-    // Check if player has hit world boundaries
-    if (m_playerPosition.y < 0 || m_playerPosition.x > Config::WindowWidth) {
-        game_state.activity_state = GameActivityState::GAME_OVER;
-        audioManager.playAudio("game-over");
-        logger.log(LogLevel::INFO, "Player hit world boundaries. Game over.");
-        return;
+    InputSource *input = m_demo || m_soak ? m_autoplay : m_input;
+    input->beginFrame();
+
+    const float frameTime = m_dropFrameTime ? 0.0f : GetFrameTime();
+    m_dropFrameTime = false;
+
+    // Real time rather than simulation steps, the fade is only for show
+    const float fadeStep = frameTime / Config::nightFadeSeconds;
+    m_night = m_night < m_nightTarget ? std::min(m_night + fadeStep, m_nightTarget) : std::max(m_night - fadeStep, m_nightTarget);
+
+    // Run as many fixed steps as the frame took, the remainder carries over to the next frame
+    m_accumulator = std::min(m_accumulator + frameTime, Config::maxFrameTime);
+    while (m_accumulator >= Config::simulationStep) {
+        m_accumulator -= Config::simulationStep;
+
+        const std::uint32_t events = m_sim.step(input->wantsJump(m_sim));
+        m_scrolled += static_cast<double>(m_sim.pipeScrollSpeed() * Config::simulationStep);
+
+        bool hitProjectile = false;
+        if (!(events & SimEventDied)) {
+            spawnProjectiles();
+            m_projectiles.update(Config::simulationStep);
+            hitProjectile = m_projectiles.overlaps(m_sim.playerRect(), &m_playerMask);
+        }
+
+        if (events & SimEventJumped) {
+            // audioManager.playAudio(AudioId::SpringEffect); // its kinda annoying lol
+            logger.log(LogLevel::INFO, "Player jumped. Current speed: " + std::to_string(m_sim.playerSpeed()));
+        }
+
+        if (events & SimEventScored) {
+            applyDifficulty();
+            audioManager.playAudio(AudioId::Score);
+            logger.log(LogLevel::INFO, "Player passed a pipe. Score updated: " + std::to_string(m_sim.score()));
+        }
+
+        if ((events & SimEventDied) || hitProjectile) {
+            if (hitProjectile) {
+                logger.log(LogLevel::INFO, "Player hit a projectile. Game over.");
+            } else if (events & SimEventHitFloor) {
+                logger.log(LogLevel::INFO, "Player collided with the floor. Game over.");
+            } else if (events & SimEventHitBoundary) {
+                logger.log(LogLevel::INFO, "Player hit world boundaries. Game over.");
+            } else {
+                logger.log(LogLevel::INFO, "Collision detected with pipe. Game over.");
+            }
+
+            audioManager.playAudio(AudioId::GameOver);
+
+            // Demo and soak runs go straight into the next run
+            if (m_demo || m_soak) {
+                m_autoplayRuns++;
+                logger.log(LogLevel::INFO, "Autoplay run " + std::to_string(m_autoplayRuns) + " ended with score " +
+                    std::to_string(m_sim.score()) + " after " + std::to_string(m_sim.ticks()) + " steps.");
+                reset_game();
+                return;
+            }
+
+            game_state.activity_state = GameActivityState::GAME_OVER;
+            m_gameOverScore = m_sim.score();
+            return;
+        }
     }
+}
 
-    // Move pipes
-    m_pipes[0].x -= m_pipeSpeed * GetFrameTime();
-    m_pipes[1].x -= m_pipeSpeed * GetFrameTime();
+void Game::reset_game() {
+    Logger& logger = Logger::getInstance();
 
-    // logger.log(LogLevel::DEBUG, "Pipe positions updated: Pipe1 X = " + std::to_string(m_pipes[0].x) + ", Pipe2 X = " + std::to_string(m_pipes[1].x));
+    // Every run gets fresh pipes, the simulation itself is deterministic for a given seed
+    std::random_device rd;
+    const std::uint64_t seed = (static_cast<std::uint64_t>(rd()) << 32) | rd();
+
+    m_sim.reset(seed);
+    m_projectiles.clear();
+    m_projectileRng.seed(static_cast<std::mt19937::result_type>(seed ^ (seed >> 32)));
+    m_projectilesDue = 0.0f;
+    applyDifficulty();
+    m_night = m_nightTarget;   // A new run starts under its sky instead of fading into it
+    m_scrolled = 0.0;
+    m_accumulator = 0.0f;
+    m_gameOverScore = 0;
 
-    // Reset pipes when off-screen
-    if (m_pipes[0].x + m_pipeWidth < 0) {
-        // Seed random for pipe gap positions
-        std::random_device rd;
-        std::mt19937 mt(rd());
-        std::uniform_real_distribution dist(50.0f, floorY - m_pipeGap - 50.0f);
-        const auto randomHeight = dist(mt);
+    logger.log(LogLevel::INFO, "Game reset to initial state.");
+}
 
-        m_pipes[0].x = Config::WindowWidth;
-        m_pipes[1].x = Config::WindowWidth;
-        m_pipes[0].height = randomHeight;
-        m_pipes[1].y = randomHeight + m_pipeGap;
-        m_pipes[1].height = floorY - m_pipes[1].y;
-        m_pipePassed = false;
+void Game::pause() {
+    Logger::getInstance().log(LogLevel::INFO, "Game paused at step " + std::to_string(m_sim.ticks()) + ".");
+    audioManager.setPaused(true);
+}
 
-        logger.log(LogLevel::INFO, "Pipes reset. New heights: Pipe1 Height = " + std::to_string(m_pipes[0].height) + ", Pipe2 Y = " + std::to_string(m_pipes[1].y));
-    }
+void Game::resume() {
+    Logger::getInstance().log(LogLevel::INFO, "Game resumed.");
+    audioManager.setPaused(false);
+    m_dropFrameTime = true;
+}
 
-    // Check if player has passed a pipe
-    if (!m_pipePassed && m_pipes[0].x + m_pipeWidth < m_playerPosition.x) {
-        m_score++;
-        m_pipePassed = true; // Prevents multiple increments for the same pipe
-        audioManager.playAudio("score");
+void Game::setInputSource(InputSource *input) {
+    m_input = input != nullptr ? input : &m_keyboard;
+}
 
-        logger.log(LogLevel::INFO, "Player passed a pipe. Score updated: " + std::to_string(m_score));
-    }
+void Game::setAttractInput(InputSource *bot) {
+    m_autoplay = bot;
+    m_menuIdleTime = 0.0f;
+}
 
-    // Define player rectangle
-    const Rectangle playerRect = {
-        m_playerPosition.x,
-        m_playerPosition.y,
-        m_playerWidth,
-        m_playerHeight
-    };
+void Game::startSoak(InputSource *bot) {
+    Logger::getInstance().log(LogLevel::INFO, "Soak test started, the bot plays until the window is closed.");
 
-    // Collision detection using CheckCollisionRecs
-    if (CheckCollisionRecs(playerRect, m_pipes[0]) || CheckCollisionRecs(playerRect, m_pipes[1])) {
-        audioManager.playAudio("game-over");
-        game_state.activity_state = GameActivityState::GAME_OVER;
-        m_gameOverScore = m_score;
+    m_autoplay = bot;
+    m_soak = true;
+    m_autoplayRuns = 0;
+    reset_game();
+    game_state.activity_state = GameActivityState::PLAYING;
+}
 
-        logger.log(LogLevel::INFO, "Collision detected with pipe. Game over.");
-    }
+void Game::setProjectileRate(const float perSecond) {
+    m_projectileRate = std::max(0.0f, perSecond);
 }
 
-void Game::reset_game() {
-    Logger& logger = Logger::getInstance();
+void Game::applyDifficulty() {
+    // m_sim already evaluated the curve at this score
+    const DifficultyLevel &level = m_sim.difficulty();
+    m_projectileRateScale = level.projectileRate;
+    audioManager.setMusicPitch(level.musicPitch);
+    m_nightTarget = level.night;
+}
 
-    m_playerSpeed = GlobalVariables::defaultSpeed;
-    m_playerPosition = GlobalVariables::defaultPosition;
-    m_pipePassed = false;
-    m_score = 0;
-    m_gameOverScore = 0;
+void Game::spawnProjectiles() {
+    if (m_demo || m_soak) {
+        return;
+    }
 
-    m_pipes[0] = { Config::WindowWidth, 0, m_pipeWidth, 200 };
-    m_pipes[1] = { Config::WindowWidth, 200 + m_pipeGap, m_pipeWidth, Config::WindowHeight - 200 - m_pipeGap };
+    m_projectilesDue += m_projectileRate * m_projectileRateScale * Config::simulationStep;
+    if (m_projectilesDue < 1.0f) {
+        return;
+    }
 
-    logger.log(LogLevel::INFO, "Game reset to initial state.");
+    // Anywhere above the floor, always faster than the pipes scroll right now so they overtake them
+    const float pipeSpeed = m_sim.pipeScrollSpeed();
+    std::uniform_real_distribution<float> height(Config::projectileRadius, m_sim.floorY() - Config::projectileRadius);
+    std::uniform_real_distribution<float> speed(pipeSpeed + 50.0f, pipeSpeed + 250.0f);
+    std::uniform_real_distribution<float> drift(-40.0f, 40.0f);
+    for (; m_projectilesDue >= 1.0f; m_projectilesDue -= 1.0f) {
+        const Vector2 position = { static_cast<float>(Config::WindowWidth) + Config::projectileRadius, height(m_projectileRng) };
+        m_projectiles.spawn(position, { -speed(m_projectileRng), drift(m_projectileRng) });
+    }
 }
 
-void Game::draw() {
-    const Texture2D background = textureManager.getTexture("background-day");
-    const Texture2D pipe = textureManager.getTexture("pipe-green");
-    const Texture2D floor = textureManager.getTexture("floor");
-    const Texture2D player = textureManager.getTexture("player");
+bool Game::anyInput() {
+    return GetKeyPressed() != 0 || IsMouseButtonPressed(MOUSE_BUTTON_LEFT) || IsMouseButtonPressed(MOUSE_BUTTON_RIGHT);
+}
 
-    // Define the source rectangle (full texture)
-    const Rectangle source = { 0.0f, 0.0f, static_cast<float>(background.width), static_cast<float>(background.height) };
+bool Game::uiButton(const Rectangle bounds, const char *text) {
+    if (!GuiButton(bounds, text)) {
+        return false;
+    }
+    // Routed to AudioBus::Ui, so the Interface slider sets how loud the menus are
+    audioManager.playAudio(AudioId::LevelComplete);
+    return true;
+}
+
+void Game::draw() {
+    const Texture2D scenery = textureManager.getTexture(TextureId::ParallaxAtlas);
 
     // Define the destination rectangle (screen dimensions)
     const Rectangle dest = { 0.0f, 0.0f, static_cast<float>(GetScreenWidth()), static_cast<float>(GetScreenHeight()) };
 
-    // Origin point for rotation (not used here, so set to (0,0))
-    constexpr Vector2 origin = { 0.0f, 0.0f };
-
-    // Draw the background texture scaled to fit the screen
-    DrawTexturePro(background, source, dest, origin, 0.0f, WHITE);
+    // Move the entities to where the simulation has them
+    FollowPipes followPipes{ m_sim };
+    FollowPlayer followPlayer{ m_sim };
+    m_world.run(followPipes);
+    m_world.run(followPlayer);
 
-    // Draw the pipes
-    DrawTexturePro(pipe, source, m_pipes[0], origin, 0.0f, WHITE);
-    DrawTexturePro(pipe, source, m_pipes[1], origin, 0.0f, WHITE);
+    // Cooked textures have premultiplied alpha
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
 
-    // Adjust the scale factor to fit the height of the floor
-    const float floorScale = static_cast<float>(GetScreenHeight()) * 0.1f / static_cast<float>(floor.height); // Floor height 10% of screen height
-    const float floorHeight = static_cast<float>(floor.height) * floorScale;
+    // Draw the sky, clouds, city, bushes and floor in one pass. The bottom pipes end where the floor starts,
+    // so it can go behind them.
+    m_background.draw(scenery, m_scrolled, m_night, dest);
 
-    // Calculate the number of tiles needed to fill the screen width
-    const int tiles = static_cast<int>(std::ceil(static_cast<float>(GetScreenWidth()) / (static_cast<float>(floor.width) * floorScale)));
+    // Draw the pipes and the player
+    DrawSprites drawSprites{ textureManager };
+    m_world.run(drawSprites);
 
-    // Position at the bottom of the screen
-    const float floorY = static_cast<float>(GetScreenHeight()) - floorHeight;
-
-    // Draw the floor texture tiled across the bottom
-    for (int i = 0; i < tiles; ++i) {
-        const float floorX = static_cast<float>(i) * static_cast<float>(floor.width) * floorScale; // X position for each tile
-        DrawTextureEx(floor, { floorX, floorY }, 0.0f, floorScale, WHITE);
+    // Draw the projectiles
+    for (std::size_t slot = 0; slot < m_projectiles.slotCount(); ++slot) {
+        if (m_projectiles.active(slot)) {
+            DrawCircleV(m_projectiles.position(slot), m_projectiles.radius(), RED);
+        }
     }
 
-    // Define the source rectangle for the player (full player texture)
-    const Rectangle playerSource = { 0.0f, 0.0f, static_cast<float>(player.width), static_cast<float>(player.height) };
-
-    // Define the destination rectangle for the player (position and size on the screen)
-    const Rectangle playerDest = {
-        m_playerPosition.x,
-        m_playerPosition.y,
-        70.0f, // Width of the player on the screen
-        70.0f  // Height of the player on the screen
-    };
+    EndBlendMode();
 
-    // Draw the player texture
-    DrawTexturePro(player, playerSource, playerDest, origin, 0.0f, WHITE);
 
+    DrawText(TextFormat("Player Y: %.2f", m_sim.playerPosition().y), 10, 30, 20, WHITE);
+    DrawText(TextFormat("Player Speed: %.2f", m_sim.playerSpeed()), 10, 50, 20, WHITE);
+    const Rectangle topPipe = m_sim.topPipe();
+    const Rectangle bottomPipe = m_sim.bottomPipe();
+    DrawText(TextFormat("Pipe 1 X: %.2f, Height: %.2f", topPipe.x, topPipe.height), 10, 70, 20, WHITE);
+    DrawText(TextFormat("Pipe 2 X: %.2f, Y: %.2f, Height: %.2f", bottomPipe.x, bottomPipe.y, bottomPipe.height), 10, 90, 20, WHITE);
+    DrawText(TextFormat("Score: %d", m_sim.score()), 10, 10, 20, WHITE);
 
-    DrawText(TextFormat("Player Y: %.2f", m_playerPosition.y), 10, 30, 20, WHITE);
-    DrawText(TextFormat("Player Speed: %.2f", m_playerSpeed), 10, 50, 20, WHITE);
-    DrawText(TextFormat("Pipe 1 X: %.2f, Height: %.2f", m_pipes[0].x, m_pipes[0].height), 10, 70, 20, WHITE);
-    DrawText(TextFormat("Pipe 2 X: %.2f, Y: %.2f, Height: %.2f", m_pipes[1].x, m_pipes[1].y, m_pipes[1].height), 10, 90, 20, WHITE);
-    DrawText(TextFormat("Score: %d", m_score), 10, 10, 20, WHITE);
+    if (m_demo) {
+        DrawText("DEMO - press any key", Config::WindowWidth / 2 - 120, Config::WindowHeight / 4, 25, WHITE);
+    } else if (m_soak) {
+        DrawText(TextFormat("SOAK - run %llu", static_cast<unsigned long long>(m_autoplayRuns + 1)), Config::WindowWidth - 200, 10, 20, WHITE);
+    }
 }
 
 void Game::draw_menu() {
     DrawText("FlappyBara", Config::WindowWidth / 2 - 100, Config::WindowHeight / 4 - 100, 40, WHITE);
 
+    // Attract mode, the demo starts after the menu has sat idle for a while
+    if (m_autoplay != nullptr) {
+        m_menuIdleTime = anyInput() || GetMouseDelta().x != 0.0f || GetMouseDelta().y != 0.0f ? 0.0f : m_menuIdleTime + GetFrameTime();
+        if (m_menuIdleTime >= Config::attractIdleSeconds) {
+            Logger::getInstance().log(LogLevel::INFO, "Menu idle, starting the demo.");
+            m_menuIdleTime = 0.0f;
+            m_demo = true;
+            reset_game();
+            game_state.activity_state = GameActivityState::PLAYING;
+            return;
+        }
+    }
+
     // Play Button
     constexpr Rectangle playButton = { static_cast<float>(Config::WindowWidth) / 2.0f - 75.0f, static_cast<float>(Config::WindowHeight) / 2.0f - 50.0f, 150.0f, 50.0f };
-    if (GuiButton(playButton, "Play")) {
+    if (uiButton(playButton, "Play")) {
         game_state.activity_state = GameActivityState::PLAYING;
         reset_game(); // Ensure game state is initialized when starting
     }
 
     constexpr Rectangle settingsButton = { playButton.x, playButton.y + 80.0f, playButton.width, playButton.height };
-    if (GuiButton(settingsButton, "Settings")) {
+    if (uiButton(settingsButton, "Settings")) {
         game_state.activity_state = GameActivityState::SETTINGS; // Open settings
     }
 
     constexpr Rectangle exitButton = { playButton.x, playButton.y + 160.0f, playButton.width, playButton.height };
-    if (GuiButton(exitButton, "Exit")) {
+    if (uiButton(exitButton, "Exit")) {
         game_state.activity_state = GameActivityState::EXIT;
     }
 }
@@ -219,8 +346,61 @@ void Game::draw_game_over() {
     constexpr float buttonHeight = 50.0f;
     const Rectangle menuButton = { static_cast<float>(Config::WindowWidth) / 2.0f - buttonWidth / 2.0f, static_cast<float>(Config::WindowHeight) / 2.0f + 60.0f, buttonWidth, buttonHeight };
 
-    if (GuiButton(menuButton, "Back")) {
+    if (uiButton(menuButton, "Back")) {
+        reset_game();
+        game_state.activity_state = GameActivityState::MENU;
+    }
+}
+
+void Game::draw_pause() {
+    DrawRectangle(0, 0, Config::WindowWidth, Config::WindowHeight, Fade(BLACK, 0.5f));
+    DrawText("Paused", Config::WindowWidth / 2 - 70, Config::WindowHeight / 4 - 100, 40, WHITE);
+
+    constexpr Rectangle resumeButton = { static_cast<float>(Config::WindowWidth) / 2.0f - 75.0f, static_cast<float>(Config::WindowHeight) / 2.0f - 50.0f, 150.0f, 50.0f };
+    if (uiButton(resumeButton, "Resume") || IsKeyPressed(KEY_P)) {
+        game_state.activity_state = GameActivityState::PLAYING;
+    }
+
+    constexpr Rectangle settingsButton = { resumeButton.x, resumeButton.y + 80.0f, resumeButton.width, resumeButton.height };
+    if (uiButton(settingsButton, "Settings")) {
+        game_state.activity_state = GameActivityState::SETTINGS;
+    }
+
+    constexpr Rectangle menuButton = { resumeButton.x, resumeButton.y + 160.0f, resumeButton.width, resumeButton.height };
+    if (uiButton(menuButton, "Menu")) {
         reset_game();
         game_state.activity_state = GameActivityState::MENU;
     }
-}
\ No newline at end of file
+}
+
+void Game::draw_settings() {
+    DrawText("Settings", Config::WindowWidth / 2 - 80, Config::WindowHeight / 4 - 100, 40, WHITE);
+
+    const Settings before = settings;
+
+    constexpr float sliderWidth = 300.0f;
+    constexpr float sliderHeight = 24.0f;
+    constexpr float sliderX = static_cast<float>(Config::WindowWidth) / 2.0f - sliderWidth / 2.0f + 40.0f;
+    constexpr float firstSliderY = static_cast<float>(Config::WindowHeight) / 4.0f;
+
+    GuiSliderBar({ sliderX, firstSliderY, sliderWidth, sliderHeight }, "Master", TextFormat("%d%%", static_cast<int>(settings.masterVolume * 100.0f)), &settings.masterVolume, 0.0f, 1.0f);
+    GuiSliderBar({ sliderX, firstSliderY + 50.0f, sliderWidth, sliderHeight }, "Sound", TextFormat("%d%%", static_cast<int>(settings.sfxVolume * 100.0f)), &settings.sfxVolume, 0.0f, 1.0f);
+    GuiSliderBar({ sliderX, firstSliderY + 100.0f, sliderWidth, sliderHeight }, "Music", TextFormat("%d%%", static_cast<int>(settings.musicVolume * 100.0f)), &settings.musicVolume, 0.0f, 1.0f);
+    GuiSliderBar({ sliderX, firstSliderY + 150.0f, sliderWidth, sliderHeight }, "Interface", TextFormat("%d%%", static_cast<int>(settings.uiVolume * 100.0f)), &settings.uiVolume, 0.0f, 1.0f);
+    GuiCheckBox({ sliderX, firstSliderY + 200.0f, sliderHeight, sliderHeight }, "Mute", &settings.muted);
+
+    // Only post mixer commands on frames where something actually moved
+    if (settings.masterVolume != before.masterVolume || settings.sfxVolume != before.sfxVolume || settings.musicVolume != before.musicVolume ||
+        settings.uiVolume != before.uiVolume || settings.muted != before.muted) {
+        audioManager.applySettings(settings);
+    }
+
+    constexpr float buttonWidth = 150.0f;
+    constexpr float buttonHeight = 50.0f;
+    constexpr Rectangle backButton = { static_cast<float>(Config::WindowWidth) / 2.0f - buttonWidth / 2.0f, firstSliderY + 280.0f, buttonWidth, buttonHeight };
+
+    if (uiButton(backButton, "Back")) {
+        settings.save(Config::settingsPath);
+        game_state.activity_state = GameActivityState::MENU;
+    }
+}
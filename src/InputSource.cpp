@@ -0,0 +1,241 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "InputSource.hpp"
+
+#include <cmath>
+
+namespace {
+    // A second flap this soon after the first barely changes the arc, so the search doesn't try it
+    constexpr float stillRisingSpeed = Simulation::jumpHeight * 0.5f;
+
+    // The clock is read before every branch, and every this many steps of a straight walk so a single long walk
+    // can't run far past the deadline either. A read costs about as much as a few simulation steps.
+    constexpr std::uint64_t clockCheckSteps = 32;
+
+    // How far past the next pipe a line has to survive, so it doesn't end pinned against the pipe's far edge
+    constexpr std::uint64_t clearedPipeTicks = 30;
+
+    // The longest lookahead: a pipe that just spawned at the right edge plus the tail behind it
+    constexpr auto maxLookaheadTicks = static_cast<std::size_t>(
+        (Config::WindowWidth + Simulation::pipeWidth) / (Simulation::pipeSpeed * Config::simulationStep)) + clearedPipeTicks;
+
+    // Dead ends are remembered per quarter pixel of height and in a table of this many entries. Exact heights would
+    // almost never repeat across lines, and the cache would stop saving searches.
+    constexpr float deadEndBucketsPerPixel = 4.0f;
+    constexpr std::size_t deadEndSlots = 1 << 14;
+
+    // Fallback when no plan covers a step: flap once the bird sinks to just above the bottom of the gap
+    constexpr float fallbackFlapMargin = 4.0f;
+}
+
+void KeyboardInput::beginFrame() {
+    pressed = IsKeyPressed(KEY_SPACE);
+}
+
+bool KeyboardInput::wantsJump(const Simulation &) {
+    const bool jump = pressed;
+    pressed = false;
+    return jump;
+}
+
+GenomeInput::GenomeInput(const BotBrain::Genome &genome) : genome(genome) {
+}
+
+bool GenomeInput::wantsJump(const Simulation &sim) {
+    return BotBrain::decide(genome, BotBrain::observe(sim));
+}
+
+LookaheadInput::LookaheadInput(const std::chrono::microseconds frameBudget) : budget(frameBudget), deadEnds(deadEndSlots) {
+    for (std::vector<Simulation> &points : branchPoints) {
+        points.reserve(std::max<std::size_t>(Config::botLookaheadTicks, maxLookaheadTicks) / Config::botFlapResolutionTicks + 1);
+    }
+}
+
+void LookaheadInput::beginFrame() {
+    deadline = Clock::now() + budget;
+}
+
+bool LookaheadInput::wantsJump(const Simulation &sim) {
+    // Look until the bird has flown past the pipe it is heading for, or the minimum lookahead if it already has
+    const Rectangle pipe = sim.bottomPipe();
+    const float distance = pipe.x + pipe.width - sim.playerPosition().x;
+    std::uint64_t lookahead = Config::botLookaheadTicks;
+    if (distance > 0.0f) {
+        const auto ticksToClear = static_cast<std::uint64_t>(std::ceil(distance / (sim.pipeScrollSpeed() * Config::simulationStep)));
+        lookahead = std::max(lookahead, ticksToClear + clearedPipeTicks);
+    }
+    const std::uint64_t horizon = sim.ticks() + lookahead;
+
+    // Dead ends stay known for the rest of the run, so a search the budget cut short gets further on the next step
+    if (sim.ticks() < searchStart) {
+        generation++;
+    }
+    searchStart = sim.ticks();
+
+    // Every walk below is checked against the frame's deadline, including the first one
+    bool aborted = Clock::now() >= deadline;
+    if (aborted) {
+        cutShort++;
+        return followPlan(sim);
+    }
+
+    // The simulation is deterministic, so the line found earlier stays good until the horizon moves past its end.
+    // Replaying it is one walk instead of a search and covers nearly every step.
+    const std::uint64_t replayed = replay(sim, horizon, aborted);
+    if (aborted) {
+        cutShort++;
+        return followPlan(sim);
+    }
+    if (replayed >= horizon) {
+        planHorizon = horizon;
+        return followPlan(sim);
+    }
+
+    // A search cut short by the budget still returns the longest line it had found, keep whichever lives longer
+    Plan line;
+    Plan best;
+    if (search(sim, horizon, Config::botMaxFlaps, line, best, aborted) > replayed) {
+        plan = best;
+        plannedAt = searchStart;
+        planHorizon = horizon;
+    }
+    if (aborted) {
+        cutShort++;
+    }
+
+    return followPlan(sim);
+}
+
+std::uint64_t LookaheadInput::searchesCutShort() const {
+    return cutShort;
+}
+
+std::uint64_t LookaheadInput::search(const Simulation &start, const std::uint64_t horizon, const int flapsLeft, Plan &line,
+                                     Plan &best, bool &aborted) {
+    // Returns the tick the longest line dies at, or horizon if one survives it, and that line in best.
+    // Not flapping again comes first, remembering every step a flap could branch off on the way.
+    // Only lines that may still flap need branch points, so a full line never indexes past the last list
+    std::vector<Simulation> *points = flapsLeft > 0 ? &branchPoints[line.count] : nullptr;
+    if (points != nullptr) {
+        points->clear();
+    }
+
+    Simulation sim = start;
+    while (sim.ticks() < horizon) {
+        // A walk the deadline cut off proved nothing, so it doesn't count as surviving any further than its start
+        if ((sim.ticks() - start.ticks()) % clockCheckSteps == clockCheckSteps - 1 && Clock::now() >= deadline) {
+            aborted = true;
+            best = line;
+            return start.ticks();
+        }
+
+        // Flap times are counted from the step being decided, so jumping right now is always an option
+        const bool onGrid = (sim.ticks() - searchStart) % Config::botFlapResolutionTicks == 0;
+        if (points != nullptr && onGrid && sim.playerSpeed() >= stillRisingSpeed) {
+            points->push_back(sim);
+        }
+
+        sim.step(false);
+        if (sim.isOver()) {
+            break;
+        }
+    }
+
+    std::uint64_t longest = sim.ticks();
+    best = line;
+    if (longest >= horizon || points == nullptr) {
+        return longest;
+    }
+
+    // Latest flap first, flapping as late as possible leaves the most room for the rest of the line
+    for (std::size_t i = points->size(); i-- > 0;) {
+        if (Clock::now() >= deadline) {
+            aborted = true;
+            return longest;
+        }
+
+        Simulation flapped = (*points)[i];
+        line.flaps[line.count++] = flapped.ticks();
+        Plan branch = line;
+        flapped.step(true);
+
+        std::uint64_t survived = flapped.ticks();
+        if (!flapped.isOver()) {
+            DeadEnd &entry = deadEnd(flapped);
+            if (entry.generation == generation && entry.flapsLeft >= flapsLeft - 1) {
+                survived = entry.longest;
+            } else {
+                survived = search(flapped, horizon, flapsLeft - 1, line, branch, aborted);
+                if (!aborted && survived < horizon) {
+                    entry = DeadEnd{ .key = deadEndKey(flapped), .longest = survived, .flapsLeft = flapsLeft - 1, .generation = generation };
+                }
+            }
+        }
+        line.count--;
+
+        if (survived > longest) {
+            longest = survived;
+            best = branch;
+        }
+        if (aborted || survived >= horizon) {
+            break;
+        }
+    }
+    return longest;
+}
+
+std::uint64_t LookaheadInput::deadEndKey(const Simulation &flapped) {
+    // Right after a flap the speed is always the same, so the step and the height are the whole state.
+    // The height is rounded down to a bucket, so flaps a fraction of a pixel apart share one entry.
+    const auto height = static_cast<std::uint64_t>(std::max(0.0f, flapped.playerPosition().y) * deadEndBucketsPerPixel);
+    return flapped.ticks() << 16 | height;
+}
+
+LookaheadInput::DeadEnd &LookaheadInput::deadEnd(const Simulation &flapped) {
+    const std::uint64_t key = deadEndKey(flapped);
+    const std::size_t slot = static_cast<std::size_t>(key * 0x9e3779b97f4a7c15ull >> 40) & (deadEnds.size() - 1);
+    DeadEnd &entry = deadEnds[slot];
+    if (entry.key != key) {
+        // Another bucket in this slot only costs a repeated search. Within a bucket the answer is an approximation:
+        // a flap a little higher or lower than the one searched is taken to crash at the same tick.
+        entry.generation = 0;
+    }
+    return entry;
+}
+
+std::uint64_t LookaheadInput::replay(const Simulation &start, const std::uint64_t horizon, bool &aborted) const {
+    if (start.ticks() < plannedAt) {
+        return start.ticks();
+    }
+
+    Simulation sim = start;
+    while (sim.ticks() < horizon && !sim.isOver()) {
+        if ((sim.ticks() - start.ticks()) % clockCheckSteps == clockCheckSteps - 1 && Clock::now() >= deadline) {
+            aborted = true;
+            return sim.ticks();
+        }
+        sim.step(plan.flapsAt(sim.ticks()));
+    }
+    return sim.ticks();
+}
+
+bool LookaheadInput::followPlan(const Simulation &sim) const {
+    // The plan only applies to the run it was made for
+    if (sim.ticks() >= plannedAt && sim.ticks() < planHorizon) {
+        return plan.flapsAt(sim.ticks());
+    }
+
+    const float gapBottom = sim.bottomPipe().y - fallbackFlapMargin;
+    return sim.playerSpeed() > 0.0f && sim.playerPosition().y + Simulation::playerHeight > gapBottom;
+}
+
+bool LookaheadInput::Plan::flapsAt(const std::uint64_t tick) const {
+    for (int i = 0; i < count; ++i) {
+        if (flaps[i] == tick) {
+            return true;
+        }
+    }
+    return false;
+}
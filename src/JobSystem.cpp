@@ -0,0 +1,269 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "JobSystem.hpp"
+
+#include <algorithm>
+#include "Logger.hpp"
+
+namespace {
+    // Set on worker threads so submit() from inside a job lands in the worker's own deque
+    thread_local const JobSystem *currentPool = nullptr;
+    thread_local unsigned int currentIndex = 0;
+
+    // Rounds of yield-and-retry before an idle worker goes to sleep
+    constexpr int spinRounds = 64;
+}
+
+JobSystem::JobSystem(unsigned int workerCount) {
+    workerCount = std::max(1u, workerCount);
+
+    m_queues.reserve(workerCount);
+    for (unsigned int i = 0; i < workerCount; ++i) {
+        m_queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    m_workers.reserve(workerCount);
+    for (unsigned int i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back([this, i](const std::stop_token &stopToken) { workerLoop(stopToken, i); });
+    }
+}
+
+JobSystem::~JobSystem() {
+    for (std::jthread &worker : m_workers) {
+        worker.request_stop();
+    }
+    m_wake.notify_all();
+    m_workers.clear();
+}
+
+unsigned int JobSystem::workerCount() const {
+    return static_cast<unsigned int>(m_queues.size());
+}
+
+void JobSystem::submit(JobCounter &counter, Job job) {
+    counter.m_remaining.fetch_add(1, std::memory_order_relaxed);
+    push(Task{ .job = std::move(job), .counter = &counter });
+}
+
+void JobSystem::wait(const JobCounter &counter) {
+    const unsigned int self = currentPool == this ? currentIndex : workerCount();
+    while (!counter.done()) {
+        if (!tryRunOne(self)) {
+            std::this_thread::yield();
+        }
+    }
+
+    if (counter.m_failed.load(std::memory_order_acquire)) {
+        std::rethrow_exception(counter.m_error);
+    }
+}
+
+void JobSystem::parallelFor(const std::size_t count, std::size_t grain, const std::function<void(std::size_t, std::size_t)> &body) {
+    grain = std::max<std::size_t>(1, grain);
+    if (count <= grain) {
+        if (count > 0) {
+            body(0, count);
+        }
+        return;
+    }
+
+    JobCounter counter;
+    for (std::size_t begin = 0; begin < count; begin += grain) {
+        const std::size_t end = std::min(count, begin + grain);
+        submit(counter, [&body, begin, end] { body(begin, end); });
+    }
+    wait(counter);
+}
+
+void JobSystem::workerLoop(const std::stop_token &stopToken, const unsigned int index) {
+    currentPool = this;
+    currentIndex = index;
+
+    while (!stopToken.stop_requested()) {
+        if (tryRunOne(index)) {
+            continue;
+        }
+
+        bool found = false;
+        for (int i = 0; i < spinRounds && !found; ++i) {
+            std::this_thread::yield();
+            found = tryRunOne(index);
+        }
+        if (found) {
+            continue;
+        }
+
+        // push() bumps m_queued before it reads m_sleeping, so either it sees us here or we see its job
+        std::unique_lock lock(m_sleepMutex);
+        m_sleeping.fetch_add(1);
+        m_wake.wait(lock, stopToken, [this] { return m_queued.load() > 0; });
+        m_sleeping.fetch_sub(1);
+    }
+}
+
+void JobSystem::push(Task task) {
+    const unsigned int target = currentPool == this
+        ? currentIndex
+        : m_nextQueue.fetch_add(1, std::memory_order_relaxed) % workerCount();
+
+    WorkerQueue &queue = *m_queues[target];
+    {
+        std::lock_guard lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+
+    m_queued.fetch_add(1);
+    if (m_sleeping.load() > 0) {
+        // Taking the mutex makes sure a worker that just counted itself as sleeping is really waiting
+        { std::lock_guard lock(m_sleepMutex); }
+        m_wake.notify_one();
+    }
+}
+
+bool JobSystem::tryRunOne(const unsigned int self) {
+    Task task;
+    if ((self < workerCount() && popOwn(self, task)) || steal(self, task)) {
+        run(task);
+        return true;
+    }
+    return false;
+}
+
+bool JobSystem::popOwn(const unsigned int self, Task &task) {
+    WorkerQueue &queue = *m_queues[self];
+    std::lock_guard lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    m_queued.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool JobSystem::steal(const unsigned int self, Task &task) {
+    if (m_queued.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+
+    const unsigned int count = workerCount();
+    const unsigned int start = self < count ? self + 1 : 0;
+    for (unsigned int i = 0; i < count; ++i) {
+        const unsigned int victim = (start + i) % count;
+        if (victim == self) {
+            continue;
+        }
+
+        WorkerQueue &queue = *m_queues[victim];
+        std::lock_guard lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            continue;
+        }
+
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        m_queued.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+void JobSystem::run(Task &task) {
+    // Counts the job as finished however it ends, a waiter spinning on the counter must always get released
+    struct Finish {
+        Task &task;
+        ~Finish() {
+            // Release whatever the job captured before the waiter can return and tear down what it points at
+            task.job = nullptr;
+            task.counter->m_remaining.fetch_sub(1, std::memory_order_release);
+        }
+    } finish{ task };
+
+    try {
+        task.job();
+    } catch (...) {
+        // Handed to the waiter, an exception escaping a worker thread would terminate the program
+        if (!task.counter->m_failed.exchange(true, std::memory_order_relaxed)) {
+            task.counter->m_error = std::current_exception();
+        }
+    }
+}
+
+TaskGraph::TaskId TaskGraph::add(std::function<void()> work) {
+    Node &node = m_nodes.emplace_back();
+    node.work = std::move(work);
+    return m_nodes.size() - 1;
+}
+
+void TaskGraph::precede(const TaskId before, const TaskId after) {
+    m_nodes[before].successors.push_back(after);
+    m_nodes[after].predecessors++;
+}
+
+std::size_t TaskGraph::size() const {
+    return m_nodes.size();
+}
+
+bool TaskGraph::run(JobSystem &jobs) {
+    if (!isAcyclic()) {
+        Logger::getInstance().log(LogLevel::ERROR, "Task graph has a dependency cycle, not running it.");
+        return false;
+    }
+
+    // Predecessors still running, per task. The last one to finish launches the task.
+    const auto pending = std::make_unique<std::atomic<std::size_t>[]>(m_nodes.size());
+    for (std::size_t i = 0; i < m_nodes.size(); ++i) {
+        pending[i].store(m_nodes[i].predecessors, std::memory_order_relaxed);
+    }
+
+    JobCounter counter;
+    for (TaskId id = 0; id < m_nodes.size(); ++id) {
+        if (m_nodes[id].predecessors == 0) {
+            launch(jobs, counter, pending.get(), id);
+        }
+    }
+    jobs.wait(counter);
+    return true;
+}
+
+void TaskGraph::launch(JobSystem &jobs, JobCounter &counter, std::atomic<std::size_t> *pending, const TaskId id) const {
+    jobs.submit(counter, [this, &jobs, &counter, pending, id] {
+        const Node &node = m_nodes[id];
+        node.work();
+
+        // Successors are submitted before this job counts as finished, so the counter can't hit zero early
+        for (const TaskId next : node.successors) {
+            if (pending[next].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                launch(jobs, counter, pending, next);
+            }
+        }
+    });
+}
+
+bool TaskGraph::isAcyclic() const {
+    // Kahn's algorithm: a graph is acyclic when every node can be removed in dependency order
+    std::vector<std::size_t> remaining(m_nodes.size());
+    std::vector<TaskId> ready;
+    for (TaskId id = 0; id < m_nodes.size(); ++id) {
+        remaining[id] = m_nodes[id].predecessors;
+        if (remaining[id] == 0) {
+            ready.push_back(id);
+        }
+    }
+
+    std::size_t visited = 0;
+    while (!ready.empty()) {
+        const TaskId id = ready.back();
+        ready.pop_back();
+        visited++;
+        for (const TaskId next : m_nodes[id].successors) {
+            if (--remaining[next] == 0) {
+                ready.push_back(next);
+            }
+        }
+    }
+    return visited == m_nodes.size();
+}
@@ -0,0 +1,37 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "MemoryPages.hpp"
+
+#include <cstdint>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+std::size_t MemoryPages::pageSize() {
+#if defined(__linux__)
+    static const auto size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+#else
+    return 4096;
+#endif
+}
+
+const unsigned char *MemoryPages::releaseFileBacked(const unsigned char *begin, const unsigned char *end) {
+#if defined(__linux__)
+    // madvise works on whole pages, so only the ones entirely inside the range go
+    const std::uintptr_t page = pageSize();
+    const std::uintptr_t firstPage = (reinterpret_cast<std::uintptr_t>(begin) + page - 1) & ~(page - 1);
+    const std::uintptr_t lastPage = reinterpret_cast<std::uintptr_t>(end) & ~(page - 1);
+
+    if (lastPage > firstPage && madvise(reinterpret_cast<void *>(firstPage), lastPage - firstPage, MADV_DONTNEED) == 0) {
+        return begin + (lastPage - reinterpret_cast<std::uintptr_t>(begin));
+    }
+#else
+    (void)end;
+#endif
+    return begin;
+}
@@ -0,0 +1,353 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "MusicStreamer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "Logger.hpp"
+#include "MemoryPages.hpp"
+
+// QOA format constants, see https://qoaformat.org
+namespace {
+    constexpr std::uint32_t qoaMagic = 0x716f6166; // "qoaf"
+    constexpr int qoaSliceLength = 20;
+    constexpr int qoaFrameLength = 256 * qoaSliceLength;
+    constexpr int qoaLmsLength = 4;
+    constexpr std::size_t qoaFileHeaderSize = 8;
+
+    constexpr int scalefactorTable[16] = { 1, 7, 21, 45, 84, 138, 211, 304, 421, 562, 731, 928, 1157, 1419, 1715, 2048 };
+
+    // scalefactor * {0.75, -0.75, 2.5, -2.5, 4.5, -4.5, 7, -7}, rounded half away from zero
+    constexpr auto dequantTable = [] {
+        constexpr int quarters[8] = { 3, -3, 10, -10, 18, -18, 28, -28 };
+        std::array<std::array<int, 8>, 16> table{};
+        for (int s = 0; s < 16; ++s) {
+            for (int q = 0; q < 8; ++q) {
+                const int scaled = scalefactorTable[s] * quarters[q];
+                table[s][q] = scaled >= 0 ? (scaled + 2) / 4 : -((-scaled + 2) / 4);
+            }
+        }
+        return table;
+    }();
+
+    static_assert(dequantTable[1][2] == 18 && dequantTable[0][7] == -7, "QOA dequantization table mismatch");
+
+    std::uint64_t readU64(const unsigned char *bytes) {
+        std::uint64_t value = 0;
+        for (int i = 0; i < 8; ++i) {
+            value = (value << 8) | bytes[i];
+        }
+        return value;
+    }
+}
+
+MusicStreamer::~MusicStreamer() {
+    close();
+}
+
+bool MusicStreamer::open(const unsigned char *data, const std::size_t size, const int chunkFrames, const int decodeBuffers,
+                         const bool releaseConsumed) {
+    Logger& logger = Logger::getInstance();
+    close();
+
+    if (data == nullptr || size < qoaFileHeaderSize + 8 || (readU64(data) >> 32) != qoaMagic) {
+        logger.log(LogLevel::ERROR, "Error: Music data is not a QOA file.");
+        return false;
+    }
+
+    // The first frame header carries the stream layout
+    const std::uint64_t frameHeader = readU64(data + qoaFileHeaderSize);
+    m_channels = static_cast<unsigned int>((frameHeader >> 56) & 0xff);
+    m_sampleRate = static_cast<unsigned int>((frameHeader >> 32) & 0xffffff);
+    if (m_channels == 0 || m_channels > m_lms.size() || m_sampleRate == 0) {
+        logger.log(LogLevel::ERROR, "Error: Unsupported QOA stream layout.");
+        return false;
+    }
+
+    m_data = data;
+    m_size = size;
+    m_readOffset = qoaFileHeaderSize;
+    m_releasedOffset = 0;
+    m_releaseConsumed = releaseConsumed;
+
+    m_frameSamples.assign(static_cast<std::size_t>(qoaFrameLength) * m_channels, 0);
+    m_frameLength = 0;
+    m_frameConsumed = 0;
+
+    m_chunkFrames = chunkFrames;
+    m_chunkCount = std::max(decodeBuffers, 2);
+    m_chunks.assign(static_cast<std::size_t>(m_chunkFrames) * m_channels * m_chunkCount, 0);
+    m_chunkHead = 0;
+    m_chunksReady = 0;
+
+    // Each stream sub-buffer holds exactly one chunk
+    SetAudioStreamBufferSizeDefault(m_chunkFrames);
+    m_stream = LoadAudioStream(m_sampleRate, 16, m_channels);
+    SetAudioStreamBufferSizeDefault(0);
+
+    if (m_stream.buffer == nullptr) {
+        logger.log(LogLevel::ERROR, "Error: Failed to create music audio stream.");
+        close();
+        return false;
+    }
+
+    fillChunks();
+
+    logger.log(LogLevel::INFO, "Streaming music: " + std::to_string(size) + " compressed bytes, " +
+        std::to_string(bufferBytes()) + " bytes of decode buffers.");
+    return true;
+}
+
+void MusicStreamer::close() {
+    if (m_stream.buffer != nullptr) {
+        UnloadAudioStream(m_stream);
+    }
+    m_stream = {};
+    m_data = nullptr;
+    m_size = 0;
+    m_playing = false;
+    m_frameSamples.clear();
+    m_frameSamples.shrink_to_fit();
+    m_chunks.clear();
+    m_chunks.shrink_to_fit();
+}
+
+void MusicStreamer::play() {
+    if (m_stream.buffer == nullptr) {
+        return;
+    }
+    PlayAudioStream(m_stream);
+    m_playing = true;
+    m_hasSubmitted = false;
+}
+
+void MusicStreamer::stop() {
+    if (m_stream.buffer == nullptr) {
+        return;
+    }
+    StopAudioStream(m_stream);
+    m_playing = false;
+
+    // Drop what was decoded ahead so the next play() starts from the top of the track
+    rewind();
+    m_chunkHead = 0;
+    m_chunksReady = 0;
+    fillChunks();
+}
+
+void MusicStreamer::pause() {
+    if (m_stream.buffer != nullptr) {
+        PauseAudioStream(m_stream);
+    }
+}
+
+void MusicStreamer::resume() {
+    // Resuming a stopped stream would start it, only a paused play() comes back
+    if (m_stream.buffer != nullptr && m_playing) {
+        ResumeAudioStream(m_stream);
+        m_hasSubmitted = false;
+    }
+}
+
+void MusicStreamer::setVolume(const float volume) {
+    if (m_stream.buffer != nullptr) {
+        SetAudioStreamVolume(m_stream, volume);
+    }
+}
+
+void MusicStreamer::setPitch(const float pitch) {
+    if (m_stream.buffer != nullptr) {
+        SetAudioStreamPitch(m_stream, pitch);
+    }
+}
+
+bool MusicStreamer::isPlaying() const {
+    return m_playing;
+}
+
+void MusicStreamer::update() {
+    if (m_stream.buffer == nullptr || !m_playing) {
+        return;
+    }
+
+    // The stream double buffers one chunk per sub-buffer, refill whichever ones it finished
+    while (IsAudioStreamProcessed(m_stream)) {
+        const short *chunk = nextChunk();
+        if (chunk == nullptr) {
+            m_underruns++;
+            break;
+        }
+
+        // Both sub-buffers drained before we got here, the device played silence in between
+        const auto now = std::chrono::steady_clock::now();
+        const auto chunkDuration = std::chrono::duration<double>(static_cast<double>(m_chunkFrames) / m_sampleRate);
+        if (m_hasSubmitted && now - m_lastSubmit > 2 * chunkDuration) {
+            m_underruns++;
+        }
+        m_lastSubmit = now;
+        m_hasSubmitted = true;
+
+        UpdateAudioStream(m_stream, chunk, m_chunkFrames);
+    }
+
+    // Keep the ring topped up so a late update() still finds decoded data waiting
+    fillChunks();
+}
+
+const short *MusicStreamer::nextChunk() {
+    if (m_chunks.empty()) {
+        return nullptr;
+    }
+    if (m_chunksReady == 0) {
+        fillChunks();
+        if (m_chunksReady == 0) {
+            return nullptr;
+        }
+    }
+
+    // The slot stays untouched until the ring is filled again, which the caller doesn't do while using it
+    const std::size_t chunkSamples = static_cast<std::size_t>(m_chunkFrames) * m_channels;
+    const short *chunk = m_chunks.data() + static_cast<std::size_t>(m_chunkHead) * chunkSamples;
+    m_chunkHead = (m_chunkHead + 1) % m_chunkCount;
+    m_chunksReady--;
+    return chunk;
+}
+
+void MusicStreamer::fillChunks() {
+    const std::size_t chunkSamples = static_cast<std::size_t>(m_chunkFrames) * m_channels;
+
+    while (m_chunksReady < m_chunkCount) {
+        short *chunk = m_chunks.data() + static_cast<std::size_t>((m_chunkHead + m_chunksReady) % m_chunkCount) * chunkSamples;
+        std::size_t written = 0;
+
+        while (written < chunkSamples) {
+            if (m_frameConsumed == m_frameLength * m_channels) {
+                if (!decodeFrame()) {
+                    // End of the track, loop back to the first frame
+                    rewind();
+                    if (!decodeFrame()) {
+                        return;
+                    }
+                }
+            }
+
+            const std::size_t count = std::min(chunkSamples - written, m_frameLength * m_channels - m_frameConsumed);
+            std::memcpy(chunk + written, m_frameSamples.data() + m_frameConsumed, count * sizeof(short));
+            written += count;
+            m_frameConsumed += count;
+        }
+
+        m_chunksReady++;
+    }
+}
+
+bool MusicStreamer::decodeFrame() {
+    const std::size_t lmsBytes = static_cast<std::size_t>(qoaLmsLength) * 4 * m_channels;
+    if (m_readOffset + 8 + lmsBytes > m_size) {
+        return false;
+    }
+
+    const unsigned char *bytes = m_data + m_readOffset;
+    const std::uint64_t frameHeader = readU64(bytes);
+    const unsigned int channels = static_cast<unsigned int>((frameHeader >> 56) & 0xff);
+    const unsigned int samples = static_cast<unsigned int>((frameHeader >> 16) & 0xffff);
+    const std::size_t frameSize = static_cast<std::size_t>(frameHeader & 0xffff);
+
+    if (channels != m_channels || samples == 0 || frameSize < 8 + lmsBytes || frameSize > m_size - m_readOffset) {
+        return false;
+    }
+
+    const std::size_t sliceCount = (frameSize - 8 - lmsBytes) / 8;
+    if (static_cast<std::size_t>(samples) * channels > sliceCount * qoaSliceLength) {
+        return false;
+    }
+
+    std::size_t p = 8;
+    for (unsigned int c = 0; c < channels; ++c) {
+        std::uint64_t history = readU64(bytes + p);
+        std::uint64_t weights = readU64(bytes + p + 8);
+        p += 16;
+        for (int i = 0; i < qoaLmsLength; ++i) {
+            m_lms[c].history[i] = static_cast<short>(history >> 48);
+            m_lms[c].weights[i] = static_cast<short>(weights >> 48);
+            history <<= 16;
+            weights <<= 16;
+        }
+    }
+
+    for (unsigned int sampleIndex = 0; sampleIndex < samples; sampleIndex += qoaSliceLength) {
+        for (unsigned int c = 0; c < channels; ++c) {
+            std::uint64_t slice = readU64(bytes + p);
+            p += 8;
+
+            const int scalefactor = static_cast<int>((slice >> 60) & 0xf);
+            slice <<= 4;
+
+            Lms &lms = m_lms[c];
+            const unsigned int sliceEnd = std::min(sampleIndex + qoaSliceLength, samples);
+            for (unsigned int i = sampleIndex; i < sliceEnd; ++i) {
+                int predicted = 0;
+                for (int k = 0; k < qoaLmsLength; ++k) {
+                    predicted += lms.weights[k] * lms.history[k];
+                }
+                predicted >>= 13;
+
+                const int dequantized = dequantTable[scalefactor][(slice >> 61) & 0x7];
+                const int reconstructed = std::clamp(predicted + dequantized, -32768, 32767);
+                slice <<= 3;
+
+                m_frameSamples[static_cast<std::size_t>(i) * channels + c] = static_cast<short>(reconstructed);
+
+                const int delta = dequantized >> 4;
+                for (int k = 0; k < qoaLmsLength; ++k) {
+                    lms.weights[k] += lms.history[k] < 0 ? -delta : delta;
+                }
+                lms.history[0] = lms.history[1];
+                lms.history[1] = lms.history[2];
+                lms.history[2] = lms.history[3];
+                lms.history[3] = reconstructed;
+            }
+        }
+    }
+
+    m_readOffset += frameSize;
+    m_frameLength = samples;
+    m_frameConsumed = 0;
+
+    releaseConsumedPages();
+    return true;
+}
+
+void MusicStreamer::rewind() {
+    m_readOffset = qoaFileHeaderSize;
+    m_releasedOffset = 0;
+    m_frameLength = 0;
+    m_frameConsumed = 0;
+}
+
+void MusicStreamer::releaseConsumedPages() {
+    // An embedded track is paged in from the executable as we read it. Dropping pages behind the read position keeps
+    // resident memory flat for long tracks, they fault back in on loop. Batched, madvise per frame would cost more.
+    if (!m_releaseConsumed || m_readOffset - m_releasedOffset < 16 * MemoryPages::pageSize()) {
+        return;
+    }
+
+    const unsigned char *released = MemoryPages::releaseFileBacked(m_data + m_releasedOffset, m_data + m_readOffset);
+    m_releasedOffset = static_cast<std::size_t>(released - m_data);
+}
+
+std::size_t MusicStreamer::bufferBytes() const {
+    return (m_frameSamples.capacity() + m_chunks.capacity()) * sizeof(short);
+}
+
+std::uint64_t MusicStreamer::underruns() const {
+    return m_underruns;
+}
+
+AudioStream MusicStreamer::stream() const {
+    return m_stream;
+}
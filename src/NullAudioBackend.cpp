@@ -0,0 +1,171 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "NullAudioBackend.hpp"
+
+bool NullAudioBackend::createVoices(const std::string_view key, const Wave &wave, const std::span<VoiceHandle> handles) {
+    if (wave.data == nullptr || wave.sampleRate == 0 || handles.empty()) {
+        return false;
+    }
+
+    std::lock_guard lock(mutex);
+
+    // Only the length is kept, the samples are never needed
+    const double length = static_cast<double>(wave.frameCount) / wave.sampleRate;
+    for (VoiceHandle &handle : handles) {
+        voices.push_back({ .key = std::string(key), .length = length, .startedAt = 0.0, .pausedAt = 0.0, .playing = false, .paused = false, .alive = true });
+        handle = static_cast<VoiceHandle>(voices.size());
+    }
+    return true;
+}
+
+void NullAudioBackend::destroyVoices(const std::span<const VoiceHandle> handles) {
+    std::lock_guard lock(mutex);
+    for (const VoiceHandle handle : handles) {
+        if (NullVoice *voice = find(handle)) {
+            voice->alive = false;
+            voice->playing = false;
+            voice->paused = false;
+        }
+    }
+}
+
+void NullAudioBackend::play(const VoiceHandle voice) {
+    std::lock_guard lock(mutex);
+    if (NullVoice *entry = find(voice)) {
+        entry->playing = true;
+        entry->paused = false;
+        entry->startedAt = clock;
+        plays[entry->key]++;
+        playsTotal++;
+    }
+}
+
+void NullAudioBackend::stop(const VoiceHandle voice) {
+    std::lock_guard lock(mutex);
+    if (NullVoice *entry = find(voice)) {
+        entry->playing = false;
+        entry->paused = false;
+    }
+}
+
+void NullAudioBackend::pause(const VoiceHandle voice) {
+    std::lock_guard lock(mutex);
+    if (NullVoice *entry = find(voice); entry != nullptr && entry->playing && !entry->paused) {
+        entry->paused = true;
+        entry->pausedAt = clock;
+    }
+}
+
+void NullAudioBackend::resume(const VoiceHandle voice) {
+    std::lock_guard lock(mutex);
+    if (NullVoice *entry = find(voice); entry != nullptr && entry->paused) {
+        // The time spent paused doesn't use up the voice's length
+        entry->startedAt += clock - entry->pausedAt;
+        entry->paused = false;
+    }
+}
+
+bool NullAudioBackend::isPlaying(const VoiceHandle voice) const {
+    std::lock_guard lock(mutex);
+    const NullVoice *entry = find(voice);
+    return entry != nullptr && entry->playing && !entry->paused && clock - entry->startedAt < entry->length;
+}
+
+void NullAudioBackend::setVolume(VoiceHandle, float) {
+}
+
+float NullAudioBackend::duration(const VoiceHandle voice) const {
+    std::lock_guard lock(mutex);
+    const NullVoice *entry = find(voice);
+    return entry != nullptr ? static_cast<float>(entry->length) : 0.0f;
+}
+
+bool NullAudioBackend::openMusic(const unsigned char *data, const std::size_t size) {
+    std::lock_guard lock(mutex);
+    musicOpen = data != nullptr && size > 0;
+    return musicOpen;
+}
+
+void NullAudioBackend::closeMusic() {
+    std::lock_guard lock(mutex);
+    musicOpen = false;
+    musicPlaying = false;
+    musicPaused = false;
+}
+
+void NullAudioBackend::playMusic() {
+    std::lock_guard lock(mutex);
+    musicPlaying = musicOpen;
+    musicPaused = false;
+}
+
+void NullAudioBackend::stopMusic() {
+    std::lock_guard lock(mutex);
+    musicPlaying = false;
+    musicPaused = false;
+}
+
+void NullAudioBackend::pauseMusic() {
+    std::lock_guard lock(mutex);
+    musicPaused = musicPlaying;
+}
+
+// Like the raylib stream, only a paused play() comes back, a stopped track stays stopped
+void NullAudioBackend::resumeMusic() {
+    std::lock_guard lock(mutex);
+    musicPaused = false;
+}
+
+void NullAudioBackend::setMusicVolume(float) {
+}
+
+void NullAudioBackend::setMusicPitch(float) {
+}
+
+void NullAudioBackend::updateMusic() {
+}
+
+std::uint64_t NullAudioBackend::musicUnderruns() const {
+    return 0;
+}
+
+void NullAudioBackend::advance(const double seconds) {
+    std::lock_guard lock(mutex);
+    clock += seconds;
+}
+
+double NullAudioBackend::now() const {
+    std::lock_guard lock(mutex);
+    return clock;
+}
+
+std::uint64_t NullAudioBackend::playCount(const std::string_view key) const {
+    std::lock_guard lock(mutex);
+    const auto it = plays.find(std::string(key));
+    return it != plays.end() ? it->second : 0;
+}
+
+std::uint64_t NullAudioBackend::totalPlays() const {
+    std::lock_guard lock(mutex);
+    return playsTotal;
+}
+
+bool NullAudioBackend::isMusicPlaying() const {
+    std::lock_guard lock(mutex);
+    return musicPlaying && !musicPaused;
+}
+
+bool NullAudioBackend::isMusicPaused() const {
+    std::lock_guard lock(mutex);
+    return musicPaused;
+}
+
+const NullAudioBackend::NullVoice *NullAudioBackend::find(const VoiceHandle voice) const {
+    return voice != invalidVoice && voice <= voices.size() && voices[voice - 1].alive ? &voices[voice - 1] : nullptr;
+}
+
+NullAudioBackend::NullVoice *NullAudioBackend::find(const VoiceHandle voice) {
+    return voice != invalidVoice && voice <= voices.size() && voices[voice - 1].alive ? &voices[voice - 1] : nullptr;
+}
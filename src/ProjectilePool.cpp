@@ -0,0 +1,193 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "ProjectilePool.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define FLAPPYBARA_SSE2 1
+#else
+#define FLAPPYBARA_SSE2 0
+#endif
+
+ProjectilePool::ProjectilePool(const std::size_t capacity, const float radius, const Rectangle bounds, const float cellSize)
+    : m_x(capacity), m_y(capacity), m_velocityX(capacity), m_velocityY(capacity), m_active(capacity),
+      m_radius(radius), m_bounds(bounds), m_inverseCellSize(1.0f / std::max(cellSize, 1.0f)),
+      m_columns(std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(bounds.width * m_inverseCellSize)))),
+      m_rows(std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(bounds.height * m_inverseCellSize)))),
+      m_cellStart(m_columns * m_rows + 1), m_cellSlots(capacity), m_slotCell(capacity) {
+    m_free.reserve(capacity);
+}
+
+ProjectilePool::Handle ProjectilePool::spawn(const Vector2 position, const Vector2 velocity) {
+    Handle slot;
+    if (!m_free.empty()) {
+        slot = m_free.back();
+        m_free.pop_back();
+    } else if (m_highWater < m_active.size()) {
+        slot = static_cast<Handle>(m_highWater++);
+    } else {
+        return invalidHandle;
+    }
+
+    m_x[slot] = position.x;
+    m_y[slot] = position.y;
+    m_velocityX[slot] = velocity.x;
+    m_velocityY[slot] = velocity.y;
+    m_active[slot] = 1;
+    m_activeCount++;
+    return slot;
+}
+
+void ProjectilePool::despawn(const Handle handle) {
+    if (handle >= m_highWater || !m_active[handle]) {
+        return;
+    }
+
+    // Dead slots are still integrated by update(), without velocity they stay where they are
+    m_velocityX[handle] = 0.0f;
+    m_velocityY[handle] = 0.0f;
+    m_active[handle] = 0;
+    m_activeCount--;
+    m_free.push_back(handle);
+}
+
+void ProjectilePool::clear() {
+    std::fill(m_active.begin(), m_active.begin() + static_cast<std::ptrdiff_t>(m_highWater), 0);
+    m_free.clear();
+    m_highWater = 0;
+    m_activeCount = 0;
+    std::fill(m_cellStart.begin(), m_cellStart.end(), 0);
+}
+
+void ProjectilePool::update(const float dt) {
+    const std::size_t count = m_highWater;
+    std::size_t i = 0;
+
+#if FLAPPYBARA_SSE2
+    // Dead slots are moved too, skipping them would cost more than the arithmetic
+    const __m128 step = _mm_set1_ps(dt);
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(&m_x[i], _mm_add_ps(_mm_loadu_ps(&m_x[i]), _mm_mul_ps(_mm_loadu_ps(&m_velocityX[i]), step)));
+        _mm_storeu_ps(&m_y[i], _mm_add_ps(_mm_loadu_ps(&m_y[i]), _mm_mul_ps(_mm_loadu_ps(&m_velocityY[i]), step)));
+    }
+#endif
+    for (; i < count; ++i) {
+        m_x[i] += m_velocityX[i] * dt;
+        m_y[i] += m_velocityY[i] * dt;
+    }
+
+    // A projectile is gone once no part of it is inside the bounds
+    const float left = m_bounds.x - m_radius;
+    const float top = m_bounds.y - m_radius;
+    const float right = m_bounds.x + m_bounds.width + m_radius;
+    const float bottom = m_bounds.y + m_bounds.height + m_radius;
+    for (std::size_t slot = 0; slot < count; ++slot) {
+        if (m_active[slot] && (m_x[slot] < left || m_x[slot] > right || m_y[slot] < top || m_y[slot] > bottom)) {
+            despawn(static_cast<Handle>(slot));
+        }
+    }
+
+    rebuildGrid();
+}
+
+bool ProjectilePool::overlaps(const Rectangle rect, const Collision::Mask *mask) const {
+    if (m_activeCount == 0) {
+        return false;
+    }
+
+    // Projectiles are filed by their centre, so every one touching rect sits in a cell under rect grown by the radius
+    const std::size_t firstColumn = cellColumn(rect.x - m_radius);
+    const std::size_t lastColumn = cellColumn(rect.x + rect.width + m_radius);
+    const std::size_t firstRow = cellRow(rect.y - m_radius);
+    const std::size_t lastRow = cellRow(rect.y + rect.height + m_radius);
+    const float radiusSquared = m_radius * m_radius;
+
+    for (std::size_t row = firstRow; row <= lastRow; ++row) {
+        // The cells of one row are next to each other, so the whole span is one run of m_cellSlots
+        const std::size_t begin = m_cellStart[row * m_columns + firstColumn];
+        const std::size_t end = m_cellStart[row * m_columns + lastColumn + 1];
+        for (std::size_t i = begin; i < end; ++i) {
+            const Handle slot = m_cellSlots[i];
+            if (!m_active[slot]) {
+                continue;   // Despawned since the last update()
+            }
+            const float dx = m_x[slot] - std::clamp(m_x[slot], rect.x, rect.x + rect.width);
+            const float dy = m_y[slot] - std::clamp(m_y[slot], rect.y, rect.y + rect.height);
+            if (dx * dx + dy * dy > radiusSquared) {
+                continue;
+            }
+            const Rectangle square = { m_x[slot] - m_radius, m_y[slot] - m_radius, 2.0f * m_radius, 2.0f * m_radius };
+            if (mask == nullptr || Collision::overlaps(*mask, rect, square)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+std::size_t ProjectilePool::activeCount() const {
+    return m_activeCount;
+}
+
+std::size_t ProjectilePool::capacity() const {
+    return m_active.size();
+}
+
+float ProjectilePool::radius() const {
+    return m_radius;
+}
+
+std::size_t ProjectilePool::slotCount() const {
+    return m_highWater;
+}
+
+bool ProjectilePool::active(const std::size_t slot) const {
+    return slot < m_highWater && m_active[slot] != 0;
+}
+
+Vector2 ProjectilePool::position(const std::size_t slot) const {
+    return { m_x[slot], m_y[slot] };
+}
+
+// Truncating instead of flooring only differs below zero, which the clamp maps to the first cell anyway
+std::size_t ProjectilePool::cellColumn(const float x) const {
+    const int column = static_cast<int>((x - m_bounds.x) * m_inverseCellSize);
+    return static_cast<std::size_t>(std::clamp(column, 0, static_cast<int>(m_columns) - 1));
+}
+
+std::size_t ProjectilePool::cellRow(const float y) const {
+    const int row = static_cast<int>((y - m_bounds.y) * m_inverseCellSize);
+    return static_cast<std::size_t>(std::clamp(row, 0, static_cast<int>(m_rows) - 1));
+}
+
+void ProjectilePool::rebuildGrid() {
+    // Counting sort by cell: count, turn the counts into running ends, then fill each cell back to front
+    const std::size_t cells = m_columns * m_rows;
+    std::fill(m_cellStart.begin(), m_cellStart.end(), 0);
+
+    for (std::size_t slot = 0; slot < m_highWater; ++slot) {
+        if (m_active[slot]) {
+            const std::size_t cell = cellRow(m_y[slot]) * m_columns + cellColumn(m_x[slot]);
+            m_slotCell[slot] = static_cast<std::uint32_t>(cell);
+            m_cellStart[cell]++;
+        }
+    }
+
+    std::uint32_t total = 0;
+    for (std::size_t cell = 0; cell < cells; ++cell) {
+        total += m_cellStart[cell];
+        m_cellStart[cell] = total;
+    }
+    m_cellStart[cells] = total;
+
+    for (std::size_t slot = m_highWater; slot-- > 0;) {
+        if (m_active[slot]) {
+            m_cellSlots[--m_cellStart[m_slotCell[slot]]] = static_cast<Handle>(slot);
+        }
+    }
+}
@@ -0,0 +1,133 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "RaylibAudioBackend.hpp"
+#include "constants.hpp"
+
+RaylibAudioBackend::RaylibAudioBackend() {
+    InitAudioDevice();
+}
+
+RaylibAudioBackend::~RaylibAudioBackend() {
+    music.close();
+    CloseAudioDevice();
+}
+
+VoiceHandle RaylibAudioBackend::allocate(const Sound &sound) {
+    if (!freeHandles.empty()) {
+        const VoiceHandle handle = freeHandles.back();
+        freeHandles.pop_back();
+        sounds[handle - 1] = sound;
+        return handle;
+    }
+
+    sounds.push_back(sound);
+    return static_cast<VoiceHandle>(sounds.size());
+}
+
+bool RaylibAudioBackend::createVoices(std::string_view, const Wave &wave, const std::span<VoiceHandle> voices) {
+    const Sound source = LoadSoundFromWave(wave);
+    if (source.stream.buffer == nullptr || voices.empty()) {
+        return false;
+    }
+
+    // Aliases share the source's PCM buffer, each only adds its own playback cursor and volume
+    voices[0] = allocate(source);
+    for (std::size_t i = 1; i < voices.size(); ++i) {
+        voices[i] = allocate(LoadSoundAlias(source));
+    }
+    return true;
+}
+
+void RaylibAudioBackend::destroyVoices(const std::span<const VoiceHandle> voices) {
+    if (voices.empty()) {
+        return;
+    }
+
+    // Aliases reference the source's buffer, so they have to go first
+    for (std::size_t i = 1; i < voices.size(); ++i) {
+        UnloadSoundAlias(sounds[voices[i] - 1]);
+        freeHandles.push_back(voices[i]);
+    }
+    UnloadSound(sounds[voices[0] - 1]);
+    freeHandles.push_back(voices[0]);
+}
+
+void RaylibAudioBackend::play(const VoiceHandle voice) {
+    PlaySound(sounds[voice - 1]);
+}
+
+void RaylibAudioBackend::stop(const VoiceHandle voice) {
+    StopSound(sounds[voice - 1]);
+}
+
+void RaylibAudioBackend::pause(const VoiceHandle voice) {
+    PauseSound(sounds[voice - 1]);
+}
+
+void RaylibAudioBackend::resume(const VoiceHandle voice) {
+    ResumeSound(sounds[voice - 1]);
+}
+
+bool RaylibAudioBackend::isPlaying(const VoiceHandle voice) const {
+    return IsSoundPlaying(sounds[voice - 1]);
+}
+
+void RaylibAudioBackend::setVolume(const VoiceHandle voice, const float volume) {
+    SetSoundVolume(sounds[voice - 1], volume);
+}
+
+float RaylibAudioBackend::duration(const VoiceHandle voice) const {
+    const Sound &sound = sounds[voice - 1];
+    return sound.stream.sampleRate > 0 ? static_cast<float>(sound.frameCount) / static_cast<float>(sound.stream.sampleRate) : 0.0f;
+}
+
+bool RaylibAudioBackend::openMusic(const unsigned char *data, const std::size_t size) {
+    // The track is embedded in the executable, see AudioBackend::openMusic()
+    return music.open(data, size, Config::musicChunkFrames, Config::musicDecodeBuffers, true);
+}
+
+void RaylibAudioBackend::closeMusic() {
+    music.close();
+}
+
+void RaylibAudioBackend::playMusic() {
+    music.play();
+}
+
+void RaylibAudioBackend::stopMusic() {
+    music.stop();
+}
+
+void RaylibAudioBackend::pauseMusic() {
+    music.pause();
+}
+
+void RaylibAudioBackend::resumeMusic() {
+    music.resume();
+}
+
+void RaylibAudioBackend::setMusicVolume(const float volume) {
+    music.setVolume(volume);
+}
+
+void RaylibAudioBackend::setMusicPitch(const float pitch) {
+    music.setPitch(pitch);
+}
+
+void RaylibAudioBackend::updateMusic() {
+    music.update();
+}
+
+std::uint64_t RaylibAudioBackend::musicUnderruns() const {
+    return music.underruns();
+}
+
+void RaylibAudioBackend::attachProcessor(const VoiceHandle voice, const AudioCallback processor) {
+    AttachAudioStreamProcessor(sounds[voice - 1].stream, processor);
+}
+
+void RaylibAudioBackend::detachProcessor(const VoiceHandle voice, const AudioCallback processor) {
+    DetachAudioStreamProcessor(sounds[voice - 1].stream, processor);
+}
@@ -0,0 +1,195 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "SceneStack.hpp"
+
+#include <chrono>
+#include <string>
+
+#include "Logger.hpp"
+#include "constants.hpp"
+
+SceneStack::SceneStack(TextureResourceManager &textureManager, const Color clearColor)
+    : textureManager(textureManager), clearColor(clearColor) {
+}
+
+SceneStack::~SceneStack() {
+    while (!m_scenes.empty()) {
+        exitScene();
+    }
+    if (m_frozenFrame.id != 0) {
+        UnloadRenderTexture(m_frozenFrame);
+    }
+}
+
+void SceneStack::push(std::unique_ptr<Scene> scene) {
+    m_changes.push_back({ ChangeKind::Push, std::move(scene) });
+}
+
+void SceneStack::pop() {
+    m_changes.push_back({ ChangeKind::Pop, nullptr });
+}
+
+void SceneStack::replace(std::unique_ptr<Scene> scene) {
+    pop();
+    push(std::move(scene));
+}
+
+void SceneStack::clear() {
+    m_changes.push_back({ ChangeKind::Clear, nullptr });
+}
+
+bool SceneStack::empty() const {
+    return m_scenes.empty() && m_changes.empty() && m_loading == nullptr;
+}
+
+void SceneStack::update() {
+    if (m_loading != nullptr) {
+        if (!preload()) {
+            return;
+        }
+        enterScene(std::move(m_loading));
+    }
+
+    applyChanges();
+
+    // A scene pushed just now may still be loading
+    if (m_loading == nullptr && !m_scenes.empty()) {
+        m_scenes.back()->update();
+    }
+}
+
+void SceneStack::applyChanges() {
+    while (m_loading == nullptr && !m_changes.empty()) {
+        Change change = std::move(m_changes.front());
+        m_changes.pop_front();
+
+        switch (change.kind) {
+            case ChangeKind::Push:
+                m_loading = std::move(change.scene);
+                m_loadedTextures = 0;
+                if (preload()) {
+                    enterScene(std::move(m_loading));
+                }
+            break;
+
+            case ChangeKind::Pop:
+                if (!m_scenes.empty()) {
+                    exitScene();
+                }
+            break;
+
+            case ChangeKind::Clear:
+                while (!m_scenes.empty()) {
+                    exitScene();
+                }
+            break;
+        }
+    }
+}
+
+void SceneStack::enterScene(std::unique_ptr<Scene> scene) {
+    if (!m_scenes.empty()) {
+        m_scenes.back()->pause();
+    }
+    m_scenes.push_back(std::move(scene));
+    m_scenes.back()->enter();
+    m_frozenFrameValid = false;
+}
+
+void SceneStack::exitScene() {
+    m_scenes.back()->exit();
+    m_scenes.pop_back();
+    if (!m_scenes.empty()) {
+        m_scenes.back()->resume();
+    }
+    m_frozenFrameValid = false;
+}
+
+bool SceneStack::preload() {
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+    const auto budget = std::chrono::duration<float, std::milli>(Config::scenePreloadBudgetMs);
+
+    // Resident textures cost nothing, and at least one upload happens per call so a texture bigger than the
+    // budget still gets there
+    const std::span<const TextureId> textures = m_loading->textures();
+    bool uploaded = false;
+    for (; m_loadedTextures < textures.size(); ++m_loadedTextures) {
+        const TextureId id = textures[m_loadedTextures];
+        if (!textureManager.isResident(id)) {
+            if (uploaded && Clock::now() - start >= budget) {
+                return false;
+            }
+            uploaded = true;
+        }
+        textureManager.getTexture(id);
+    }
+
+    return true;
+}
+
+void SceneStack::draw() {
+    if (m_loading != nullptr) {
+        drawLoadingScreen();
+        return;
+    }
+    if (m_scenes.empty()) {
+        return;
+    }
+
+    Scene &top = *m_scenes.back();
+    if (top.overlay() && m_scenes.size() > 1) {
+        if (!m_frozenFrameValid || m_frozenFrame.texture.width != GetScreenWidth() || m_frozenFrame.texture.height != GetScreenHeight()) {
+            captureFrozenFrame();
+        }
+
+        // Render textures are upside down
+        const Rectangle source = { 0.0f, 0.0f, static_cast<float>(m_frozenFrame.texture.width), -static_cast<float>(m_frozenFrame.texture.height) };
+        DrawTextureRec(m_frozenFrame.texture, source, { 0.0f, 0.0f }, WHITE);
+    }
+
+    top.draw();
+}
+
+void SceneStack::captureFrozenFrame() {
+    if (m_frozenFrame.texture.width != GetScreenWidth() || m_frozenFrame.texture.height != GetScreenHeight()) {
+        if (m_frozenFrame.id != 0) {
+            UnloadRenderTexture(m_frozenFrame);
+        }
+        m_frozenFrame = LoadRenderTexture(GetScreenWidth(), GetScreenHeight());
+        Logger::getInstance().log(LogLevel::INFO, "Frozen frame render texture created at " +
+            std::to_string(GetScreenWidth()) + "x" + std::to_string(GetScreenHeight()));
+    }
+
+    // From the first scene that covers the screen up to the one under the top
+    std::size_t first = m_scenes.size() - 1;
+    while (first > 0 && m_scenes[first - 1]->overlay()) {
+        first--;
+    }
+    first = first > 0 ? first - 1 : 0;
+
+    BeginTextureMode(m_frozenFrame);
+    ClearBackground(clearColor);
+    for (std::size_t i = first; i + 1 < m_scenes.size(); ++i) {
+        m_scenes[i]->draw();
+    }
+    EndTextureMode();
+
+    m_frozenFrameValid = true;
+}
+
+void SceneStack::drawLoadingScreen() const {
+    const std::size_t total = m_loading->textures().size();
+    const float progress = total > 0 ? static_cast<float>(m_loadedTextures) / static_cast<float>(total) : 1.0f;
+
+    constexpr float barWidth = 300.0f;
+    constexpr float barHeight = 20.0f;
+    const float x = static_cast<float>(GetScreenWidth()) / 2.0f - barWidth / 2.0f;
+    const float y = static_cast<float>(GetScreenHeight()) / 2.0f;
+
+    DrawText("Loading...", static_cast<int>(x), static_cast<int>(y) - 40, 30, WHITE);
+    DrawRectangleLinesEx({ x, y, barWidth, barHeight }, 2.0f, WHITE);
+    DrawRectangleRec({ x, y, barWidth * progress, barHeight }, WHITE);
+}
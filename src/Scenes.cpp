@@ -0,0 +1,177 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "Scenes.hpp"
+
+#include <array>
+#include <memory>
+
+MenuScene::MenuScene(Game &game, GameState &game_state, SceneStack &scenes)
+    : game(game), game_state(game_state), scenes(scenes) {
+}
+
+void MenuScene::enter() {
+    game_state.activity_state = GameActivityState::MENU;
+}
+
+void MenuScene::resume() {
+    game_state.activity_state = GameActivityState::MENU;
+}
+
+void MenuScene::draw() {
+    game.draw_menu();
+
+    switch (game_state.activity_state) {
+        case GameActivityState::PLAYING:
+            scenes.replace(std::make_unique<PlayScene>(game, game_state, scenes));
+        break;
+
+        case GameActivityState::SETTINGS:
+            scenes.push(std::make_unique<SettingsScene>(game, game_state, scenes));
+        break;
+
+        case GameActivityState::EXIT:
+            scenes.clear();
+        break;
+
+        default:
+        break;
+    }
+}
+
+PlayScene::PlayScene(Game &game, GameState &game_state, SceneStack &scenes)
+    : game(game), game_state(game_state), scenes(scenes) {
+}
+
+void PlayScene::enter() {
+    game_state.activity_state = GameActivityState::PLAYING;
+}
+
+void PlayScene::pause() {
+    game.pause();
+}
+
+void PlayScene::resume() {
+    game_state.activity_state = GameActivityState::PLAYING;
+    game.resume();
+}
+
+void PlayScene::update() {
+    game.update();
+
+    switch (game_state.activity_state) {
+        case GameActivityState::GAME_OVER:
+            scenes.replace(std::make_unique<GameOverScene>(game, game_state, scenes));
+        break;
+
+        case GameActivityState::MENU:
+            scenes.replace(std::make_unique<MenuScene>(game, game_state, scenes));
+        break;
+
+        case GameActivityState::PLAYING:
+            if (IsKeyPressed(KEY_P)) {
+                scenes.push(std::make_unique<PauseScene>(game, game_state, scenes));
+            }
+        break;
+
+        default:
+        break;
+    }
+}
+
+void PlayScene::draw() {
+    game.draw();
+}
+
+std::span<const TextureId> PlayScene::textures() const {
+    static constexpr std::array textures = { TextureId::ParallaxAtlas, TextureId::PipeGreen, TextureId::Player };
+    return textures;
+}
+
+PauseScene::PauseScene(Game &game, GameState &game_state, SceneStack &scenes)
+    : game(game), game_state(game_state), scenes(scenes) {
+}
+
+void PauseScene::enter() {
+    game_state.activity_state = GameActivityState::PAUSED;
+    EnableEventWaiting();
+}
+
+void PauseScene::exit() {
+    DisableEventWaiting();
+}
+
+void PauseScene::pause() {
+    DisableEventWaiting();
+}
+
+void PauseScene::resume() {
+    game_state.activity_state = GameActivityState::PAUSED;
+    EnableEventWaiting();
+}
+
+void PauseScene::draw() {
+    game.draw_pause();
+
+    // The change is applied next frame, which must not wait for another input event to come
+    if (game_state.activity_state != GameActivityState::PAUSED) {
+        DisableEventWaiting();
+    }
+
+    switch (game_state.activity_state) {
+        case GameActivityState::PLAYING:
+            scenes.pop();
+        break;
+
+        case GameActivityState::SETTINGS:
+            scenes.push(std::make_unique<SettingsScene>(game, game_state, scenes));
+        break;
+
+        // The run was reset, drop it together with the pause menu
+        case GameActivityState::MENU:
+            scenes.clear();
+            scenes.push(std::make_unique<MenuScene>(game, game_state, scenes));
+        break;
+
+        default:
+        break;
+    }
+}
+
+bool PauseScene::overlay() const {
+    return true;
+}
+
+GameOverScene::GameOverScene(Game &game, GameState &game_state, SceneStack &scenes)
+    : game(game), game_state(game_state), scenes(scenes) {
+}
+
+void GameOverScene::enter() {
+    game_state.activity_state = GameActivityState::GAME_OVER;
+}
+
+void GameOverScene::draw() {
+    game.draw_game_over();
+
+    if (game_state.activity_state == GameActivityState::MENU) {
+        scenes.replace(std::make_unique<MenuScene>(game, game_state, scenes));
+    }
+}
+
+SettingsScene::SettingsScene(Game &game, GameState &game_state, SceneStack &scenes)
+    : game(game), game_state(game_state), scenes(scenes) {
+}
+
+void SettingsScene::enter() {
+    game_state.activity_state = GameActivityState::SETTINGS;
+}
+
+void SettingsScene::draw() {
+    game.draw_settings();
+
+    // Back, the scene underneath sets its own state again when it resumes
+    if (game_state.activity_state == GameActivityState::MENU) {
+        scenes.pop();
+    }
+}
@@ -0,0 +1,74 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "Settings.hpp"
+
+#include <algorithm>
+#include <fstream>
+
+#include "Logger.hpp"
+
+namespace {
+    float parseVolume(const std::string &value, const float fallback) {
+        try {
+            return std::clamp(std::stof(value), 0.0f, 1.0f);
+        } catch (const std::exception &) {
+            return fallback;
+        }
+    }
+}
+
+Settings Settings::load(const std::string &path) {
+    Logger& logger = Logger::getInstance();
+    Settings settings;
+
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        logger.log(LogLevel::INFO, "No settings file at " + path + ", using defaults.");
+        return settings;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        const std::size_t separator = line.find('=');
+        if (line.empty() || line[0] == '#' || separator == std::string::npos) {
+            continue;
+        }
+
+        const std::string key = line.substr(0, separator);
+        const std::string value = line.substr(separator + 1);
+
+        if (key == "master_volume") {
+            settings.masterVolume = parseVolume(value, settings.masterVolume);
+        } else if (key == "sfx_volume") {
+            settings.sfxVolume = parseVolume(value, settings.sfxVolume);
+        } else if (key == "music_volume") {
+            settings.musicVolume = parseVolume(value, settings.musicVolume);
+        } else if (key == "ui_volume") {
+            settings.uiVolume = parseVolume(value, settings.uiVolume);
+        } else if (key == "muted") {
+            settings.muted = value == "1" || value == "true";
+        } else {
+            logger.log(LogLevel::WARNING, "Ignoring unknown setting: " + key);
+        }
+    }
+
+    logger.log(LogLevel::INFO, "Loaded settings from " + path);
+    return settings;
+}
+
+bool Settings::save(const std::string &path) const {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open()) {
+        Logger::getInstance().log(LogLevel::ERROR, "Error: Failed to write settings to " + path);
+        return false;
+    }
+
+    file << "master_volume=" << masterVolume << "\n";
+    file << "sfx_volume=" << sfxVolume << "\n";
+    file << "music_volume=" << musicVolume << "\n";
+    file << "ui_volume=" << uiVolume << "\n";
+    file << "muted=" << (muted ? 1 : 0) << "\n";
+    return true;
+}
@@ -0,0 +1,292 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "Simulation.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include "DifficultyCurve.hpp"
+
+namespace {
+    // 10% of the screen is floor
+    constexpr float floorTop = static_cast<float>(Config::WindowHeight) * 0.9f;
+}
+
+template <std::size_t MaxPipePairs>
+BasicSimulation<MaxPipePairs>::BasicSimulation(const std::uint64_t seed) {
+    reset(seed);
+}
+
+template <std::size_t MaxPipePairs>
+void BasicSimulation<MaxPipePairs>::reset(const std::uint64_t seed) {
+    m_playerPosition = GlobalVariables::defaultPosition;
+    m_playerSpeed = GlobalVariables::defaultSpeed;
+
+    m_score = 0;
+    applyDifficulty();
+
+    // The first pair always has the same gap, the rest come from the seed
+    m_pipes.clear();
+    spawnPipe(Config::WindowWidth, 200.0f);
+    m_nextPipe = m_pipes.head();
+
+    m_over = false;
+    m_ticks = 0;
+    m_rngState = seed;
+}
+
+template <std::size_t MaxPipePairs>
+std::uint32_t BasicSimulation<MaxPipePairs>::step(const bool jump) {
+    if (m_over) {
+        return SimEventNone;
+    }
+
+    constexpr float dt = Config::simulationStep;
+    std::uint32_t events = SimEventNone;
+    m_ticks++;
+
+    // Apply gravity to player
+    const float previousY = m_playerPosition.y;
+    m_playerSpeed += m_gravity * dt;
+    m_playerPosition.y += m_playerSpeed * dt;
+
+    if (jump) {
+        m_playerSpeed = jumpHeight;
+        events |= SimEventJumped;
+    }
+
+    // Floor collision
+    if (m_playerPosition.y + playerHeight >= floorTop) {
+        m_over = true;
+        return events | SimEventHitFloor;
+    }
+
+    // World boundaries
+    if (m_playerPosition.y < 0 || m_playerPosition.x > Config::WindowWidth) {
+        m_over = true;
+        return events | SimEventHitBoundary;
+    }
+
+    const float scroll = m_pipeSpeed * dt;
+    m_pipes.scroll(scroll);
+
+    // Swept test over the whole step, in the pipes' frame the player moves right by the scroll and down by its own
+    // motion. A pair that was still ahead of the player when the step began counts even if it has already scrolled
+    // past, so fast pipes can't tunnel through the player.
+    const float playerX = m_playerPosition.x;
+    const Rectangle playerStart = { playerX - scroll, previousY, playerWidth, playerHeight };
+    const Vector2 motion = { scroll, m_playerPosition.y - previousY };
+    for (std::uint64_t id = m_nextPipe; id < m_pipes.tail() && m_pipes.x(id) < playerX + playerWidth; ++id) {
+        const std::size_t index = static_cast<std::size_t>(id - m_pipes.head());
+        if (sweepHitsPipe(playerStart, motion, topPipe(index)) || sweepHitsPipe(playerStart, motion, bottomPipe(index))) {
+            m_over = true;
+            return events | SimEventHitPipe;
+        }
+    }
+
+    // Pairs are ordered left to right, so everything past the first pair still ahead of the player is ahead too
+    while (m_nextPipe < m_pipes.tail() && m_pipes.x(m_nextPipe) + pipeWidth < playerX) {
+        m_pipes.setPassed(m_nextPipe);
+        m_nextPipe++;
+        m_score++;
+        events |= SimEventScored;
+    }
+    if (events & SimEventScored) {
+        applyDifficulty();
+    }
+
+    // Only once every pair that moved this step has been tested and scored, or a fast one could leave unseen
+    recyclePipes();
+
+    return events;
+}
+
+template <std::size_t MaxPipePairs>
+bool BasicSimulation<MaxPipePairs>::isOver() const {
+    return m_over;
+}
+
+template <std::size_t MaxPipePairs>
+int BasicSimulation<MaxPipePairs>::score() const {
+    return m_score;
+}
+
+template <std::size_t MaxPipePairs>
+std::uint64_t BasicSimulation<MaxPipePairs>::ticks() const {
+    return m_ticks;
+}
+
+template <std::size_t MaxPipePairs>
+Vector2 BasicSimulation<MaxPipePairs>::playerPosition() const {
+    return m_playerPosition;
+}
+
+template <std::size_t MaxPipePairs>
+float BasicSimulation<MaxPipePairs>::playerSpeed() const {
+    return m_playerSpeed;
+}
+
+template <std::size_t MaxPipePairs>
+Rectangle BasicSimulation<MaxPipePairs>::playerRect() const {
+    return { m_playerPosition.x, m_playerPosition.y, playerWidth, playerHeight };
+}
+
+template <std::size_t MaxPipePairs>
+Rectangle BasicSimulation<MaxPipePairs>::topPipe() const {
+    return topPipe(static_cast<std::size_t>(focusPipe() - m_pipes.head()));
+}
+
+template <std::size_t MaxPipePairs>
+Rectangle BasicSimulation<MaxPipePairs>::bottomPipe() const {
+    return bottomPipe(static_cast<std::size_t>(focusPipe() - m_pipes.head()));
+}
+
+template <std::size_t MaxPipePairs>
+std::size_t BasicSimulation<MaxPipePairs>::pipeCount() const {
+    return m_pipes.size();
+}
+
+template <std::size_t MaxPipePairs>
+Rectangle BasicSimulation<MaxPipePairs>::topPipe(const std::size_t index) const {
+    const std::uint64_t id = m_pipes.head() + index;
+    return { m_pipes.x(id), 0.0f, pipeWidth, m_pipes.gapY(id) };
+}
+
+template <std::size_t MaxPipePairs>
+Rectangle BasicSimulation<MaxPipePairs>::bottomPipe(const std::size_t index) const {
+    const std::uint64_t id = m_pipes.head() + index;
+    const float bottomY = m_pipes.gapY(id) + m_pipes.gapSize(id);
+    return { m_pipes.x(id), bottomY, pipeWidth, floorTop - bottomY };
+}
+
+template <std::size_t MaxPipePairs>
+void BasicSimulation<MaxPipePairs>::setPipeSpacing(const float spacing) {
+    m_pipeSpacing = std::max(spacing, minPipeSpacing);
+}
+
+template <std::size_t MaxPipePairs>
+void BasicSimulation<MaxPipePairs>::setPipeSpeed(const float speed) {
+    m_pipeSpeed = std::max(speed, 0.0f);
+}
+
+template <std::size_t MaxPipePairs>
+float BasicSimulation<MaxPipePairs>::pipeScrollSpeed() const {
+    return m_pipeSpeed;
+}
+
+template <std::size_t MaxPipePairs>
+void BasicSimulation<MaxPipePairs>::setGravity(const float gravity) {
+    m_gravity = gravity;
+}
+
+template <std::size_t MaxPipePairs>
+void BasicSimulation<MaxPipePairs>::setDifficulty(const DifficultyCurve *curve) {
+    m_difficulty = curve;
+    m_level = {};
+    applyDifficulty();
+}
+
+template <std::size_t MaxPipePairs>
+const DifficultyLevel &BasicSimulation<MaxPipePairs>::difficulty() const {
+    return m_level;
+}
+
+template <std::size_t MaxPipePairs>
+void BasicSimulation<MaxPipePairs>::setPlayerMask(const Collision::Mask *mask) {
+    m_playerMask = mask;
+}
+
+template <std::size_t MaxPipePairs>
+void BasicSimulation<MaxPipePairs>::setPipeGap(const float gap) {
+    m_pipeGap = std::clamp(gap, playerHeight, maxPipeGap);
+}
+
+template <std::size_t MaxPipePairs>
+float BasicSimulation<MaxPipePairs>::floorY() const {
+    return floorTop;
+}
+
+template <std::size_t MaxPipePairs>
+void BasicSimulation<MaxPipePairs>::recyclePipes() {
+    while (!m_pipes.empty() && m_pipes.x(m_pipes.head()) + pipeWidth < 0) {
+        m_pipes.popFront();
+    }
+    m_nextPipe = std::max(m_nextPipe, m_pipes.head());
+
+    // Each new pair goes exactly one spacing behind the previous one, at the right edge at the latest
+    for (;;) {
+        const float x = m_pipes.empty() ? Config::WindowWidth : m_pipes.x(m_pipes.tail() - 1) + m_pipeSpacing;
+        if (x > Config::WindowWidth || m_pipes.full()) {
+            break;
+        }
+        spawnPipe(x, nextRandom(50.0f, floorTop - m_pipeGap - 50.0f));
+    }
+}
+
+template <std::size_t MaxPipePairs>
+void BasicSimulation<MaxPipePairs>::spawnPipe(const float x, const float gapTop) {
+    m_pipes.push(x, gapTop, m_pipeGap);
+}
+
+template <std::size_t MaxPipePairs>
+void BasicSimulation<MaxPipePairs>::applyDifficulty() {
+    if (m_difficulty == nullptr) {
+        return;
+    }
+
+    m_level = m_difficulty->at(m_score);
+    setPipeSpeed(m_level.pipeSpeed);
+    setPipeGap(m_level.pipeGap);
+    setPipeSpacing(m_level.pipeSpacing);
+    setGravity(m_level.gravity);
+}
+
+template <std::size_t MaxPipePairs>
+bool BasicSimulation<MaxPipePairs>::sweepHitsPipe(const Rectangle start, const Vector2 motion, const Rectangle pipe) const {
+    // Broad phase, the bounding boxes over the whole step
+    const std::optional<Collision::Impact> impact = Collision::sweep(start, motion, pipe);
+    if (!impact || m_playerMask == nullptr) {
+        return impact.has_value();
+    }
+
+    // Fine phase over the part of the step the boxes overlap, stepping at most one mask cell at a time. Samples sit
+    // in the middle of each stretch, where the boxes start to overlap they only touch and a short overlap would go
+    // unseen. The last one is where the overlap ends, at the end of the step that is where the player stays.
+    const float from = impact->time;
+    const float to = std::min(impact->exitTime, 1.0f);
+    constexpr float cell = std::min(playerWidth, playerHeight) / Collision::maskSize;
+    const float travel = std::max(std::abs(motion.x), std::abs(motion.y)) * (to - from);
+    const int samples = 1 + static_cast<int>(travel / cell);
+
+    for (int i = 0; i <= samples; ++i) {
+        const float t = i < samples ? from + (to - from) * (static_cast<float>(i) + 0.5f) / static_cast<float>(samples) : to;
+        const Rectangle player = { start.x + motion.x * t, start.y + motion.y * t, start.width, start.height };
+        if (Collision::overlaps(*m_playerMask, player, pipe)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <std::size_t MaxPipePairs>
+std::uint64_t BasicSimulation<MaxPipePairs>::focusPipe() const {
+    return m_nextPipe < m_pipes.tail() ? m_nextPipe : m_pipes.tail() - 1;
+}
+
+template <std::size_t MaxPipePairs>
+float BasicSimulation<MaxPipePairs>::nextRandom(const float min, const float max) {
+    m_rngState += 0x9e3779b97f4a7c15ull;
+    std::uint64_t z = m_rngState;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    z ^= z >> 31;
+
+    // Top 24 bits give every representable float step in [0, 1)
+    const float unit = static_cast<float>(z >> 40) * (1.0f / 16777216.0f);
+    return min + (max - min) * unit;
+}
+
+// The instantiations declared in Simulation.hpp
+template class BasicSimulation<8>;
+template class BasicSimulation<1024>;
@@ -0,0 +1,259 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "TexturePreprocess.hpp"
+#include "AssetIds.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define FLAPPYBARA_SSE2 1
+#else
+#define FLAPPYBARA_SSE2 0
+#endif
+
+namespace {
+    constexpr int bytesPerPixel = 4;
+
+    // x * a / 255 rounded, without a division
+    std::uint8_t multiplyAlpha(const unsigned int x, const unsigned int a) {
+        const unsigned int t = x * a + 128;
+        return static_cast<std::uint8_t>((t + (t >> 8)) >> 8);
+    }
+
+    void premultiply(std::uint8_t *pixels, const std::size_t pixelCount) {
+        std::size_t i = 0;
+
+#if FLAPPYBARA_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i rounding = _mm_set1_epi16(128);
+        // Lanes holding alpha keep their original value
+        const __m128i alphaLanes = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+
+        // Four RGBA pixels per iteration, widened to 16 bits two pixels at a time
+        for (; i + 4 <= pixelCount; i += 4) {
+            std::uint8_t *p = pixels + i * bytesPerPixel;
+            const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+
+            __m128i halves[2] = { _mm_unpacklo_epi8(packed, zero), _mm_unpackhi_epi8(packed, zero) };
+            for (__m128i &half : halves) {
+                __m128i alpha = _mm_shufflelo_epi16(half, _MM_SHUFFLE(3, 3, 3, 3));
+                alpha = _mm_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+
+                __m128i t = _mm_add_epi16(_mm_mullo_epi16(half, alpha), rounding);
+                t = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+
+                half = _mm_or_si128(_mm_and_si128(alphaLanes, half), _mm_andnot_si128(alphaLanes, t));
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(p), _mm_packus_epi16(halves[0], halves[1]));
+        }
+#endif
+
+        for (; i < pixelCount; ++i) {
+            std::uint8_t *p = pixels + i * bytesPerPixel;
+            p[0] = multiplyAlpha(p[0], p[3]);
+            p[1] = multiplyAlpha(p[1], p[3]);
+            p[2] = multiplyAlpha(p[2], p[3]);
+        }
+    }
+
+    // 2x2 box filter from src (srcWidth x srcHeight) into dst (half size, at least 1x1). When a side is odd its last
+    // source row or column has no partner, the last destination texel on that side averages three instead of two so
+    // the edge isn't dropped from every smaller level. A side of 1 is clamped.
+    void downsample(const std::uint8_t *src, const int srcWidth, const int srcHeight, std::uint8_t *dst, const int dstWidth, const int dstHeight) {
+        // Destination column that takes three source columns, dstWidth when none does
+        const int foldColumn = srcWidth > 1 && srcWidth % 2 == 1 ? dstWidth - 1 : dstWidth;
+        const auto sourceRow = [&](const int row) {
+            return src + static_cast<std::size_t>(std::min(row, srcHeight - 1)) * srcWidth * bytesPerPixel;
+        };
+
+        for (int y = 0; y < dstHeight; ++y) {
+            const std::uint8_t *row0 = sourceRow(y * 2);
+            const std::uint8_t *row1 = sourceRow(y * 2 + 1);
+            const bool foldRow = srcHeight > 1 && srcHeight % 2 == 1 && y == dstHeight - 1;
+            const std::uint8_t *row2 = foldRow ? sourceRow(srcHeight - 1) : nullptr;
+            std::uint8_t *out = dst + static_cast<std::size_t>(y) * dstWidth * bytesPerPixel;
+
+            int x = 0;
+
+#if FLAPPYBARA_SSE2
+            // Two destination pixels from four source pixels on each row when the source is wide enough.
+            // Summed in 16 bits and rounded once like the scalar tail, so a texel doesn't depend on which path made it.
+            // Texels folding in a third row or column are left to the scalar tail.
+            if (srcWidth >= 2 && !foldRow) {
+                const __m128i zero = _mm_setzero_si128();
+                const __m128i two = _mm_set1_epi16(2);
+                for (; x + 2 <= foldColumn && x * 2 + 4 <= srcWidth; x += 2) {
+                    const __m128i top = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row0 + x * 2 * bytesPerPixel));
+                    const __m128i bottom = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row1 + x * 2 * bytesPerPixel));
+
+                    // Source pixels 0 and 1 in the low half, 2 and 3 in the high half, each column summed vertically
+                    const __m128i left = _mm_add_epi16(_mm_unpacklo_epi8(top, zero), _mm_unpacklo_epi8(bottom, zero));
+                    const __m128i right = _mm_add_epi16(_mm_unpackhi_epi8(top, zero), _mm_unpackhi_epi8(bottom, zero));
+
+                    // Then horizontally, leaving destination pixel 0 in the low half and pixel 1 in the high half
+                    const __m128i sums = _mm_unpacklo_epi64(_mm_add_epi16(left, _mm_srli_si128(left, 8)),
+                                                            _mm_add_epi16(right, _mm_srli_si128(right, 8)));
+                    const __m128i averages = _mm_srli_epi16(_mm_add_epi16(sums, two), 2);
+                    _mm_storel_epi64(reinterpret_cast<__m128i *>(out + x * bytesPerPixel), _mm_packus_epi16(averages, zero));
+                }
+            }
+#endif
+
+            for (; x < dstWidth; ++x) {
+                const int x0 = std::min(x * 2, srcWidth - 1) * bytesPerPixel;
+                const int x1 = std::min(x * 2 + 1, srcWidth - 1) * bytesPerPixel;
+                const bool foldX = x == foldColumn;
+                const int x2 = (srcWidth - 1) * bytesPerPixel;
+                const unsigned int taps = (foldX ? 3 : 2) * (foldRow ? 3 : 2);
+
+                for (int c = 0; c < bytesPerPixel; ++c) {
+                    unsigned int sum = row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c];
+                    if (foldX) {
+                        sum += row0[x2 + c] + row1[x2 + c];
+                    }
+                    if (foldRow) {
+                        sum += row2[x0 + c] + row2[x1 + c] + (foldX ? row2[x2 + c] : 0u);
+                    }
+                    out[x * bytesPerPixel + c] = static_cast<std::uint8_t>((sum + taps / 2) / taps);
+                }
+            }
+        }
+    }
+}
+
+namespace TexturePreprocess {
+    Image premultipliedMipChain(const Image &source) {
+        Image base = ImageCopy(source);
+        ImageFormat(&base, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        if (base.data == nullptr) {
+            return base;
+        }
+
+        int mipmaps = 1;
+        for (int w = base.width, h = base.height; w > 1 || h > 1; w = std::max(1, w / 2), h = std::max(1, h / 2)) {
+            mipmaps++;
+        }
+
+        const std::size_t totalSize = mipChainSize(base.width, base.height, base.format, mipmaps);
+        auto *chain = static_cast<std::uint8_t *>(MemAlloc(static_cast<unsigned int>(totalSize)));
+
+        const std::size_t baseSize = static_cast<std::size_t>(base.width) * base.height * bytesPerPixel;
+        std::memcpy(chain, base.data, baseSize);
+        premultiply(chain, static_cast<std::size_t>(base.width) * base.height);
+
+        // Each level is filtered from the already premultiplied level above it
+        std::uint8_t *level = chain;
+        int width = base.width;
+        int height = base.height;
+        for (int i = 1; i < mipmaps; ++i) {
+            const int nextWidth = std::max(1, width / 2);
+            const int nextHeight = std::max(1, height / 2);
+            std::uint8_t *next = level + static_cast<std::size_t>(width) * height * bytesPerPixel;
+
+            downsample(level, width, height, next, nextWidth, nextHeight);
+
+            level = next;
+            width = nextWidth;
+            height = nextHeight;
+        }
+
+        const Image result{
+            .data = chain,
+            .width = base.width,
+            .height = base.height,
+            .mipmaps = mipmaps,
+            .format = base.format,
+        };
+        UnloadImage(base);
+        return result;
+    }
+
+    Collision::Mask collisionMask(const Image &source, const unsigned char alphaThreshold) {
+        Image rgba = ImageCopy(source);
+        ImageFormat(&rgba, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        if (rgba.data == nullptr || rgba.width <= 0 || rgba.height <= 0) {
+            UnloadImage(rgba);
+            return Collision::Mask::solid();
+        }
+
+        const auto *pixels = static_cast<const std::uint8_t *>(rgba.data);
+        Collision::Mask mask;
+        for (int row = 0; row < Collision::maskSize; ++row) {
+            // Pixels [y0, y1) fall into this row, at least one even when the image is smaller than the mask
+            const int y0 = row * rgba.height / Collision::maskSize;
+            const int y1 = std::max(y0 + 1, (row + 1) * rgba.height / Collision::maskSize);
+
+            for (int column = 0; column < Collision::maskSize; ++column) {
+                const int x0 = column * rgba.width / Collision::maskSize;
+                const int x1 = std::max(x0 + 1, (column + 1) * rgba.width / Collision::maskSize);
+
+                int solid = 0;
+                for (int y = y0; y < y1; ++y) {
+                    for (int x = x0; x < x1; ++x) {
+                        solid += pixels[(static_cast<std::size_t>(y) * rgba.width + x) * bytesPerPixel + 3] >= alphaThreshold;
+                    }
+                }
+                if (solid * 2 >= (x1 - x0) * (y1 - y0)) {
+                    mask.rows[row] |= 1ull << column;
+                }
+            }
+        }
+
+        UnloadImage(rgba);
+        return mask;
+    }
+
+    std::size_t mipChainSize(int width, int height, const int format, const int mipmaps) {
+        std::size_t size = 0;
+        for (int i = 0; i < mipmaps; ++i) {
+            size += static_cast<std::size_t>(GetPixelDataSize(width, height, format));
+            width = std::max(1, width / 2);
+            height = std::max(1, height / 2);
+        }
+        return size;
+    }
+
+    Image parallaxAtlas(const std::span<const Image> parts) {
+        const int width = Assets::parallaxAtlasWidth;
+        if (parts.size() != Assets::parallaxAtlasParts.size()) {
+            return Image{};
+        }
+
+        Image atlas = GenImageColor(width, Assets::parallaxAtlasRow(TextureId::Count), BLANK);
+        if (atlas.data == nullptr) {
+            return atlas;
+        }
+
+        int row = 0;
+        for (std::size_t i = 0; i < parts.size(); ++i) {
+            const int height = Assets::parallaxAtlasParts[i].height;
+            Image part = ImageCopy(parts[i]);
+            ImageFormat(&part, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            if (part.data == nullptr) {
+                UnloadImage(atlas);
+                return Image{};
+            }
+            if (part.width != width || part.height != height) {
+                ImageResize(&part, width, height);
+            }
+
+            // Same format and width, so the part is one contiguous block of the atlas
+            std::memcpy(static_cast<unsigned char *>(atlas.data) + static_cast<std::size_t>(row) * width * bytesPerPixel,
+                        part.data, static_cast<std::size_t>(height) * width * bytesPerPixel);
+            UnloadImage(part);
+            row += height;
+        }
+        return atlas;
+    }
+
+    std::mutex &decodeMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+}
@@ -4,50 +4,60 @@
 
 #include <filesystem>
 #include "TextureResourceManager.hpp"
+#include <algorithm>
 #include <iostream>
 
 #include "constants.hpp"
+#include "TexturePreprocess.hpp"
 
-#include "../resources/textures/headers/background_day_texture.h"
-// #include "../resources/textures/headers/background_night_texture.h"
-#include "../resources/textures/headers/base_texture.h"
-#include "../resources/textures/headers/pipe_green_texture.h"
-// #include "../resources/textures/headers/pipe_red_texture.h"
-#include "../resources/textures/headers/player_texture.h"
+#include "textures/background_day_texture.h"
+#include "textures/background_night_texture.h"
+#include "textures/base_texture.h"
+#include "textures/pipe_green_texture.h"
+#include "textures/pipe_red_texture.h"
+#include "textures/player_texture.h"
+#include "textures/parallax_atlas_texture.h"
 
 TextureResourceManager::TextureResourceManager() {
+    textureSlots.resize(Assets::textures.size());
+    for (std::size_t i = 0; i < Assets::textures.size(); ++i) {
+        textureSlots[i].key = std::string(Assets::textures[i].key);
+        slotIndices[textureSlots[i].key] = i;
+    }
+
     loadTextureResources();
 }
 
 TextureResourceManager::~TextureResourceManager() {
+    logStats();
     unloadAllTextures();
 }
 
 void TextureResourceManager::loadTextureResources() {
     Logger& logger = Logger::getInstance();
-    logger.log(LogLevel::INFO, "Loading texture resources.");
+    logger.log(LogLevel::INFO, "Registering texture resources.");
 
     constexpr Image background_day_img = {
         .data = BACKGROUND_DAY_TEXTURE_DATA,
         .width = BACKGROUND_DAY_TEXTURE_WIDTH,
         .height = BACKGROUND_DAY_TEXTURE_HEIGHT,
-        .mipmaps = 1,
+        .mipmaps = BACKGROUND_DAY_TEXTURE_MIPMAPS,
         .format = BACKGROUND_DAY_TEXTURE_FORMAT,
     };
 
-    // constexpr Image background_night_img = {
-    //     .data = BACKGROUND_NIGHT_TEXTURE_DATA,
-    //     .width = BACKGROUND_NIGHT_TEXTURE_WIDTH,
-    //     .height = BACKGROUND_NIGHT_TEXTURE_HEIGHT,
-    //     .mipmaps = 1,
-    //     .format = BACKGROUND_NIGHT_TEXTURE_FORMAT,
-    // };
+    constexpr Image background_night_img = {
+        .data = BACKGROUND_NIGHT_TEXTURE_DATA,
+        .width = BACKGROUND_NIGHT_TEXTURE_WIDTH,
+        .height = BACKGROUND_NIGHT_TEXTURE_HEIGHT,
+        .mipmaps = BACKGROUND_NIGHT_TEXTURE_MIPMAPS,
+        .format = BACKGROUND_NIGHT_TEXTURE_FORMAT,
+    };
 
     constexpr Image base_img = {
         .data = BASE_TEXTURE_DATA,
         .width = BASE_TEXTURE_WIDTH,
         .height = BASE_TEXTURE_HEIGHT,
-        .mipmaps = 1,
+        .mipmaps = BASE_TEXTURE_MIPMAPS,
         .format = BASE_TEXTURE_FORMAT,
     };
 
@@ -55,145 +65,296 @@ void TextureResourceManager::loadTextureResources() {
         .data = PIPE_GREEN_TEXTURE_DATA,
         .width = PIPE_GREEN_TEXTURE_WIDTH,
         .height = PIPE_GREEN_TEXTURE_HEIGHT,
-        .mipmaps = 1,
+        .mipmaps = PIPE_GREEN_TEXTURE_MIPMAPS,
         .format = PIPE_GREEN_TEXTURE_FORMAT,
     };
 
-    // constexpr Image pipe_red_img = {
-    //     .data = PIPE_RED_TEXTURE_DATA,
-    //     .width = PIPE_RED_TEXTURE_WIDTH,
-    //     .height = PIPE_RED_TEXTURE_HEIGHT,
-    //     .mipmaps = 1,
-    //     .format = PIPE_RED_TEXTURE_FORMAT,
-    // };
+    constexpr Image pipe_red_img = {
+        .data = PIPE_RED_TEXTURE_DATA,
+        .width = PIPE_RED_TEXTURE_WIDTH,
+        .height = PIPE_RED_TEXTURE_HEIGHT,
+        .mipmaps = PIPE_RED_TEXTURE_MIPMAPS,
+        .format = PIPE_RED_TEXTURE_FORMAT,
+    };
 
     constexpr Image player_img = {
         .data = PLAYER_TEXTURE_DATA,
         .width = PLAYER_TEXTURE_WIDTH,
         .height = PLAYER_TEXTURE_HEIGHT,
-        .mipmaps = 1,
+        .mipmaps = PLAYER_TEXTURE_MIPMAPS,
         .format = PLAYER_TEXTURE_FORMAT,
     };
 
-    loadTextureFromHeader("background-day", background_day_img);
-    // loadTextureFromHeader("background-night", background_night_img);
-    loadTextureFromHeader("floor", base_img);
-    loadTextureFromHeader("pipe-green", pipe_green_img);
-    // loadTextureFromHeader("pipe-red", pipe_red_img);
-    loadTextureFromHeader("player", player_img);
+    constexpr Image parallax_atlas_img = {
+        .data = PARALLAX_ATLAS_TEXTURE_DATA,
+        .width = PARALLAX_ATLAS_TEXTURE_WIDTH,
+        .height = PARALLAX_ATLAS_TEXTURE_HEIGHT,
+        .mipmaps = PARALLAX_ATLAS_TEXTURE_MIPMAPS,
+        .format = PARALLAX_ATLAS_TEXTURE_FORMAT,
+    };
+
+    loadTextureFromHeader(TextureId::BackgroundDay, background_day_img);
+    loadTextureFromHeader(TextureId::BackgroundNight, background_night_img);
+    loadTextureFromHeader(TextureId::Floor, base_img);
+    loadTextureFromHeader(TextureId::PipeGreen, pipe_green_img);
+    loadTextureFromHeader(TextureId::PipeRed, pipe_red_img);
+    loadTextureFromHeader(TextureId::Player, player_img);
+    loadTextureFromHeader(TextureId::ParallaxAtlas, parallax_atlas_img);
+
+    logger.log(LogLevel::INFO, "Texture resources registered successfully.");
+}
 
-    logger.log(LogLevel::INFO, "Texture resources loaded successfully.");
+void TextureResourceManager::loadTextureFromHeader(const TextureId id, const Image &image) {
+    loadTextureFromHeader(textureSlots[Assets::index(id)].key, image);
 }
 
 void TextureResourceManager::loadTextureFromHeader(const std::string &key, const Image &image) {
     Logger& logger = Logger::getInstance();
 
-    if (textureResources.contains(key)) {
+    TextureEntry &entry = slotForKey(key);
+    if (entry.registered) {
         logger.log(LogLevel::WARNING, "Texture key '" + key + "' already exists. Skipping load.");
         return;
     }
 
-    const Texture2D texture = LoadTextureFromImage(image);
-    if (texture.id == 0) {
-        logger.log(LogLevel::ERROR, "Error: Failed to load texture from header data for key: " + key);
-        throw std::runtime_error("Error: Failed to load texture from header data for key: " + key);
+    // A missing texture source fails the cook, so an empty header is a stale or broken build, not a missing file
+    if (image.data == nullptr || image.width == 0 || image.height == 0) {
+        logger.log(LogLevel::ERROR, "Error: Texture '" + key + "' has no image data in its header, re-run cook-assets.");
+        throw std::runtime_error("Error: Texture '" + key + "' has no image data in its header!");
     }
 
-    textureResources[key] = texture;
-    logger.log(LogLevel::INFO, "Loaded texture '" + key + "' with ID: " + std::to_string(texture.id));
+    entry.registered = true;
+    entry.source = image;
+    entry.byteSize = TexturePreprocess::mipChainSize(image.width, image.height, image.format, image.mipmaps);
+
+    logger.log(LogLevel::INFO, "Registered texture '" + key + "' (" + std::to_string(entry.byteSize) + " bytes).");
 }
 
-Texture2D TextureResourceManager::getTexture(const std::string &key) const {
+Texture2D TextureResourceManager::getTexture(const TextureId id) {
+    return acquireTexture(textureSlots[Assets::index(id)]);
+}
+
+bool TextureResourceManager::isResident(const TextureId id) const {
+    return textureSlots[Assets::index(id)].texture.id != 0;
+}
+
+Texture2D TextureResourceManager::getTexture(const std::string &key) {
     Logger& logger = Logger::getInstance();
 
-    if (!textureResources.contains(key)) {
+    const auto it = slotIndices.find(key);
+    if (it == slotIndices.end()) {
         logger.log(LogLevel::ERROR, "Error: Texture key '" + key + "' not found!");
         throw std::runtime_error("Error: Texture key '" + key + "' not found!");
     }
-    return textureResources.at(key);
+
+    return acquireTexture(textureSlots[it->second]);
+}
+
+Texture2D TextureResourceManager::acquireTexture(TextureEntry &entry) {
+    if (entry.texture.id == 0) {
+        makeResident(entry);
+    } else {
+        stats.hits++;
+    }
+
+    entry.lastUsedFrame = currentFrame;
+    return entry.texture;
+}
+
+TextureResourceManager::TextureEntry &TextureResourceManager::slotForKey(const std::string &key) {
+    if (const auto it = slotIndices.find(key); it != slotIndices.end()) {
+        return textureSlots[it->second];
+    }
+
+    slotIndices[key] = textureSlots.size();
+    TextureEntry &entry = textureSlots.emplace_back();
+    entry.key = key;
+    return entry;
+}
+
+void TextureResourceManager::makeResident(TextureEntry &entry) {
+    Logger& logger = Logger::getInstance();
+
+    if (!entry.registered) {
+        logger.log(LogLevel::ERROR, "Error: Texture key '" + entry.key + "' not found!");
+        throw std::runtime_error("Error: Texture key '" + entry.key + "' not found!");
+    }
+
+    // Textures on disk report their size after the first load, so the budget check may lag one upload behind.
+    evictUntilFits(entry.byteSize, &entry);
+
+    const Texture2D texture = entry.source.data != nullptr ? LoadTextureFromImage(entry.source) : LoadTexture(entry.path.c_str());
+    if (texture.id == 0) {
+        logger.log(LogLevel::ERROR, "Error: Failed to upload texture for key: " + entry.key);
+        throw std::runtime_error("Error: Failed to upload texture for key: " + entry.key);
+    }
+
+    // Cooked textures carry their full mip chain, sample it so minified backgrounds don't alias
+    if (texture.mipmaps > 1) {
+        SetTextureFilter(texture, TEXTURE_FILTER_TRILINEAR);
+    }
+
+    entry.texture = texture;
+    entry.byteSize = TexturePreprocess::mipChainSize(texture.width, texture.height, texture.format, texture.mipmaps);
+    entry.uploadCount++;
+
+    stats.uploads++;
+    stats.residentBytes += entry.byteSize;
+    if (stats.residentBytes > stats.budgetBytes) {
+        stats.budgetOverruns++;
+        logger.log(LogLevel::WARNING, "Texture budget exceeded after uploading '" + entry.key + "': " +
+            std::to_string(stats.residentBytes) + " / " + std::to_string(stats.budgetBytes) + " bytes.");
+    }
+    stats.peakResidentBytes = std::max(stats.peakResidentBytes, stats.residentBytes);
+
+    logger.log(LogLevel::INFO, "Uploaded texture '" + entry.key + "' with ID: " + std::to_string(texture.id));
+}
+
+void TextureResourceManager::evictUntilFits(const std::size_t incomingBytes, const TextureEntry *keep) {
+    while (stats.residentBytes + incomingBytes > stats.budgetBytes) {
+        // Find the least recently used texture that was not drawn this frame.
+        // Textures used in the current frame may still be referenced by the pending render batch.
+        TextureEntry *victim = nullptr;
+
+        for (TextureEntry &entry : textureSlots) {
+            if (&entry == keep || entry.texture.id == 0 || entry.lastUsedFrame >= currentFrame) {
+                continue;
+            }
+            if (victim == nullptr || entry.lastUsedFrame < victim->lastUsedFrame) {
+                victim = &entry;
+            }
+        }
+
+        if (victim == nullptr) {
+            return;
+        }
+
+        evict(*victim);
+    }
+}
+
+void TextureResourceManager::evict(TextureEntry &entry) {
+    Logger& logger = Logger::getInstance();
+
+    UnloadTexture(entry.texture);
+    entry.texture = {};
+    entry.evictionCount++;
+
+    stats.residentBytes -= entry.byteSize;
+    stats.evictions++;
+
+    logger.log(LogLevel::INFO, "Evicted texture '" + entry.key + "' (last used on frame " + std::to_string(entry.lastUsedFrame) + ").");
 }
 
 void TextureResourceManager::unloadTexture(const std::string &key) {
     Logger& logger = Logger::getInstance();
-    if (textureResources.contains(key)) {
-        UnloadTexture(textureResources[key]);
-        textureResources.erase(key);
+    if (const auto it = slotIndices.find(key); it != slotIndices.end() && textureSlots[it->second].registered) {
+        // Keep the slot so TextureId indices stay stable, it just stops being registered
+        release(textureSlots[it->second]);
         logger.log(LogLevel::INFO, "Unloaded texture '" + key + "'.");
     } else {
         std::cerr << "Error: Texture key '" << key << "' not found!" << std::endl;
     }
 }
 
+void TextureResourceManager::reloadTexture(const TextureId id, const Image &image) {
+    Logger& logger = Logger::getInstance();
+    TextureEntry &entry = textureSlots[Assets::index(id)];
+
+    if (entry.texture.id != 0) {
+        UnloadTexture(entry.texture);
+        entry.texture = {};
+        stats.residentBytes -= entry.byteSize;
+    }
+    if (entry.ownsSource) {
+        UnloadImage(entry.source);
+    }
+
+    entry.registered = true;
+    entry.source = image;
+    entry.ownsSource = true;
+    entry.path.clear();
+    entry.byteSize = TexturePreprocess::mipChainSize(image.width, image.height, image.format, image.mipmaps);
+
+    logger.log(LogLevel::INFO, "Reloaded texture '" + entry.key + "' (" + std::to_string(image.width) + "x" + std::to_string(image.height) + ").");
+}
+
 void TextureResourceManager::unloadAllTextures() {
     Logger& logger = Logger::getInstance();
 
-    for (auto &[key, texture] : textureResources) {
-        UnloadTexture(texture);
+    for (TextureEntry &entry : textureSlots) {
+        release(entry);
     }
-    textureResources.clear();
+    stats.residentBytes = 0;
 
     logger.log(LogLevel::INFO, "Unloaded all textures.");
 }
 
+void TextureResourceManager::release(TextureEntry &entry) {
+    if (entry.texture.id != 0) {
+        UnloadTexture(entry.texture);
+        stats.residentBytes -= entry.byteSize;
+    }
+    if (entry.ownsSource) {
+        UnloadImage(entry.source);
+    }
+
+    std::string key = std::move(entry.key);
+    entry = TextureEntry{};
+    entry.key = std::move(key);
+}
+
 void TextureResourceManager::addTexture(const std::string &key, const std::string &path) {
     Logger& logger = Logger::getInstance();
 
-    if (textureResources.contains(key)) {
+    TextureEntry &entry = slotForKey(key);
+    if (entry.registered) {
         logger.log(LogLevel::WARNING, "Texture key '" + key + "' already exists. Skipping load.");
         return;
     }
 
-    const Texture2D texture = LoadTexture(path.c_str());
-    if (texture.id == 0) {
+    if (!std::filesystem::exists(path)) {
         logger.log(LogLevel::ERROR, "Error: Failed to load texture from path: " + path);
         throw std::runtime_error("Error: Failed to load texture from path: " + path);
     }
 
-    textureResources[key] = texture;
+    entry.registered = true;
+    entry.path = path;
 
-    logger.log(LogLevel::INFO, "Loaded texture '" + key + "' with ID: " + std::to_string(texture.id));
+    logger.log(LogLevel::INFO, "Registered texture '" + key + "' from path: " + path);
 }
 
+void TextureResourceManager::beginFrame() {
+    currentFrame++;
+}
 
-void TextureResourceManager::buildTextureHeaders() {
+void TextureResourceManager::setBudget(const std::size_t budgetBytes) {
     Logger& logger = Logger::getInstance();
 
-    if constexpr (!Config::buildTextureHeaders) {
-        logger.log(LogLevel::INFO, "Texture headers building disabled.");
-        return;
-    }
+    stats.budgetBytes = budgetBytes;
+    evictUntilFits(0, nullptr);
 
-    const std::string outputDir = "../resources/textures/headers/";
-    if (!std::filesystem::exists(outputDir)) {
-        std::filesystem::create_directories(outputDir);
-        logger.log(LogLevel::INFO, "Created missing output directory for texture headers: " + outputDir);
-    }
+    logger.log(LogLevel::INFO, "Texture budget set to " + std::to_string(budgetBytes) + " bytes.");
+}
 
-    for (const auto &[key, path] : predefinedTextures) {
-        // Load the image file
-        const Image image = LoadImage(path.c_str());
-        if (!image.data) {
-            logger.log(LogLevel::ERROR, "Error: Failed to load image data: " + path);
-            continue;
-        }
+const TextureResidencyStats &TextureResourceManager::getStats() const {
+    return stats;
+}
 
-        // Generate a sanitized output header file name
-        const std::string filename = path.substr(path.find_last_of("/\\") + 1);
-        const std::string sanitizedFilename = filename.substr(0, filename.find_last_of('.')) + "_texture.h";
-        const std::string outputPath = outputDir + sanitizedFilename;
+void TextureResourceManager::logStats() const {
+    Logger& logger = Logger::getInstance();
 
-        logger.log(LogLevel::INFO, "Building header: " + outputPath);
+    logger.log(LogLevel::INFO, "Texture residency: " + std::to_string(stats.residentBytes) + " / " +
+        std::to_string(stats.budgetBytes) + " bytes resident (peak " + std::to_string(stats.peakResidentBytes) +
+        "), hits: " + std::to_string(stats.hits) + ", uploads: " + std::to_string(stats.uploads) +
+        ", evictions: " + std::to_string(stats.evictions) + ", overruns: " + std::to_string(stats.budgetOverruns));
 
-        // Export the image as a C header
-        if (!ExportImageAsCode(image, outputPath.c_str())) {
-            logger.log(LogLevel::ERROR, "Failed to export image as C header file: " + outputPath);
-        } else {
-            logger.log(LogLevel::INFO, "Image exported as C header file successfully: " + outputPath);
+    for (const TextureEntry &entry : textureSlots) {
+        if (!entry.registered) {
+            continue;
         }
-
-        // Unload the image to free memory
-        UnloadImage(image);
+        logger.log(LogLevel::INFO, "  '" + entry.key + "': " + std::to_string(entry.byteSize) + " bytes, uploads: " +
+            std::to_string(entry.uploadCount) + ", evictions: " + std::to_string(entry.evictionCount) +
+            (entry.texture.id != 0 ? ", resident" : ""));
     }
-
-    logger.log(LogLevel::INFO, "Texture headers building completed.");
-}
\ No newline at end of file
+}
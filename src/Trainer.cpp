@@ -0,0 +1,162 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include "Trainer.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace {
+    // Surviving matters, but passing pipes is what the bot is for
+    constexpr float fitnessPerScore = 500.0f;
+}
+
+Trainer::Trainer(const TrainerOptions &options) : options(options), jobs(options.threads), rng(options.seed) {
+    // Whole batches only, so every lane of every batch holds a real genome
+    const std::size_t lanes = BotBrain::Batch::lanes;
+    this->options.population = std::max(lanes, (options.population + lanes - 1) / lanes * lanes);
+
+    std::uniform_real_distribution weight(-1.0f, 1.0f);
+    population.resize(this->options.population);
+    for (BotBrain::Genome &genome : population) {
+        for (float &w : genome.weights) {
+            w = weight(rng);
+        }
+    }
+    averageScores.resize(population.size());
+}
+
+void Trainer::runGeneration() {
+    evaluate(rng());
+
+    const auto bestIt = std::ranges::max_element(population, {}, &BotBrain::Genome::fitness);
+    bestGenome = *bestIt;
+    bestScore = averageScores[static_cast<std::size_t>(bestIt - population.begin())];
+    mean = std::accumulate(population.begin(), population.end(), 0.0f,
+        [](const float sum, const BotBrain::Genome &genome) { return sum + genome.fitness; }) / static_cast<float>(population.size());
+
+    breed();
+    generationIndex++;
+}
+
+int Trainer::generation() const {
+    return generationIndex;
+}
+
+const BotBrain::Genome &Trainer::best() const {
+    return bestGenome;
+}
+
+float Trainer::meanFitness() const {
+    return mean;
+}
+
+float Trainer::bestAverageScore() const {
+    return bestScore;
+}
+
+void Trainer::evaluate(const std::uint64_t generationSeed) {
+    const std::size_t batches = population.size() / BotBrain::Batch::lanes;
+
+    // One batch per job, a batch runs for milliseconds so the spawn cost doesn't matter and stealing evens out
+    // batches whose birds die early
+    jobs.parallelFor(batches, 1, [&](const std::size_t begin, const std::size_t end) {
+        for (std::size_t batch = begin; batch < end; ++batch) {
+            evaluateBatch(batch * BotBrain::Batch::lanes, generationSeed);
+        }
+    });
+}
+
+void Trainer::evaluateBatch(const std::size_t first, const std::uint64_t generationSeed) {
+    constexpr std::size_t lanes = BotBrain::Batch::lanes;
+
+    BotBrain::Batch batch;
+    batch.load(std::span(population).subspan(first, lanes));
+
+    std::array<float, lanes> fitness{};
+    std::array<float, lanes> scores{};
+
+    for (int run = 0; run < options.evaluationRuns; ++run) {
+        std::array<Simulation, lanes> sims;
+        for (Simulation &sim : sims) {
+            sim.reset(generationSeed + static_cast<std::uint64_t>(run));
+        }
+
+        std::array<BotBrain::Inputs, lanes> inputs{};
+        std::array<bool, lanes> jump{};
+
+        for (std::uint64_t tick = 0; tick < options.maxTicks; ++tick) {
+            bool anyAlive = false;
+            for (std::size_t lane = 0; lane < lanes; ++lane) {
+                if (!sims[lane].isOver()) {
+                    inputs[lane] = BotBrain::observe(sims[lane]);
+                    anyAlive = true;
+                }
+            }
+            if (!anyAlive) {
+                break;
+            }
+
+            batch.decide(inputs, jump);
+
+            // step() ignores finished simulations
+            for (std::size_t lane = 0; lane < lanes; ++lane) {
+                sims[lane].step(jump[lane]);
+            }
+        }
+
+        for (std::size_t lane = 0; lane < lanes; ++lane) {
+            fitness[lane] += static_cast<float>(sims[lane].ticks()) + fitnessPerScore * static_cast<float>(sims[lane].score());
+            scores[lane] += static_cast<float>(sims[lane].score());
+        }
+    }
+
+    // Each batch writes only its own genomes, no synchronization needed
+    const auto runs = static_cast<float>(options.evaluationRuns);
+    for (std::size_t lane = 0; lane < lanes; ++lane) {
+        population[first + lane].fitness = fitness[lane] / runs;
+        averageScores[first + lane] = scores[lane] / runs;
+    }
+}
+
+void Trainer::breed() {
+    std::ranges::sort(population, std::ranges::greater{}, &BotBrain::Genome::fitness);
+
+    const auto eliteCount = std::max<std::size_t>(1, static_cast<std::size_t>(static_cast<float>(population.size()) * options.eliteFraction));
+    std::vector<BotBrain::Genome> next(population.begin(), population.begin() + static_cast<std::ptrdiff_t>(eliteCount));
+    next.reserve(population.size());
+
+    std::uniform_real_distribution chance(0.0f, 1.0f);
+    std::normal_distribution perturbation(0.0f, options.mutationStrength);
+
+    while (next.size() < population.size()) {
+        const BotBrain::Genome &a = tournament();
+        const BotBrain::Genome &b = tournament();
+
+        BotBrain::Genome child;
+        for (int i = 0; i < BotBrain::parameterCount; ++i) {
+            child.weights[i] = chance(rng) < 0.5f ? a.weights[i] : b.weights[i];
+            if (chance(rng) < options.mutationRate) {
+                child.weights[i] += perturbation(rng);
+            }
+        }
+        next.push_back(child);
+    }
+
+    population = std::move(next);
+}
+
+const BotBrain::Genome &Trainer::tournament() {
+    constexpr int contestants = 3;
+    std::uniform_int_distribution<std::size_t> pick(0, population.size() - 1);
+
+    const BotBrain::Genome *winner = &population[pick(rng)];
+    for (int i = 1; i < contestants; ++i) {
+        const BotBrain::Genome &challenger = population[pick(rng)];
+        if (challenger.fitness > winner->fitness) {
+            winner = &challenger;
+        }
+    }
+    return *winner;
+}
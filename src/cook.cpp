@@ -0,0 +1,37 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "AssetCooker.hpp"
+
+// flappybara-cook <resources dir> <output dir> <manifest file> [-j threads]
+// Run by the build before the game is compiled, see the cook-assets target in CMakeLists.txt.
+int main(const int argc, char **argv) {
+    if (argc < 4) {
+        std::cerr << "Usage: " << argv[0] << " <resources dir> <output dir> <manifest file> [-j threads]\n";
+        return 2;
+    }
+
+    unsigned int threads = std::thread::hardware_concurrency();
+    for (int i = 4; i + 1 < argc; ++i) {
+        if (std::string(argv[i]) == "-j") {
+            threads = static_cast<unsigned int>(std::stoul(argv[i + 1]));
+        }
+    }
+
+    // Keep raylib's per-file loader output out of the build log, failures are reported by the cooker
+    SetTraceLogLevel(LOG_WARNING);
+
+    AssetCooker cooker(argv[1], argv[2], argv[3]);
+    const int failures = cooker.cook(threads);
+
+    if (failures > 0) {
+        std::cerr << "flappybara-cook: " << failures << " asset(s) failed to cook, see game.log\n";
+        return 1;
+    }
+    return 0;
+}
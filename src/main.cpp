@@ -4,72 +4,90 @@
 
 #include "main.hpp"
 
-int main() {
+int main(const int argc, char **argv) {
+    // --null-audio runs without opening an audio device, e.g. on machines without a sound card
+    // --bot <genome> lets a genome trained by flappybara-train play instead of the keyboard
+    // --soak lets the lookahead bot play run after run until the window is closed, for unattended testing
+    // --bullet-hell fills the screen with projectiles
+    AudioBackendKind audioBackend = AudioBackendKind::Raylib;
+    std::string botPath;
+    bool soak = false;
+    bool bulletHell = false;
+    for (int i = 1; i < argc; ++i) {
+        const std::string argument = argv[i];
+        if (argument == "--null-audio") {
+            audioBackend = AudioBackendKind::Null;
+        } else if (argument == "--bot" && i + 1 < argc) {
+            botPath = argv[++i];
+        } else if (argument == "--soak") {
+            soak = true;
+        } else if (argument == "--bullet-hell") {
+            bulletHell = true;
+        }
+    }
+
     InitWindow(Config::WindowWidth, Config::WindowHeight, Config::WindowTitle);
     SetTargetFPS(Config::FPS);
     // SetExitKey(0);
 
     TextureResourceManager textureManager;
-    textureManager.buildTextureHeaders();
+    AudioResourceManager audioManager(createAudioBackend(audioBackend));
 
-    AudioResourceManager audioManager;
-    audioManager.buildAudioHeaders();
+    Settings settings = Settings::load(Config::settingsPath);
+    audioManager.applySettings(settings);
 
     GameState game_state{
         .activity_state = GameActivityState::MENU,
     };
 
-    Game game(game_state, audioManager, textureManager);
-
-    Logger& logger = Logger::getInstance();
-
-    bool exitTriggered = false;
-
-    logger.log(LogLevel::INFO, "Starting game...");
-
-    audioManager.playBackgroundMusic();
-
-    while (!WindowShouldClose() && !exitTriggered) {
-        UpdateMusicStream(audioManager.getBackgroundMusicRef());
+    Game game(game_state, audioManager, textureManager, settings);
+    if (bulletHell) {
+        game.setProjectileRate(Config::bulletHellProjectilesPerSecond);
+    }
 
-        BeginDrawing();
-        ClearBackground(GetColor(0x052c46ff));
+    std::optional<GenomeInput> botInput;
+    if (!botPath.empty()) {
+        if (const std::optional<BotBrain::Genome> genome = BotBrain::loadGenome(botPath)) {
+            botInput.emplace(*genome);
+            game.setInputSource(&*botInput);
+            Logger::getInstance().log(LogLevel::INFO, "Demo bot loaded from " + botPath);
+        }
+    }
 
-        switch (game_state.activity_state) {
-            case GameActivityState::MENU:
-                game.draw_menu();
-            break;
+    // Plays the attract mode demo on an idle menu, or everything when soak testing
+    LookaheadInput lookahead;
+    if (soak) {
+        game.startSoak(&lookahead);
+    } else {
+        game.setAttractInput(&lookahead);
+    }
 
-            case GameActivityState::PLAYING:
-                game.update();
-                game.draw();
-            break;
+    // Does nothing outside of debug builds
+    AssetWatcher assetWatcher;
 
-            case GameActivityState::GAME_OVER:
-                game.draw_game_over();
-            break;
+    Logger& logger = Logger::getInstance();
 
-            case GameActivityState::SETTINGS:
-                // todo
-            break;
+    logger.log(LogLevel::INFO, "Starting game...");
 
-            case GameActivityState::PAUSED:
-                // todo
-            break;
+    audioManager.playBackgroundMusic();
 
-            case GameActivityState::LOADING:
-                // todo
-            break;
+    // The screens, a soak test goes straight into play. Exit on the menu pops everything.
+    SceneStack scenes(textureManager, GetColor(0x052c46ff));
+    if (soak) {
+        scenes.push(std::make_unique<PlayScene>(game, game_state, scenes));
+    } else {
+        scenes.push(std::make_unique<MenuScene>(game, game_state, scenes));
+    }
 
-            case GameActivityState::EXIT:
-                exitTriggered = true;
-            break;
+    while (!WindowShouldClose() && !scenes.empty()) {
+        assetWatcher.applyPendingReloads(textureManager, audioManager);
+        textureManager.beginFrame();
 
-            default:
-                DrawText("Unknown State", Config::WindowWidth / 2 - 50, Config::WindowHeight / 2, 20, RED);
-            break;
-        }
+        scenes.update();
 
+        BeginDrawing();
+        ClearBackground(GetColor(0x052c46ff));
+        scenes.draw();
         EndDrawing();
     }
 
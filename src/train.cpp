@@ -0,0 +1,60 @@
+//
+// Created by codingwithjamal on 10/19/2026.
+//
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "BotBrain.hpp"
+#include "Trainer.hpp"
+
+// flappybara-train [--population N] [--generations N] [--runs N] [--threads N] [--seed N] [--out file]
+// Evolves a bot on headless simulations and keeps the best genome so far in the output file.
+// Play it back with: FlappyBara --bot <file>
+int main(const int argc, char **argv) {
+    TrainerOptions options;
+    int generations = 100;
+    std::string outPath = "bot.genome";
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string option = argv[i];
+        const std::string value = argv[i + 1];
+        if (option == "--population") {
+            options.population = std::stoul(value);
+        } else if (option == "--generations") {
+            generations = std::stoi(value);
+        } else if (option == "--runs") {
+            options.evaluationRuns = std::stoi(value);
+        } else if (option == "--threads") {
+            options.threads = static_cast<unsigned int>(std::stoul(value));
+        } else if (option == "--seed") {
+            options.seed = std::stoull(value);
+        } else if (option == "--out") {
+            outPath = value;
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--population N] [--generations N] [--runs N] [--threads N] [--seed N] [--out file]\n";
+            return 2;
+        }
+    }
+
+    Trainer trainer(options);
+    float bestFitness = -1.0f;
+
+    std::cout << std::fixed << std::setprecision(1);
+    for (int i = 0; i < generations; ++i) {
+        trainer.runGeneration();
+
+        const BotBrain::Genome &best = trainer.best();
+        std::cout << "generation " << trainer.generation() << ": best fitness " << best.fitness << " (score "
+                  << trainer.bestAverageScore() << "), mean " << trainer.meanFitness() << "\n";
+
+        if (best.fitness > bestFitness) {
+            bestFitness = best.fitness;
+            BotBrain::saveGenome(outPath, best);
+        }
+    }
+
+    std::cout << "Best genome saved to " << outPath << "\n";
+    return 0;
+}